@@ -25,6 +25,7 @@
 #include "Controller.h"
 #include "Scene.h"
 #include "Actor.h"
+#include "Profiler.h"
 
 #include "GUI.h"
 #include "GUIFont.h"
@@ -410,8 +411,11 @@ void GAScripted::Update()
     // If the game didn't end, keep updating activity
     if (m_ActivityState != ActivityState::Over)
     {   
-        // Call the defined function, but only after first checking if it exists
-        g_LuaMan.RunScriptString("if " + m_LuaClassName + ".UpdateActivity then " + m_LuaClassName + ":UpdateActivity(); end");
+        {
+            ProfileZone profileZone(m_LuaClassName, ":UpdateActivity", m_ScriptPath);
+            // Call the defined function, but only after first checking if it exists
+            g_LuaMan.RunScriptString("if " + m_LuaClassName + ".UpdateActivity then " + m_LuaClassName + ":UpdateActivity(); end");
+        }
 
         UpdateGlobalScripts(false);
     }
@@ -649,7 +649,7 @@ public:
 // Description:     Returns how much starting gold was selected in scenario setup dialog. 20000 - infinite amount.
 // Arguments:       None.
 // Return value:    How much starting gold must be given to human players.
-	int GetStartingGold() { return m_StartingGold; }
+	int GetStartingGold() const { return m_StartingGold; }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -669,7 +669,7 @@ public:
 //					Call it to determine whether you should call MakeAllUnseen or not at the start of activity.
 // Arguments:       None.
 // Return value:    Whether Fog of war flag was checked during scenario setup dialog.
-	bool GetFogOfWarEnabled() { return m_FogOfWarEnabled; }
+	bool GetFogOfWarEnabled() const { return m_FogOfWarEnabled; }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
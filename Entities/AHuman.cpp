@@ -1656,16 +1656,15 @@ bool AHuman::IsWithinRange(Vector &point) const
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  Look
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Casts an unseen-revealing ray in the direction of where this is facing.
-// Arguments:       The degree angle to deviate from the current view point in the ray
-//                  casting. A random ray will be chosen out of this +-range.
+// Description:     Registers this' eyes with the team's batched field-of-view pass, which
+//                  reveals the unseen layer around them.
 
 bool AHuman::Look(float FOVSpread, float range)
 {
-    if (!g_SceneMan.AnythingUnseen(m_Team) || m_CanRevealUnseen == false)
+    if (m_CanRevealUnseen == false)
         return false;
 
-    // Set the length of the look vector
+    // Set the length of the look
     float aimDistance = m_AimDistance + range;
     Vector aimPos = m_Pos;
 
@@ -1681,20 +1680,17 @@ bool AHuman::Look(float FOVSpread, float range)
         aimPos = GetEyePos();
     }
 
-    // Create the vector to trace along
-    Vector lookVector(aimDistance, 0);
-    // Set the rotation to the actual aiming angle
+    // Look along the actual aiming angle
+    Vector lookDirection(1.0F, 0);
     Matrix aimMatrix(m_HFlipped ? -m_AimAngle : m_AimAngle);
     aimMatrix.SetXFlipped(m_HFlipped);
-    lookVector *= aimMatrix;
-    // Add the spread
-	lookVector.DegRotate(FOVSpread * RandomNormalNum());
+    lookDirection *= aimMatrix;
 
     // TODO: generate an alarm event if we spot an enemy actor?
 
-	Vector ignored;
-    // Cast the seeing ray, adjusting the skip to match the resolution of the unseen map
-    return g_SceneMan.CastSeeRay(m_Team, aimPos, lookVector, ignored, 25, (int)g_SceneMan.GetUnseenResolution(m_Team).GetSmallest() / 2);
+    // The cone covers about as much as the randomly spread rays used to, which nearly all fell within twice the spread
+    g_SceneMan.RegisterTeamEyePoint(m_Team, aimPos, aimDistance, lookDirection, DegreesToRadians(FOVSpread * 2.0F));
+    return true;
 }
 
 
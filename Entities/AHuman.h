@@ -700,11 +700,13 @@ ClassInfoGetters;
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  Look
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Casts an unseen-revealing ray in the direction of where this is facing.
-// Arguments:       The degree angle to deviate from the current view point in the ray
-//                  casting. A random ray will be chosen out of this +-range.
-//                  The range, in pixels, beyond the actors sharp aim that the ray will have.
-// Return value:    Whether any unseen pixels were revealed by this look.
+// Description:     Registers this' eyes, or sharp aim if aiming, as an eye point with the
+//                  team's batched field-of-view pass, which reveals the unseen layer.
+// Arguments:       The degree angle of the look's spread. The field of view is a cone
+//                  reaching twice this far to either side of the aim, blocked by terrain.
+//                  The range, in pixels, beyond the actors sharp aim that the eye will have.
+// Return value:    Whether an eye point was registered. Anything it reveals is revealed
+//                  later, when the team's next field-of-view pass completes.
 
 	bool Look(float FOVSpread, float range) override;
 
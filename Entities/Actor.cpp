@@ -658,46 +658,23 @@ Controller::InputMode Actor::SwapControllerModes(Controller::InputMode newMode,
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  Look
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Casts an unseen-revealing ray in the direction of where this is facing.
+// Description:     Registers this' eyes with the team's batched field-of-view pass, which
+//                  reveals the unseen layer around them.
 
 bool Actor::Look(float FOVSpread, float range)
 {
-    if (!g_SceneMan.AnythingUnseen(m_Team) || m_CanRevealUnseen == false)
+    if (m_CanRevealUnseen == false)
         return false;
 
-    // Use the 'eyes' on the 'head', if applicable
-    Vector aimPos = GetEyePos();
-/*
-    Matrix aimMatrix(m_HFlipped ? -m_AimAngle : m_AimAngle);
-    aimMatrix.SetXFlipped(m_HFlipped);
-    // Get the langth of the look vector
-    Vector aimDistance = m_ViewPoint - aimPos;
-    // Add half the screen width
-    Vector lookVector(fabs(aimDistance.m_X) + range, 0);
-    // Set the rotation to the acutal aiming angle
-    lookVector *= aimMatrix;
-    // Add the spread
-    lookVector.DegRotate(FOVSpread * NormalRand());
-// TEST: Really need so far?
-    lookVector /= 2;
-*/
-    Vector lookVector = m_Vel;
-    // If there is no vel, just look in all directions
-    if (lookVector.GetLargest() < 0.01)
-    {
-        lookVector.SetXY(range, 0);
-		lookVector.DegRotate(RandomNum(-180.0F, 180.0F));
-    }
-    else
-    {
-        // Set the distance in the look direction
-        lookVector.SetMagnitude(range);
-        // Add the spread from the directed look
-        lookVector.DegRotate(FOVSpread * RandomNormalNum());
-    }
+    // Look in the direction of travel, or in all directions if there is no vel
+    Vector lookDirection = m_Vel;
+    if (lookDirection.GetLargest() < 0.01)
+        lookDirection.Reset();
 
-	Vector ignored;
-    return g_SceneMan.CastSeeRay(m_Team, aimPos, lookVector, ignored, 25, g_SceneMan.GetUnseenResolution(m_Team).GetSmallest() / 2);
+    // The cone covers about as much as the randomly spread rays used to, which nearly all fell within twice the spread
+    // Use the 'eyes' on the 'head', if applicable
+    g_SceneMan.RegisterTeamEyePoint(m_Team, GetEyePos(), range, lookDirection, DegreesToRadians(FOVSpread * 2.0F));
+    return true;
 }
 
 
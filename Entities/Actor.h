@@ -517,11 +517,14 @@ ClassInfoGetters;
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  Look
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Casts an unseen-revealing ray in the direction of where this is facing.
-// Arguments:       The degree angle to deviate from the current view point in the ray
-//                  casting. A random ray will be chosen out of this +-range.
-//                  The range, in pixels, that the ray will have.
-// Return value:    Whether any unseen pixels were revealed by this look.
+// Description:     Registers this' eyes as an eye point with the team's batched
+//                  field-of-view pass, which reveals the unseen layer around them.
+// Arguments:       The degree angle of the look's spread. The field of view is a cone
+//                  reaching twice this far to either side of the direction of travel, or
+//                  all around if this isn't moving, blocked by terrain.
+//                  The range, in pixels, that the eye will have.
+// Return value:    Whether an eye point was registered. Anything it reveals is revealed
+//                  later, when the team's next field-of-view pass completes.
 
     virtual bool Look(float FOVSpread, float range);
 
@@ -594,6 +597,18 @@ ClassInfoGetters;
     bool IsDead() const { return m_Status == DEAD; }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  CanSleep
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Indicates whether this Actor is allowed to fall asleep at all. Only
+//                  dead Actors may, since living ones need to keep traveling for their
+//                  controllers to be able to move them.
+// Arguments:       None.
+// Return value:    Whether this Actor may fall asleep.
+
+    bool CanSleep() const override { return IsDead() && MOSRotating::CanSleep(); }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  PieNeedsUpdate
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -3,11 +3,23 @@
 #include "MOSRotating.h"
 #include "LimbPath.h"
 #include "ConsoleMan.h"
+#include "Profiler.h"
+#include "SceneSampler.h"
 
 namespace RTE {
 
 	ConcreteClassInfo(AtomGroup, Entity, 500);
 
+	thread_local std::vector<std::unique_ptr<AtomGroup::TravelScratch>> AtomGroup::s_TravelScratches;
+	thread_local size_t AtomGroup::s_TravelScratchDepth = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AtomGroup::TravelScratchLease::TravelScratchLease() {
+		if (s_TravelScratchDepth == s_TravelScratches.size()) { s_TravelScratches.emplace_back(std::make_unique<TravelScratch>()); }
+		Scratch = s_TravelScratches[s_TravelScratchDepth++].get();
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void AtomGroup::Clear() {
@@ -222,7 +234,7 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void AtomGroup::AddAtoms(const std::list<Atom *> &atomList, long subgroupID, const Vector &offset, const Matrix &offsetRotation) {
+	void AtomGroup::AddAtoms(const std::vector<Atom *> &atomList, long subgroupID, const Vector &offset, const Matrix &offsetRotation) {
 		if (m_SubGroups.count(subgroupID) == 0) { m_SubGroups.insert({ subgroupID, std::list<Atom *>() }); }
 
 		Atom *atomToAdd;
@@ -244,21 +256,13 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool AtomGroup::RemoveAtoms(long removeID) {
-		bool removedAny = false;
-		std::list<Atom *>::iterator eraseItr;
-
-		// TODO: Look into using remove_if.
-		for (std::list<Atom *>::iterator atomItr = m_Atoms.begin(); atomItr != m_Atoms.end();) {
-			if ((*atomItr)->GetSubID() == removeID) {
-				delete (*atomItr);
-				eraseItr = atomItr;
-				atomItr++;
-				m_Atoms.erase(eraseItr);
-				removedAny = true;
-			} else {
-				atomItr++;
-			}
+		std::vector<Atom *>::iterator removeItr = std::remove_if(m_Atoms.begin(), m_Atoms.end(), [removeID](const Atom *atom) { return atom->GetSubID() == removeID; });
+		bool removedAny = removeItr != m_Atoms.end();
+
+		for (std::vector<Atom *>::iterator atomItr = removeItr; atomItr != m_Atoms.end(); ++atomItr) {
+			delete (*atomItr);
 		}
+		m_Atoms.erase(removeItr, m_Atoms.end());
 		m_SubGroups.erase(removeID);
 		if (removedAny) {
 			m_MomentOfInertia = 0.0F;
@@ -292,6 +296,7 @@ namespace RTE {
 
 	// TODO: Break down and rework this trainwreck.
 	float AtomGroup::Travel(Vector &position, Vector &velocity, Matrix &rotation, float &angularVel, bool &didWrap, Vector &totalImpulse, float mass, float travelTime, bool callOnBounce, bool callOnSink, bool scenePreLocked) {
+		ProfileZone profileZone("AtomGroup::Travel");
 		RTEAssert(m_OwnerMOSR, "Tried to travel an AtomGroup that has no parent!");
 
 		m_MomentOfInertia = GetMomentOfInertia();
@@ -322,21 +327,32 @@ namespace RTE {
 
 		HitData hitData;
 
-		std::map<MOID, std::list<Atom *>> hitMOAtoms;
-		std::list<Atom *> hitTerrAtoms;
-		std::list<Atom *> penetratingAtoms;
-		std::list<Atom *> hitResponseAtoms;
+		TravelScratchLease scratchLease;
+		std::vector<Vector> &rotatedOffsets = scratchLease.Scratch->AtomOffsets;
+		std::vector<std::pair<MOID, size_t>> &hitMOAtoms = scratchLease.Scratch->HitMOAtoms;
+		std::vector<Atom *> &hitTerrAtoms = scratchLease.Scratch->HitTerrAtoms;
+		std::vector<Atom *> &penetratingAtoms = scratchLease.Scratch->PenetratingAtoms;
+		std::vector<Atom *> &hitResponseAtoms = scratchLease.Scratch->HitResponseAtoms;
 
 		// Lock all bitmaps involved outside the loop - only relevant for video bitmaps so disabled at the moment.
 		//if (!scenePreLocked) { g_SceneMan.LockScene(); }
+		// One sampler for the whole travel, which the Atoms sample the Scene through on every step.
+		const SceneSamplerBase sceneSampler;
 
 		// Loop for all the different straight segments (between bounces etc) that have to be traveled during the travelTime.
 		do {
+			// The rotation doesn't change until the segment is traveled, so rotate all the Atom offsets once up front for both of the setup loops below.
+			rotatedOffsets.resize(m_Atoms.size());
+			for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+				rotatedOffsets[atomIndex] = m_OwnerMOSR->RotateOffset(m_Atoms[atomIndex]->GetOffset());
+			}
+
 			// First see what Atoms are inside either the terrain or another MO, and cause collisions responses before even starting the segment
-			for (Atom *atom : m_Atoms) {
-				const Vector startOff = m_OwnerMOSR->RotateOffset(atom->GetOffset());
+			for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+				Atom *atom = m_Atoms[atomIndex];
+				const Vector &startOff = rotatedOffsets[atomIndex];
 
-				if (atom->SetupPos(position + startOff)) {
+				if (atom->SetupPos(position + startOff, sceneSampler)) {
 					hitData.Reset();
 					if (atom->IsIgnoringTerrain()) {
 						// Calculate and store the accurate hit radius of the Atom in relation to the CoM.
@@ -404,9 +420,10 @@ namespace RTE {
 				break;
 			}
 
-			for (Atom *atom : m_Atoms) {
+			for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+				Atom *atom = m_Atoms[atomIndex];
 				// Calculate the segment trajectory for each individual Atom, with rotations considered.
-				const Vector startOff = m_OwnerMOSR->RotateOffset(atom->GetOffset());
+				const Vector &startOff = rotatedOffsets[atomIndex];
 				const Vector trajFromAngularTravel = Vector(startOff).RadRotate(rotDelta) - startOff;
 
 				// Set up the initial rasterized step for each Atom and save the longest trajectory.
@@ -433,8 +450,9 @@ namespace RTE {
 				
 				int atomsHitMOsCount = 0;
 
-				for (Atom *atom : m_Atoms) {
-					if (atom->StepForward()) {
+				for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+					Atom *atom = m_Atoms[atomIndex];
+					if (atom->StepForward(sceneSampler)) {
 						// If something was hit, first check for terrain hit.
 						if (atom->HitWhatTerrMaterial()) {
 							m_OwnerMOSR->SetHitWhatTerrMaterial(atom->HitWhatTerrMaterial());
@@ -447,15 +465,8 @@ namespace RTE {
 								MovableObject *moCollidedWith = g_MovableMan.GetMOFromID(tempMOID);
 								if (moCollidedWith && moCollidedWith->HitWhatMOID() == g_NoMOID) { moCollidedWith->SetHitWhatMOID(m_OwnerMOSR->m_MOID); }
 
-								// See if we already have another Atom hitting this MO in this step. If not, then create a new list unique for that MO's ID and insert into the map of MO-hitting Atoms.
-								if (!(hitMOAtoms.count(tempMOID))) {
-									std::list<Atom *> newList;
-									newList.push_back(atom);
-									hitMOAtoms.insert({ tempMOID, newList });
-								} else {
-									// If another Atom of this group has already hit this same MO during this step, go ahead and add the new Atom to the corresponding map for that MOID.
-									hitMOAtoms.at(tempMOID).push_back(atom);
-								}
+								// Gets grouped by MOID after all Atoms have stepped.
+								hitMOAtoms.push_back({ tempMOID, atomIndex });
 
 								// Add the hit MO to the ignore list of ignored MOIDs
 								//AddMOIDToIgnore(tempMOID);
@@ -484,6 +495,9 @@ namespace RTE {
 				hitStep = true;
 				++hitCount;
 
+				// Group the MO-hitting Atoms by the MOID they hit, with each group in Atom order, so they're processed MO by MO in MOID order.
+				std::sort(hitMOAtoms.begin(), hitMOAtoms.end());
+
 				// Calculate the progress made on this segment before hitting something. Special case of being at rest.
 				if (stepCount == 0 && stepsOnSeg == 1) {
 					halted = true;
@@ -513,7 +527,7 @@ namespace RTE {
 					const float momentInertiaDistribution = m_MomentOfInertia / static_cast<float>(hitTerrAtoms.size() * (m_Resolution ? m_Resolution : 1));
 
 					// Determine which of the colliding Atoms will penetrate the terrain.
-					for (std::list<Atom*>::iterator atomItr = hitTerrAtoms.begin(); atomItr != hitTerrAtoms.end(); ) {
+					for (std::vector<Atom *>::iterator atomItr = hitTerrAtoms.begin(); atomItr != hitTerrAtoms.end(); ) {
 						// Calculate and store the accurate hit radius of the Atom in relation to the CoM
 						hitData.HitRadius[HITOR] = m_OwnerMOSR->RotateOffset((*atomItr)->GetOffset()) * c_MPP;
 						// Figure out the pre-collision velocity of the hitting Atom due to body translation and rotation.
@@ -568,7 +582,7 @@ namespace RTE {
 						//hitTerrAtom->SetHitData(hitData);
 
 						// Compute and store this Atom's collision response impulse force.
-						hitTerrAtom->TerrHitResponse();
+						hitTerrAtom->TerrHitResponse(sceneSampler);
 						hitResponseAtoms.push_back(hitTerrAtom);
 					}
 				}
@@ -623,11 +637,16 @@ namespace RTE {
 					hitData.MomInertia[HITOR] = m_MomentOfInertia;
 					hitData.ImpulseFactor[HITOR] = 1.0F / static_cast<float>(atomsHitMOsCount);
 
-					for (const map<MOID, std::list<Atom *>>::value_type &MOAtomMapEntry : hitMOAtoms) {
+					for (std::vector<std::pair<MOID, size_t>>::const_iterator MOGroupBegin = hitMOAtoms.begin(); MOGroupBegin != hitMOAtoms.end(); ) {
+						std::vector<std::pair<MOID, size_t>>::const_iterator MOGroupEnd = MOGroupBegin;
+						while (MOGroupEnd != hitMOAtoms.end() && MOGroupEnd->first == MOGroupBegin->first) {
+							++MOGroupEnd;
+						}
 						// The denominator that the MovableObject being hit should divide its mass with for each Atom of this AtomGroup that is colliding with it during this step.
-						hitData.ImpulseFactor[HITEE] = 1.0F / static_cast<float>(MOAtomMapEntry.second.size());
+						hitData.ImpulseFactor[HITEE] = 1.0F / static_cast<float>(MOGroupEnd - MOGroupBegin);
 
-						for (Atom *hitMOAtom : MOAtomMapEntry.second) {
+						for (; MOGroupBegin != MOGroupEnd; ++MOGroupBegin) {
+							Atom *hitMOAtom = m_Atoms[MOGroupBegin->second];
 							// Step back all Atoms that hit MOs during this step iteration. This is so we aren't intersecting the hit MO anymore.
 							hitMOAtom->StepBack();
 							//hitData.HitPoint = hitMOAtom->GetCurrentPos();
@@ -639,7 +658,7 @@ namespace RTE {
 							// Set the Atom with the HitData with all the info we have so far.
 							hitMOAtom->SetHitData(hitData);
 							// Let the Atom calculate the impulse force resulting from the collision, and only add it if collision is valid
-							if (hitMOAtom->MOHitResponse()) {
+							if (hitMOAtom->MOHitResponse(sceneSampler)) {
 								// Report the hit to both MO's in collision
 								HitData &hd = hitMOAtom->GetHitData();
 								// Don't count collision if either says they got terminated
@@ -731,6 +750,7 @@ namespace RTE {
 
 	// TODO: Break down and rework this dumpsterfire.
 	Vector AtomGroup::PushTravel(Vector &position, const Vector &velocity, float pushForce, bool &didWrap, float travelTime, bool callOnBounce, bool callOnSink, bool scenePreLocked) {
+		ProfileZone profileZone("AtomGroup::PushTravel");
 		RTEAssert(m_OwnerMOSR, "Tried to push-travel an AtomGroup that has no parent!");
 
 		didWrap = false;
@@ -765,14 +785,26 @@ namespace RTE {
 
 		HitData hitData;
 
-		std::map<MOID, std::set<Atom *>> MOIgnoreMap;
-		std::map<MOID, std::deque<std::pair<Atom *, Vector>>> hitMOAtoms;
-		std::deque<std::pair<Atom *, Vector>> hitTerrAtoms;
-		std::deque<std::pair<Atom *, Vector>> penetratingAtoms;
-		std::deque<std::pair<Vector, Vector>> impulseForces; // First Vector is the impulse force in kg * m/s, the second is force point, or its offset from the origin of the AtomGroup.
+		// Atoms are referred to by their index in m_Atoms here, so their flipped offsets can be looked up in flippedOffsets.
+		TravelScratchLease scratchLease;
+		std::vector<Vector> &flippedOffsets = scratchLease.Scratch->AtomOffsets;
+		std::vector<std::pair<MOID, size_t>> &MOIgnorePairs = scratchLease.Scratch->MOIgnorePairs;
+		std::vector<std::pair<MOID, size_t>> &hitMOAtoms = scratchLease.Scratch->HitMOAtoms;
+		std::vector<size_t> &hitTerrAtoms = scratchLease.Scratch->HitTerrAtomIndices;
+		std::vector<size_t> &penetratingAtoms = scratchLease.Scratch->PenetratingAtomIndices;
+		std::vector<std::pair<Vector, Vector>> &impulseForces = scratchLease.Scratch->ImpulseForces; // First Vector is the impulse force in kg * m/s, the second is force point, or its offset from the origin of the AtomGroup.
+		MOIgnorePairs.clear();
+
+		// Flipping doesn't change during a push travel, so flip all the Atom offsets once up front instead of on every step.
+		flippedOffsets.resize(m_Atoms.size());
+		for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+			flippedOffsets[atomIndex] = m_Atoms[atomIndex]->GetOffset().GetXFlipped(m_OwnerMOSR->m_HFlipped);
+		}
 
 		// Lock all bitmaps involved outside the loop - only relevant for video bitmaps so disabled at the moment.
 		//if (!scenePreLocked) { g_SceneMan.LockScene(); }
+		// One sampler for the whole push travel, so the pixel samples of each step don't each go through SceneMan, the Scene and its layers.
+		const SceneSamplerBase sceneSampler;
 
 		// Before the very first step of the first leg of this travel, we find that we're already intersecting with another MO, then we completely ignore collisions with that MO for this entire travel.
 		// This is to prevent MO's from getting stuck in each other.
@@ -780,24 +812,16 @@ namespace RTE {
 			intPos[X] = position.GetFloorIntX();
 			intPos[Y] = position.GetFloorIntY();
 
-			for (Atom *atom : m_Atoms) {
-				const Vector flippedOffset = atom->GetOffset().GetXFlipped(m_OwnerMOSR->m_HFlipped);
+			for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+				const Vector &flippedOffset = flippedOffsets[atomIndex];
 				// See if the Atom is starting out on top of another MO
-				MOID tempMOID = g_SceneMan.GetMOIDPixel(intPos[X] + flippedOffset.GetFloorIntX(), intPos[Y] + flippedOffset.GetFloorIntY());
-
-				if (tempMOID != g_NoMOID) {
-					// Make the appropriate entry in the MO-Atom interaction ignore map
-					if (MOIgnoreMap.count(tempMOID) != 0) {
-						// Found an entry for this MOID, so add the Atom entry to it
-						MOIgnoreMap.at(tempMOID).insert(atom);
-					} else {
-						// There wasn't already an entry for this MOID, so create one and add the Atom to it.
-						std::set<Atom *> newSet;
-						newSet.insert(atom);
-						MOIgnoreMap.insert({ tempMOID, newSet });
-					}
-				}
+				MOID tempMOID = sceneSampler.GetMOIDPixel(intPos[X] + flippedOffset.GetFloorIntX(), intPos[Y] + flippedOffset.GetFloorIntY());
+
+				// Make the appropriate entry in the MO-Atom interaction ignore list.
+				if (tempMOID != g_NoMOID) { MOIgnorePairs.push_back({ tempMOID, atomIndex }); }
 			}
+			// Sorted so it can be binary searched on every step.
+			std::sort(MOIgnorePairs.begin(), MOIgnorePairs.end());
 		}
 
 		// Loop for all the different straight legs (between bounces etc) that have to be traveled during the travelTime.
@@ -875,7 +899,7 @@ namespace RTE {
 				}
 				error += delta2[sub];
 
-				didWrap = g_SceneMan.WrapPosition(intPos[X], intPos[Y]) || didWrap;
+				didWrap = sceneSampler.WrapPosition(intPos[X], intPos[Y]) || didWrap;
 
 				// SCENE COLLISION DETECTION /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -884,33 +908,26 @@ namespace RTE {
 				hitMOAtoms.clear();
 				hitTerrAtoms.clear();
 
-				for (Atom *atom : m_Atoms) {
-					const Vector flippedOffset = atom->GetOffset().GetXFlipped(m_OwnerMOSR->m_HFlipped);
+				for (size_t atomIndex = 0; atomIndex < m_Atoms.size(); ++atomIndex) {
+					const Vector &flippedOffset = flippedOffsets[atomIndex];
 					MOID tempMOID = g_NoMOID;
 
 					// First check if we hit any MO's, if applicable.
 					bool ignoreHit = false;
 					if (hitMOs) {
-						tempMOID = g_SceneMan.GetMOIDPixel(intPos[X] + flippedOffset.GetFloorIntX(), intPos[Y] + flippedOffset.GetFloorIntY());
+						tempMOID = sceneSampler.GetMOIDPixel(intPos[X] + flippedOffset.GetFloorIntX(), intPos[Y] + flippedOffset.GetFloorIntY());
 						// Check the ignore map for Atoms that should ignore hits against certain MOs.
-						if (tempMOID != g_NoMOID && (MOIgnoreMap.count(tempMOID) != 0)) { ignoreHit = MOIgnoreMap.at(tempMOID).count(atom) != 0; }
+						if (tempMOID != g_NoMOID && !MOIgnorePairs.empty()) { ignoreHit = std::binary_search(MOIgnorePairs.begin(), MOIgnorePairs.end(), std::make_pair(tempMOID, atomIndex)); }
 					}
 
 					if (hitMOs && tempMOID && !ignoreHit) {
-						// See if we already have another Atom hitting this MO in this step. If not, then create a new deque unique for that MO's ID and insert into the map of MO-hitting Atoms.
-						if (hitMOAtoms.count(tempMOID) == 0) {
-							std::deque<std::pair<Atom *, Vector>> newDeque;
-							newDeque.push_back({ atom, flippedOffset });
-							hitMOAtoms.insert({ tempMOID, newDeque });
-						} else {
-							// If another Atom of this group has already hit this same MO during this step, go ahead and add the new Atom to the corresponding deque for that MOID.
-							hitMOAtoms.at(tempMOID).push_back({ atom, flippedOffset });
-						}
+						// Gets grouped by MOID after all Atoms have been checked.
+						hitMOAtoms.push_back({ tempMOID, atomIndex });
 						// Count the number of Atoms of this group that hit MOs this step. Used to properly distribute the mass of the owner MO in later collision responses during this step.
 						atomsHitMOsCount++;
 					// If no MO has ever been hit yet during this step, then keep checking for terrain hits.
-					} else if (atomsHitMOsCount == 0 && g_SceneMan.GetTerrMatter(intPos[X] + flippedOffset.GetFloorIntX(), intPos[Y] + flippedOffset.GetFloorIntY())) {
-						hitTerrAtoms.push_back({ atom, flippedOffset });
+					} else if (atomsHitMOsCount == 0 && sceneSampler.GetTerrMatter(intPos[X] + flippedOffset.GetFloorIntX(), intPos[Y] + flippedOffset.GetFloorIntY())) {
+						hitTerrAtoms.push_back(atomIndex);
 					}
 
 #ifdef DEBUG_BUILD
@@ -926,6 +943,8 @@ namespace RTE {
 				}
 
 				// There are colliding Atoms, therefore the group hit something.
+				// Group the MO-hitting Atoms by the MOID they hit, with each group in Atom order.
+				std::sort(hitMOAtoms.begin(), hitMOAtoms.end());
 				hitPos[X] = intPos[X];
 				hitPos[Y] = intPos[Y];
 				++hitCount;
@@ -947,7 +966,7 @@ namespace RTE {
 					intPos[dom] -= increment[dom];
 					if (subStepped) { intPos[sub] -= increment[sub]; }
 					// Undo wrap, if necessary.
-					didWrap = !g_SceneMan.WrapPosition(intPos[X], intPos[Y]) && didWrap;
+					didWrap = !sceneSampler.WrapPosition(intPos[X], intPos[Y]) && didWrap;
 
 					// Set the mass and other data pertaining to the hitor, aka this AtomGroup's owner MO.
 					hitData.TotalMass[HITOR] = mass;
@@ -960,13 +979,17 @@ namespace RTE {
 					//float hitorMass = mass / ((atomsHitMOsCount/* + hitTerrAtoms.size()*/) * (m_Resolution ? m_Resolution : 1));
 					//float hiteeMassDenom = 0;
 
-					for (const std::map<MOID, std::deque<std::pair<Atom *, Vector>>>::value_type &MOAtomMapEntry : hitMOAtoms) {
+					for (std::vector<std::pair<MOID, size_t>>::const_iterator MOGroupBegin = hitMOAtoms.begin(); MOGroupBegin != hitMOAtoms.end(); ) {
+						std::vector<std::pair<MOID, size_t>>::const_iterator MOGroupEnd = MOGroupBegin;
+						while (MOGroupEnd != hitMOAtoms.end() && MOGroupEnd->first == MOGroupBegin->first) {
+							++MOGroupEnd;
+						}
 						// The denominator that the MovableObject being hit should divide its mass with for each Atom of this AtomGroup that is colliding with it during this step.
-						hitData.ImpulseFactor[HITEE] = 1.0F / static_cast<float>(MOAtomMapEntry.second.size());
+						hitData.ImpulseFactor[HITEE] = 1.0F / static_cast<float>(MOGroupEnd - MOGroupBegin);
 
-						for (const std::pair<Atom *, Vector> &hitMOAtomEntry : MOAtomMapEntry.second) {
+						for (; MOGroupBegin != MOGroupEnd; ++MOGroupBegin) {
 							// Bake in current Atom's offset into the int positions.
-							const Vector &atomOffset = hitMOAtomEntry.second;
+							const Vector &atomOffset = flippedOffsets[MOGroupBegin->second];
 							intPos[X] += atomOffset.GetFloorIntX();
 							intPos[Y] += atomOffset.GetFloorIntY();
 							hitPos[X] += atomOffset.GetFloorIntX();
@@ -978,14 +1001,14 @@ namespace RTE {
 							hitData.BitmapNormal.Reset();
 
 							// Check for the collision point in the dominant direction of travel.
-							if (delta[dom] && ((dom == X && g_SceneMan.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (dom == Y && g_SceneMan.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
+							if (delta[dom] && ((dom == X && sceneSampler.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (dom == Y && sceneSampler.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
 								hit[dom] = true;
 								hitData.HitPoint = (dom == X) ? Vector(static_cast<float>(hitPos[X]), static_cast<float>(intPos[Y])) : Vector(static_cast<float>(intPos[X]), static_cast<float>(hitPos[Y]));
 								hitData.BitmapNormal[dom] = static_cast<float>(-increment[dom]);
 							}
 
 							// Check for the collision point in the submissive direction of travel.
-							if (subStepped && delta[sub] && ((sub == X && g_SceneMan.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (sub == Y && g_SceneMan.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
+							if (subStepped && delta[sub] && ((sub == X && sceneSampler.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (sub == Y && sceneSampler.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
 								hit[sub] = true;
 
 								//if (hitData.HitPoint.IsZero()) {
@@ -1014,7 +1037,7 @@ namespace RTE {
 							hitPos[X] -= atomOffset.GetFloorIntX();
 							hitPos[Y] -= atomOffset.GetFloorIntY();
 
-							MOID hitMOID = g_SceneMan.GetMOIDPixel(hitData.HitPoint.GetFloorIntX(), hitData.HitPoint.GetFloorIntY());
+							MOID hitMOID = sceneSampler.GetMOIDPixel(hitData.HitPoint.GetFloorIntX(), hitData.HitPoint.GetFloorIntY());
 
 							if (hitMOID != g_NoMOID) {
 								hitData.Body[HITOR] = m_OwnerMOSR;
@@ -1027,7 +1050,7 @@ namespace RTE {
 								hitData.Body[HITEE]->CollideAtPoint(hitData);
 
 								// Save the impulse force resulting from the MO collision response calculation.
-								impulseForces.push_back(make_pair(hitData.ResImpulse[HITOR], atomOffset));
+								impulseForces.push_back({ hitData.ResImpulse[HITOR], atomOffset });
 							}
 						}
 					}
@@ -1047,10 +1070,10 @@ namespace RTE {
 
 					massDist = mass / static_cast<float>(hitTerrAtoms.size() * (m_Resolution ? m_Resolution : 1));
 
-					for (std::deque<std::pair<Atom *, Vector>>::iterator atomItr = hitTerrAtoms.begin(); atomItr != hitTerrAtoms.end(); ) {
-						if (g_SceneMan.WillPenetrate(intPos[X] + (*atomItr).second.GetFloorIntX(), intPos[Y] + (*atomItr).second.GetFloorIntY(), forceVel, massDist)) {
+					for (std::vector<size_t>::iterator atomItr = hitTerrAtoms.begin(); atomItr != hitTerrAtoms.end(); ) {
+						if (g_SceneMan.WillPenetrate(intPos[X] + flippedOffsets[*atomItr].GetFloorIntX(), intPos[Y] + flippedOffsets[*atomItr].GetFloorIntY(), forceVel, massDist)) {
 							// Move the penetrating Atom to the penetrating list from the collision list.
-							penetratingAtoms.push_back({ (*atomItr).first, (*atomItr).second });
+							penetratingAtoms.push_back(*atomItr);
 							atomItr = hitTerrAtoms.erase(atomItr);
 							somethingPenetrated = true;
 						} else {
@@ -1068,7 +1091,7 @@ namespace RTE {
 					if (subStepped) { intPos[sub] -= increment[sub]; }
 
 					// Undo wrap, if necessary.
-					didWrap = !g_SceneMan.WrapPosition(intPos[X], intPos[Y]) && didWrap;
+					didWrap = !sceneSampler.WrapPosition(intPos[X], intPos[Y]) && didWrap;
 
 					// Call the call-on-bounce function, if requested.
 					//if (m_OwnerMOSR && callOnBounce) { halted = m_OwnerMOSR->OnBounce(position); }
@@ -1077,9 +1100,10 @@ namespace RTE {
 					massDist = mass / static_cast<float>((hitTerrAtoms.size()/* + atomsHitMOsCount*/) * (m_Resolution ? m_Resolution : 1));
 
 					// Gather the collision response effects so that the impulse force can be calculated.
-					for (const std::pair<Atom *, Vector> &hitTerrAtomsEntry : hitTerrAtoms) {
+					for (size_t hitTerrAtomIndex : hitTerrAtoms) {
+						const Atom *hitTerrAtom = m_Atoms[hitTerrAtomIndex];
 						// Bake in current Atom's offset into the int positions.
-						const Vector &atomOffset = hitTerrAtomsEntry.second;
+						const Vector &atomOffset = flippedOffsets[hitTerrAtomIndex];
 						intPos[X] += atomOffset.GetFloorIntX();
 						intPos[Y] += atomOffset.GetFloorIntY();
 						hitPos[X] += atomOffset.GetFloorIntX();
@@ -1087,39 +1111,39 @@ namespace RTE {
 
 						Vector newVel = forceVel;
 
-						unsigned char hitMaterialID = g_SceneMan.GetTerrMatter(hitPos[X], hitPos[Y]);
+						unsigned char hitMaterialID = sceneSampler.GetTerrMatter(hitPos[X], hitPos[Y]);
 						hitMaterial = g_SceneMan.GetMaterialFromID(hitMaterialID);
 
 						// Check for and react upon a collision in the dominant direction of travel.
-						if (delta[dom] && ((dom == X && g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y])) || (dom == Y && g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y])))) {
+						if (delta[dom] && ((dom == X && sceneSampler.GetTerrMatter(hitPos[X], intPos[Y])) || (dom == Y && sceneSampler.GetTerrMatter(intPos[X], hitPos[Y])))) {
 							hit[dom] = true;
-							unsigned char domMaterialID = (dom == X) ? g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y]) : g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y]);
+							unsigned char domMaterialID = (dom == X) ? sceneSampler.GetTerrMatter(hitPos[X], intPos[Y]) : sceneSampler.GetTerrMatter(intPos[X], hitPos[Y]);
 							domMaterial = g_SceneMan.GetMaterialFromID(domMaterialID);
 
 							// Bounce according to the collision.
-							newVel[dom] = -newVel[dom] * hitTerrAtomsEntry.first->GetMaterial()->GetRestitution() * domMaterial->GetRestitution();
+							newVel[dom] = -newVel[dom] * hitTerrAtom->GetMaterial()->GetRestitution() * domMaterial->GetRestitution();
 						}
 
 						// Check for and react upon a collision in the submissive direction of travel.
-						if (subStepped && delta[sub] && ((sub == X && g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y])) || (sub == Y && g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y])))) {
+						if (subStepped && delta[sub] && ((sub == X && sceneSampler.GetTerrMatter(hitPos[X], intPos[Y])) || (sub == Y && sceneSampler.GetTerrMatter(intPos[X], hitPos[Y])))) {
 							hit[sub] = true;
-							unsigned char subMaterialID = (sub == X) ? g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y]) : g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y]);
+							unsigned char subMaterialID = (sub == X) ? sceneSampler.GetTerrMatter(hitPos[X], intPos[Y]) : sceneSampler.GetTerrMatter(intPos[X], hitPos[Y]);
 							subMaterial = g_SceneMan.GetMaterialFromID(subMaterialID);
 
 							// Bounce according to the collision.
-							newVel[sub] = -newVel[sub] * hitTerrAtomsEntry.first->GetMaterial()->GetRestitution() * subMaterial->GetRestitution();
+							newVel[sub] = -newVel[sub] * hitTerrAtom->GetMaterial()->GetRestitution() * subMaterial->GetRestitution();
 						}
 
 						// If hit right on the corner of a pixel, bounce straight back with no friction.
 						if (!hit[dom] && !hit[sub]) {
 							hit[dom] = true;
-							newVel[dom] = -newVel[dom] * hitTerrAtomsEntry.first->GetMaterial()->GetRestitution() * hitMaterial->GetRestitution();
+							newVel[dom] = -newVel[dom] * hitTerrAtom->GetMaterial()->GetRestitution() * hitMaterial->GetRestitution();
 							hit[sub] = true;
-							newVel[sub] = -newVel[sub] * hitTerrAtomsEntry.first->GetMaterial()->GetRestitution() * hitMaterial->GetRestitution();
+							newVel[sub] = -newVel[sub] * hitTerrAtom->GetMaterial()->GetRestitution() * hitMaterial->GetRestitution();
 						} else if (hit[dom] && !hit[sub]) {
-							newVel[sub] -= newVel[sub] * hitTerrAtomsEntry.first->GetMaterial()->GetFriction() * domMaterial->GetFriction();
+							newVel[sub] -= newVel[sub] * hitTerrAtom->GetMaterial()->GetFriction() * domMaterial->GetFriction();
 						} else if (hit[sub] && !hit[dom]) {
-							newVel[dom] -= newVel[dom] * hitTerrAtomsEntry.first->GetMaterial()->GetFriction() * subMaterial->GetFriction();
+							newVel[dom] -= newVel[dom] * hitTerrAtom->GetMaterial()->GetFriction() * subMaterial->GetFriction();
 						}
 
 						// Compute and store this Atom's collision response impulse force.
@@ -1147,9 +1171,10 @@ namespace RTE {
 					massDist = mass / static_cast<float>(penetratingAtoms.size() * (m_Resolution ? m_Resolution : 1));
 
 					// Apply the collision response effects.
-					for (const std::pair<Atom *, Vector> &penetratingAtomsEntry : penetratingAtoms) {
-						if (g_SceneMan.TryPenetrate(intPos[X] + penetratingAtomsEntry.second.GetFloorIntX(), intPos[Y] + penetratingAtomsEntry.second.GetFloorIntY(), forceVel * massDist, forceVel, retardation, 1.0F, penetratingAtomsEntry.first->GetNumPenetrations())) {
-							impulseForces.push_back({ forceVel * massDist * retardation, penetratingAtomsEntry.second });
+					for (size_t penetratingAtomIndex : penetratingAtoms) {
+						const Vector &atomOffset = flippedOffsets[penetratingAtomIndex];
+						if (g_SceneMan.TryPenetrate(intPos[X] + atomOffset.GetFloorIntX(), intPos[Y] + atomOffset.GetFloorIntY(), forceVel * massDist, forceVel, retardation, 1.0F, m_Atoms[penetratingAtomIndex]->GetNumPenetrations())) {
+							impulseForces.push_back({ forceVel * massDist * retardation, atomOffset });
 						}
 					}
 				}
@@ -1191,6 +1216,7 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool AtomGroup::PushAsLimb(const Vector &jointPos, const Vector &velocity, const Matrix &rotation, LimbPath &limbPath, const float travelTime, bool *restarted, bool affectRotation) {
+		ProfileZone profileZone("AtomGroup::PushAsLimb");
 		RTEAssert(m_OwnerMOSR, "Tried to push-as-limb an AtomGroup that has no parent!");
 
 		bool didWrap = false;
@@ -1263,10 +1289,11 @@ namespace RTE {
 
 		bool penetrates = false;
 		Vector atomPos;
+		const SceneSamplerBase sceneSampler;
 
 		for (const Atom *atom : m_Atoms) {
 			atomPos = m_OwnerMOSR->GetPos() + GetAdjustedAtomOffset(atom);
-			if (g_SceneMan.GetTerrMatter(atomPos.GetFloorIntX(), atomPos.GetFloorIntY()) != g_MaterialAir) {
+			if (sceneSampler.GetTerrMatter(atomPos.GetFloorIntX(), atomPos.GetFloorIntY()) != g_MaterialAir) {
 				penetrates = true;
 				break;
 			}
@@ -1286,11 +1313,12 @@ namespace RTE {
 		//if (!g_SceneMan.SceneIsLocked()) { g_SceneMan.LockScene(); }
 
 		Vector atomPos;
+		const SceneSamplerBase sceneSampler;
 		int inTerrain = 0;
 
 		for (const Atom *atom : m_Atoms) {
 			atomPos = m_OwnerMOSR->GetPos() + GetAdjustedAtomOffset(atom);
-			if (g_SceneMan.GetTerrMatter(atomPos.GetFloorIntX(), atomPos.GetFloorIntY()) != g_MaterialAir) { inTerrain++; }
+			if (sceneSampler.GetTerrMatter(atomPos.GetFloorIntX(), atomPos.GetFloorIntY()) != g_MaterialAir) { inTerrain++; }
 		}
 
 		//if (g_SceneMan.SceneIsLocked()) { g_SceneMan.UnlockScene(); }
@@ -1302,18 +1330,21 @@ namespace RTE {
 
 	// TODO: Look into breaking this into smaller methods.
 	bool AtomGroup::ResolveTerrainIntersection(Vector &position, unsigned char strongerThan) const {
-		std::list<Atom *> intersectingAtoms;
+		TravelScratchLease scratchLease;
+		std::vector<Atom *> &intersectingAtoms = scratchLease.Scratch->IntersectingAtoms;
+		intersectingAtoms.clear();
 		MOID hitMaterial = g_MaterialAir;
 
 		float strengthThreshold = (strongerThan != g_MaterialAir) ? g_SceneMan.GetMaterialFromID(strongerThan)->GetIntegrity() : 0.0F;
 
 		Vector atomOffset = Vector();
 		Vector atomPos = Vector();
+		const SceneSamplerBase sceneSampler;
 
 		// First go through all Atoms to find the first intersection and get the intersected MO
 		for (Atom *atom : m_Atoms) {
 			atomOffset = m_OwnerMOSR->RotateOffset(atom->GetOffset());
-			atom->SetupPos(position + atomOffset);
+			atom->SetupPos(position + atomOffset, sceneSampler);
 			atomPos = atom->GetCurrentPos();
 			hitMaterial = g_SceneMan.GetTerrain()->GetPixel(atomPos.GetFloorIntX(), atomPos.GetFloorIntY());
 			if (hitMaterial != g_MaterialAir && strengthThreshold > 0.0F && g_SceneMan.GetMaterialFromID(hitMaterial)->GetIntegrity() > strengthThreshold) {
@@ -1394,13 +1425,14 @@ namespace RTE {
 
 		Vector atomOffset = Vector();
 		Vector atomPos = Vector();
+		const SceneSamplerBase sceneSampler;
 
 		// First go through all Atoms to find the first intersection and get the intersected MO
 		for (Atom *atom : m_Atoms) {
 			atomOffset = m_OwnerMOSR->RotateOffset(atom->GetOffset());
-			atom->SetupPos(position + atomOffset);
+			atom->SetupPos(position + atomOffset, sceneSampler);
 			atomPos = atom->GetCurrentPos();
-			hitMOID = g_SceneMan.GetMOIDPixel(atomPos.GetFloorIntX(), atomPos.GetFloorIntY());
+			hitMOID = sceneSampler.GetMOIDPixel(atomPos.GetFloorIntX(), atomPos.GetFloorIntY());
 
 			if (hitMOID != g_NoMOID && !atom->IsIgnoringMOID(hitMOID)) {
 				// Save the correct MOID to search for other atom intersections with
@@ -1429,12 +1461,14 @@ namespace RTE {
 			return false;
 		}
 
-		std::list<Atom *> intersectingAtoms;
+		TravelScratchLease scratchLease;
+		std::vector<Atom *> &intersectingAtoms = scratchLease.Scratch->IntersectingAtoms;
+		intersectingAtoms.clear();
 
 		// Restart and go through all Atoms to find all intersecting the specific intersected MO
 		for (Atom *atom : m_Atoms) {
 			atomPos = atom->GetCurrentPos();
-			if (g_SceneMan.GetMOIDPixel(atomPos.GetFloorIntX(), atomPos.GetFloorIntY()) == currentMOID) {
+			if (sceneSampler.GetMOIDPixel(atomPos.GetFloorIntX(), atomPos.GetFloorIntY()) == currentMOID) {
 				// Add atom to list of intersecting ones
 				intersectingAtoms.push_back(atom);
 			}
@@ -95,7 +95,7 @@ namespace RTE {
 		/// Gets the current list of Atoms that make up the group.
 		/// </summary>
 		/// <returns>A const reference to the Atom list.</returns>
-		const std::list<Atom *> & GetAtomList() const { return m_Atoms; }
+		const std::vector<Atom *> & GetAtomList() const { return m_Atoms; }
 
 		/// <summary>
 		/// Gets the current number of Atoms that make up the group.
@@ -189,7 +189,7 @@ namespace RTE {
 		/// <param name="subgroupID">The desired subgroup ID for the Atoms being added.</param>
 		/// <param name="offset">An offset that should be applied to all added Atoms.</param>
 		/// <param name="offsetRotation">The rotation of the placed Atoms around the specified offset.</param>
-		void AddAtoms(const std::list<Atom *> &atomList, long subgroupID = 0, const Vector &offset = Vector(), const Matrix &offsetRotation = Matrix());
+		void AddAtoms(const std::vector<Atom *> &atomList, long subgroupID = 0, const Vector &offset = Vector(), const Matrix &offsetRotation = Matrix());
 
 		/// <summary>
 		/// Removes all Atoms of a specific subgroup ID from this AtomGroup.
@@ -355,9 +355,7 @@ namespace RTE {
 
 		static Entity::ClassInfo m_sClass; //!< ClassInfo for this class.
 
-		// TODO: It's probably worth trying out changing this from a list to a vector. m_Atoms is iterated over often and we could probably get some big gainz by doing this swap.
-		// The downside is anytime attachables with atoms get added we may have the cost of resizing the vector but that's an uncommon use case while iterating over atoms happens multiple times per frame.
-		std::list<Atom *> m_Atoms; //!< List of Atoms that constitute the group. Owned by this.
+		std::vector<Atom *> m_Atoms; //!< List of Atoms that constitute the group. Owned by this.
 		std::unordered_map<long, std::list<Atom *>> m_SubGroups; //!< Sub groupings of Atoms. Points to Atoms owned in m_Atoms. Not owned.
 
 		MOSRotating *m_OwnerMOSR; //!< The owner of this AtomGroup. The owner is obviously not owned by this AtomGroup.
@@ -385,6 +383,42 @@ namespace RTE {
 
 	private:
 
+		/// <summary>
+		/// Reusable buffers for the bookkeeping Travel, PushTravel and the intersection resolving methods do, so they don't allocate anything once the buffers have grown big enough.
+		/// </summary>
+		struct TravelScratch {
+			std::vector<Vector> AtomOffsets; //!< The rotated or flipped offset of each Atom, in the same order as m_Atoms.
+			std::vector<std::pair<MOID, size_t>> HitMOAtoms; //!< The MOID hit and the index of the hitting Atom for each Atom that hit an MO this step. Sorted so Atoms hitting the same MO are grouped together.
+			std::vector<Atom *> HitTerrAtoms; //!< Atoms that hit terrain this step.
+			std::vector<Atom *> PenetratingAtoms; //!< Atoms that are penetrating terrain this step.
+			std::vector<Atom *> HitResponseAtoms; //!< Atoms whose collision responses should be applied to the owner at the end of the segment.
+			std::vector<std::pair<MOID, size_t>> MOIgnorePairs; //!< The MOID and the index of the Atom for each Atom that started a push travel on top of an MO, and should ignore it. Sorted for binary searching.
+			std::vector<size_t> HitTerrAtomIndices; //!< Indices of the Atoms that hit terrain this push travel step.
+			std::vector<size_t> PenetratingAtomIndices; //!< Indices of the Atoms that are penetrating terrain this push travel step.
+			std::vector<std::pair<Vector, Vector>> ImpulseForces; //!< Impulse forces and the offsets they act at, gathered during a push travel leg.
+			std::vector<Atom *> IntersectingAtoms; //!< Atoms found to be intersecting something while resolving intersections.
+		};
+
+		/// <summary>
+		/// Hands out a TravelScratch of the calling thread for as long as it exists. A travel that happens further down the call stack, like one caused by a collision callback, gets a different one.
+		/// </summary>
+		struct TravelScratchLease {
+			TravelScratch *Scratch; //!< The TravelScratch that was handed out.
+
+			/// <summary>
+			/// Constructor method used to instantiate a TravelScratchLease object in system memory, taking the next TravelScratch not in use by the calling thread.
+			/// </summary>
+			TravelScratchLease();
+
+			/// <summary>
+			/// Destructor method used to give the TravelScratch back to the calling thread.
+			/// </summary>
+			~TravelScratchLease() { --s_TravelScratchDepth; }
+		};
+
+		static thread_local std::vector<std::unique_ptr<TravelScratch>> s_TravelScratches; //!< The TravelScratches of the calling thread, one per travel nesting depth.
+		static thread_local size_t s_TravelScratchDepth; //!< How many of the calling thread's TravelScratches are currently handed out.
+
 #pragma region Create Breakdown
 		/// <summary>
 		/// Generates an AtomGroup using the owner MOSRotating's sprite outline.
@@ -15,6 +15,7 @@
 #include "PresetMan.h"
 #include "LuaMan.h"
 #include "MovableMan.h"
+#include "Profiler.h"
 
 namespace RTE {
 
@@ -209,6 +210,8 @@ void GlobalScript::End()
 
 void GlobalScript::Update()
 {
+    ProfileZone profileZone(m_LuaClassName, ":UpdateScript", m_ScriptPath);
+
     // Call the defined function, but only after first checking if it exists
     int error = g_LuaMan.RunScriptString("if " + m_LuaClassName + ".UpdateScript then " + m_LuaClassName + ":UpdateScript(); end");
 	// Kill script on any error to avoid spamming the console with error messages
@@ -56,6 +56,10 @@ void MOSRotating::Clear()
     m_ForceDeepCheck = false;
     m_DeepHardness = 0;
     m_TravelImpulse.Reset();
+    m_Asleep = false;
+    m_SleepyUpdates = 0;
+    m_SleepPos.Reset();
+    m_SleepRotAngle = 0;
     m_SpriteCenter.Reset();
     m_OrientToVel = 0;
     m_Recoiled = false;
@@ -1247,6 +1251,48 @@ void MOSRotating::RestDetection()
     m_PrevAngVel = m_AngularVel;
 }
 
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  UpdateSleepState
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Puts this MOSRotating to sleep if it has been resting for long enough,
+//                  or wakes it up if it was moved, pushed, or the terrain around it
+//                  changed since it fell asleep.
+
+void MOSRotating::UpdateSleepState()
+{
+    if (m_Asleep)
+    {
+        // Sleeping skips PostTravel, so expire and cull here instead, or resting debris would never be deleted. Nothing can have hit us since we last traveled either.
+        CheckLifetimeAndBounds();
+        m_AlreadyHitBy.clear();
+
+        // Anything that moved, turned or pushed us since we fell asleep, be it a collision, a script or a force, wakes us up. So does the ground shifting beneath us.
+        float wakeRadius = GetRadius() + 2.0F;
+        if (!CanSleep() || !m_Forces.empty() || !m_ImpulseForces.empty() || !m_Vel.IsZero() || m_AngularVel != 0 || m_Pos != m_SleepPos || m_Rotation.GetRadAngle() != m_SleepRotAngle ||
+            g_SceneMan.WasTerrainChangedWithin(static_cast<int>(m_Pos.m_X - wakeRadius), static_cast<int>(m_Pos.m_Y - wakeRadius), static_cast<int>(m_Pos.m_X + wakeRadius), static_cast<int>(m_Pos.m_Y + wakeRadius)))
+            WakeUp();
+        return;
+    }
+
+    if (!CanSleep() || !m_Forces.empty() || !m_ImpulseForces.empty() || m_Vel.GetMagnitude() > c_SleepVelThreshold || std::abs(m_AngularVel) > c_SleepAngularVelThreshold)
+    {
+        m_SleepyUpdates = 0;
+        return;
+    }
+
+    // Same as in RestDetection, don't fall asleep in mid-air, e.g. at the apex of a throw.
+    if (++m_SleepyUpdates >= c_UpdatesBeforeSleep && !g_SceneMan.OverAltitude(m_Pos, m_SpriteRadius + 4, 3))
+    {
+        m_Asleep = true;
+        m_Vel.Reset();
+        m_AngularVel = 0;
+        m_TravelImpulse.Reset();
+        m_SleepPos = m_Pos;
+        m_SleepRotAngle = m_Rotation.GetRadAngle();
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool MOSRotating::IsOnScenePoint(Vector &scenePoint) const {
@@ -508,6 +508,53 @@ ClassInfoGetters;
     void RestDetection() override;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  IsAsleep
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Indicates whether this MOSRotating is asleep, meaning it has been at
+//                  rest long enough that MovableMan skips traveling it until something
+//                  disturbs it. It still gets updated, run its scripts and drawn to the
+//                  MOID layer.
+// Arguments:       None.
+// Return value:    Whether this MOSRotating is asleep.
+
+    bool IsAsleep() const override { return m_Asleep; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  UpdateSleepState
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Puts this MOSRotating to sleep if it has been resting for long enough,
+//                  or wakes it up if it was moved, pushed, or the terrain around it
+//                  changed since it fell asleep. Should be done once every sim update,
+//                  after the MOSRotating was updated and its impulses applied.
+// Arguments:       None.
+// Return value:    None.
+
+    void UpdateSleepState() override;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  WakeUp
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Wakes this MOSRotating up if it was asleep, so it gets traveled again.
+// Arguments:       None.
+// Return value:    None.
+
+    void WakeUp() override { m_Asleep = false; m_SleepyUpdates = 0; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  CanSleep
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Indicates whether this MOSRotating is allowed to fall asleep at all,
+//                  regardless of how much it's moving.
+// Arguments:       None.
+// Return value:    Whether this MOSRotating may fall asleep.
+
+    virtual bool CanSleep() const { return m_PinStrength == 0 && m_RestThreshold >= 0; }
+
+
     /// <summary>
     /// Indicates whether this MOSRotating's current graphical representation, including its Attachables, overlaps a point in absolute scene coordinates.
     /// </summary>
@@ -939,6 +986,10 @@ protected:
     float m_DeepHardness;
     // The amount of impulse force exerted on this during the last frame.
     Vector m_TravelImpulse;
+    bool m_Asleep; //!< Whether this is asleep and skipped when MovableMan travels MOs.
+    int m_SleepyUpdates; //!< How many sim updates in a row this has been moving slowly enough to fall asleep.
+    Vector m_SleepPos; //!< The position this fell asleep at, to detect being moved while asleep.
+    float m_SleepRotAngle; //!< The rotation angle this fell asleep at, in radians, to detect being turned while asleep.
     // The precomupted center location of the sprite relative to the MovableObject::m_Pos.
     Vector m_SpriteCenter;
     // How much to orient the rotation of this to match the velocity vector each frame 0 = none, 1.0 = immediately align with vel vector
@@ -1010,6 +1061,10 @@ protected:
 
 private:
 
+    static constexpr int c_UpdatesBeforeSleep = 30; //!< How many sim updates in a row a MOSRotating has to be moving slowly before it falls asleep.
+    static constexpr float c_SleepVelThreshold = 0.5F; //!< The speed below which a MOSRotating counts as resting, in m/s. Comfortably above the velocity one sim update of gravity leaves on something lying on the ground.
+    static constexpr float c_SleepAngularVelThreshold = 0.1F; //!< The angular speed below which a MOSRotating counts as resting, in rad/s.
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          Clear
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 #include "LuaMan.h"
 #include "Atom.h"
 #include "Actor.h"
+#include "Profiler.h"
 
 namespace RTE {
 
@@ -78,6 +79,8 @@ void MovableObject::Clear()
     m_FunctionsAndScripts.clear();
     m_ScriptPresetName.clear();
     m_ScriptObjectName.clear();
+    m_HasThreadUnsafeScripts = false;
+    m_ScriptWorkerState = -1;
     m_ScreenEffectFile.Reset();
     m_pScreenEffect = 0;
 	m_EffectRotAngle = 0;
@@ -481,8 +484,10 @@ int MovableObject::Save(Writer &writer) const
 void MovableObject::Destroy(bool notInherited) {
     if (ObjectScriptsInitialized()) {
         RunScriptedFunctionInAppropriateScripts("Destroy");
+        LuaMan::WorkerStateScope workerStateScope(m_ScriptWorkerState);
         g_LuaMan.RunScriptString(m_ScriptObjectName + " = nil;");
     }
+    if (m_ScriptWorkerState >= 0) { g_LuaMan.UnqueueParallelScriptUpdate(m_ScriptWorkerState, this); }
 	g_MovableMan.UnregisterObject(this);
     if (!notInherited) { SceneObject::Destroy(); }
     Clear();
@@ -491,6 +496,18 @@ void MovableObject::Destroy(bool notInherited) {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int MovableObject::InitializeObjectScripts() {
+    // If all of this' scripts are thread-safe, they all run on a worker state so their Update can run in parallel with other objects'. Otherwise they stay on the master state.
+    if (m_HasThreadUnsafeScripts) {
+        m_ScriptWorkerState = -1;
+    } else if (m_ScriptWorkerState < 0) {
+        m_ScriptWorkerState = g_LuaMan.AssignWorkerState();
+    }
+    LuaMan::WorkerStateScope workerStateScope(m_ScriptWorkerState);
+
+    if (m_ScriptWorkerState >= 0 && LoadScriptsIntoWorkerState() < 0) {
+        m_ScriptObjectName = "ERROR";
+        return -1;
+    }
     m_ScriptObjectName = GetClassName() + "s." + g_LuaMan.GetNewObjectID();
 
     g_LuaMan.SetTempEntity(this);
@@ -509,6 +526,36 @@ int MovableObject::InitializeObjectScripts() {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+int MovableObject::LoadScriptsIntoWorkerState() {
+    if (g_LuaMan.RunScriptString(GetClassName() + "s = " + GetClassName() + "s or {}; " + m_ScriptPresetName + " = " + m_ScriptPresetName + " or {};") < 0) {
+        return -1;
+    }
+    for (const auto &[scriptPath, scriptEnabled] : m_AllLoadedScripts) {
+        for (const std::string &functionName : GetSupportedScriptFunctionNames()) {
+            if (g_LuaMan.RunScriptString(functionName + " = nil;") < 0) {
+                return -1;
+            }
+        }
+        if (g_LuaMan.RunScriptFile(scriptPath) < 0) {
+            return -2;
+        }
+        for (const auto &[functionName, functionScriptPaths] : m_FunctionsAndScripts) {
+            if (std::find(functionScriptPaths.begin(), functionScriptPaths.end(), scriptPath) != functionScriptPaths.end()) {
+                int error = g_LuaMan.RunScriptString(
+                    m_ScriptPresetName + "." + functionName + " = " + m_ScriptPresetName + "." + functionName + " or {}; " +
+                    m_ScriptPresetName + "." + functionName + "[\"" + scriptPath + "\"] = " + functionName + ";"
+                );
+                if (error < 0) {
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 int MovableObject::LoadScript(const std::string &scriptPath, bool loadAsEnabledScript) {
     if (scriptPath.empty()) {
         return -1;
@@ -525,6 +572,9 @@ int MovableObject::LoadScript(const std::string &scriptPath, bool loadAsEnabledS
             return -4;
         }
     }
+    if (g_LuaMan.RunScriptString("ThreadSafe = nil;") < 0) {
+        return -4;
+    }
     // Create a new table for all presets and object instances of this class, to organize things a bit
     if (g_LuaMan.RunScriptString(GetClassName() + "s = " + GetClassName() + "s or {};") < 0) {
         return -4;
@@ -534,6 +584,8 @@ int MovableObject::LoadScript(const std::string &scriptPath, bool loadAsEnabledS
     if (g_LuaMan.RunScriptFile(scriptPath) < 0) {
         return -5;
     }
+    // Scripts declare themselves safe to run in parallel with other thread-safe scripts by setting ThreadSafe = true
+    if (!g_LuaMan.ExpressionIsTrue("ThreadSafe", false)) { m_HasThreadUnsafeScripts = true; }
 
     // If there's no ScriptPresetName this is the first script being loaded for this preset, or scripts have been reloaded.
     // Generate a ScriptPresetName, setup a table for the preset's functions, and clear the instance object name so it gets created in the first run of UpdateScripts
@@ -581,6 +633,7 @@ int MovableObject::ReloadScripts() {
         std::map<std::string, bool> loadedScriptsCopy = object->m_AllLoadedScripts;
         object->m_AllLoadedScripts.clear();
         object->m_FunctionsAndScripts.clear();
+        object->m_HasThreadUnsafeScripts = false;
         if (isPresetObject) {
             object->m_ScriptPresetName.clear();
         } else {
@@ -697,8 +750,10 @@ int MovableObject::RunScriptedFunction(const std::string &scriptPath, const std:
         return -1;
     }
 
+    LuaMan::WorkerStateScope workerStateScope(m_ScriptWorkerState);
     std::string presetAndFunctionName = m_ScriptPresetName + "." + functionName;
     std::string fullFunctionName = presetAndFunctionName + "[\"" + scriptPath + "\"]";
+    ProfileZone profileZone(presetAndFunctionName, scriptPath);
 
     int status = g_LuaMan.RunScriptedFunction(fullFunctionName, m_ScriptObjectName, {presetAndFunctionName, m_ScriptObjectName, fullFunctionName}, functionEntityArguments, functionLiteralArguments);
     if (status < 0 && m_AllLoadedScripts.size() > 1) {
@@ -971,13 +1026,7 @@ void MovableObject::PostTravel()
 	}
 	m_IsUpdated = true;
 
-    // Check for age expiration
-    if (m_Lifetime && m_AgeTimer.GetElapsedSimTimeMS() > m_Lifetime)
-        m_ToDelete = true;
-
-    // Check for stupid positions and velocities, but critical stuff can't go too fast
-    if (!g_SceneMan.IsWithinBounds(m_Pos.m_X, m_Pos.m_Y, 100))
-        m_ToDelete = true;
+    CheckLifetimeAndBounds();
 
     // Fix speeds that are too high
     FixTooFast();
@@ -990,6 +1039,18 @@ void MovableObject::PostTravel()
     m_CheckTerrIntersection = false;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MovableObject::CheckLifetimeAndBounds() {
+    // Check for age expiration
+    if (m_Lifetime && m_AgeTimer.GetElapsedSimTimeMS() > m_Lifetime)
+        m_ToDelete = true;
+
+    // Check for stupid positions and velocities, but critical stuff can't go too fast
+    if (!g_SceneMan.IsWithinBounds(m_Pos.m_X, m_Pos.m_Y, 100))
+        m_ToDelete = true;
+}
+
 /*
 //////////////////////////////////////////////////////////////////////////////////////////
 // Pure v. method:  Update
@@ -1011,8 +1072,17 @@ int MovableObject::UpdateScripts() {
         return -1;
     }
 
+    // Anything that could reload or initialize scripts was already done on the main thread when this was queued for a parallel update, so just run Update.
+    if (g_LuaMan.IsInParallelScriptUpdate()) {
+        return RunScriptedFunctionInAppropriateScripts("Update", false, true);
+    }
+
     int status = !g_LuaMan.ExpressionIsTrue(m_ScriptPresetName, false) ? ReloadScripts() : 0;
     status = (status >= 0 && !ObjectScriptsInitialized()) ? InitializeObjectScripts() : status;
+    if (status >= 0 && m_ScriptWorkerState >= 0) {
+        g_LuaMan.QueueParallelScriptUpdate(m_ScriptWorkerState, this);
+        return status;
+    }
     status = (status >= 0) ? RunScriptedFunctionInAppropriateScripts("Update", false, true) : status;
 
     return status;
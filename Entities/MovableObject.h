@@ -1199,6 +1199,40 @@ enum MOType
     virtual void RestDetection();
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  IsAsleep
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Indicates whether this MO is asleep, meaning it has been at rest long
+//                  enough that MovableMan skips traveling it until something disturbs it.
+//                  It still gets updated, run its scripts and drawn to the MOID layer.
+// Arguments:       None.
+// Return value:    Whether this MO is asleep.
+
+    virtual bool IsAsleep() const { return false; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  UpdateSleepState
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Puts this MO to sleep if it has been resting for long enough, or wakes
+//                  it up if anything disturbed it since it fell asleep. Should be done
+//                  once every sim update, after the MO was updated.
+// Arguments:       None.
+// Return value:    None.
+
+    virtual void UpdateSleepState() {}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  WakeUp
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Wakes this MO up if it was asleep, so it gets traveled again.
+// Arguments:       None.
+// Return value:    None.
+
+    virtual void WakeUp() {}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  NotResting
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1820,6 +1854,17 @@ protected:
     /// <returns>0 on success, -2 if it fails to setup the script object in Lua, and -3 if it fails to run any Create function.</returns>
     int InitializeObjectScripts();
 
+    /// <summary>
+    /// Loads all of this MO's scripts into the currently active LuaMan worker state, and sets up this' preset table there to match the one in the master state.
+    /// </summary>
+    /// <returns>0 on success, -1 if it fails to setup the preset table, and -2 if it fails to run any of the script files.</returns>
+    int LoadScriptsIntoWorkerState();
+
+    /// <summary>
+    /// Flags this MO for deletion if it has outlived its lifetime or strayed too far outside the scene. Done in PostTravel, and in its place while this MO is asleep.
+    /// </summary>
+    void CheckLifetimeAndBounds();
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  UpdateChildMOIDs
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1950,6 +1995,8 @@ protected:
     std::string m_ScriptPresetName;
     // The ID name unique to this' object instance representation in the Lua state.
     std::string m_ScriptObjectName;
+    bool m_HasThreadUnsafeScripts; //!< Whether any of this' loaded scripts doesn't declare itself thread-safe, meaning all of them have to run on the master Lua state.
+    int m_ScriptWorkerState; //!< The index of the LuaMan worker state all of this' scripts run on. -1 means the master state.
 
     // Special post processing flash effect file and Bitmap. Shuold be loaded from a 32bpp bitmap
     ContentFile m_ScreenEffectFile;
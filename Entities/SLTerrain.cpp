@@ -20,6 +20,7 @@
 #include "MOPixel.h"
 #include "MOSprite.h"
 #include "Atom.h"
+#include "Profiler.h"
 
 namespace RTE {
 
@@ -267,6 +268,8 @@ int SLTerrain::LoadData()
     // Load the materials bitmap into the main bitmap
     if (SceneLayer::LoadData())
         return -1;
+    // Page the terrain layers in and out around the views if the Scene is big enough to need it
+    MapMainBitmap();
 
     RTEAssert(m_pFGColor, "Terrain's foreground layer not instantiated before trying to load its data!");
     RTEAssert(m_pBGColor, "Terrain's background layer not instantiated before trying to load its data!");
@@ -284,6 +287,8 @@ int SLTerrain::LoadData()
             RTEAbort("Could not load the Background Color SceneLayer data from file, when a path was specified for it!");
             return -1;
         }
+        m_pFGColor->MapMainBitmap();
+        m_pBGColor->MapMainBitmap();
         // Ok, we have now loaded the layers in from files, don't need to generate them from the material layer
         InitScrollRatios();
         return 0;
@@ -291,7 +296,7 @@ int SLTerrain::LoadData()
 
     // Create blank foreground layer
     m_pFGColor->Destroy();
-    BITMAP *pFGBitmap = create_bitmap_ex(8, m_pMainBitmap->w, m_pMainBitmap->h);
+    BITMAP *pFGBitmap = CreateLayerBitmap(m_pMainBitmap->w, m_pMainBitmap->h);
     if (!pFGBitmap || m_pFGColor->Create(pFGBitmap, true, m_Offset, m_WrapX, m_WrapY, m_ScrollRatio))
     {
         RTEAbort("Failed to create terrain's foreground layer's bitmap!");
@@ -300,7 +305,7 @@ int SLTerrain::LoadData()
 
     // Create blank background layer
     m_pBGColor->Destroy();
-    BITMAP *pBGBitmap = create_bitmap_ex(8, m_pMainBitmap->w, m_pMainBitmap->h);
+    BITMAP *pBGBitmap = CreateLayerBitmap(m_pMainBitmap->w, m_pMainBitmap->h);
     if (!pBGBitmap || m_pBGColor->Create(pBGBitmap, true, m_Offset, m_WrapX, m_WrapY, m_ScrollRatio))
     {
         RTEAbort("Failed to create terrain's background layer's bitmap!");
@@ -308,8 +313,8 @@ int SLTerrain::LoadData()
     }
 
     // Structural integrity calc buffer bitmap
-    destroy_bitmap(m_pStructural);
-    m_pStructural = create_bitmap_ex(8, m_pMainBitmap->w, m_pMainBitmap->h);
+    DestroyLayerBitmap(m_pStructural);
+    m_pStructural = CreateLayerBitmap(m_pMainBitmap->w, m_pMainBitmap->h);
     RTEAssert(m_pStructural, "Failed to allocate BITMAP in Terrain::Create");
     clear_bitmap(m_pStructural);
 
@@ -504,6 +509,27 @@ int SLTerrain::LoadData()
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  PrefetchData
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Queues the bitmap data of this and its color layers to be read and
+//                  decoded in the background, so LoadData doesn't have to wait for the disk.
+
+void SLTerrain::PrefetchData()
+{
+    SceneLayer::PrefetchData();
+
+    // Mirror LoadData; the color layers are either loaded from file, or generated with the background texture
+    if (m_pFGColor && m_pBGColor && m_pFGColor->IsFileData() && m_pBGColor->IsFileData())
+    {
+        m_pFGColor->PrefetchData();
+        m_pBGColor->PrefetchData();
+    }
+    else
+        m_BGTextureFile.PrefetchBitmap();
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  SaveData
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -699,7 +725,7 @@ void SLTerrain::Destroy(bool notInherited)
 {
     delete m_pFGColor;
     delete m_pBGColor;
-    destroy_bitmap(m_pStructural);
+    DestroyLayerBitmap(m_pStructural);
 
     for (list<TerrainDebris *>::iterator tdItr = m_TerrainDebris.begin(); tdItr != m_TerrainDebris.end(); ++tdItr)
     {
@@ -926,6 +952,7 @@ deque<MOPixel *> SLTerrain::EraseSilhouette(BITMAP *pSprite,
 {
 // TODO: OPTIMIZE THIS, IT'S A TIME HOG. MAYBE JSUT STAMP THE OUTLINE AND SAMPLE SOME RANDOM PARTICLES?
 
+    ProfileZone profileZone("SLTerrain::EraseSilhouette");
     RTEAssert(pSprite, "Null BITMAP passed to SLTerrain::EraseSilhouette");
 
     deque<MOPixel *> MOPDeque;
@@ -1087,6 +1114,8 @@ bool SLTerrain::ApplyObject(Entity *pEntity)
 
 void SLTerrain::ApplyMovableObject(MovableObject *pMObject)
 {
+    ProfileZone profileZone("SLTerrain::ApplyMovableObject");
+
     if (!pMObject)
         return;
 
@@ -1217,6 +1246,8 @@ void SLTerrain::RegisterTerrainChange(TerrainObject *pTObject)
 
 void SLTerrain::ApplyTerrainObject(TerrainObject *pTObject)
 {
+    ProfileZone profileZone("SLTerrain::ApplyTerrainObject");
+
     if (!pTObject)
         return;
 
@@ -1354,6 +1385,8 @@ void SLTerrain::CleanAirBox(Box box, bool wrapsX, bool wrapsY)
 
 void SLTerrain::CleanAir()
 {
+    ProfileZone profileZone("SLTerrain::CleanAir");
+
     acquire_bitmap(m_pMainBitmap);
     acquire_bitmap(m_pFGColor->GetBitmap());
 
@@ -1410,9 +1443,9 @@ void SLTerrain::Update()
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Draws this SLTerrain's current scrolled position to a bitmap.
 
-void SLTerrain::DrawBackground(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride)
+void SLTerrain::DrawBackground(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride, const Box &clipBox)
 {
-    m_pBGColor->Draw(pTargetBitmap, targetBox, scrollOverride);
+    m_pBGColor->Draw(pTargetBitmap, targetBox, scrollOverride, clipBox);
 }
 
 
@@ -1421,15 +1454,15 @@ void SLTerrain::DrawBackground(BITMAP *pTargetBitmap, Box &targetBox, const Vect
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Draws this SLTerrain's current scrolled position to a bitmap.
 
-void SLTerrain::Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride) const
+void SLTerrain::Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride, const Box &clipBox) const
 {
     if (m_DrawMaterial)
     {
-        SceneLayer::Draw(pTargetBitmap, targetBox, scrollOverride);
+        SceneLayer::Draw(pTargetBitmap, targetBox, scrollOverride, clipBox);
     }
     else
     {
-        m_pFGColor->Draw(pTargetBitmap, targetBox, scrollOverride);
+        m_pFGColor->Draw(pTargetBitmap, targetBox, scrollOverride, clipBox);
     }
 }
 
@@ -276,6 +276,17 @@ ClassInfoGetters
 	int LoadData() override;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  PrefetchData
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Queues the bitmap data of this and its color layers to be read and
+//                  decoded in the background, so LoadData doesn't have to wait for the disk.
+// Arguments:       None.
+// Return value:    None.
+
+	void PrefetchData() override;
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  SaveData
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -666,9 +677,10 @@ ClassInfoGetters
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The box on the target bitmap to further limit drawing to, if not empty.
 // Return value:    None.
 
-	void DrawBackground(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1));
+	void DrawBackground(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1), const Box &clipBox = Box());
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -680,9 +692,10 @@ ClassInfoGetters
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The box on the target bitmap to further limit drawing to, if not empty.
 // Return value:    None.
 
-	void Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1)) const override;
+	void Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1), const Box &clipBox = Box()) const override;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Protected member variable and method declarations
@@ -583,6 +583,23 @@ int Scene::LoadData(bool placeObjects, bool initPathfinding, bool placeUnits)
 {
     RTEAssert(m_pTerrain, "Terrain not instantiated before trying to load its data!");
 
+    ///////////////////////////////////
+    // Get all the layers that come from files read and decoded in the background, so they're ready or close to it by the time each one is loaded below
+    m_pTerrain->PrefetchData();
+    for (int team = Activity::TeamOne; team < Activity::MaxTeamCount; ++team)
+    {
+        if (m_UnseenPixelSize[team].IsZero() && m_apUnseenLayer[team])
+            m_apUnseenLayer[team]->PrefetchData();
+    }
+    if (initPathfinding)
+    {
+        for (list<SceneLayer *>::iterator slItr = m_BackLayerList.begin(); slItr != m_BackLayerList.end(); ++slItr)
+        {
+            if (*slItr)
+                (*slItr)->PrefetchData();
+        }
+    }
+
     ///////////////////////////////////
     // Load Terrain's data
     if (m_pTerrain->LoadData() < 0)
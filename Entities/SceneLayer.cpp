@@ -13,6 +13,8 @@
 
 #include "SceneLayer.h"
 #include "ContentFile.h"
+#include "SettingsMan.h"
+#include "MappedBitmap.h"
 
 namespace RTE {
 
@@ -170,7 +172,7 @@ int SceneLayer::Create(const SceneLayer &reference)
         RTEAssert(pCopyFrom, "Couldn't load the bitmap file specified for SceneLayer!");
 
         // Destination
-        m_pMainBitmap = create_bitmap_ex(8, pCopyFrom->w, pCopyFrom->h);
+        m_pMainBitmap = CreateLayerBitmap(pCopyFrom->w, pCopyFrom->h);
         RTEAssert(m_pMainBitmap, "Failed to allocate BITMAP in SceneLayer::Create");
 
         // Copy!
@@ -240,6 +242,20 @@ int SceneLayer::LoadData()
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  PrefetchData
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Queues the bitmap data of this to be read and decoded in the
+//                  background, so LoadData doesn't have to wait for the disk.
+
+void SceneLayer::PrefetchData()
+{
+    // Same conversion mode as LoadData, or the prefetch would be thrown away
+    if (IsFileData())
+        m_BitmapFile.PrefetchBitmap(COLORCONV_NONE);
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  SaveData
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -274,7 +290,7 @@ int SceneLayer::SaveData(string bitmapPath)
 int SceneLayer::ClearData()
 {
     if (m_pMainBitmap && m_MainBitmapOwned)
-        destroy_bitmap(m_pMainBitmap);
+        DestroyLayerBitmap(m_pMainBitmap);
     m_pMainBitmap = 0;
 
     m_MainBitmapOwned = false;
@@ -356,7 +372,7 @@ int SceneLayer::Save(Writer &writer) const
 void SceneLayer::Destroy(bool notInherited)
 {
     if (m_MainBitmapOwned)
-        destroy_bitmap(m_pMainBitmap);
+        DestroyLayerBitmap(m_pMainBitmap);
 
     if (!notInherited)
         Entity::Destroy();
@@ -364,6 +380,71 @@ void SceneLayer::Destroy(bool notInherited)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          MapMainBitmap
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Moves the contents of this' owned BITMAP into a memory-mapped one, if
+//                  it's large enough to be streamed according to the settings.
+
+void SceneLayer::MapMainBitmap()
+{
+    if (!m_pMainBitmap || !m_MainBitmapOwned || MappedBitmap::IsMapped(m_pMainBitmap) || !IsStreamedSize(m_pMainBitmap->w, m_pMainBitmap->h))
+        return;
+
+    BITMAP *pMappedBitmap = MappedBitmap::Create(m_pMainBitmap->w, m_pMainBitmap->h, bitmap_color_depth(m_pMainBitmap));
+    // Just keep the loaded bitmap in memory if no mapping could be made for it
+    if (!pMappedBitmap)
+        return;
+
+    blit(m_pMainBitmap, pMappedBitmap, 0, 0, 0, 0, m_pMainBitmap->w, m_pMainBitmap->h);
+    destroy_bitmap(m_pMainBitmap);
+    m_pMainBitmap = pMappedBitmap;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Static method:   IsStreamedSize
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a layer BITMAP of a certain size is to be backed by a
+//                  memory-mapped file, according to the settings.
+
+bool SceneLayer::IsStreamedSize(int width, int height)
+{
+    long long streamingThreshold = static_cast<long long>(g_SettingsMan.GetSceneLayerStreamingThreshold()) * 1000000;
+    return streamingThreshold > 0 && static_cast<long long>(width) * static_cast<long long>(height) >= streamingThreshold;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Static method:   CreateLayerBitmap
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Creates a BITMAP for a scene-sized layer, memory-mapped if it's large
+//                  enough to be streamed.
+
+BITMAP * SceneLayer::CreateLayerBitmap(int width, int height, int colorDepth)
+{
+    if (IsStreamedSize(width, height))
+    {
+        // Fall back to a regular bitmap if no mapping could be made, e.g. because the temp directory is out of space
+        if (BITMAP *pMappedBitmap = MappedBitmap::Create(width, height, colorDepth))
+            return pMappedBitmap;
+    }
+    return create_bitmap_ex(colorDepth, width, height);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Static method:   DestroyLayerBitmap
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Destroys a BITMAP made by CreateLayerBitmap, or any other memory BITMAP.
+
+void SceneLayer::DestroyLayerBitmap(BITMAP *pBitmap)
+{
+    if (pBitmap && !MappedBitmap::Destroy(pBitmap))
+        destroy_bitmap(pBitmap);
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          SetScaleFactor
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -586,7 +667,7 @@ struct SLDrawBox
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Draws this SceneLayer's current scrolled position to a bitmap.
 
-void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride) const
+void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride, const Box &clipBox) const
 {
     RTEAssert(m_pMainBitmap, "Data of this SceneLayer has not been loaded before trying to draw!");
 
@@ -628,6 +709,9 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
 
     // Set the clipping rectangle of the target bitmap to match the specified target box
     set_clip_rect(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth() - 1, targetBox.GetCorner().m_Y + targetBox.GetHeight() - 1);
+    // Restrict it further to the clip box, if there is one
+    if (!clipBox.IsEmpty())
+        add_clip_rect(pTargetBitmap, clipBox.GetCorner().GetFloorIntX(), clipBox.GetCorner().GetFloorIntY(), clipBox.GetCorner().GetFloorIntX() + static_cast<int>(clipBox.GetWidth()) - 1, clipBox.GetCorner().GetFloorIntY() + static_cast<int>(clipBox.GetHeight()) - 1);
 
     // Choose the correct blitting function based on transparency setting
     void (*pfBlit)(BITMAP *source, BITMAP *dest, int source_x, int source_y, int dest_x, int dest_y, int width, int height) = m_DrawTrans ? &masked_blit : &blit;
@@ -155,6 +155,17 @@ ClassInfoGetters;
     virtual int LoadData();
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual method:  PrefetchData
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Queues the bitmap data of this to be read and decoded in the
+//                  background, so LoadData doesn't have to wait for the disk.
+// Arguments:       None.
+// Return value:    None.
+
+    virtual void PrefetchData();
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  SaveData
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +232,52 @@ ClassInfoGetters;
 	size_t GetBitmapHash() const { return m_BitmapFile.GetHash(); }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          MapMainBitmap
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Moves the contents of this' owned BITMAP into a memory-mapped one, if
+//                  it's large enough to be streamed according to the settings. Should
+//                  be done right after loading the data of scene-sized layers.
+// Arguments:       None.
+// Return value:    None.
+
+    void MapMainBitmap();
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Static method:   IsStreamedSize
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a layer BITMAP of a certain size is to be backed by a
+//                  memory-mapped file, according to the settings.
+// Arguments:       The width and height of the BITMAP.
+// Return value:    Whether layer BITMAPs of this size are streamed.
+
+    static bool IsStreamedSize(int width, int height);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Static method:   CreateLayerBitmap
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Creates a BITMAP for a scene-sized layer. If it's large enough to be
+//                  streamed, it's backed by a memory-mapped file that is only paged in
+//                  around the views, otherwise it's a regular memory BITMAP.
+// Arguments:       The width and height of the BITMAP, and its color depth.
+// Return value:    The created BITMAP, or 0 if it couldn't be created. Ownership IS
+//                  transferred, and it has to be destroyed with DestroyLayerBitmap.
+
+    static BITMAP * CreateLayerBitmap(int width, int height, int colorDepth = 8);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Static method:   DestroyLayerBitmap
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Destroys a BITMAP made by CreateLayerBitmap, or any other memory BITMAP.
+// Arguments:       The BITMAP to destroy. Can be 0.
+// Return value:    None.
+
+    static void DestroyLayerBitmap(BITMAP *pBitmap);
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetOffset
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -453,9 +510,10 @@ ClassInfoGetters;
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The box on the target bitmap to further limit drawing to, if not empty.
 // Return value:    None.
 
-    virtual void Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride = Vector(-1, -1)) const;
+    virtual void Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride = Vector(-1, -1), const Box &clipBox = Box()) const;
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
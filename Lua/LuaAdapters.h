@@ -8,16 +8,18 @@ namespace RTE {
 
 #pragma region Manager Lua Adapters
 	/// <summary>
-	/// Adds the given MovableObject to MovableMan if it doesn't already exist in there, or prints an error if it does.
+	/// Adds the given MovableObject to MovableMan if it doesn't already exist in there, or prints an error if it does. Deferred if called from a script updating in parallel, as are the other Add adapters.
 	/// </summary>
 	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
 	/// <param name="movableObject">A pointer to the MovableObject to be added.</param>
 	static void AddMO(MovableMan &movableMan, MovableObject *movableObject) {
-		if (movableMan.ValidMO(movableObject)) {
-			g_ConsoleMan.PrintString("ERROR: Tried to add a MovableObject that already exists in the simulation! " + movableObject->GetPresetName());
-		} else {
-			movableMan.AddMO(movableObject);
-		}
+		g_LuaMan.RunOrDeferCommand([&movableMan, movableObject]() {
+			if (movableMan.ValidMO(movableObject)) {
+				g_ConsoleMan.PrintString("ERROR: Tried to add a MovableObject that already exists in the simulation! " + movableObject->GetPresetName());
+			} else {
+				movableMan.AddMO(movableObject);
+			}
+		});
 	}
 
 	/// <summary>
@@ -26,11 +28,13 @@ namespace RTE {
 	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
 	/// <param name="actor">A pointer to the Actor to be added.</param>
 	static void AddActor(MovableMan &movableMan, Actor *actor) {
-		if (movableMan.IsActor(actor)) {
-			g_ConsoleMan.PrintString("ERROR: Tried to add an Actor that already exists in the simulation!" + actor->GetPresetName());
-		} else {
-			movableMan.AddActor(actor);
-		}
+		g_LuaMan.RunOrDeferCommand([&movableMan, actor]() {
+			if (movableMan.IsActor(actor)) {
+				g_ConsoleMan.PrintString("ERROR: Tried to add an Actor that already exists in the simulation!" + actor->GetPresetName());
+			} else {
+				movableMan.AddActor(actor);
+			}
+		});
 	}
 
 	/// <summary>
@@ -39,11 +43,13 @@ namespace RTE {
 	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
 	/// <param name="item">A pointer to the item to be added.</param>
 	static void AddItem(MovableMan &movableMan, MovableObject *item) {
-		if (movableMan.ValidMO(item)) {
-			g_ConsoleMan.PrintString("ERROR: Tried to add an Item that already exists in the simulation!" + item->GetPresetName());
-		} else {
-			movableMan.AddItem(item);
-		}
+		g_LuaMan.RunOrDeferCommand([&movableMan, item]() {
+			if (movableMan.ValidMO(item)) {
+				g_ConsoleMan.PrintString("ERROR: Tried to add an Item that already exists in the simulation!" + item->GetPresetName());
+			} else {
+				movableMan.AddItem(item);
+			}
+		});
 	}
 
 	/// <summary>
@@ -52,11 +58,95 @@ namespace RTE {
 	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
 	/// <param name="particle">A pointer to the pctor to be added.</param>
 	static void AddParticle(MovableMan &movableMan, MovableObject *particle) {
-		if (movableMan.ValidMO(particle)) {
-			g_ConsoleMan.PrintString("ERROR: Tried to add a Particle that already exists in the simulation!" + particle->GetPresetName());
-		} else {
-			movableMan.AddParticle(particle);
+		g_LuaMan.RunOrDeferCommand([&movableMan, particle]() {
+			if (movableMan.ValidMO(particle)) {
+				g_ConsoleMan.PrintString("ERROR: Tried to add a Particle that already exists in the simulation!" + particle->GetPresetName());
+			} else {
+				movableMan.AddParticle(particle);
+			}
+		});
+	}
+
+	/// <summary>
+	/// Adds the given SceneObject to the scene, deferred if called from a script updating in parallel.
+	/// </summary>
+	/// <param name="sceneMan">A reference to SceneMan, provided by Lua.</param>
+	/// <param name="sceneObject">A pointer to the SceneObject to be added.</param>
+	/// <returns>Whether the SceneObject was successfully added, or true if it was deferred.</returns>
+	static bool AddSceneObject(SceneMan &sceneMan, SceneObject *sceneObject) {
+		if (!g_LuaMan.IsInParallelScriptUpdate()) {
+			return sceneMan.AddSceneObject(sceneObject);
+		}
+		g_LuaMan.RunOrDeferCommand([&sceneMan, sceneObject]() { sceneMan.AddSceneObject(sceneObject); });
+		return true;
+	}
+
+	/// <summary>
+	/// Adds the given TerrainObject to the terrain, deferred if called from a script updating in parallel.
+	/// </summary>
+	/// <param name="sceneMan">A reference to SceneMan, provided by Lua.</param>
+	/// <param name="terrainObject">A pointer to the TerrainObject to be added.</param>
+	/// <returns>Whether the TerrainObject was successfully added, or true if it was deferred.</returns>
+	static bool AddTerrainObject(SceneMan &sceneMan, TerrainObject *terrainObject) {
+		if (!g_LuaMan.IsInParallelScriptUpdate()) {
+			return sceneMan.AddTerrainObject(terrainObject);
+		}
+		g_LuaMan.RunOrDeferCommand([&sceneMan, terrainObject]() { sceneMan.AddTerrainObject(terrainObject); });
+		return true;
+	}
+
+	/// <summary>
+	/// Packs a list of MO:s into a new Lua array table, so it can be handed to Lua in one go instead of being iterated over the luabind boundary.
+	/// </summary>
+	/// <param name="luaState">The Lua state to create the table in.</param>
+	/// <param name="moList">The MO:s to pack. Ownership is NOT transferred!</param>
+	/// <returns>A Lua table with the MO:s at indices 1 through n.</returns>
+	template <typename MOType> static luabind::object MOListToLuaTable(lua_State *luaState, const std::vector<MOType *> &moList) {
+		luabind::object luaTable = luabind::newtable(luaState);
+		int luaIndex = 1;
+		for (MOType *mo : moList) {
+			luaTable[luaIndex++] = mo;
 		}
+		return luaTable;
+	}
+
+	/// <summary>
+	/// Gets all the Actors in MovableMan that match the given query, as a Lua array table.
+	/// </summary>
+	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
+	/// <param name="luaState">The Lua state calling this, provided by luabind.</param>
+	/// <param name="query">The MOQuery to match the Actors against.</param>
+	/// <returns>A Lua table with the matching Actors.</returns>
+	static luabind::object QueryActors(const MovableMan &movableMan, lua_State *luaState, const MOQuery &query) {
+		std::vector<Actor *> matches;
+		movableMan.QueryActors(query, matches);
+		return MOListToLuaTable(luaState, matches);
+	}
+
+	/// <summary>
+	/// Gets all the items in MovableMan that match the given query, as a Lua array table.
+	/// </summary>
+	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
+	/// <param name="luaState">The Lua state calling this, provided by luabind.</param>
+	/// <param name="query">The MOQuery to match the items against.</param>
+	/// <returns>A Lua table with the matching items.</returns>
+	static luabind::object QueryItems(const MovableMan &movableMan, lua_State *luaState, const MOQuery &query) {
+		std::vector<MovableObject *> matches;
+		movableMan.QueryItems(query, matches);
+		return MOListToLuaTable(luaState, matches);
+	}
+
+	/// <summary>
+	/// Gets all the particles in MovableMan that match the given query, as a Lua array table.
+	/// </summary>
+	/// <param name="movableMan">A reference to MovableMan, provided by Lua.</param>
+	/// <param name="luaState">The Lua state calling this, provided by luabind.</param>
+	/// <param name="query">The MOQuery to match the particles against.</param>
+	/// <returns>A Lua table with the matching particles.</returns>
+	static luabind::object QueryParticles(const MovableMan &movableMan, lua_State *luaState, const MOQuery &query) {
+		std::vector<MovableObject *> matches;
+		movableMan.QueryParticles(query, matches);
+		return MOListToLuaTable(luaState, matches);
 	}
 
 	/// <summary>
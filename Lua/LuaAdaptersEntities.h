@@ -2,6 +2,7 @@
 #define _RTELUAADAPTERSENTITIES_
 
 #include "ConsoleMan.h"
+#include "LuaMan.h"
 #include "PresetMan.h"
 
 #include "ACDropShip.h"
@@ -43,6 +44,14 @@
 namespace RTE {
 
 #pragma region Entity Lua Adapter Macros
+	/// <summary>
+	/// Raises a Lua error if the calling thread is updating thread-safe scripts in parallel. Entities can't be created there, because the class memory pools, the unique ID counter and MovableMan's registry of objects aren't safe to use from several threads at once.
+	/// </summary>
+	/// <param name="typeName">The type of Entity that was going to be created, for the error message.</param>
+	static void RejectEntityCreationInParallelScriptUpdate(const char *typeName) {
+		if (g_LuaMan.IsInParallelScriptUpdate()) { throw std::runtime_error(std::string("Can't create a ") + typeName + " from the Update of a ThreadSafe script!"); }
+	}
+
 	/// <summary>
 	/// Convenience macro to generate preset clone-create adapter functions that will return the exact pre-cast types, so we don't have to do: myNewActor = ToActor(PresetMan:GetPreset("AHuman", "Soldier Light", "All")):Clone()
 	/// But can instead do: myNewActor = CreateActor("Soldier Light", "All");
@@ -51,6 +60,7 @@ namespace RTE {
 	/// </summary>
 	#define LuaEntityCreate(TYPE) \
 		static TYPE * Create##TYPE(std::string preseName, std::string moduleName) { \
+			RejectEntityCreationInParallelScriptUpdate(#TYPE); \
 			const Entity *entityPreset = g_PresetMan.GetEntityPreset(#TYPE, preseName, moduleName); \
 			if (!entityPreset) { \
 				g_ConsoleMan.PrintString(std::string("ERROR: There is no ") + std::string(#TYPE) + std::string(" of the Preset name \"") + preseName + std::string("\" defined in the \"") + moduleName + std::string("\" Data Module!")); \
@@ -62,6 +72,7 @@ namespace RTE {
 			return Create##TYPE(preset, "All"); \
 		} \
 		static TYPE * Random##TYPE(std::string groupName, int moduleSpaceID) { \
+			RejectEntityCreationInParallelScriptUpdate(#TYPE); \
 			const Entity *entityPreset = g_PresetMan.GetRandomBuyableOfGroupFromTech(groupName, #TYPE, moduleSpaceID); \
 			if (!entityPreset) { entityPreset = g_PresetMan.GetRandomBuyableOfGroupFromTech(groupName, #TYPE, g_PresetMan.GetModuleID("Base.rte")); } \
 			if (!entityPreset) { entityPreset = g_PresetMan.GetRandomBuyableOfGroupFromTech("Any", #TYPE, moduleSpaceID); } \
@@ -72,6 +83,7 @@ namespace RTE {
 			return dynamic_cast<TYPE *>(entityPreset->Clone()); \
 		} \
 		static TYPE * Random##TYPE(std::string groupName, std::string dataModuleName) { \
+			RejectEntityCreationInParallelScriptUpdate(#TYPE); \
 			int moduleSpaceID = g_PresetMan.GetModuleID(dataModuleName); \
 			const Entity *entityPreset = g_PresetMan.GetRandomBuyableOfGroupFromTech(groupName, #TYPE, moduleSpaceID); \
 			if (!entityPreset) { entityPreset = g_PresetMan.GetRandomBuyableOfGroupFromTech(groupName, #TYPE, g_PresetMan.GetModuleID("Base.rte")); } \
@@ -91,6 +103,7 @@ namespace RTE {
 	/// </summary>
 	#define LuaEntityClone(TYPE) \
 		static TYPE * Clone##TYPE(const TYPE *thisEntity) { \
+			RejectEntityCreationInParallelScriptUpdate(#TYPE); \
 			if (thisEntity) { \
 				return dynamic_cast<TYPE *>(thisEntity->Clone()); \
 			} \
@@ -122,6 +135,7 @@ namespace RTE {
 	/// </summary>
 	#define LuaPropertyOwnershipSafetyFaker(OBJECTTYPE, PROPERTYTYPE, SETTERFUNCTION) \
 		static void OBJECTTYPE##SETTERFUNCTION(OBJECTTYPE *luaSelfObject, PROPERTYTYPE *objectToSet) { \
+			RejectEntityCreationInParallelScriptUpdate(#PROPERTYTYPE); \
 			luaSelfObject->SETTERFUNCTION(objectToSet ? dynamic_cast<PROPERTYTYPE *>(objectToSet->Clone()) : nullptr); \
 		}
 #pragma endregion
@@ -152,7 +166,52 @@ namespace RTE {
 	}
 
 	static void GibThis(MOSRotating *luaSelfObject) {
-		luaSelfObject->GibThis();
+		g_LuaMan.RunOrDeferCommand([luaSelfObject]() { luaSelfObject->GibThis(); });
+	}
+
+	// Sound playback goes through AudioMan and FMOD, which aren't safe to use from scripts updating in parallel, so these defer it until the parallel update is done. Deferred commands report success.
+	static bool PlaySoundContainer2(SoundContainer *luaSelfObject, int player) {
+		if (!g_LuaMan.IsInParallelScriptUpdate()) {
+			return luaSelfObject->Play(player);
+		}
+		g_LuaMan.RunOrDeferCommand([luaSelfObject, player]() { luaSelfObject->Play(player); });
+		return true;
+	}
+	static bool PlaySoundContainer1(SoundContainer *luaSelfObject) {
+		return PlaySoundContainer2(luaSelfObject, -1);
+	}
+	static bool PlaySoundContainer4(SoundContainer *luaSelfObject, const Vector &position, int player) {
+		if (!g_LuaMan.IsInParallelScriptUpdate()) {
+			return luaSelfObject->Play(position, player);
+		}
+		g_LuaMan.RunOrDeferCommand([luaSelfObject, position, player]() { luaSelfObject->Play(position, player); });
+		return true;
+	}
+	static bool PlaySoundContainer3(SoundContainer *luaSelfObject, const Vector &position) {
+		return PlaySoundContainer4(luaSelfObject, position, -1);
+	}
+	static bool StopSoundContainer2(SoundContainer *luaSelfObject, int player) {
+		if (!g_LuaMan.IsInParallelScriptUpdate()) {
+			return luaSelfObject->Stop(player);
+		}
+		g_LuaMan.RunOrDeferCommand([luaSelfObject, player]() { luaSelfObject->Stop(player); });
+		return true;
+	}
+	static bool StopSoundContainer1(SoundContainer *luaSelfObject) {
+		return StopSoundContainer2(luaSelfObject, -1);
+	}
+	static bool RestartSoundContainer2(SoundContainer *luaSelfObject, int player) {
+		if (!g_LuaMan.IsInParallelScriptUpdate()) {
+			return luaSelfObject->Restart(player);
+		}
+		g_LuaMan.RunOrDeferCommand([luaSelfObject, player]() { luaSelfObject->Restart(player); });
+		return true;
+	}
+	static bool RestartSoundContainer1(SoundContainer *luaSelfObject) {
+		return RestartSoundContainer2(luaSelfObject, -1);
+	}
+	static void FadeOutSoundContainer(SoundContainer *luaSelfObject, int fadeOutTime) {
+		g_LuaMan.RunOrDeferCommand([luaSelfObject, fadeOutTime]() { luaSelfObject->FadeOut(fadeOutTime); });
 	}
 
 	static float GetTotalValue(const SceneObject *luaSelfObject, int nativeModule, float foreignMult) {
@@ -11,6 +11,7 @@
 #include "out_value_policy.hpp"
 #include "iterator_policy.hpp"
 #include "return_reference_to_policy.hpp"
+#include "raw_policy.hpp"
 
 namespace luabind {
 	/// <summary>
@@ -185,6 +185,7 @@ namespace RTE {
 	/// </summary>
 	struct MiscLuaBindings {
 		LuaBindingRegisterFunctionDeclarationForType(AlarmEvent);
+		LuaBindingRegisterFunctionDeclarationForType(MOQuery);
 		LuaBindingRegisterFunctionDeclarationForType(InputDevice);
 		LuaBindingRegisterFunctionDeclarationForType(InputElements);
 		LuaBindingRegisterFunctionDeclarationForType(MouseButtons);
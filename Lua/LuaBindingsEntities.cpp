@@ -973,6 +973,8 @@ namespace RTE {
 		.def("RestDetection", &MovableObject::RestDetection)
 		.def("NotResting", &MovableObject::NotResting)
 		.def("IsAtRest", &MovableObject::IsAtRest)
+		.def("IsAsleep", &MovableObject::IsAsleep)
+		.def("WakeUp", &MovableObject::WakeUp)
 		.def("MoveOutOfTerrain", &MovableObject::MoveOutOfTerrain)
 		.def("RotateOffset", &MovableObject::RotateOffset);
 	}
@@ -1137,15 +1139,15 @@ namespace RTE {
 		.def("GetTopLevelSoundSet", &SoundContainer::GetTopLevelSoundSet)
 		.def("SetTopLevelSoundSet", &SoundContainer::SetTopLevelSoundSet)
 		.def("IsBeingPlayed", &SoundContainer::IsBeingPlayed)
-		.def("Play", (bool (SoundContainer:: *)()) &SoundContainer::Play)
-		.def("Play", (bool (SoundContainer:: *)(const int player)) &SoundContainer::Play)
-		.def("Play", (bool (SoundContainer:: *)(const Vector &position)) &SoundContainer::Play)
-		.def("Play", (bool (SoundContainer:: *)(const Vector &position, int player)) &SoundContainer::Play)
-		.def("Stop", (bool (SoundContainer:: *)()) &SoundContainer::Stop)
-		.def("Stop", (bool (SoundContainer:: *)(int player)) &SoundContainer::Stop)
-		.def("Restart", (bool (SoundContainer:: *)()) &SoundContainer::Restart)
-		.def("Restart", (bool (SoundContainer:: *)(int player)) &SoundContainer::Restart)
-		.def("FadeOut", &SoundContainer::FadeOut)
+		.def("Play", &PlaySoundContainer1)
+		.def("Play", &PlaySoundContainer2)
+		.def("Play", &PlaySoundContainer3)
+		.def("Play", &PlaySoundContainer4)
+		.def("Stop", &StopSoundContainer1)
+		.def("Stop", &StopSoundContainer2)
+		.def("Restart", &RestartSoundContainer1)
+		.def("Restart", &RestartSoundContainer2)
+		.def("FadeOut", &FadeOutSoundContainer)
 
 		.enum_("SoundOverlapMode")[
 			luabind::value("OVERLAP", SoundContainer::SoundOverlapMode::OVERLAP),
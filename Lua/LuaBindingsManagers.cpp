@@ -155,7 +155,10 @@ namespace RTE {
 		.def("AddMO", &AddMO, luabind::adopt(_2))
 		.def("AddActor", &AddActor, luabind::adopt(_2))
 		.def("AddItem", &AddItem, luabind::adopt(_2))
-		.def("AddParticle", &AddParticle, luabind::adopt(_2));
+		.def("AddParticle", &AddParticle, luabind::adopt(_2))
+		.def("QueryActors", &QueryActors, luabind::raw(_2))
+		.def("QueryItems", &QueryItems, luabind::raw(_2))
+		.def("QueryParticles", &QueryParticles, luabind::raw(_2));
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,6 +284,7 @@ namespace RTE {
 		.def("CastSeeRay", &SceneMan::CastSeeRay)
 		.def("CastUnseeRay", &SceneMan::CastUnseeRay)
 		.def("CastUnseenRay", &SceneMan::CastUnseenRay)
+		.def("IsVisibleToTeam", &SceneMan::IsVisibleToTeam)
 		.def("CastMaterialRay", (bool (SceneMan::*)(const Vector &, const Vector &, unsigned char, Vector &, int, bool))&SceneMan::CastMaterialRay)
 		.def("CastMaterialRay", (float (SceneMan::*)(const Vector &, const Vector &, unsigned char, int))&SceneMan::CastMaterialRay)
 		.def("CastNotMaterialRay", (bool (SceneMan::*)(const Vector &, const Vector &, unsigned char, Vector &, int, bool))&SceneMan::CastNotMaterialRay)
@@ -304,8 +308,8 @@ namespace RTE {
 		.def("ShortestDistance", &SceneMan::ShortestDistance)
 		.def("ObscuredPoint", (bool (SceneMan::*)(Vector &, int))&SceneMan::ObscuredPoint)//, out_value(_2))
 		.def("ObscuredPoint", (bool (SceneMan::*)(int, int, int))&SceneMan::ObscuredPoint)
-		.def("AddSceneObject", &SceneMan::AddSceneObject, luabind::adopt(_2))
-		.def("AddTerrainObject", &SceneMan::AddTerrainObject, luabind::adopt(_2))
+		.def("AddSceneObject", &AddSceneObject, luabind::adopt(_2))
+		.def("AddTerrainObject", &AddTerrainObject, luabind::adopt(_2))
 		.def("CheckAndRemoveOrphans", (int (SceneMan::*)(int, int, int, int, bool))&SceneMan::RemoveOrphans);
 	}
 
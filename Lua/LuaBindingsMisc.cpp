@@ -15,6 +15,24 @@ namespace RTE {
 		.def_readwrite("Range", &AlarmEvent::m_Range);
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	LuaBindingRegisterFunctionDefinitionForType(MiscLuaBindings, MOQuery) {
+		return luabind::class_<MOQuery>("MOQuery")
+
+		.def(luabind::constructor<>())
+
+		.def_readwrite("Team", &MOQuery::m_Team)
+		.def_readwrite("NotOfTeam", &MOQuery::m_NotOfTeam)
+		.def_readwrite("ClassName", &MOQuery::m_ClassName)
+		.def_readwrite("Group", &MOQuery::m_Group)
+		.def_readwrite("PresetName", &MOQuery::m_PresetName)
+		.def_readwrite("Box", &MOQuery::m_Box)
+		.def_readwrite("Center", &MOQuery::m_Center)
+		.def_readwrite("Radius", &MOQuery::m_Radius)
+		.def_readwrite("Limit", &MOQuery::m_Limit);
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	LuaBindingRegisterFunctionDefinitionForType(MiscLuaBindings, InputDevice) {
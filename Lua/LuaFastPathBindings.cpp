@@ -0,0 +1,525 @@
+#include "LuaFastPathBindings.h"
+
+#include "detail/class_registry.hpp"
+#include "detail/class_rep.hpp"
+#include "detail/object_rep.hpp"
+#include "detail/operator_id.hpp"
+
+#include "ACrab.h"
+#include "AHuman.h"
+#include "Deployment.h"
+#include "HDFirearm.h"
+
+namespace RTE {
+
+	using luabind::detail::class_rep;
+	using luabind::detail::object_rep;
+
+	template <typename ClassType, typename ResultType, typename ... ArgumentTypes>
+	struct LuaFastPathBindings::MemberFunctionTraits<ResultType (ClassType::*)(ArgumentTypes ...)> {
+		using Class = ClassType;
+		using Result = ResultType;
+		using Arguments = std::tuple<ArgumentTypes ...>;
+		static constexpr bool IsConst = false;
+	};
+
+	template <typename ClassType, typename ResultType, typename ... ArgumentTypes>
+	struct LuaFastPathBindings::MemberFunctionTraits<ResultType (ClassType::*)(ArgumentTypes ...) const> {
+		using Class = ClassType;
+		using Result = ResultType;
+		using Arguments = std::tuple<ArgumentTypes ...>;
+		static constexpr bool IsConst = true;
+	};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LuaFastPathBindings::Register(lua_State *luaState) {
+		const luabind::detail::class_registry *classRegistry = luabind::detail::class_registry::get_registry(luaState);
+		class_rep *vectorClass = classRegistry->find_class(LUABIND_TYPEID(Vector));
+		RTEAssert(vectorClass, "Tried to register the Lua fast path bindings before the Vector bindings were registered!");
+
+		luabind::detail::getref(luaState, classRegistry->cpp_instance());
+		int instanceMetatable = lua_gettop(luaState);
+
+		// Build a table of members for each bound class, keyed by the class_rep, so the handlers can find a member with two table lookups.
+		lua_newtable(luaState);
+		int classMembers = lua_gettop(luaState);
+
+		for (class_rep *classRep : GetBoundClasses(luaState)) {
+			lua_newtable(luaState);
+			int members = lua_gettop(luaState);
+
+			// Definitions are ordered base classes first, so a definition in a derived class replaces the one it overrides, same as it does in LuaBind.
+			for (const PropertyDefinition &propertyDefinition : GetPropertyDefinitions()) {
+				int getterPointerOffset = 0;
+				int setterPointerOffset = 0;
+				if (GetBaseClassPointerOffset(classRep, propertyDefinition.GetterClass, getterPointerOffset) && (!propertyDefinition.Setter || GetBaseClassPointerOffset(classRep, propertyDefinition.SetterClass, setterPointerOffset))) {
+					lua_pushstring(luaState, propertyDefinition.Name);
+					ResolvedProperty *resolvedProperty = static_cast<ResolvedProperty *>(lua_newuserdata(luaState, sizeof(ResolvedProperty)));
+					*resolvedProperty = { propertyDefinition.Getter, propertyDefinition.Setter, getterPointerOffset, setterPointerOffset };
+					lua_rawset(luaState, members);
+				}
+			}
+			for (const MethodDefinition &methodDefinition : GetMethodDefinitions()) {
+				int pointerOffset = 0;
+				if (!GetBaseClassPointerOffset(classRep, methodDefinition.Class, pointerOffset)) {
+					continue;
+				}
+				classRep->get_table(luaState);
+				lua_pushstring(luaState, methodDefinition.Name);
+				lua_rawget(luaState, -2);
+				lua_remove(luaState, -2);
+				if (!lua_isfunction(luaState, -1)) {
+					lua_pop(luaState, 1);
+					continue;
+				}
+				int originalFunction = lua_gettop(luaState);
+				lua_pushstring(luaState, methodDefinition.Name);
+				lua_pushvalue(luaState, instanceMetatable);
+				lua_pushlightuserdata(luaState, vectorClass);
+				lua_pushvalue(luaState, originalFunction);
+				lua_pushlightuserdata(luaState, const_cast<MethodDefinition *>(&methodDefinition));
+				lua_pushlightuserdata(luaState, classRep);
+				lua_pushinteger(luaState, pointerOffset);
+				lua_pushcclosure(luaState, &LuaFastPathBindings::MethodHandler, MethodPointerOffsetUpvalue);
+				lua_rawset(luaState, members);
+				lua_pop(luaState, 1);
+			}
+
+			lua_pushlightuserdata(luaState, classRep);
+			lua_insert(luaState, members);
+			lua_rawset(luaState, classMembers);
+		}
+
+		lua_pushstring(luaState, "__index");
+		lua_pushvalue(luaState, instanceMetatable);
+		lua_pushlightuserdata(luaState, vectorClass);
+		lua_pushvalue(luaState, classMembers);
+		lua_pushcclosure(luaState, &LuaFastPathBindings::IndexHandler, ClassMembersUpvalue);
+		lua_rawset(luaState, instanceMetatable);
+
+		lua_pushstring(luaState, "__newindex");
+		lua_pushvalue(luaState, instanceMetatable);
+		lua_pushlightuserdata(luaState, vectorClass);
+		lua_pushvalue(luaState, classMembers);
+		lua_pushcclosure(luaState, &LuaFastPathBindings::NewIndexHandler, ClassMembersUpvalue);
+		lua_rawset(luaState, instanceMetatable);
+
+		for (int operatorId : { luabind::detail::op_add, luabind::detail::op_sub, luabind::detail::op_mul, luabind::detail::op_div, luabind::detail::op_eq }) {
+			lua_pushstring(luaState, luabind::detail::get_operator_name(operatorId));
+			lua_pushvalue(luaState, instanceMetatable);
+			lua_pushlightuserdata(luaState, vectorClass);
+			lua_pushstring(luaState, luabind::detail::get_operator_name(operatorId));
+			lua_rawget(luaState, instanceMetatable);
+			lua_pushinteger(luaState, operatorId);
+			lua_pushcclosure(luaState, &LuaFastPathBindings::OperatorHandler, OperatorIdUpvalue);
+			lua_rawset(luaState, instanceMetatable);
+		}
+
+		lua_pop(luaState, 2);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const std::vector<LuaFastPathBindings::PropertyDefinition> & LuaFastPathBindings::GetPropertyDefinitions() {
+		static const std::vector<PropertyDefinition> propertyDefinitions = {
+			DefineProperty<&Vector::GetX, &Vector::SetX>("X"),
+			DefineProperty<&Vector::GetY, &Vector::SetY>("Y"),
+			DefineProperty<&Vector::GetMagnitude>("Magnitude"),
+			DefineProperty<&Vector::GetNormalized>("Normalized"),
+			DefineProperty<&Vector::GetPerpendicular>("Perpendicular"),
+			DefineProperty<&Vector::GetAbsRadAngle>("AbsRadAngle"),
+
+			DefineProperty<&SceneObject::GetPos, &SceneObject::SetPos>("Pos"),
+			DefineProperty<&SceneObject::IsHFlipped, &SceneObject::SetHFlipped>("HFlipped"),
+			DefineProperty<&SceneObject::GetRotAngle, &SceneObject::SetRotAngle>("RotAngle"),
+			DefineProperty<&SceneObject::GetTeam, &SceneObject::SetTeam>("Team"),
+
+			DefineProperty<&Deployment::IsHFlipped>("HFlipped"),
+
+			DefineProperty<&MovableObject::GetMass, &MovableObject::SetMass>("Mass"),
+			DefineProperty<&MovableObject::GetPos, &MovableObject::SetPos>("Pos"),
+			DefineProperty<&MovableObject::GetVel, &MovableObject::SetVel>("Vel"),
+			DefineProperty<&MovableObject::GetAngularVel, &MovableObject::SetAngularVel>("AngularVel"),
+			DefineProperty<&MovableObject::GetRadius>("Radius"),
+			DefineProperty<&MovableObject::GetAge, &MovableObject::SetAge>("Age"),
+			DefineProperty<&MovableObject::GetID>("ID"),
+			DefineProperty<&MovableObject::GetRootID>("RootID"),
+			DefineProperty<&MovableObject::GetSharpness, &MovableObject::SetSharpness>("Sharpness"),
+			DefineProperty<&MovableObject::ToDelete, &MovableObject::SetToDelete>("ToDelete"),
+			DefineProperty<&MovableObject::GetPinStrength, &MovableObject::SetPinStrength>("PinStrength"),
+
+			DefineProperty<&MOSprite::IsHFlipped, &MOSprite::SetHFlipped>("HFlipped"),
+			DefineProperty<&MOSprite::GetRotAngle, &MOSprite::SetRotAngle>("RotAngle"),
+			DefineProperty<&MOSprite::GetAngularVel, &MOSprite::SetAngularVel>("AngularVel"),
+
+			DefineProperty<&Actor::GetStatus, &Actor::SetStatus>("Status"),
+			DefineProperty<&Actor::GetHealth, &Actor::SetHealth>("Health"),
+			DefineProperty<&Actor::GetMaxHealth, &Actor::SetMaxHealth>("MaxHealth"),
+
+			DefineProperty<&ACrab::GetJetTimeTotal, &ACrab::SetJetTimeTotal>("JetTimeTotal"),
+			DefineProperty<&ACrab::GetJetTimeLeft>("JetTimeLeft"),
+			DefineProperty<&ACrab::FirearmIsReady>("FirearmIsReady"),
+			DefineProperty<&ACrab::FirearmIsEmpty>("FirearmIsEmpty"),
+			DefineProperty<&ACrab::FirearmNeedsReload>("FirearmNeedsReload"),
+
+			DefineProperty<&AHuman::GetJetTimeTotal, &AHuman::SetJetTimeTotal>("JetTimeTotal"),
+			DefineProperty<&AHuman::GetJetTimeLeft, &AHuman::SetJetTimeLeft>("JetTimeLeft"),
+			DefineProperty<&AHuman::FirearmIsReady>("FirearmIsReady"),
+			DefineProperty<&AHuman::FirearmIsEmpty>("FirearmIsEmpty"),
+			DefineProperty<&AHuman::FirearmNeedsReload>("FirearmNeedsReload"),
+			DefineProperty<&AHuman::IsClimbing>("IsClimbing"),
+
+			DefineProperty<&HDFirearm::GetRateOfFire, &HDFirearm::SetRateOfFire>("RateOfFire"),
+			DefineProperty<&HDFirearm::IsFullAuto, &HDFirearm::SetFullAuto>("FullAuto"),
+			DefineProperty<&HDFirearm::GetRoundInMagCount>("RoundInMagCount"),
+			DefineProperty<&HDFirearm::GetRoundInMagCapacity>("RoundInMagCapacity"),
+			DefineProperty<&HDFirearm::GetReloadProgress>("ReloadProgress"),
+			DefineProperty<&HDFirearm::FiredFrame>("FiredFrame")
+		};
+		return propertyDefinitions;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const std::vector<LuaFastPathBindings::MethodDefinition> & LuaFastPathBindings::GetMethodDefinitions() {
+		static const std::vector<MethodDefinition> methodDefinitions = {
+			DefineMethod<&Vector::IsZero>("IsZero"),
+			DefineMethod<&Vector::Dot>("Dot"),
+			DefineMethod<&Vector::Cross>("Cross"),
+
+			DefineMethod<&MOSRotating::GetNumberValue>("GetNumberValue"),
+			DefineMethod<&MOSRotating::SetNumberValue>("SetNumberValue"),
+			DefineMethod<&MOSRotating::NumberValueExists>("NumberValueExists"),
+
+			DefineMethod<&Actor::IsPlayerControlled>("IsPlayerControlled"),
+			DefineMethod<&Actor::IsDead>("IsDead"),
+
+			DefineMethod<&HeldDevice::IsReloading>("IsReloading")
+		};
+		return methodDefinitions;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <auto GetterFunction, auto SetterFunction>
+	LuaFastPathBindings::PropertyDefinition LuaFastPathBindings::DefineProperty(const char *name) {
+		using GetterTraits = MemberFunctionTraits<decltype(GetterFunction)>;
+		static_assert(GetterTraits::IsConst && std::tuple_size_v<typename GetterTraits::Arguments> == 0, "Fast path property getters must be const and take no arguments!");
+
+		if constexpr (std::is_null_pointer_v<decltype(SetterFunction)>) {
+			return { name, &typeid(typename GetterTraits::Class), &GetProperty<GetterFunction>, nullptr, nullptr };
+		} else {
+			using SetterTraits = MemberFunctionTraits<decltype(SetterFunction)>;
+			static_assert(std::tuple_size_v<typename SetterTraits::Arguments> == 1, "Fast path property setters must take exactly one argument!");
+			return { name, &typeid(typename GetterTraits::Class), &GetProperty<GetterFunction>, &typeid(typename SetterTraits::Class), &SetProperty<SetterFunction> };
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <auto MethodFunction>
+	LuaFastPathBindings::MethodDefinition LuaFastPathBindings::DefineMethod(const char *name) {
+		using Traits = MemberFunctionTraits<decltype(MethodFunction)>;
+		constexpr size_t argumentCount = std::tuple_size_v<typename Traits::Arguments>;
+
+		MethodCaller caller = [](lua_State *luaState, void *object) { return CallMethod<MethodFunction>(luaState, object, std::make_index_sequence<argumentCount>()); };
+		return { name, &typeid(typename Traits::Class), caller, static_cast<int>(argumentCount), Traits::IsConst };
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LuaFastPathBindings::IndexHandler(lua_State *luaState) {
+		// The instance metatable is only ever set on LuaBind object_reps, so the object doesn't need validating here.
+		const object_rep *objectRep = static_cast<const object_rep *>(lua_touserdata(luaState, 1));
+		if (objectRep->ptr()) {
+			// LuaBind looks in the object's own table before anything else, so whatever a script stored on the object shadows the bound properties and methods of the same name.
+			const luabind::detail::lua_reference &instanceTable = objectRep->get_lua_table();
+			if (instanceTable.is_valid()) {
+				instanceTable.get(luaState);
+				lua_pushvalue(luaState, 2);
+				lua_gettable(luaState, -2);
+				if (!lua_isnil(luaState, -1)) {
+					return 1;
+				}
+				lua_settop(luaState, 2);
+			}
+			lua_pushlightuserdata(luaState, const_cast<class_rep *>(objectRep->crep()));
+			lua_rawget(luaState, lua_upvalueindex(ClassMembersUpvalue));
+			if (lua_istable(luaState, -1)) {
+				lua_pushvalue(luaState, 2);
+				lua_rawget(luaState, -2);
+				if (lua_type(luaState, -1) == LUA_TUSERDATA) {
+					const ResolvedProperty *resolvedProperty = static_cast<const ResolvedProperty *>(lua_touserdata(luaState, -1));
+					resolvedProperty->Getter(luaState, objectRep->ptr(resolvedProperty->GetterPointerOffset));
+					return 1;
+				}
+				if (lua_isfunction(luaState, -1)) {
+					return 1;
+				}
+			}
+			lua_settop(luaState, 2);
+		}
+		return class_rep::gettable_dispatcher(luaState);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LuaFastPathBindings::NewIndexHandler(lua_State *luaState) {
+		const object_rep *objectRep = static_cast<const object_rep *>(lua_touserdata(luaState, 1));
+		if (objectRep->ptr() && !(objectRep->flags() & object_rep::constant)) {
+			lua_pushlightuserdata(luaState, const_cast<class_rep *>(objectRep->crep()));
+			lua_rawget(luaState, lua_upvalueindex(ClassMembersUpvalue));
+			if (lua_istable(luaState, -1)) {
+				lua_pushvalue(luaState, 2);
+				lua_rawget(luaState, -2);
+				if (lua_type(luaState, -1) == LUA_TUSERDATA) {
+					const ResolvedProperty *resolvedProperty = static_cast<const ResolvedProperty *>(lua_touserdata(luaState, -1));
+					if (resolvedProperty->Setter && resolvedProperty->Setter(luaState, objectRep->ptr(resolvedProperty->SetterPointerOffset), 3)) {
+						return 0;
+					}
+				}
+			}
+			lua_settop(luaState, 3);
+		}
+		return class_rep::settable_dispatcher(luaState);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LuaFastPathBindings::MethodHandler(lua_State *luaState) {
+		const MethodDefinition *methodDefinition = static_cast<const MethodDefinition *>(lua_touserdata(luaState, lua_upvalueindex(MethodDefinitionUpvalue)));
+		const object_rep *objectRep = ToObjectRep(luaState, 1);
+
+		if (objectRep && objectRep->ptr() && objectRep->crep() == lua_touserdata(luaState, lua_upvalueindex(MethodClassUpvalue)) && lua_gettop(luaState) == methodDefinition->ArgumentCount + 1 && (methodDefinition->IsConst || !(objectRep->flags() & object_rep::constant))) {
+			int resultCount = methodDefinition->Caller(luaState, objectRep->ptr(static_cast<int>(lua_tointeger(luaState, lua_upvalueindex(MethodPointerOffsetUpvalue)))));
+			if (resultCount >= 0) {
+				return resultCount;
+			}
+		}
+		return CallOriginalFunction(luaState);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LuaFastPathBindings::OperatorHandler(lua_State *luaState) {
+		const Vector *leftVector = (lua_gettop(luaState) == 2) ? ToVector(luaState, 1) : nullptr;
+		if (leftVector) {
+			const Vector *rightVector = nullptr;
+			switch (lua_tointeger(luaState, lua_upvalueindex(OperatorIdUpvalue))) {
+				case luabind::detail::op_add:
+					if (rightVector = ToVector(luaState, 2); rightVector) {
+						PushValue<Vector>(luaState, *leftVector + *rightVector);
+						return 1;
+					}
+					break;
+				case luabind::detail::op_sub:
+					if (rightVector = ToVector(luaState, 2); rightVector) {
+						PushValue<Vector>(luaState, *leftVector - *rightVector);
+						return 1;
+					}
+					break;
+				case luabind::detail::op_mul:
+					if (lua_type(luaState, 2) == LUA_TNUMBER) {
+						PushValue<Vector>(luaState, *leftVector * static_cast<float>(lua_tonumber(luaState, 2)));
+						return 1;
+					}
+					break;
+				case luabind::detail::op_div:
+					if (lua_type(luaState, 2) == LUA_TNUMBER) {
+						PushValue<Vector>(luaState, *leftVector / static_cast<float>(lua_tonumber(luaState, 2)));
+						return 1;
+					}
+					break;
+				case luabind::detail::op_eq:
+					if (rightVector = ToVector(luaState, 2); rightVector) {
+						lua_pushboolean(luaState, *leftVector == *rightVector);
+						return 1;
+					}
+					break;
+				default:
+					break;
+			}
+		}
+		return CallOriginalFunction(luaState);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LuaFastPathBindings::CallOriginalFunction(lua_State *luaState) {
+		int argumentCount = lua_gettop(luaState);
+		lua_pushvalue(luaState, lua_upvalueindex(OriginalFunctionUpvalue));
+		lua_insert(luaState, 1);
+		lua_call(luaState, argumentCount, LUA_MULTRET);
+		return lua_gettop(luaState);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <auto GetterFunction>
+	void LuaFastPathBindings::GetProperty(lua_State *luaState, void *object) {
+		using Traits = MemberFunctionTraits<decltype(GetterFunction)>;
+		PushValue<typename Traits::Result>(luaState, (static_cast<typename Traits::Class *>(object)->*GetterFunction)());
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <auto SetterFunction>
+	bool LuaFastPathBindings::SetProperty(lua_State *luaState, void *object, int valueIndex) {
+		using Traits = MemberFunctionTraits<decltype(SetterFunction)>;
+		using ValueType = std::tuple_element_t<0, typename Traits::Arguments>;
+
+		if (!IsValueOfType<ValueType>(luaState, valueIndex)) {
+			return false;
+		}
+		(static_cast<typename Traits::Class *>(object)->*SetterFunction)(ToValue<ValueType>(luaState, valueIndex));
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <auto MethodFunction, size_t ... ArgumentIndices>
+	int LuaFastPathBindings::CallMethod(lua_State *luaState, void *object, std::index_sequence<ArgumentIndices ...>) {
+		using Traits = MemberFunctionTraits<decltype(MethodFunction)>;
+
+		// Arguments start after the object itself, which is at stack index 1.
+		if (!(IsValueOfType<std::tuple_element_t<ArgumentIndices, typename Traits::Arguments>>(luaState, ArgumentIndices + 2) && ...)) {
+			return -1;
+		}
+		typename Traits::Class *self = static_cast<typename Traits::Class *>(object);
+		if constexpr (std::is_void_v<typename Traits::Result>) {
+			(self->*MethodFunction)(ToValue<std::tuple_element_t<ArgumentIndices, typename Traits::Arguments>>(luaState, ArgumentIndices + 2) ...);
+			return 0;
+		} else {
+			PushValue<typename Traits::Result>(luaState, (self->*MethodFunction)(ToValue<std::tuple_element_t<ArgumentIndices, typename Traits::Arguments>>(luaState, ArgumentIndices + 2) ...));
+			return 1;
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <typename Type>
+	bool LuaFastPathBindings::IsValueOfType(lua_State *luaState, int index) {
+		using ValueType = std::decay_t<Type>;
+
+		// These mirror LuaBind's own argument matching, which doesn't do any implicit conversions between Lua types.
+		if constexpr (std::is_same_v<ValueType, bool>) {
+			return lua_type(luaState, index) == LUA_TBOOLEAN;
+		} else if constexpr (std::is_arithmetic_v<ValueType> || std::is_enum_v<ValueType>) {
+			return lua_type(luaState, index) == LUA_TNUMBER;
+		} else if constexpr (std::is_same_v<ValueType, std::string>) {
+			return lua_type(luaState, index) == LUA_TSTRING;
+		} else {
+			static_assert(std::is_same_v<ValueType, Vector> && !std::is_same_v<Type, Vector &>, "Unsupported fast path argument type!");
+			return ToVector(luaState, index) != nullptr;
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <typename Type>
+	Type LuaFastPathBindings::ToValue(lua_State *luaState, int index) {
+		using ValueType = std::decay_t<Type>;
+
+		if constexpr (std::is_same_v<ValueType, bool>) {
+			return lua_toboolean(luaState, index) != 0;
+		} else if constexpr (std::is_enum_v<ValueType>) {
+			return static_cast<ValueType>(static_cast<int>(lua_tonumber(luaState, index)));
+		} else if constexpr (std::is_arithmetic_v<ValueType>) {
+			return static_cast<ValueType>(lua_tonumber(luaState, index));
+		} else if constexpr (std::is_same_v<ValueType, std::string>) {
+			size_t length = 0;
+			const char *string = lua_tolstring(luaState, index, &length);
+			return std::string(string, length);
+		} else {
+			return *ToVector(luaState, index);
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <typename Type>
+	void LuaFastPathBindings::PushValue(lua_State *luaState, Type value) {
+		using ValueType = std::decay_t<Type>;
+
+		if constexpr (std::is_same_v<ValueType, bool>) {
+			lua_pushboolean(luaState, value);
+		} else if constexpr (std::is_arithmetic_v<ValueType> || std::is_enum_v<ValueType>) {
+			lua_pushnumber(luaState, static_cast<lua_Number>(value));
+		} else if constexpr (std::is_same_v<ValueType, std::string>) {
+			lua_pushlstring(luaState, value.data(), value.size());
+		} else if constexpr (std::is_same_v<Type, const Vector &>) {
+			// Same as LuaBind, const references are pushed as non-owning const objects so scripts keep seeing the live value.
+			void *userData = lua_newuserdata(luaState, sizeof(object_rep));
+			new (userData) object_rep(const_cast<Vector *>(&value), static_cast<class_rep *>(lua_touserdata(luaState, lua_upvalueindex(VectorClassUpvalue))), object_rep::constant, nullptr);
+			lua_pushvalue(luaState, lua_upvalueindex(InstanceMetatableUpvalue));
+			lua_setmetatable(luaState, -2);
+		} else {
+			static_assert(std::is_same_v<Type, Vector>, "Unsupported fast path result type!");
+			// LuaBind heap allocates every Vector returned by value. Construct it right after the object_rep in the same userdata instead, so it's freed along with it.
+			constexpr size_t vectorOffset = (sizeof(object_rep) + alignof(Vector) - 1) / alignof(Vector) * alignof(Vector);
+			char *userData = static_cast<char *>(lua_newuserdata(luaState, vectorOffset + sizeof(Vector)));
+			Vector *vector = new (userData + vectorOffset) Vector(value);
+			new (userData) object_rep(vector, static_cast<class_rep *>(lua_touserdata(luaState, lua_upvalueindex(VectorClassUpvalue))), object_rep::owner, &luabind::detail::destruct_only_s<Vector>::apply);
+			lua_pushvalue(luaState, lua_upvalueindex(InstanceMetatableUpvalue));
+			lua_setmetatable(luaState, -2);
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	object_rep * LuaFastPathBindings::ToObjectRep(lua_State *luaState, int index) {
+		if (lua_type(luaState, index) != LUA_TUSERDATA || !lua_getmetatable(luaState, index)) {
+			return nullptr;
+		}
+		bool isObjectRep = lua_rawequal(luaState, -1, lua_upvalueindex(InstanceMetatableUpvalue));
+		lua_pop(luaState, 1);
+		return isObjectRep ? static_cast<object_rep *>(lua_touserdata(luaState, index)) : nullptr;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const Vector * LuaFastPathBindings::ToVector(lua_State *luaState, int index) {
+		const object_rep *objectRep = ToObjectRep(luaState, index);
+		return (objectRep && objectRep->crep() == lua_touserdata(luaState, lua_upvalueindex(VectorClassUpvalue))) ? static_cast<const Vector *>(objectRep->ptr()) : nullptr;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool LuaFastPathBindings::GetBaseClassPointerOffset(const class_rep *classRep, const std::type_info *baseClass, int &pointerOffset) {
+		if (LUABIND_TYPE_INFO_EQUAL(classRep->type(), baseClass)) {
+			pointerOffset = 0;
+			return true;
+		}
+		for (const class_rep::base_info &baseInfo : classRep->bases()) {
+			if (GetBaseClassPointerOffset(baseInfo.base, baseClass, pointerOffset)) {
+				pointerOffset += baseInfo.pointer_offset;
+				return true;
+			}
+		}
+		return false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<class_rep *> LuaFastPathBindings::GetBoundClasses(lua_State *luaState) {
+		std::vector<class_rep *> boundClasses;
+
+		// LuaBind doesn't expose its class list, but all the classes are registered as globals with a metatable of their own.
+		luabind::detail::getref(luaState, luabind::detail::class_registry::get_registry(luaState)->cpp_class());
+		lua_pushnil(luaState);
+		while (lua_next(luaState, LUA_GLOBALSINDEX)) {
+			if (lua_type(luaState, -1) == LUA_TUSERDATA && lua_getmetatable(luaState, -1)) {
+				if (lua_rawequal(luaState, -1, -4)) {
+					class_rep *classRep = static_cast<class_rep *>(lua_touserdata(luaState, -2));
+					// Classes with held types store the holder rather than the object in their object_reps, so leave those to LuaBind.
+					if (classRep->get_class_type() == class_rep::cpp_class && !classRep->extractor()) { boundClasses.emplace_back(classRep); }
+				}
+				lua_pop(luaState, 1);
+			}
+			lua_pop(luaState, 1);
+		}
+		lua_pop(luaState, 1);
+		return boundClasses;
+	}
+}
@@ -0,0 +1,247 @@
+#ifndef _RTELUAFASTPATHBINDINGS_
+#define _RTELUAFASTPATHBINDINGS_
+
+#include "LuaBindDefinitions.h"
+
+namespace luabind::detail {
+	class class_rep;
+	class object_rep;
+}
+
+namespace RTE {
+
+	class Vector;
+
+	/// <summary>
+	/// Installs raw Lua C API handlers in front of LuaBind's instance metamethods for the hottest properties, methods and operators of the bound types.
+	/// LuaBind resolves every property access through a chain of table lookups and a string keyed map, and every method call through overload resolution. The handlers here skip all that for a fixed set of members with simple signatures.
+	/// Anything the fast path doesn't know, or can't handle exactly like LuaBind would (const objects, mismatched argument types, scripted overrides), is passed on to LuaBind unchanged, so scripts see no difference other than speed.
+	/// </summary>
+	class LuaFastPathBindings {
+
+	public:
+
+		/// <summary>
+		/// Installs the fast path handlers into a Lua state. Must be done after all the LuaBind bindings have been registered to the state.
+		/// </summary>
+		/// <param name="luaState">The Lua state to install the fast path handlers into.</param>
+		static void Register(lua_State *luaState);
+
+	private:
+
+		/// <summary>
+		/// Function pointer type for pushing the value of a property of an object onto the Lua stack.
+		/// </summary>
+		using PropertyGetter = void (*)(lua_State *luaState, void *object);
+
+		/// <summary>
+		/// Function pointer type for setting a property of an object from a value on the Lua stack. Returns false without touching the object if the value isn't of the expected type.
+		/// </summary>
+		using PropertySetter = bool (*)(lua_State *luaState, void *object, int valueIndex);
+
+		/// <summary>
+		/// Function pointer type for calling a method of an object with the arguments on the Lua stack. Returns the number of pushed results, or -1 without calling anything if the arguments aren't of the expected types.
+		/// </summary>
+		using MethodCaller = int (*)(lua_State *luaState, void *object);
+
+		/// <summary>
+		/// Static description of a property the fast path handles.
+		/// </summary>
+		struct PropertyDefinition {
+			const char *Name; //!< The name the property is bound to Lua with.
+			const std::type_info *GetterClass; //!< The class the getter is a member of.
+			PropertyGetter Getter; //!< The getter of the property.
+			const std::type_info *SetterClass; //!< The class the setter is a member of, or nullptr if the property is read-only.
+			PropertySetter Setter; //!< The setter of the property, or nullptr if the property is read-only.
+		};
+
+		/// <summary>
+		/// Static description of a method the fast path handles.
+		/// </summary>
+		struct MethodDefinition {
+			const char *Name; //!< The name the method is bound to Lua with.
+			const std::type_info *Class; //!< The class the method is a member of.
+			MethodCaller Caller; //!< The caller of the method.
+			int ArgumentCount; //!< The number of arguments the method takes, not counting the object itself.
+			bool IsConst; //!< Whether the method is const and can be called on const objects.
+		};
+
+		/// <summary>
+		/// A property as resolved for a specific bound class. Stored in Lua userdata in the per-class member tables.
+		/// </summary>
+		struct ResolvedProperty {
+			PropertyGetter Getter; //!< The getter of the property.
+			PropertySetter Setter; //!< The setter of the property, or nullptr if the property is read-only.
+			int GetterPointerOffset; //!< The offset to add to the object pointer to get a pointer to the getter's class.
+			int SetterPointerOffset; //!< The offset to add to the object pointer to get a pointer to the setter's class.
+		};
+
+		/// <summary>
+		/// Enumeration for the upvalues of the fast path handlers. The first two are shared by all handlers, the rest depend on the kind of handler.
+		/// </summary>
+		enum HandlerUpvalue {
+			InstanceMetatableUpvalue = 1,
+			VectorClassUpvalue,
+			ClassMembersUpvalue,
+			OriginalFunctionUpvalue = ClassMembersUpvalue,
+			MethodDefinitionUpvalue,
+			MethodClassUpvalue,
+			MethodPointerOffsetUpvalue,
+			OperatorIdUpvalue = MethodDefinitionUpvalue
+		};
+
+		/// <summary>
+		/// Deduces the class, result and argument types of a member function pointer type.
+		/// </summary>
+		template <typename MemberFunctionType> struct MemberFunctionTraits;
+
+#pragma region Definitions
+		/// <summary>
+		/// Gets the properties the fast path handles, ordered so that overriding definitions in derived classes come after the ones they override.
+		/// </summary>
+		/// <returns>The properties the fast path handles.</returns>
+		static const std::vector<PropertyDefinition> & GetPropertyDefinitions();
+
+		/// <summary>
+		/// Gets the methods the fast path handles, ordered so that overriding definitions in derived classes come after the ones they override.
+		/// </summary>
+		/// <returns>The methods the fast path handles.</returns>
+		static const std::vector<MethodDefinition> & GetMethodDefinitions();
+
+		/// <summary>
+		/// Makes a PropertyDefinition out of a getter and an optional setter member function.
+		/// </summary>
+		/// <param name="name">The name the property is bound to Lua with.</param>
+		/// <returns>The PropertyDefinition for the property.</returns>
+		template <auto GetterFunction, auto SetterFunction = nullptr> static PropertyDefinition DefineProperty(const char *name);
+
+		/// <summary>
+		/// Makes a MethodDefinition out of a member function.
+		/// </summary>
+		/// <param name="name">The name the method is bound to Lua with.</param>
+		/// <returns>The MethodDefinition for the method.</returns>
+		template <auto MethodFunction> static MethodDefinition DefineMethod(const char *name);
+#pragma endregion
+
+#pragma region Handlers
+		/// <summary>
+		/// Replacement for LuaBind's instance __index metamethod. Serves values stored in the object's own table first, same as LuaBind, then known properties and methods directly, and passes everything else on to LuaBind.
+		/// </summary>
+		/// <param name="luaState">The Lua state the metamethod is called in.</param>
+		/// <returns>The number of results pushed onto the Lua stack.</returns>
+		static int IndexHandler(lua_State *luaState);
+
+		/// <summary>
+		/// Replacement for LuaBind's instance __newindex metamethod. Sets known properties directly and passes everything else on to LuaBind.
+		/// </summary>
+		/// <param name="luaState">The Lua state the metamethod is called in.</param>
+		/// <returns>The number of results pushed onto the Lua stack.</returns>
+		static int NewIndexHandler(lua_State *luaState);
+
+		/// <summary>
+		/// Replacement for the LuaBind function of a method. Calls the method directly if the object and arguments match its definition, and calls the original function otherwise.
+		/// </summary>
+		/// <param name="luaState">The Lua state the method is called in.</param>
+		/// <returns>The number of results pushed onto the Lua stack.</returns>
+		static int MethodHandler(lua_State *luaState);
+
+		/// <summary>
+		/// Replacement for LuaBind's arithmetic and comparison instance metamethods. Handles Vector operands directly and calls the original metamethod otherwise.
+		/// </summary>
+		/// <param name="luaState">The Lua state the metamethod is called in.</param>
+		/// <returns>The number of results pushed onto the Lua stack.</returns>
+		static int OperatorHandler(lua_State *luaState);
+
+		/// <summary>
+		/// Calls the original LuaBind function stored in the OriginalFunctionUpvalue of the running handler with all the arguments the handler was called with.
+		/// </summary>
+		/// <param name="luaState">The Lua state the handler is called in.</param>
+		/// <returns>The number of results pushed onto the Lua stack.</returns>
+		static int CallOriginalFunction(lua_State *luaState);
+#pragma endregion
+
+#pragma region Member Function Adapters
+		/// <summary>
+		/// Pushes the value returned by a getter member function onto the Lua stack.
+		/// </summary>
+		/// <param name="luaState">The Lua state to push the value onto.</param>
+		/// <param name="object">Pointer to the object to call the getter on, already adjusted to the getter's class.</param>
+		template <auto GetterFunction> static void GetProperty(lua_State *luaState, void *object);
+
+		/// <summary>
+		/// Calls a setter member function with a value from the Lua stack, if the value is of the expected type.
+		/// </summary>
+		/// <param name="luaState">The Lua state the value is on.</param>
+		/// <param name="object">Pointer to the object to call the setter on, already adjusted to the setter's class.</param>
+		/// <param name="valueIndex">The stack index of the value.</param>
+		/// <returns>Whether the setter was called.</returns>
+		template <auto SetterFunction> static bool SetProperty(lua_State *luaState, void *object, int valueIndex);
+
+		/// <summary>
+		/// Calls a member function with the arguments on the Lua stack, if all of them are of the expected types, and pushes its result.
+		/// </summary>
+		/// <param name="luaState">The Lua state the arguments are on.</param>
+		/// <param name="object">Pointer to the object to call the method on, already adjusted to the method's class.</param>
+		/// <returns>The number of pushed results, or -1 if the method wasn't called.</returns>
+		template <auto MethodFunction, size_t ... ArgumentIndices> static int CallMethod(lua_State *luaState, void *object, std::index_sequence<ArgumentIndices ...>);
+#pragma endregion
+
+#pragma region Value Conversion
+		/// <summary>
+		/// Checks whether a value on the Lua stack can be converted to a C++ type the same way LuaBind would.
+		/// </summary>
+		/// <param name="luaState">The Lua state the value is on.</param>
+		/// <param name="index">The stack index of the value.</param>
+		/// <returns>Whether the value can be converted.</returns>
+		template <typename Type> static bool IsValueOfType(lua_State *luaState, int index);
+
+		/// <summary>
+		/// Converts a value on the Lua stack to a C++ type. IsValueOfType must have been checked beforehand.
+		/// </summary>
+		/// <param name="luaState">The Lua state the value is on.</param>
+		/// <param name="index">The stack index of the value.</param>
+		/// <returns>The converted value.</returns>
+		template <typename Type> static Type ToValue(lua_State *luaState, int index);
+
+		/// <summary>
+		/// Pushes a C++ value onto the Lua stack the same way LuaBind would. Const Vector references are pushed as const references to the original Vector, Vectors returned by value are constructed directly inside the Lua userdata.
+		/// </summary>
+		/// <param name="luaState">The Lua state to push the value onto.</param>
+		/// <param name="value">The value to push.</param>
+		template <typename Type> static void PushValue(lua_State *luaState, Type value);
+
+		/// <summary>
+		/// Gets the LuaBind object_rep of a value on the Lua stack, if it's an instance of a bound C++ class.
+		/// </summary>
+		/// <param name="luaState">The Lua state the value is on. Must be called from inside a fast path handler.</param>
+		/// <param name="index">The stack index of the value.</param>
+		/// <returns>The object_rep of the value, or nullptr if it's not an instance of a bound C++ class.</returns>
+		static luabind::detail::object_rep * ToObjectRep(lua_State *luaState, int index);
+
+		/// <summary>
+		/// Gets the Vector a value on the Lua stack holds, if it's a Vector.
+		/// </summary>
+		/// <param name="luaState">The Lua state the value is on. Must be called from inside a fast path handler.</param>
+		/// <param name="index">The stack index of the value.</param>
+		/// <returns>The Vector the value holds, or nullptr if it's not a Vector.</returns>
+		static const Vector * ToVector(lua_State *luaState, int index);
+#pragma endregion
+
+		/// <summary>
+		/// Gets the offset to add to a pointer to an instance of a bound class to get a pointer to one of its base classes.
+		/// </summary>
+		/// <param name="classRep">The bound class.</param>
+		/// <param name="baseClass">The base class to get the offset to.</param>
+		/// <param name="pointerOffset">Set to the offset, if the base class was found.</param>
+		/// <returns>Whether the base class is the bound class or one of its bases.</returns>
+		static bool GetBaseClassPointerOffset(const luabind::detail::class_rep *classRep, const std::type_info *baseClass, int &pointerOffset);
+
+		/// <summary>
+		/// Gets all the C++ classes bound to a Lua state that the fast path can handle instances of.
+		/// </summary>
+		/// <param name="luaState">The Lua state to get the bound classes of.</param>
+		/// <returns>The bound classes.</returns>
+		static std::vector<luabind::detail::class_rep *> GetBoundClasses(lua_State *luaState);
+	};
+}
+#endif
@@ -34,6 +34,8 @@
 #include "PresetMan.h"
 #include "UInputMan.h"
 #include "PerformanceMan.h"
+#include "ThreadMan.h"
+#include "Profiler.h"
 #include "MetaMan.h"
 #include "NetworkServer.h"
 #include "Scene.h"
@@ -56,6 +58,7 @@ namespace RTE {
 
 	void InitializeManagers() {
 		g_SettingsMan.Initialize();
+		g_ThreadMan.Initialize();
 
 		g_LuaMan.Initialize();
 		//g_NetworkServer.Initialize();
@@ -102,6 +105,7 @@ namespace RTE {
 		g_LuaMan.Destroy();
 		ContentFile::FreeAllLoaded();
 		g_ConsoleMan.Destroy();
+		g_ThreadMan.Destroy();
 
 #ifdef DEBUG_BUILD
 		Entity::ClassInfo::DumpPoolMemoryInfo(Writer("MemCleanupInfo.txt"));
@@ -131,6 +135,10 @@ namespace RTE {
 
 			if (currentArg == "-cout") { System::EnableLoggingToCLI(); }
 
+			if (!lastArg && currentArg == "-record") { g_UInputMan.GetInputReplay().SetToRecord(argValue[++i]); }
+
+			if (!lastArg && currentArg == "-profile") { Profiler::StartCapture(argValue[++i]); }
+
 			if (!lastArg && !singleModuleSet && currentArg == "-module") {
 				std::string moduleToLoad = argValue[++i];
 				if (moduleToLoad.find(System::GetModulePackageExtension()) == moduleToLoad.length() - System::GetModulePackageExtension().length()) {
@@ -146,6 +154,9 @@ namespace RTE {
 				} else if (!lastArg && currentArg == "-editor") {
 					g_ActivityMan.SetEditorToLaunch(argValue[++i]);
 					launchModeSet = true;
+				} else if (!lastArg && currentArg == "-replay") {
+					g_UInputMan.GetInputReplay().SetToPlayBack(argValue[++i]);
+					launchModeSet = true;
 				}
 			}
 			++i;
@@ -182,6 +193,7 @@ namespace RTE {
 			*/
 			g_ConsoleMan.Update();
 
+			DrawRNGScope drawRNGScope;
 			//g_MenuMan.Draw();
 			g_ConsoleMan.Draw(g_FrameMan.GetBackBuffer32());
 			g_FrameMan.FlipFrameBuffers();
@@ -220,24 +232,29 @@ namespace RTE {
 
 				g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::SimTotal);
 
-				g_UInputMan.Update();
+				{
+					ProfileZone profileZone("Sim Update");
+					g_UInputMan.Update();
+
+					// It is vital that server is updated after input manager but before activity because input manager will clear received pressed and released events on next update.
+					//if (g_NetworkServer.IsServerModeEnabled()) {
+					//	g_NetworkServer.Update(true);
+					//	serverUpdated = true;
+					//}
+					g_FrameMan.Update();
+					g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::ActivityUpdate);
+					g_ActivityMan.Update();
+					g_PerformanceMan.StopPerformanceMeasurement(PerformanceMan::ActivityUpdate);
+					g_MovableMan.Update();
+					g_AudioMan.Update();
 
-				// It is vital that server is updated after input manager but before activity because input manager will clear received pressed and released events on next update.
-				//if (g_NetworkServer.IsServerModeEnabled()) {
-				//	g_NetworkServer.Update(true);
-				//	serverUpdated = true;
-				//}
-				g_FrameMan.Update();
-				g_LuaMan.Update();
-				g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::ActivityUpdate);
-				g_ActivityMan.Update();
-				g_PerformanceMan.StopPerformanceMeasurement(PerformanceMan::ActivityUpdate);
-				g_MovableMan.Update();
-				g_AudioMan.Update();
+					g_ActivityMan.LateUpdateGlobalScripts();
 
-				g_ActivityMan.LateUpdateGlobalScripts();
+					g_ConsoleMan.Update();
 
-				g_ConsoleMan.Update();
+					// Lua garbage collection goes last so it can be sized to whatever time is left in the sim update.
+					g_LuaMan.Update();
+				}
 				g_PerformanceMan.StopPerformanceMeasurement(PerformanceMan::SimTotal);
 
 				if (!g_ActivityMan.IsInActivity()) {
@@ -281,8 +298,12 @@ namespace RTE {
 				}
 			}
 			*/
-			g_FrameMan.Draw();
-			g_FrameMan.FlipFrameBuffers();
+			// Playback is only about how long the sim takes, so drawing would just get in the way of the measurements.
+			if (!g_UInputMan.GetInputReplay().IsPlayingBack()) {
+				DrawRNGScope drawRNGScope;
+				g_FrameMan.Draw();
+				g_FrameMan.FlipFrameBuffers();
+			}
 		}
 	}
 }
@@ -302,6 +323,7 @@ int main(int argc, char **argv) {
 
 	System::Initialize();
 	SeedRNG();
+	Profiler::SetThreadName("Main");
 
 	InitializeManagers();
 
@@ -348,6 +370,7 @@ int main(int argc, char **argv) {
 	
 	RunGameLoop();
 
+	if (Profiler::IsCapturing()) { Profiler::StopCapture(); }
 	DestroyManagers();
 	return 0;
 }
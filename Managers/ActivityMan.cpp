@@ -8,6 +8,7 @@
 #include "FrameMan.h"
 #include "PostProcessMan.h"
 #include "MetaMan.h"
+#include "LuaMan.h"
 
 #include "GAScripted.h"
 
@@ -34,6 +35,7 @@ namespace RTE {
 		m_InActivity = false;
 		m_ActivityNeedsRestart = false;
 		m_ActivityNeedsResume = false;
+		m_QuickSave = nullptr;
 		m_LastMusicPath.clear();
 		m_LastMusicPos = 0.0F;
 		m_LaunchIntoActivity = false;
@@ -48,6 +50,8 @@ namespace RTE {
 		} else if (IsSetToLaunchIntoEditor()) {
 			// Evaluate LaunchIntoEditor before LaunchIntoActivity so it takes priority when both are set, otherwise it is ignored and editor is never launched.
 			return SetStartEditorActivitySetToLaunchInto();
+		} else if (g_UInputMan.GetInputReplay().IsSetToPlayBack()) {
+			return g_UInputMan.GetInputReplay().StartPlayback();
 		} else if (IsSetToLaunchIntoActivity()) {
 			m_ActivityNeedsRestart = true;
 			return true;
@@ -165,6 +169,10 @@ namespace RTE {
 
 		m_StartActivity.reset(activity);
 		m_Activity.reset(dynamic_cast<Activity *>(m_StartActivity->Clone()));
+		m_QuickSave = nullptr;
+
+		// Recording and playback have to seed the RNG before anything in the new Activity uses it.
+		g_UInputMan.GetInputReplay().ActivityStarting(*m_StartActivity);
 
 		m_Activity->SetupPlayers();
 		int error = m_Activity->Start();
@@ -186,6 +194,9 @@ namespace RTE {
 		g_PostProcessMan.ClearScenePostEffects();
 		g_FrameMan.ClearScreenText();
 
+		// The previous Activity's scripts and objects are gone now, so this is the least disruptive time for a full collection, and for handing garbage collection over to the paced steps.
+		g_LuaMan.StartPacedGarbageCollection();
+
 		// Reset the mouse input to the center
 		g_UInputMan.SetMouseValueMagnitude(0.05F);
 
@@ -305,6 +316,43 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ActivityMan::QuickSave() {
+		if (SimulationSnapshot::IsRestoreBlockedByScripts()) {
+			g_ConsoleMan.PrintString("ERROR: Quick saving isn't supported in scripted Activities, their scripts can't be rewound!");
+			return;
+		}
+		std::unique_ptr<SimulationSnapshot> quickSave = std::make_unique<SimulationSnapshot>();
+		// Unchanged terrain tiles are shared with the previous quick save, so only the ones that changed since then have to be compressed.
+		if (!m_Activity || !quickSave->Capture(m_QuickSave.get())) {
+			g_ConsoleMan.PrintString("ERROR: No Activity to quick save!");
+			return;
+		}
+		char message[256];
+		std::snprintf(message, sizeof(message), "SYSTEM: Quick saved %i objects and %.1f KB of terrain in %.2f ms (%i terrain tiles unchanged)", quickSave->GetMOCount(), static_cast<float>(quickSave->GetTerrainSize()) / 1024.0F, quickSave->GetCaptureTime(), quickSave->GetSharedTileCount());
+		g_ConsoleMan.PrintString(message);
+		m_QuickSave = std::move(quickSave);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ActivityMan::QuickLoad() {
+		if (g_UInputMan.GetInputReplay().IsActive()) {
+			g_ConsoleMan.PrintString("ERROR: Quick loading isn't supported while recording or playing back input, it would make the playback differ from the recording!");
+			return;
+		}
+		if (SimulationSnapshot::IsRestoreBlockedByScripts()) {
+			g_ConsoleMan.PrintString("ERROR: Quick loading isn't supported in scripted Activities, their scripts can't be rewound!");
+			return;
+		}
+		if (!m_QuickSave || !m_QuickSave->Restore()) {
+			g_ConsoleMan.PrintString("ERROR: No quick save of the current Activity to load!");
+			return;
+		}
+		g_ConsoleMan.PrintString("SYSTEM: Quick save loaded");
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void ActivityMan::LateUpdateGlobalScripts() const {
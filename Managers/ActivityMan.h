@@ -3,6 +3,7 @@
 
 #include "Singleton.h"
 #include "Activity.h"
+#include "SimulationSnapshot.h"
 
 #define g_ActivityMan ActivityMan::Instance()
 
@@ -223,6 +224,17 @@ namespace RTE {
 		/// </summary>
 		void EndActivity() const;
 
+		/// <summary>
+		/// Captures the state of the current Activity into the quick save, replacing the previous one. The quick save only lasts until another Activity is started.
+		/// This isn't bound to any input, because the state of Activity and global scripts can't be captured, so it can't be used in scripted Activities.
+		/// </summary>
+		void QuickSave();
+
+		/// <summary>
+		/// Puts the quick save of the current Activity back into effect, if there is one.
+		/// </summary>
+		void QuickLoad();
+
 		/// <summary>
 		/// Only updates Global Scripts of the current activity with LateUpdate flag enabled.
 		/// </summary>
@@ -246,6 +258,8 @@ namespace RTE {
 		bool m_ActivityNeedsRestart; //!< Whether the current Activity needs to be restarted.
 		bool m_ActivityNeedsResume; //!< Whether the game simulation needs to be started back up after the current Activity was unpaused.
 
+		std::unique_ptr<SimulationSnapshot> m_QuickSave; //!< The snapshot of the current Activity that was last quick saved.
+
 		std::string m_LastMusicPath; //!< Path to the last music stream being played.
 		float m_LastMusicPos; //!< What the last position of the in-game music track was before pause, in seconds.
 
@@ -26,6 +26,16 @@ namespace RTE {
 
 		m_SoundPanningEffectStrength = 0.5F;
 
+		m_UseNoSoundOutput = false;
+		m_SoundVoiceBudget = 96;
+		m_SoundCoalescingWindow = 50;
+		m_SoundCoalescingRadius = 50.0F;
+		m_SoundVoices.clear();
+		m_3DEffectsUpdateCount = 0;
+		m_SoundVoiceStatsTimer.Reset();
+		m_SoundVoiceStats.fill(0);
+		m_SoundVoiceStatsLastSecond.fill(0);
+
 		//////////////////////////////////////////////////
 		//TODO These need to be removed when our soundscape is sorted out. They're only here temporarily to allow for easier tweaking by pawnis.
 		m_ListenerZOffset = 400;
@@ -57,6 +67,7 @@ namespace RTE {
 		audioSystemAdvancedSettings.randomSeed = RandomNum(0, INT_MAX);
 
 		audioSystemSetupResult = (audioSystemSetupResult == FMOD_OK) ? m_AudioSystem->setAdvancedSettings(&audioSystemAdvancedSettings) : audioSystemSetupResult;
+		if (m_UseNoSoundOutput) { audioSystemSetupResult = (audioSystemSetupResult == FMOD_OK) ? m_AudioSystem->setOutput(FMOD_OUTPUTTYPE_NOSOUND) : audioSystemSetupResult; }
 		audioSystemSetupResult = (audioSystemSetupResult == FMOD_OK) ? m_AudioSystem->set3DSettings(1, c_PPM, 1) : audioSystemSetupResult;
 		audioSystemSetupResult = (audioSystemSetupResult == FMOD_OK) ? m_AudioSystem->setSoftwareChannels(c_MaxSoftwareChannels) : audioSystemSetupResult;
 		audioSystemSetupResult = (audioSystemSetupResult == FMOD_OK) ? m_AudioSystem->init(c_MaxVirtualChannels, FMOD_INIT_VOL0_BECOMES_VIRTUAL, 0) : audioSystemSetupResult;
@@ -145,6 +156,12 @@ namespace RTE {
 
 			status = status == FMOD_OK ? m_AudioSystem->update() : status;
 
+			if (m_SoundVoiceStatsTimer.IsPastRealMS(1000)) {
+				m_SoundVoiceStatsLastSecond = m_SoundVoiceStats;
+				m_SoundVoiceStats.fill(0);
+				m_SoundVoiceStatsTimer.Reset();
+			}
+
 			if (!IsMusicPlaying() && m_SilenceTimer.IsPastRealTimeLimit()) { PlayNextStream(); }
 			if (status != FMOD_OK) { g_ConsoleMan.PrintString("ERROR: Could not update AudioMan due to FMOD error: " + std::string(FMOD_ErrorString(status))); }
 		}
@@ -525,15 +542,39 @@ namespace RTE {
 			g_ConsoleMan.PrintString("Unable to select new sounds to play for SoundContainer " + soundContainer->GetPresetName());
 			return false;
 		}
+		// In multiplayer the clients' listeners are elsewhere, so they need to get the event even if the sound is culled or merged here.
+		if (m_IsInMultiplayerMode) { RegisterSoundEvent(player, SOUND_PLAY, soundContainer); }
+
+		// Only one-shot mobile sounds are culled or merged, since looping and immobile (i.e. GUI) sounds are expected to keep playing until they're stopped.
+		bool cullable = !soundContainer->IsImmobile() && soundContainer->GetLoopSetting() == 0;
+		float audibility = soundContainer->IsImmobile() ? soundContainer->GetVolume() : EstimateSoundAudibility(soundContainer->GetPosition(), soundContainer->GetAttenuationStartDistance(), soundContainer->GetVolume());
+		if (cullable && audibility == 0.0F) {
+			m_SoundVoiceStats.at(VoicesCulled)++;
+			return false;
+		}
+
 		FMOD::ChannelGroup *channelGroupToPlayIn = soundContainer->IsImmobile() ? m_ImmobileSoundChannelGroup : m_MobileSoundChannelGroup;
 		FMOD::Channel *channel;
 		int channelIndex;
 		std::vector<const SoundSet::SoundData *> selectedSoundData;
 		soundContainer->GetTopLevelSoundSet().GetFlattenedSoundData(selectedSoundData, true);
 		float pitchVariationFactor = 1.0F + std::abs(soundContainer->GetPitchVariation());
+		bool anySoundHandled = false;
 		for (const SoundSet::SoundData *soundData : selectedSoundData) {
+			Vector soundPosition = soundContainer->GetPosition() + soundData->Offset;
+			if (cullable && MergeIntoPlayingVoice(soundData->SoundObject, soundPosition)) {
+				m_SoundVoiceStats.at(VoicesMerged)++;
+				anySoundHandled = true;
+				continue;
+			}
+			if (!MakeRoomForVoice(soundContainer->GetPriority(), audibility, cullable)) {
+				m_SoundVoiceStats.at(VoicesCulled)++;
+				continue;
+			}
+
 			result = (result == FMOD_OK) ? m_AudioSystem->playSound(soundData->SoundObject, channelGroupToPlayIn, true, &channel) : result;
 			result = (result == FMOD_OK) ? channel->getIndex(&channelIndex) : result;
+			if (result == FMOD_OK) { m_SoundVoices.insert_or_assign(channelIndex, SoundVoice{ soundData->SoundObject, soundPosition, g_TimerMan.GetAbsoluteTime(), soundContainer->GetPriority(), audibility, 1, cullable }); }
 
 			result = (result == FMOD_OK) ? channel->setUserData(soundContainer) : result;
 			result = (result == FMOD_OK) ? channel->setCallback(SoundChannelEndedCallback) : result;
@@ -547,7 +588,7 @@ namespace RTE {
 				m_SoundChannelMinimumAudibleDistances.insert({ channelIndex, soundData->MinimumAudibleDistance });
 				result = (result == FMOD_OK) ? channel->set3DLevel(m_SoundPanningEffectStrength) : result;
 
-				FMOD_VECTOR soundContainerPosition = GetAsFMODVector(soundContainer->GetPosition() + soundData->Offset);
+				FMOD_VECTOR soundContainerPosition = GetAsFMODVector(soundPosition);
 				UpdatePositionalEffectsForSoundChannel(channel, &soundContainerPosition);
 			}
 
@@ -563,10 +604,10 @@ namespace RTE {
 			}
 
 			soundContainer->AddPlayingChannel(channelIndex);
+			m_SoundVoiceStats.at(VoicesStarted)++;
+			anySoundHandled = true;
 		}
-
-		if (m_IsInMultiplayerMode) { RegisterSoundEvent(player, SOUND_PLAY, soundContainer); }
-		return true;
+		return anySoundHandled;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -714,13 +755,23 @@ namespace RTE {
 
 		for (int i = 0; i < numberOfPlayingChannels; i++) {
 			result = m_MobileSoundChannelGroup->getChannel(i, &soundChannel);
+
+			// Distant voices are barely audible and don't need precise panning, so their positional effects are only updated every few updates, spread out by channel index.
+			int channelIndex;
+			result = result == FMOD_OK ? soundChannel->getIndex(&channelIndex) : result;
+			std::unordered_map<int, SoundVoice>::const_iterator voiceEntry = (result == FMOD_OK) ? m_SoundVoices.find(channelIndex) : m_SoundVoices.end();
+			bool isDistantVoice = voiceEntry != m_SoundVoices.end() && voiceEntry->second.Audibility < c_DistantVoiceAudibility;
+			if (isDistantVoice && (m_3DEffectsUpdateCount + channelIndex) % c_DistantVoiceUpdateInterval != 0) {
+				continue;
+			}
+
 			FMOD_VECTOR channelPosition;
 			result = result == FMOD_OK ? soundChannel->get3DAttributes(&channelPosition, nullptr) : result;
 			result = result == FMOD_OK ? UpdatePositionalEffectsForSoundChannel(soundChannel, &channelPosition) : result;
 
 			float channel3dLevel;
-			result = (result == FMOD_OK) ? soundChannel->get3DLevel(&channel3dLevel) : result;
-			if (result == FMOD_OK && m_CurrentActivityHumanPlayerPositions.size() == 1) {
+			result = (result == FMOD_OK && !isDistantVoice) ? soundChannel->get3DLevel(&channel3dLevel) : result;
+			if (result == FMOD_OK && !isDistantVoice && m_CurrentActivityHumanPlayerPositions.size() == 1) {
 				float distanceToPlayer = (*(m_CurrentActivityHumanPlayerPositions.at(0).get()) - GetAsVector(channelPosition)).GetMagnitude();
 				if (distanceToPlayer < m_MinimumDistanceForPanning) {
 					soundChannel->set3DLevel(0);
@@ -736,11 +787,12 @@ namespace RTE {
 				continue;
 			}
 		}
+		m_3DEffectsUpdateCount++;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	FMOD_RESULT AudioMan::UpdatePositionalEffectsForSoundChannel(FMOD::Channel *soundChannel, const FMOD_VECTOR *positionOverride) const {
+	FMOD_RESULT AudioMan::UpdatePositionalEffectsForSoundChannel(FMOD::Channel *soundChannel, const FMOD_VECTOR *positionOverride) {
 		FMOD_RESULT result = FMOD_OK;
 		bool sceneWraps = g_SceneMan.SceneWrapsX();
 
@@ -801,9 +853,16 @@ namespace RTE {
 		result = result == FMOD_OK ? soundChannel->getUserData(&userData) : result;
 		float panLevel;
 		result = result == FMOD_OK ? soundChannel->get3DLevel(&panLevel) : result;
-		if (result == FMOD_OK && (panLevel < 1.0F || attenuatedVolume == 0.0F)) {
+		std::unordered_map<int, SoundVoice>::iterator voiceEntry = (result == FMOD_OK) ? m_SoundVoices.find(soundChannelIndex) : m_SoundVoices.end();
+		float voiceGain = 1.0F;
+		if (voiceEntry != m_SoundVoices.end()) {
+			voiceGain = std::min(std::sqrt(static_cast<float>(voiceEntry->second.MergedCount)), c_MaxCoalescedVoiceGain);
+			voiceEntry->second.Audibility = attenuatedVolume * static_cast<SoundContainer *>(userData)->GetVolume();
+		}
+		if (result == FMOD_OK) {
 			const SoundContainer *channelSoundContainer = static_cast<SoundContainer *>(userData);
-			result = soundChannel->setVolume(attenuatedVolume * channelSoundContainer->GetVolume());
+			// Fully panned sounds that can be heard are attenuated by FMOD itself, so only the volume and the gain from merged plays are set on them.
+			result = soundChannel->setVolume(((panLevel < 1.0F || attenuatedVolume == 0.0F) ? attenuatedVolume : 1.0F) * channelSoundContainer->GetVolume() * voiceGain);
 		}
 
 		result = (result == FMOD_OK && (sceneWraps || positionOverride)) ? soundChannel->set3DAttributes(&channelPosition, nullptr) : result;
@@ -811,6 +870,76 @@ namespace RTE {
 		return result;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	float AudioMan::EstimateSoundAudibility(const Vector &position, float attenuationStartDistance, float volume) const {
+		if (m_CurrentActivityHumanPlayerPositions.empty()) {
+			return volume;
+		}
+		float shortestDistance = c_SoundMaxAudibleDistance;
+		for (const std::unique_ptr<const Vector> &humanPlayerPosition : m_CurrentActivityHumanPlayerPositions) {
+			shortestDistance = std::min(shortestDistance, g_SceneMan.ShortestDistance(*humanPlayerPosition, position).GetMagnitude());
+		}
+		if (shortestDistance >= static_cast<float>(c_SoundMaxAudibleDistance)) {
+			return 0.0F;
+		}
+		return (shortestDistance <= attenuationStartDistance) ? volume : volume * attenuationStartDistance / shortestDistance;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool AudioMan::MergeIntoPlayingVoice(FMOD::Sound *sound, const Vector &position) {
+		long long coalescingStartTime = g_TimerMan.GetAbsoluteTime() - static_cast<long long>(m_SoundCoalescingWindow) * 1000;
+
+		for (std::pair<const int, SoundVoice> &voiceEntry : m_SoundVoices) {
+			SoundVoice &voice = voiceEntry.second;
+			if (voice.Cullable && voice.Sound == sound && voice.StartTime >= coalescingStartTime && g_SceneMan.ShortestDistance(voice.Position, position).GetMagnitude() <= m_SoundCoalescingRadius) {
+				FMOD::Channel *voiceChannel;
+				if (m_AudioSystem->getChannel(voiceEntry.first, &voiceChannel) != FMOD_OK) {
+					return false;
+				}
+				// Pass the channel's current position on, since it's only read back from the channel for wrapping Scenes.
+				FMOD_VECTOR voiceChannelPosition;
+				if (voiceChannel->get3DAttributes(&voiceChannelPosition, nullptr) != FMOD_OK) {
+					return false;
+				}
+				voice.MergedCount++;
+				UpdatePositionalEffectsForSoundChannel(voiceChannel, &voiceChannelPosition);
+				return true;
+			}
+		}
+		return false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool AudioMan::MakeRoomForVoice(int priority, float audibility, bool cullable) {
+		if (static_cast<int>(m_SoundVoices.size()) < m_SoundVoiceBudget) {
+			return true;
+		}
+		// Find the least important cullable voice, i.e. the one with the highest priority value, and the lowest audibility among those.
+		std::unordered_map<int, SoundVoice>::const_iterator leastImportantVoice = m_SoundVoices.end();
+		for (std::unordered_map<int, SoundVoice>::const_iterator voiceEntry = m_SoundVoices.begin(); voiceEntry != m_SoundVoices.end(); ++voiceEntry) {
+			if (voiceEntry->second.Cullable && (leastImportantVoice == m_SoundVoices.end() || voiceEntry->second.Priority > leastImportantVoice->second.Priority || (voiceEntry->second.Priority == leastImportantVoice->second.Priority && voiceEntry->second.Audibility < leastImportantVoice->second.Audibility))) {
+				leastImportantVoice = voiceEntry;
+			}
+		}
+		if (leastImportantVoice == m_SoundVoices.end()) {
+			return !cullable;
+		}
+		if (cullable && (priority > leastImportantVoice->second.Priority || (priority == leastImportantVoice->second.Priority && audibility <= leastImportantVoice->second.Audibility))) {
+			return false;
+		}
+
+		int channelIndex = leastImportantVoice->first;
+		FMOD::Channel *channel;
+		if (m_AudioSystem->getChannel(channelIndex, &channel) == FMOD_OK) { channel->stop(); }
+		// Stopping the channel normally removes the voice through SoundChannelEndedCallback, but make sure it's gone in case the channel was already invalid.
+		m_SoundVoices.erase(channelIndex);
+		m_SoundVoiceStats.at(VoicesCulled)++;
+		return true;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	FMOD_RESULT F_CALLBACK AudioMan::MusicChannelEndedCallback(FMOD_CHANNELCONTROL *channelControl, FMOD_CHANNELCONTROL_TYPE channelControlType, FMOD_CHANNELCONTROL_CALLBACK_TYPE callbackType, void *unusedCommandData1, void *unusedCommandData2) {
@@ -839,6 +968,7 @@ namespace RTE {
 				result = (result == FMOD_OK) ? channel->setUserData(nullptr) : result;
 
 				if (g_AudioMan.m_SoundChannelMinimumAudibleDistances.find(channelIndex) != g_AudioMan.m_SoundChannelMinimumAudibleDistances.end()) { g_AudioMan.m_SoundChannelMinimumAudibleDistances.erase(channelIndex); }
+				g_AudioMan.m_SoundVoices.erase(channelIndex);
 
 				if (result != FMOD_OK) {
 					g_ConsoleMan.PrintString("ERROR: An error occurred when Ending a sound in SoundContainer " + channelSoundContainer->GetPresetName() + ": " + std::string(FMOD_ErrorString(result)));
@@ -25,6 +25,16 @@ namespace RTE {
 
 	public:
 
+		/// <summary>
+		/// Enumeration for the sound voice statistics tracked each second.
+		/// </summary>
+		enum SoundVoiceStat {
+			VoicesStarted = 0,
+			VoicesCulled,
+			VoicesMerged,
+			SoundVoiceStatCount
+		};
+
 		/// <summary>
 		/// Hardcoded playback priorities for sounds. Note that sounds don't have to use these specifically; their priority can be anywhere between high and low.
 		/// </summary>
@@ -284,6 +294,25 @@ namespace RTE {
 		/// </summary>
 		/// <param name="volume">The desired volume scalar. 0.0-1.0.</param>
 		void SetSoundsVolume(float volume = 1.0F) { m_SoundsVolume = volume; if (m_AudioEnabled) { m_SoundChannelGroup->setVolume(m_SoundsVolume); } }
+
+		/// <summary>
+		/// Gets the maximum number of sound voices that can play at once. One-shot mobile sounds beyond this are culled unless they are more important than the least important playing voice, which they then replace.
+		/// </summary>
+		/// <returns>The maximum number of sound voices that can play at once.</returns>
+		int GetSoundVoiceBudget() const { return m_SoundVoiceBudget; }
+
+		/// <summary>
+		/// Gets the number of sound voices currently playing.
+		/// </summary>
+		/// <returns>The number of sound voices currently playing.</returns>
+		int GetSoundVoiceCount() const { return static_cast<int>(m_SoundVoices.size()); }
+
+		/// <summary>
+		/// Gets how many times a sound voice statistic was counted during the last full second.
+		/// </summary>
+		/// <param name="stat">The statistic to get. See SoundVoiceStat enumeration.</param>
+		/// <returns>How many voices were started, culled or merged into identical playing voices during the last full second.</returns>
+		int GetSoundVoiceStatPerSecond(SoundVoiceStat stat) const { return m_SoundVoiceStatsLastSecond.at(stat); }
 #pragma endregion
 
 #pragma region Global Playback and Handling
@@ -426,6 +455,23 @@ namespace RTE {
 
 	protected:
 
+		static constexpr int c_DistantVoiceUpdateInterval = 4; //!< How many 3D effects updates a distant voice's positional effects are updated on only one of.
+		static constexpr float c_DistantVoiceAudibility = 0.05F; //!< The audibility below which a voice is considered distant.
+		static constexpr float c_MaxCoalescedVoiceGain = 2.0F; //!< The maximum volume multiplier a voice can get from identical sounds being merged into it.
+
+		/// <summary>
+		/// Bookkeeping for a single playing sound channel, used to enforce the voice budget and to merge identical sounds.
+		/// </summary>
+		struct SoundVoice {
+			FMOD::Sound *Sound; //!< The sound playing on the channel.
+			Vector Position; //!< The scene position the sound was started at.
+			long long StartTime; //!< The absolute time the voice was started at, in microseconds.
+			int Priority; //!< The playback priority of the voice. Lower is more important, see PlaybackPriority.
+			float Audibility; //!< How loud the voice was for its closest listener as of the last update, 0 being inaudible.
+			int MergedCount; //!< How many plays this voice stands in for, counting the one that started it.
+			bool Cullable; //!< Whether the voice is a one-shot mobile sound, which can be merged into, culled or replaced.
+		};
+
 		const FMOD_VECTOR c_FMODForward = FMOD_VECTOR{0, 0, 1}; //!< An FMOD_VECTOR defining the Forwards direction. Necessary for 3D Sounds.
 		const FMOD_VECTOR c_FMODUp = FMOD_VECTOR{0, 1, 0}; //!< An FMOD_VECTOR defining the Up direction. Necessary for 3D Sounds.
 
@@ -450,6 +496,16 @@ namespace RTE {
 
 		float m_SoundPanningEffectStrength; //!< The strength of the sound panning effect, 0 (no panning) - 1 (full panning).
 
+		bool m_UseNoSoundOutput; //!< Whether FMOD should mix to its no-sound output instead of an actual audio device. Everything else works as usual, which is useful for profiling and testing without audio hardware.
+		int m_SoundVoiceBudget; //!< The maximum number of sound voices that can play at once.
+		int m_SoundCoalescingWindow; //!< The time window, in ms, in which identical one-shot sounds started close to each other are merged into a single louder voice.
+		float m_SoundCoalescingRadius; //!< The distance, in pixels, within which identical one-shot sounds started in the same time window are merged into a single louder voice.
+		std::unordered_map<int, SoundVoice> m_SoundVoices; //!< The bookkeeping of all the sound channels started by PlaySoundContainer that are still playing, keyed by channel index.
+		long m_3DEffectsUpdateCount; //!< The number of times 3D effects have been updated, used to spread out the updates of distant voices.
+		Timer m_SoundVoiceStatsTimer; //!< Timer for collecting the sound voice statistics of each second.
+		std::array<int, SoundVoiceStatCount> m_SoundVoiceStats; //!< The sound voice statistics of the current second.
+		std::array<int, SoundVoiceStatCount> m_SoundVoiceStatsLastSecond; //!< The sound voice statistics of the last full second.
+
 		//////////////////////////////////////////////////
 		//TODO These need to be removed when our soundscape is sorted out. They're only here temporarily to allow for easier tweaking by pawnis.
 		float m_ListenerZOffset;
@@ -474,7 +530,7 @@ namespace RTE {
 		/// </summary>
 		/// <param name="soundContainer">Pointer to the SoundContainer to start playing. Ownership is NOT transferred!</param>
 		/// <param name="player">Which player to play the SoundContainer's sounds for, -1 means all players. Defaults to -1.</param>
-		/// <returns>Whether or not playback of the Sound was successful.</returns>
+		/// <returns>Whether or not playback of the Sound was successful. Sounds merged into an identical playing voice count as successful, sounds culled by the voice budget don't.</returns>
 		bool PlaySoundContainer(SoundContainer *soundContainer, int player = -1);
 
 		/// <summary>
@@ -527,7 +583,35 @@ namespace RTE {
 		/// <param name="soundChannel">The channel whose position should be set or updated.</param>
 		/// <param name="positionToUse">An optional position to set for this sound channel. Done this way to save setting and resetting data in FMOD.</param>
 		/// <returns>Whether the channel's position was succesfully set.</returns>
-		FMOD_RESULT UpdatePositionalEffectsForSoundChannel(FMOD::Channel *soundChannel, const FMOD_VECTOR *positionToUse = nullptr) const;
+		FMOD_RESULT UpdatePositionalEffectsForSoundChannel(FMOD::Channel *soundChannel, const FMOD_VECTOR *positionToUse = nullptr);
+#pragma endregion
+
+#pragma region Voice Management
+		/// <summary>
+		/// Estimates how loud a mobile sound would be for its closest listener, using the same attenuation as UpdatePositionalEffectsForSoundChannel.
+		/// </summary>
+		/// <param name="position">The scene position of the sound.</param>
+		/// <param name="attenuationStartDistance">The distance at which the sound starts attenuating.</param>
+		/// <param name="volume">The volume of the sound.</param>
+		/// <returns>The estimated audibility of the sound, 0 being inaudible. If there are no listeners, this is the volume.</returns>
+		float EstimateSoundAudibility(const Vector &position, float attenuationStartDistance, float volume) const;
+
+		/// <summary>
+		/// Merges a one-shot sound into an identical cullable voice that was started within the coalescing window and radius, making that voice louder instead of starting a new one.
+		/// </summary>
+		/// <param name="sound">The sound to play.</param>
+		/// <param name="position">The scene position to play the sound at.</param>
+		/// <returns>Whether the sound was merged into a playing voice.</returns>
+		bool MergeIntoPlayingVoice(FMOD::Sound *sound, const Vector &position);
+
+		/// <summary>
+		/// Makes sure there's room in the voice budget for a new voice, stopping the least important cullable voice if the budget is full and the new voice is more important than it.
+		/// </summary>
+		/// <param name="priority">The playback priority of the new voice.</param>
+		/// <param name="audibility">The estimated audibility of the new voice.</param>
+		/// <param name="cullable">Whether the new voice is cullable. Voices that aren't are played even if no room can be made for them.</param>
+		/// <returns>Whether the new voice should be played.</returns>
+		bool MakeRoomForVoice(int priority, float audibility, bool cullable);
 #pragma endregion
 
 #pragma region FMOD Callbacks
@@ -198,6 +198,7 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void ConsoleMan::PrintString(const std::string &stringToPrint) {
+		std::lock_guard<std::mutex> outputLogLock(m_OutputLogMutex);
 		m_OutputLog.emplace_back("\n" + stringToPrint);
 		if (System::IsLoggingToCLI()) { System::PrintToCLI(stringToPrint); }
 	}
@@ -217,6 +218,7 @@ namespace RTE {
 		PrintString("CTRL + R - Reset activity");
 		PrintString("CTRL + M - Switch display mode: Draw -> Material -> MO");
 		PrintString("CTRL + O - Toggle one sim update per frame");
+		PrintString("CTRL + T - Start/stop capturing a profiler trace to ProfilerTrace.json");
 		PrintString("----------------");
 		PrintString("F2 - Reload all Lua scripts");
 		PrintString("F3 - Save console log");
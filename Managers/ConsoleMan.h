@@ -175,6 +175,7 @@ namespace RTE {
 		int m_ConsoleTextMaxNumLines; //!< Maximum number of lines to display in the console text label.
 
 		std::deque<std::string> m_OutputLog; //!< Log of all strings outputted by the console.
+		std::mutex m_OutputLogMutex; //!< Mutex so scripts running in parallel on Lua worker states can print at the same time.
 		std::deque<std::string> m_InputLog; //!< Log of previously entered input strings.
 		std::deque<std::string>::iterator m_InputLogPosition; //!< Iterator to the current position in the log.
 		std::unordered_set<std::string> m_LoadWarningLog; //!< Log for non-fatal errors produced during loading (e.g. used .bmp file extension to load a .png file).
@@ -3,9 +3,11 @@
 #include "PrimitiveMan.h"
 #include "PerformanceMan.h"
 #include "ActivityMan.h"
+#include "MovableMan.h"
 #include "ConsoleMan.h"
 #include "SettingsMan.h"
 #include "UInputMan.h"
+#include "Profiler.h"
 
 #include "SLTerrain.h"
 #include "Scene.h"
@@ -640,6 +642,7 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void FrameMan::FlipFrameBuffers() const {
+		ProfileZone profileZone("FrameMan::FlipFrameBuffers");
 		if (m_ResMultiplier > 1) {
 			stretch_blit(m_BackBuffer32, screen, 0, 0, m_BackBuffer32->w, m_BackBuffer32->h, 0, 0, SCREEN_W, SCREEN_H);
 		} else {
@@ -796,6 +799,9 @@ namespace RTE {
 		// nullptr for the PALETTE parameter here because the bitmap is 32bpp and whatever we index it with will end up wrong anyway.
 		save_png(fileName, bitmapToSave, nullptr);
 
+		// The color conversion mode is global, so any BITMAPs being decoded in the background need to be done with it first.
+		ContentFile::WaitForPrefetches();
+
 		int lastColorConversionMode = get_color_conversion();
 		set_color_conversion(COLORCONV_REDUCE_TO_256);
 		// nullptr for the PALETTE parameter here because we don't need the bad palette from it and don't want it to overwrite anything.
@@ -963,6 +969,7 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void FrameMan::Draw() {
+		ProfileZone profileZone("FrameMan::Draw");
 		// Count how many split screens we'll need
 		int screenCount = (m_HSplit ? 2 : 1) * (m_VSplit ? 2 : 1);
 		RTEAssert(screenCount <= 1 || m_PlayerScreen, "Splitscreen surface not ready when needed!");
@@ -1190,7 +1197,9 @@ namespace RTE {
 			int effectStrength = 0;
 			Vector targetPos(0, 0);
 
-			// Draw objects
+			// Draw objects. The MO color layer normally only holds what the player screens can see, so redraw all of it first.
+			g_SceneMan.ClearMOColorLayer(true);
+			g_MovableMan.Draw(g_SceneMan.GetMOColorBitmap());
 			draw_sprite(m_WorldDumpBuffer, g_SceneMan.GetMOColorBitmap(), 0, 0);
 
 			// Draw post-effects
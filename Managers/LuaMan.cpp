@@ -3,15 +3,30 @@
 #include "LuaBindingRegisterDefinitions.h"
 #include "LuaAdapters.h"
 #include "LuaAdaptersEntities.h"
+#include "LuaFastPathBindings.h"
+#include "PerformanceMan.h"
+#include "ThreadMan.h"
+#include "TimerMan.h"
+#include "Profiler.h"
 
 namespace RTE {
 
+	thread_local int LuaMan::s_ActiveWorkerState = -1;
+	thread_local std::vector<std::function<void()>> *LuaMan::s_DeferredCommands = nullptr;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void LuaMan::Clear() {
 		m_MasterState = nullptr;
+		m_WorkerStates.clear();
+		m_WorkerStateCount = 0;
+		m_NextWorkerState = 0;
 		m_DisableLuaJIT = false;
+		m_DisableLuaFastPath = false;
 		m_LastError.clear();
+		m_MasterHeapSizeKB = 0;
+		m_GarbageCollectionPaced = false;
+		m_GarbageCollectionTime = 0;
 		m_NextPresetID = 0;
 		m_NextObjectID = 0;
 		m_TempEntity = nullptr;
@@ -23,8 +38,21 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void LuaMan::Initialize() {
-		m_MasterState = luaL_newstate();
-		luabind::open(m_MasterState);
+		m_MasterState = CreateState();
+		m_MasterHeapSizeKB = lua_gc(m_MasterState, LUA_GCCOUNT, 0);
+
+		m_WorkerStates.resize(std::max(m_WorkerStateCount, 0));
+		for (WorkerState &workerState : m_WorkerStates) {
+			workerState.State = CreateState();
+			workerState.HeapSizeKB = lua_gc(workerState.State, LUA_GCCOUNT, 0);
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	lua_State * LuaMan::CreateState() {
+		lua_State *luaState = luaL_newstate();
+		luabind::open(luaState);
 
 		const luaL_Reg libsToLoad[] = {
 			{ LUA_COLIBNAME, luaopen_base },
@@ -41,21 +69,21 @@ namespace RTE {
 			if (m_DisableLuaJIT && lib->name == LUA_JITLIBNAME) {
 				continue;
 			}
-			lua_pushcfunction(m_MasterState, lib->func);
-			lua_pushstring(m_MasterState, lib->name);
-			lua_call(m_MasterState, 1, 0);
+			lua_pushcfunction(luaState, lib->func);
+			lua_pushstring(luaState, lib->name);
+			lua_call(luaState, 1, 0);
 		}
 
 		// LuaJIT should start automatically after we load the library (if we loaded it) but we're making sure it did anyway.
-		if (!m_DisableLuaJIT && !luaJIT_setmode(m_MasterState, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_ON)) { RTEAbort("Failed to initialize LuaJIT!\nIf this error persists, please disable LuaJIT with \"Settings.ini\" property \"DisableLuaJIT\"."); }
+		if (!m_DisableLuaJIT && !luaJIT_setmode(luaState, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_ON)) { RTEAbort("Failed to initialize LuaJIT!\nIf this error persists, please disable LuaJIT with \"Settings.ini\" property \"DisableLuaJIT\"."); }
 
 		// From LuaBind documentation:
 		// As mentioned in the Lua documentation, it is possible to pass an error handler function to lua_pcall(). LuaBind makes use of lua_pcall() internally when calling member functions and free functions.
 		// It is possible to set the error handler function that LuaBind will use globally:
 		//set_pcall_callback(&AddFileAndLineToError); // NOTE: this seems to do nothing because retrieving the error from the lua stack wasn't done correctly. The current error handling works just fine but might look into doing this properly sometime later.
 
-		// Register all relevant bindings to the master state. Note that the order of registration is important, as bindings can't derive from an unregistered type (inheritance and all that).
-		luabind::module(m_MasterState)[
+		// Register all relevant bindings to the state. Note that the order of registration is important, as bindings can't derive from an unregistered type (inheritance and all that).
+		luabind::module(luaState)[
 			luabind::class_<LuaMan>("LuaManager")
 				.property("TempEntity", &LuaMan::GetTempEntity)
 				.def_readonly("TempEntities", &LuaMan::m_TempEntityVector, luabind::return_stl_iterator)
@@ -143,6 +171,7 @@ namespace RTE {
 			RegisterLuaBindingsOfType(ManagerLuaBindings, TimerMan),
 			RegisterLuaBindingsOfType(ManagerLuaBindings, UInputMan),
 			RegisterLuaBindingsOfType(MiscLuaBindings, AlarmEvent),
+			RegisterLuaBindingsOfType(MiscLuaBindings, MOQuery),
 			RegisterLuaBindingsOfType(MiscLuaBindings, InputDevice),
 			RegisterLuaBindingsOfType(MiscLuaBindings, InputElements),
 			RegisterLuaBindingsOfType(MiscLuaBindings, JoyButtons),
@@ -150,23 +179,26 @@ namespace RTE {
 			RegisterLuaBindingsOfType(MiscLuaBindings, MouseButtons)
 		];
 
-		// Assign the manager instances to globals in the lua master state
-		luabind::globals(m_MasterState)["TimerMan"] = &g_TimerMan;
-		luabind::globals(m_MasterState)["FrameMan"] = &g_FrameMan;
-		luabind::globals(m_MasterState)["PostProcessMan"] = &g_PostProcessMan;
-		luabind::globals(m_MasterState)["PrimitiveMan"] = &g_PrimitiveMan;
-		luabind::globals(m_MasterState)["PresetMan"] = &g_PresetMan;
-		luabind::globals(m_MasterState)["AudioMan"] = &g_AudioMan;
-		luabind::globals(m_MasterState)["UInputMan"] = &g_UInputMan;
-		luabind::globals(m_MasterState)["SceneMan"] = &g_SceneMan;
-		luabind::globals(m_MasterState)["ActivityMan"] = &g_ActivityMan;
-		luabind::globals(m_MasterState)["MetaMan"] = &g_MetaMan;
-		luabind::globals(m_MasterState)["MovableMan"] = &g_MovableMan;
-		luabind::globals(m_MasterState)["ConsoleMan"] = &g_ConsoleMan;
-		luabind::globals(m_MasterState)["LuaMan"] = &g_LuaMan;
-		luabind::globals(m_MasterState)["SettingsMan"] = &g_SettingsMan;
-
-		luaL_dostring(m_MasterState,
+		// Install the raw Lua C API handlers for the hottest members in front of LuaBind's. Has to come after the registration because it resolves against the bound classes.
+		if (!m_DisableLuaFastPath) { LuaFastPathBindings::Register(luaState); }
+
+		// Assign the manager instances to globals in the lua state
+		luabind::globals(luaState)["TimerMan"] = &g_TimerMan;
+		luabind::globals(luaState)["FrameMan"] = &g_FrameMan;
+		luabind::globals(luaState)["PostProcessMan"] = &g_PostProcessMan;
+		luabind::globals(luaState)["PrimitiveMan"] = &g_PrimitiveMan;
+		luabind::globals(luaState)["PresetMan"] = &g_PresetMan;
+		luabind::globals(luaState)["AudioMan"] = &g_AudioMan;
+		luabind::globals(luaState)["UInputMan"] = &g_UInputMan;
+		luabind::globals(luaState)["SceneMan"] = &g_SceneMan;
+		luabind::globals(luaState)["ActivityMan"] = &g_ActivityMan;
+		luabind::globals(luaState)["MetaMan"] = &g_MetaMan;
+		luabind::globals(luaState)["MovableMan"] = &g_MovableMan;
+		luabind::globals(luaState)["ConsoleMan"] = &g_ConsoleMan;
+		luabind::globals(luaState)["LuaMan"] = &g_LuaMan;
+		luabind::globals(luaState)["SettingsMan"] = &g_SettingsMan;
+
+		luaL_dostring(luaState,
 			// Override print() in the lua state to output to the console.
 			"print = function(toPrint) ConsoleMan:PrintString(\"PRINT: \" .. tostring(toPrint)); end;\n"
 			// Add cls() as a shortcut to ConsoleMan:Clear().
@@ -174,12 +206,17 @@ namespace RTE {
 			// Add package path to the defaults.
 			"package.path = package.path .. \";Base.rte/?.lua\";\n"
 		);
+
+		return luaState;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void LuaMan::Destroy() {
 		lua_close(m_MasterState);
+		for (const WorkerState &workerState : m_WorkerStates) {
+			lua_close(workerState.State);
+		}
 
 		for (int i = 0; i < c_MaxOpenFiles; ++i) {
 			FileClose(i);
@@ -193,6 +230,64 @@ namespace RTE {
 		luaL_dostring(m_MasterState, "for m, n in pairs(package.loaded) do if type(n) == \"boolean\" then package.loaded[m] = nil; end; end;");
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LuaMan::AssignWorkerState() {
+		if (m_WorkerStates.empty()) {
+			return -1;
+		}
+		int workerState = m_NextWorkerState;
+		m_NextWorkerState = (m_NextWorkerState + 1) % static_cast<int>(m_WorkerStates.size());
+		return workerState;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LuaMan::UnqueueParallelScriptUpdate(int workerState, const MovableObject *movableObject) {
+		if (workerState >= 0 && workerState < static_cast<int>(m_WorkerStates.size())) {
+			std::vector<MovableObject *> &queuedScriptUpdates = m_WorkerStates[workerState].QueuedScriptUpdates;
+			queuedScriptUpdates.erase(std::remove(queuedScriptUpdates.begin(), queuedScriptUpdates.end(), movableObject), queuedScriptUpdates.end());
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LuaMan::RunParallelScriptUpdates() {
+		ProfileZone profileZone("LuaMan::RunParallelScriptUpdates");
+		std::vector<std::future<void>> workerStateResults;
+		for (int workerStateIndex = 0; workerStateIndex < static_cast<int>(m_WorkerStates.size()); ++workerStateIndex) {
+			if (m_WorkerStates[workerStateIndex].QueuedScriptUpdates.empty()) {
+				continue;
+			}
+			// Each worker thread has its own RNG, so seed it from ours to keep script randomness tied to the main seed.
+			unsigned int workerRNGSeed = g_RNG();
+			workerStateResults.emplace_back(g_ThreadMan.QueueJob([this, workerStateIndex, workerRNGSeed]() {
+				ProfileZone workerProfileZone("LuaMan::RunParallelScriptUpdates Worker State");
+				WorkerState &workerState = m_WorkerStates[workerStateIndex];
+				WorkerStateScope workerStateScope(workerStateIndex);
+				s_DeferredCommands = &workerState.DeferredCommands;
+				SeedRNG(workerRNGSeed);
+
+				for (MovableObject *movableObject : workerState.QueuedScriptUpdates) {
+					movableObject->UpdateScripts();
+				}
+				s_DeferredCommands = nullptr;
+			}));
+		}
+		for (std::future<void> &workerStateResult : workerStateResults) {
+			workerStateResult.get();
+		}
+
+		// Apply deferred commands in worker state order so the results don't depend on which worker finished first.
+		for (WorkerState &workerState : m_WorkerStates) {
+			for (const std::function<void()> &deferredCommand : workerState.DeferredCommands) {
+				deferredCommand();
+			}
+			workerState.DeferredCommands.clear();
+			workerState.QueuedScriptUpdates.clear();
+		}
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string LuaMan::GetNewPresetID() {
@@ -249,25 +344,27 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int LuaMan::RunScriptString(const std::string &scriptString, bool consoleErrors) {
+		lua_State *luaState = GetActiveState();
+		std::string &lastError = GetActiveLastError();
 		if (scriptString.empty()) {
 			return -1;
 		}
 		int error = 0;
 
-		lua_pushcfunction(m_MasterState, &AddFileAndLineToError);
+		lua_pushcfunction(luaState, &AddFileAndLineToError);
 		// Load the script string onto the stack and then execute it with pcall. Pcall will call the file and line error handler if there's an error by pointing 2 up the stack to it.
-		if (luaL_loadstring(m_MasterState, scriptString.c_str()) || lua_pcall(m_MasterState, 0, LUA_MULTRET, -2)) {
+		if (luaL_loadstring(luaState, scriptString.c_str()) || lua_pcall(luaState, 0, LUA_MULTRET, -2)) {
 			// Retrieve the error message then pop it off the stack to clean it up
-			m_LastError = lua_tostring(m_MasterState, -1);
-			lua_pop(m_MasterState, 1);
+			lastError = lua_tostring(luaState, -1);
+			lua_pop(luaState, 1);
 			if (consoleErrors) {
-				g_ConsoleMan.PrintString("ERROR: " + m_LastError);
+				g_ConsoleMan.PrintString("ERROR: " + lastError);
 				ClearErrors();
 			}
 			error = -1;
 		}
 		// Pop the file and line error handler off the stack to clean it up
-		lua_pop(m_MasterState, 1);
+		lua_pop(luaState, 1);
 
 		return error;
 	}
@@ -275,15 +372,18 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int LuaMan::RunScriptFile(const std::string &filePath, bool consoleErrors) {
+		ProfileZone profileZone("LuaMan::RunScriptFile", filePath);
+		lua_State *luaState = GetActiveState();
+		std::string &lastError = GetActiveLastError();
 		if (filePath.empty()) {
-			m_LastError = "Can't run a script file with an empty filepath!";
+			lastError = "Can't run a script file with an empty filepath!";
 			return -1;
 		}
 
 		if (!System::PathExistsCaseSensitive(filePath)) {
-			m_LastError = "Script file: " + filePath + " doesn't exist!";
+			lastError = "Script file: " + filePath + " doesn't exist!";
 			if (consoleErrors) {
-				g_ConsoleMan.PrintString("ERROR: " + m_LastError);
+				g_ConsoleMan.PrintString("ERROR: " + lastError);
 				ClearErrors();
 			}
 			return -1;
@@ -291,19 +391,19 @@ namespace RTE {
 
 		int error = 0;
 
-		lua_pushcfunction(m_MasterState, &AddFileAndLineToError);
+		lua_pushcfunction(luaState, &AddFileAndLineToError);
 		// Load the script file's contents onto the stack and then execute it with pcall. Pcall will call the file and line error handler if there's an error by pointing 2 up the stack to it.
-		if (luaL_loadfile(m_MasterState, filePath.c_str()) || lua_pcall(m_MasterState, 0, LUA_MULTRET, -2)) {
-			m_LastError = lua_tostring(m_MasterState, -1);
-			lua_pop(m_MasterState, 1);
+		if (luaL_loadfile(luaState, filePath.c_str()) || lua_pcall(luaState, 0, LUA_MULTRET, -2)) {
+			lastError = lua_tostring(luaState, -1);
+			lua_pop(luaState, 1);
 			if (consoleErrors) {
-				g_ConsoleMan.PrintString("ERROR: " + m_LastError);
+				g_ConsoleMan.PrintString("ERROR: " + lastError);
 				ClearErrors();
 			}
 			error = -1;
 		}
 		// Pop the file and line error handler off the stack to clean it up
-		lua_pop(m_MasterState, 1);
+		lua_pop(luaState, 1);
 
 		return error;
 	}
@@ -311,25 +411,27 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool LuaMan::ExpressionIsTrue(const std::string &expression, bool consoleErrors) {
+		lua_State *luaState = GetActiveState();
+		std::string &lastError = GetActiveLastError();
 		if (expression.empty()) {
 			return false;
 		}
 		bool result = false;
 
 		// Push the script string onto the stack so we can execute it, and then actually try to run it. Assign the result to a dedicated temp global variable.
-		if (luaL_dostring(m_MasterState, std::string("ExpressionResult = " + expression + ";").c_str())) {
-			m_LastError = std::string("When evaluating Lua expression: ") + lua_tostring(m_MasterState, -1);
-			lua_pop(m_MasterState, 1);
+		if (luaL_dostring(luaState, std::string("ExpressionResult = " + expression + ";").c_str())) {
+			lastError = std::string("When evaluating Lua expression: ") + lua_tostring(luaState, -1);
+			lua_pop(luaState, 1);
 			if (consoleErrors) {
-				g_ConsoleMan.PrintString("ERROR: " + m_LastError);
+				g_ConsoleMan.PrintString("ERROR: " + lastError);
 				ClearErrors();
 			}
 			return false;
 		}
 		// Put the result of the expression on the lua stack and check its value. Need to pop it off the stack afterwards so it leaves the stack unchanged.
-		lua_getglobal(m_MasterState, "ExpressionResult");
-		result = lua_toboolean(m_MasterState, -1);
-		lua_pop(m_MasterState, 1);
+		lua_getglobal(luaState, "ExpressionResult");
+		result = lua_toboolean(luaState, -1);
+		lua_pop(luaState, 1);
 
 		return result;
 	}
@@ -337,21 +439,23 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void LuaMan::SavePointerAsGlobal(void *objectToSave, const std::string &globalName) {
+		lua_State *luaState = GetActiveState();
 		// Push the pointer onto the Lua stack.
-		lua_pushlightuserdata(m_MasterState, objectToSave);
+		lua_pushlightuserdata(luaState, objectToSave);
 		// Pop and assign that pointer to a global var in the Lua state.
-		lua_setglobal(m_MasterState, globalName.c_str());
+		lua_setglobal(luaState, globalName.c_str());
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool LuaMan::GlobalIsDefined(const std::string &globalName) {
+		lua_State *luaState = GetActiveState();
 		// Get the var you want onto the stack so we can check it.
-		lua_getglobal(m_MasterState, globalName.c_str());
+		lua_getglobal(luaState, globalName.c_str());
 		// Now report if it is nil/null or not.
-		bool isDefined = !lua_isnil(m_MasterState, -1);
+		bool isDefined = !lua_isnil(luaState, -1);
 		// Pop the var so this operation is balanced and leaves the stack as it was.
-		lua_pop(m_MasterState, 1);
+		lua_pop(luaState, 1);
 
 		return isDefined;
 	}
@@ -359,19 +463,20 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool LuaMan::TableEntryIsDefined(const std::string &tableName, const std::string &indexName) {
+		lua_State *luaState = GetActiveState();
 		// Push the table onto the stack, checking if it even exists.
-		lua_getglobal(m_MasterState, tableName.c_str());
-		if (!lua_istable(m_MasterState, -1)) {
+		lua_getglobal(luaState, tableName.c_str());
+		if (!lua_istable(luaState, -1)) {
 			// Clean up and report that there was nothing properly defined here.
-			lua_pop(m_MasterState, 1);
+			lua_pop(luaState, 1);
 			return false;
 		}
 		// Push the value at the requested index onto the stack so we can check if it's anything.
-		lua_getfield(m_MasterState, -1, indexName.c_str());
+		lua_getfield(luaState, -1, indexName.c_str());
 		// Now report if it is nil/null or not
-		bool isDefined = !lua_isnil(m_MasterState, -1);
+		bool isDefined = !lua_isnil(luaState, -1);
 		// Pop both the var and the table so this operation is balanced and leaves the stack as it was.
-		lua_pop(m_MasterState, 2);
+		lua_pop(luaState, 2);
 
 		return isDefined;
 	}
@@ -462,7 +567,67 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void LuaMan::Update() const {
-		lua_gc(m_MasterState, LUA_GCSTEP, 1);
+	int LuaMan::GetHeapSizeKB() const {
+		int heapSizeKB = m_MasterHeapSizeKB;
+		for (const WorkerState &workerState : m_WorkerStates) {
+			heapSizeKB += workerState.HeapSizeKB;
+		}
+		return heapSizeKB;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LuaMan::Update() {
+		ProfileZone profileZone("LuaMan::Update");
+		g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::LuaGarbageCollection);
+		long long startTime = g_TimerMan.GetAbsoluteTime();
+
+		long long timeLeftInSimUpdate = static_cast<long long>(g_TimerMan.GetDeltaTimeSecs() * 1000000.0F) - g_PerformanceMan.GetElapsedMeasurementTime(PerformanceMan::SimTotal);
+		long long deadline = startTime + std::clamp(static_cast<long long>(static_cast<float>(timeLeftInSimUpdate) * c_GarbageCollectionBudgetShare), 0LL, c_MaxGarbageCollectionTime);
+
+		if (m_GarbageCollectionPaced) {
+			StepGarbageCollection(m_MasterState, m_MasterHeapSizeKB, deadline);
+			for (WorkerState &workerState : m_WorkerStates) {
+				StepGarbageCollection(workerState.State, workerState.HeapSizeKB, deadline);
+			}
+		} else {
+			// The automatic collector is still running until an Activity starts, so it only gets nudged along.
+			lua_gc(m_MasterState, LUA_GCSTEP, 1);
+			m_MasterHeapSizeKB = lua_gc(m_MasterState, LUA_GCCOUNT, 0);
+			for (WorkerState &workerState : m_WorkerStates) {
+				lua_gc(workerState.State, LUA_GCSTEP, 1);
+				workerState.HeapSizeKB = lua_gc(workerState.State, LUA_GCCOUNT, 0);
+			}
+		}
+
+		m_GarbageCollectionTime = static_cast<float>(g_TimerMan.GetAbsoluteTime() - startTime) / 1000.0F;
+		g_PerformanceMan.StopPerformanceMeasurement(PerformanceMan::LuaGarbageCollection);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LuaMan::StepGarbageCollection(lua_State *luaState, int &heapSizeKB, long long deadline) const {
+		int allocatedKB = lua_gc(luaState, LUA_GCCOUNT, 0) - heapSizeKB;
+		bool cycleFinished = lua_gc(luaState, LUA_GCSTEP, std::max(allocatedKB, 1)) == 1;
+		while (!cycleFinished && g_TimerMan.GetAbsoluteTime() < deadline) {
+			cycleFinished = lua_gc(luaState, LUA_GCSTEP, c_GarbageCollectionStepSizeKB) == 1;
+		}
+		// Stepping re-arms the automatic collector's threshold, so it has to be stopped again.
+		lua_gc(luaState, LUA_GCSTOP, 0);
+		heapSizeKB = lua_gc(luaState, LUA_GCCOUNT, 0);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LuaMan::StartPacedGarbageCollection() {
+		lua_gc(m_MasterState, LUA_GCCOLLECT, 0);
+		lua_gc(m_MasterState, LUA_GCSTOP, 0);
+		m_MasterHeapSizeKB = lua_gc(m_MasterState, LUA_GCCOUNT, 0);
+		for (WorkerState &workerState : m_WorkerStates) {
+			lua_gc(workerState.State, LUA_GCCOLLECT, 0);
+			lua_gc(workerState.State, LUA_GCSTOP, 0);
+			workerState.HeapSizeKB = lua_gc(workerState.State, LUA_GCCOUNT, 0);
+		}
+		m_GarbageCollectionPaced = true;
 	}
 }
\ No newline at end of file
@@ -11,14 +11,45 @@ struct lua_State;
 
 namespace RTE {
 
+	class MovableObject;
+
 	/// <summary>
-	/// The singleton manager of the master Lua script state.
+	/// The singleton manager of the master Lua script state, and of the optional worker states that thread-safe MovableObject scripts are updated on in parallel.
 	/// </summary>
 	class LuaMan : public Singleton<LuaMan> {
 		friend class SettingsMan;
+		friend class LuaQueryBenchmark;
+		friend class LuaBindingBenchmark;
 
 	public:
 
+		/// <summary>
+		/// Makes a worker state the one all script execution methods of LuaMan run on from the calling thread, for as long as this is in scope.
+		/// </summary>
+		class WorkerStateScope {
+
+		public:
+
+			/// <summary>
+			/// Constructor method used to instantiate a WorkerStateScope object in system memory and make the given worker state active on the calling thread.
+			/// </summary>
+			/// <param name="workerState">The index of the worker state to make active. -1 means the master state.</param>
+			explicit WorkerStateScope(int workerState) : m_PreviousWorkerState(s_ActiveWorkerState) { s_ActiveWorkerState = workerState; }
+
+			/// <summary>
+			/// Destructor method used to make the previously active state active again on the calling thread.
+			/// </summary>
+			~WorkerStateScope() { s_ActiveWorkerState = m_PreviousWorkerState; }
+
+		private:
+
+			int m_PreviousWorkerState; //!< The index of the worker state that was active on the calling thread before this scope.
+
+			// Disallow the use of some implicit methods.
+			WorkerStateScope(const WorkerStateScope &reference) = delete;
+			WorkerStateScope & operator=(const WorkerStateScope &rhs) = delete;
+		};
+
 #pragma region Creation
 		/// <summary>
 		/// Constructor method used to instantiate a LuaMan object in system memory. Initialize() should be called before using the object.
@@ -78,6 +109,63 @@ namespace RTE {
 		/// </summary>
 		/// <param name="entityVector">The temporary vector of entities. Ownership is NOT transferred!</param>
 		void SetTempEntityVector(std::vector<Entity *> entityVector) { m_TempEntityVector = entityVector; }
+
+		/// <summary>
+		/// Gets the number of worker states that thread-safe scripts can be updated on in parallel.
+		/// </summary>
+		/// <returns>The number of worker states. 0 means all scripts run on the master state.</returns>
+		int GetWorkerStateCount() const { return static_cast<int>(m_WorkerStates.size()); }
+
+		/// <summary>
+		/// Picks the worker state that the next scripted object with thread-safe scripts should run all of its scripts on. Worker states are handed out round-robin.
+		/// </summary>
+		/// <returns>The index of the worker state to use, or -1 if there are no worker states and the master state should be used.</returns>
+		int AssignWorkerState();
+
+		/// <summary>
+		/// Gets whether the calling thread is currently updating scripts in parallel, meaning engine mutations must go through DeferCommand.
+		/// </summary>
+		/// <returns>Whether the calling thread is updating scripts in parallel.</returns>
+		bool IsInParallelScriptUpdate() const { return s_DeferredCommands != nullptr; }
+
+		/// <summary>
+		/// Gets the combined size of the heaps of the master and all worker states, as of the last update or full garbage collection.
+		/// </summary>
+		/// <returns>The combined heap size in kilobytes.</returns>
+		int GetHeapSizeKB() const;
+
+		/// <summary>
+		/// Gets how long the garbage collection steps of the last update took.
+		/// </summary>
+		/// <returns>The garbage collection time of the last update in milliseconds.</returns>
+		float GetGarbageCollectionTime() const { return m_GarbageCollectionTime; }
+#pragma endregion
+
+#pragma region Parallel Script Updates
+		/// <summary>
+		/// Queues the Update function of a scripted object's scripts to be run on its worker state during the next RunParallelScriptUpdates.
+		/// </summary>
+		/// <param name="workerState">The index of the worker state the object's scripts run on.</param>
+		/// <param name="movableObject">The object to update the scripts of. Ownership is NOT transferred!</param>
+		void QueueParallelScriptUpdate(int workerState, MovableObject *movableObject) { m_WorkerStates.at(workerState).QueuedScriptUpdates.emplace_back(movableObject); }
+
+		/// <summary>
+		/// Removes a scripted object from the queue of script updates to run on its worker state, so it can be safely deleted.
+		/// </summary>
+		/// <param name="workerState">The index of the worker state the object's scripts run on.</param>
+		/// <param name="movableObject">The object to remove from the queue.</param>
+		void UnqueueParallelScriptUpdate(int workerState, const MovableObject *movableObject);
+
+		/// <summary>
+		/// Runs all queued script updates, each worker state's on its own ThreadMan worker, waits for them to finish and then applies all the commands they deferred, in order.
+		/// </summary>
+		void RunParallelScriptUpdates();
+
+		/// <summary>
+		/// Runs a command that mutates engine state right away, or if the calling thread is updating scripts in parallel, defers it until all parallel script updates are done.
+		/// </summary>
+		/// <param name="command">The command to run or defer.</param>
+		void RunOrDeferCommand(std::function<void()> command) { if (s_DeferredCommands) { s_DeferredCommands->emplace_back(std::move(command)); } else { command(); } }
 #pragma endregion
 
 #pragma region Script Execution Handling
@@ -147,18 +235,18 @@ namespace RTE {
 		/// Tells whether there are any errors reported waiting to be read.
 		/// </summary>
 		/// <returns>Whether errors exist.</returns>
-		bool ErrorExists() const { return !m_LastError.empty(); }
+		bool ErrorExists() const { return !GetActiveLastError().empty(); }
 
 		/// <summary>
 		/// Returns the last error message from executing scripts.
 		/// </summary>
 		/// <returns>The error string with hopefully meaningful info about what went wrong.</returns>
-		std::string GetLastError() const { return m_LastError; }
+		std::string GetLastError() const { return GetActiveLastError(); }
 
 		/// <summary>
 		/// Clears the last error message, so the Lua state will not be considered to have any errors until the next time there's a script error.
 		/// </summary>
-		void ClearErrors() { m_LastError.clear(); }
+		void ClearErrors() { GetActiveLastError().clear(); }
 #pragma endregion
 
 #pragma region File I/O Handling
@@ -205,20 +293,51 @@ namespace RTE {
 
 #pragma region Concrete Methods
 		/// <summary>
-		/// Updates the state of this LuaMan.
+		/// Updates the state of this LuaMan. Once paced garbage collection is started, the automatic Lua garbage collector is turned off and this is where garbage gets collected, in incremental steps sized to the time left in the sim update.
+		/// Should be done at the end of every sim update so the remaining time is known.
 		/// </summary>
-		void Update() const;
+		void Update();
+
+		/// <summary>
+		/// Runs full garbage collection cycles on the master and all worker states, then turns off the automatic collector so garbage only gets collected in Update's paced steps from then on.
+		/// The full collections can take a long time, so this should only be done at transitions like starting an Activity.
+		/// </summary>
+		void StartPacedGarbageCollection();
 #pragma endregion
 
 	private:
 
 		static constexpr int c_MaxOpenFiles = 10; //!< The maximum number of files that can be opened with FileOpen at runtime.
+		static constexpr float c_GarbageCollectionBudgetShare = 0.5F; //!< The share of the time left in a sim update that may be spent on garbage collection steps.
+		static constexpr long long c_MaxGarbageCollectionTime = 2000; //!< The most time in microseconds that may be spent on garbage collection steps in one update, however much is left in the sim update.
+		static constexpr int c_GarbageCollectionStepSizeKB = 16; //!< The size in kilobytes of each extra garbage collection step taken while there's time left in the update's budget.
+
+		/// <summary>
+		/// A Lua state that thread-safe scripts are run on in parallel with the other worker states, along with everything it needs to do so.
+		/// </summary>
+		struct WorkerState {
+			lua_State *State; //!< The Lua state itself.
+			std::string LastError; //!< Description of the last error that occurred in script execution on this state.
+			std::vector<MovableObject *> QueuedScriptUpdates; //!< The objects whose Update scripts should be run on this state during the next parallel script update.
+			std::vector<std::function<void()>> DeferredCommands; //!< The engine mutations deferred by scripts on this state during the current parallel script update.
+			int HeapSizeKB; //!< The heap size of this state in kilobytes after its last garbage collection step.
+		};
+
+		static thread_local int s_ActiveWorkerState; //!< The index of the worker state script execution methods run on from this thread. -1 means the master state.
+		static thread_local std::vector<std::function<void()>> *s_DeferredCommands; //!< The command buffer engine mutations go into while this thread is updating scripts in parallel. Nullptr otherwise.
 
 		lua_State *m_MasterState; //!< The master parent script state.
+		std::vector<WorkerState> m_WorkerStates; //!< The worker states thread-safe scripts are updated on in parallel.
+		int m_WorkerStateCount; //!< How many worker states to create on initialization. 0 means all scripts run on the master state.
+		int m_NextWorkerState; //!< The index of the worker state to hand out to the next scripted object with thread-safe scripts.
 
 		bool m_DisableLuaJIT; //!< Whether to disable LuaJIT or not. Disabling will skip loading the JIT library entirely as just setting 'jit.off()' seems to have no visible effect.
+		bool m_DisableLuaFastPath; //!< Whether to leave out the LuaFastPathBindings handlers, so every binding goes through LuaBind like it used to.
 
 		std::string m_LastError; //!< Description of the last error that occurred in the script execution.
+		int m_MasterHeapSizeKB; //!< The heap size of the master state in kilobytes after its last garbage collection step.
+		bool m_GarbageCollectionPaced; //!< Whether the automatic collector is turned off and garbage is only collected in Update's paced steps. Stays false until the first Activity starts, so the heap doesn't grow unchecked while data is loaded.
+		float m_GarbageCollectionTime; //!< How long the garbage collection steps of the last update took, in milliseconds.
 
 		long m_NextPresetID; //!< The next unique preset ID to hand out to the next Preset that wants to define some functions. This gets incremented each time a new one is requested to give unique ID's to all original presets.
 		long m_NextObjectID; //!< The next unique object ID to hand out to the next scripted Entity instance that wants to run its preset's scripts. This gets incremented each time a new one is requested to give unique ID's to all scripted objects.
@@ -227,6 +346,38 @@ namespace RTE {
 
 		std::array<FILE *, c_MaxOpenFiles> m_OpenedFiles; //!< Internal list of opened files used by File functions.
 
+		/// <summary>
+		/// Gets the Lua state script execution methods should run on from the calling thread.
+		/// </summary>
+		/// <returns>The active worker state, or the master state if none is active.</returns>
+		lua_State * GetActiveState() const { return (s_ActiveWorkerState < 0) ? m_MasterState : m_WorkerStates.at(s_ActiveWorkerState).State; }
+
+		/// <summary>
+		/// Gets the last error message of the Lua state script execution methods should run on from the calling thread.
+		/// </summary>
+		/// <returns>The last error message of the active state.</returns>
+		std::string & GetActiveLastError() { return (s_ActiveWorkerState < 0) ? m_LastError : m_WorkerStates.at(s_ActiveWorkerState).LastError; }
+
+		/// <summary>
+		/// Gets the last error message of the Lua state script execution methods should run on from the calling thread.
+		/// </summary>
+		/// <returns>The last error message of the active state.</returns>
+		const std::string & GetActiveLastError() const { return (s_ActiveWorkerState < 0) ? m_LastError : m_WorkerStates.at(s_ActiveWorkerState).LastError; }
+
+		/// <summary>
+		/// Creates a new Lua state, loads the standard libraries into it and registers all the bindings and manager globals with it.
+		/// </summary>
+		/// <returns>The newly created Lua state. Ownership IS transferred!</returns>
+		lua_State * CreateState();
+
+		/// <summary>
+		/// Runs incremental garbage collection steps on a Lua state. The first step is sized to what was allocated since the last update so collection keeps pace with allocation even when there's no time left, further steps are taken until the deadline or the end of the collection cycle.
+		/// </summary>
+		/// <param name="luaState">The Lua state to collect garbage in.</param>
+		/// <param name="heapSizeKB">The heap size of the state in kilobytes after its previous step. Updated to the heap size after this one.</param>
+		/// <param name="deadline">The absolute time in microseconds after which no further steps should be started.</param>
+		void StepGarbageCollection(lua_State *luaState, int &heapSizeKB, long long deadline) const;
+
 		/// <summary>
 		/// Clears all the member variables of this LuaMan, effectively resetting the members of this abstraction level only.
 		/// </summary>
@@ -14,6 +14,7 @@
 #include "MovableMan.h"
 #include "PostProcessMan.h"
 #include "PerformanceMan.h"
+#include "Profiler.h"
 #include "PresetMan.h"
 #include "AHuman.h"
 #include "MOPixel.h"
@@ -50,6 +51,7 @@ void MovableMan::Clear()
     m_AddedActors.clear();
     m_AddedItems.clear();
     m_AddedParticles.clear();
+    m_MOsToDelete.clear();
     m_ActorRoster[Activity::TeamOne].clear();
     m_ActorRoster[Activity::TeamTwo].clear();
     m_ActorRoster[Activity::TeamThree].clear();
@@ -86,6 +88,12 @@ int MovableMan::Initialize()
     m_SloMoTimer.SetSimTimeLimitMS(0);
     m_SloMoTimer.SetRealTimeLimitMS(0);
 
+    // The add queues are drained every update but keep their capacity, so reserving up front means they never reallocate in the common case
+    m_AddedActors.reserve(c_AddQueueReserve);
+    m_AddedItems.reserve(c_AddQueueReserve);
+    m_AddedParticles.reserve(c_AddQueueReserve);
+    m_MOsToDelete.reserve(c_AddQueueReserve);
+
     return 0;
 }
 
@@ -128,11 +136,11 @@ int MovableMan::Save(Writer &writer) const
     Serializable::Save(writer);
 
     writer << m_Actors.size();
-    for (deque<Actor *>::const_iterator itr = m_Actors.begin(); itr != m_Actors.end(); ++itr)
+    for (vector<Actor *>::const_iterator itr = m_Actors.begin(); itr != m_Actors.end(); ++itr)
         writer << **itr;
 
     writer << m_Particles.size();
-    for (deque<MovableObject *>::const_iterator itr2 = m_Particles.begin(); itr2 != m_Particles.end(); ++itr2)
+    for (vector<MovableObject *>::const_iterator itr2 = m_Particles.begin(); itr2 != m_Particles.end(); ++itr2)
         writer << **itr2;
 
     return 0;
@@ -146,11 +154,12 @@ int MovableMan::Save(Writer &writer) const
 
 void MovableMan::Destroy()
 {
-    for (deque<Actor *>::iterator it1 = m_Actors.begin(); it1 != m_Actors.end(); ++it1)
+    DeleteQueuedMOs();
+    for (vector<Actor *>::iterator it1 = m_Actors.begin(); it1 != m_Actors.end(); ++it1)
         delete (*it1);
-    for (deque<MovableObject *>::iterator it2 = m_Items.begin(); it2 != m_Items.end(); ++it2)
+    for (vector<MovableObject *>::iterator it2 = m_Items.begin(); it2 != m_Items.end(); ++it2)
         delete (*it2);
-    for (deque<MovableObject *>::iterator it3 = m_Particles.begin(); it3 != m_Particles.end(); ++it3)
+    for (vector<MovableObject *>::iterator it3 = m_Particles.begin(); it3 != m_Particles.end(); ++it3)
         delete (*it3);
 
     Clear();
@@ -208,11 +217,12 @@ void MovableMan::UnregisterObject(MovableObject * mo)
 
 void MovableMan::PurgeAllMOs()
 {
-    for (deque<Actor *>::iterator it1 = m_Actors.begin(); it1 != m_Actors.end(); ++it1)
+    DeleteQueuedMOs();
+    for (vector<Actor *>::iterator it1 = m_Actors.begin(); it1 != m_Actors.end(); ++it1)
         delete (*it1);
-    for (deque<MovableObject *>::iterator it2 = m_Items.begin(); it2 != m_Items.end(); ++it2)
+    for (vector<MovableObject *>::iterator it2 = m_Items.begin(); it2 != m_Items.end(); ++it2)
         delete (*it2);
-    for (deque<MovableObject *>::iterator it3 = m_Particles.begin(); it3 != m_Particles.end(); ++it3)
+    for (vector<MovableObject *>::iterator it3 = m_Particles.begin(); it3 != m_Particles.end(); ++it3)
         delete (*it3);
 
     m_Actors.clear();
@@ -232,6 +242,7 @@ void MovableMan::PurgeAllMOs()
     m_ValiditySearchResults.clear();
     m_AddedAlarmEvents.clear();
     m_AlarmEvents.clear();
+    m_AIScheduler.Reset();
     m_MOIDIndex.clear();
 
     // Set the time limit to 0 so it will report as being past it from the start of simulation
@@ -254,7 +265,7 @@ Actor * MovableMan::GetNextActorInGroup(std::string group, Actor *pAfterThis)
         return 0;
 
     // Begin at the beginning
-    deque<Actor *>::const_iterator aIt = m_Actors.begin();
+    vector<Actor *>::const_iterator aIt = m_Actors.begin();
 
     // Search for the actor to start search from, if specified
     if (pAfterThis)
@@ -310,7 +321,7 @@ Actor * MovableMan::GetPrevActorInGroup(std::string group, Actor *pBeforeThis)
         return 0;
 
     // Begin at the reverse beginning
-    deque<Actor *>::reverse_iterator aIt = m_Actors.rbegin();
+    vector<Actor *>::reverse_iterator aIt = m_Actors.rbegin();
 
     // Search for the actor to start search from, if specified
     if (pBeforeThis)
@@ -366,7 +377,7 @@ Actor * MovableMan::GetNextTeamActor(int team, Actor *pAfterThis)
         return 0;
 /*
     // Begin at the beginning
-    deque<Actor *>::const_iterator aIt = m_Actors.begin();
+    vector<Actor *>::const_iterator aIt = m_Actors.begin();
 
     // Search for the actor to start search from, if specified
     if (pAfterThis)
@@ -451,7 +462,7 @@ Actor * MovableMan::GetPrevTeamActor(int team, Actor *pBeforeThis)
         return 0;
 /* Obsolete, now uses team rosters which are sorted
     // Begin at the reverse beginning
-    deque<Actor *>::const_reverse_iterator aIt = m_Actors.rbegin();
+    vector<Actor *>::const_reverse_iterator aIt = m_Actors.rbegin();
 
     // Search for the actor to start search from, if specified
     if (pBeforeThis)
@@ -545,7 +556,7 @@ Actor * MovableMan::GetClosestTeamActor(int team, int player, const Vector &scen
     // If we're looking for a noteam actor, then go through the entire actor list instead
     if (team == Activity::NoTeam)
     {
-        for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+        for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
         {
             if ((*aIt) == pExcludeThis || (*aIt)->GetTeam() != Activity::NoTeam)
                 continue;
@@ -604,7 +615,7 @@ Actor * MovableMan::GetClosestEnemyActor(int team, const Vector &scenePoint, int
     float shortestDistance = maxRadius;
     Actor *pClosestActor = 0;
     
-    for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
     {
         if ((*aIt)->GetTeam() == team)
             continue;
@@ -643,7 +654,7 @@ Actor * MovableMan::GetClosestActor(const Vector &scenePoint, int maxRadius, Vec
     float shortestDistance = maxRadius;
     Actor *pClosestActor = 0;
 
-    for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
     {
         if ((*aIt) == pExcludeThis)
             continue;
@@ -752,7 +763,7 @@ Actor * MovableMan::GetUnassignedBrain(int team) const
 
     // Also need to look through all the actors added this frame, one might be a brain.
     int actorTeam = Activity::NoTeam;
-    for (deque<Actor *>::const_iterator aaIt = m_AddedActors.begin(); aaIt != m_AddedActors.end(); ++aaIt)
+    for (vector<Actor *>::const_iterator aaIt = m_AddedActors.begin(); aaIt != m_AddedActors.end(); ++aaIt)
     {
         int actorTeam = (*aaIt)->GetTeam();
         // Accept no-team brains too - ACTUALLY, DON'T
@@ -764,6 +775,101 @@ Actor * MovableMan::GetUnassignedBrain(int team) const
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryMOList
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the MO:s in one of the internal lists that match a query.
+
+template <typename MOType>
+int MovableMan::QueryMOList(const MOQuery &query, const std::vector<MOType *> &moList, std::vector<MOType *> &matches) const {
+    matches.clear();
+
+    // Resolve the class once up front instead of by name for every MO. An unknown class can't match anything.
+    const Entity::ClassInfo *classToMatch = nullptr;
+    if (!query.m_ClassName.empty()) {
+        classToMatch = Entity::ClassInfo::GetClass(query.m_ClassName);
+        if (!classToMatch) {
+            return 0;
+        }
+    }
+    std::list<Box> wrappedBoxes;
+    if (!query.m_Box.IsEmpty()) { g_SceneMan.WrapBox(query.m_Box, wrappedBoxes); }
+
+    bool useRadius = query.m_Radius > 0;
+    float radiusSquared = query.m_Radius * query.m_Radius;
+    std::vector<std::pair<float, MOType *>> matchesByDistance;
+
+    for (MOType *mo : moList) {
+        if ((query.m_Team != Activity::NoTeam && mo->GetTeam() != query.m_Team) || (query.m_NotOfTeam != Activity::NoTeam && mo->GetTeam() == query.m_NotOfTeam)) {
+            continue;
+        }
+        if (classToMatch && !mo->GetClass().IsClassOrChildClassOf(classToMatch)) {
+            continue;
+        }
+        if (!query.m_PresetName.empty() && mo->GetPresetName() != query.m_PresetName) {
+            continue;
+        }
+        if (!query.m_Group.empty() && !mo->IsInGroup(query.m_Group)) {
+            continue;
+        }
+        if (!wrappedBoxes.empty() && std::none_of(wrappedBoxes.begin(), wrappedBoxes.end(), [&mo](const Box &box) { return box.IsWithinBox(mo->GetPos()); })) {
+            continue;
+        }
+        if (useRadius) {
+            Vector distanceVec = g_SceneMan.ShortestDistance(query.m_Center, mo->GetPos());
+            float distanceSquared = distanceVec.m_X * distanceVec.m_X + distanceVec.m_Y * distanceVec.m_Y;
+            if (distanceSquared <= radiusSquared) { matchesByDistance.emplace_back(distanceSquared, mo); }
+        } else {
+            matches.push_back(mo);
+            if (query.m_Limit > 0 && static_cast<int>(matches.size()) >= query.m_Limit) {
+                break;
+            }
+        }
+    }
+
+    // With a radius, the limit should keep the closest matches rather than whichever came first in the list.
+    if (useRadius) {
+        std::sort(matchesByDistance.begin(), matchesByDistance.end(), [](const std::pair<float, MOType *> &lhs, const std::pair<float, MOType *> &rhs) { return lhs.first < rhs.first; });
+        size_t matchCount = (query.m_Limit > 0) ? std::min(matchesByDistance.size(), static_cast<size_t>(query.m_Limit)) : matchesByDistance.size();
+        matches.reserve(matchCount);
+        for (size_t i = 0; i < matchCount; ++i) {
+            matches.push_back(matchesByDistance[i].second);
+        }
+    }
+    return static_cast<int>(matches.size());
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryActors
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the Actors in the internal Actor list that match a query.
+
+int MovableMan::QueryActors(const MOQuery &query, std::vector<Actor *> &matches) const {
+    return QueryMOList(query, m_Actors, matches);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryItems
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the items in the internal item list that match a query.
+
+int MovableMan::QueryItems(const MOQuery &query, std::vector<MovableObject *> &matches) const {
+    return QueryMOList(query, m_Items, matches);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryParticles
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the particles in the internal particle list that match a query.
+
+int MovableMan::QueryParticles(const MOQuery &query, std::vector<MovableObject *> &matches) const {
+    return QueryMOList(query, m_Particles, matches);
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          AddMO
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -834,6 +940,7 @@ void MovableMan::AddActor(Actor *pActorToAdd)
             if (pActorToAdd->IsStatus(Actor::INACTIVE))
                 pActorToAdd->SetStatus(Actor::STABLE);
             pActorToAdd->NotResting();
+            pActorToAdd->WakeUp();
             pActorToAdd->NewFrame();
             pActorToAdd->SetAge(0);
         }
@@ -873,6 +980,7 @@ void MovableMan::AddItem(MovableObject *pItemToAdd)
             if (!pItemToAdd->IsSetToDelete()) { pItemToAdd->MoveOutOfTerrain(g_MaterialGrass); }
 
             pItemToAdd->NotResting();
+            pItemToAdd->WakeUp();
             pItemToAdd->NewFrame();
             pItemToAdd->SetAge(0);
         }
@@ -908,6 +1016,7 @@ void MovableMan::AddParticle(MovableObject *pMOToAdd)
 //            pMOToAdd->MoveOutOfTerrain(g_MaterialGrass);
 
             pMOToAdd->NotResting();
+            pMOToAdd->WakeUp();
             pMOToAdd->NewFrame();
             pMOToAdd->SetAge(0);
         }
@@ -932,19 +1041,21 @@ bool MovableMan::RemoveActor(MovableObject *pActorToRem)
 
     if (pActorToRem)
     {
-        for (deque<Actor *>::iterator itr = m_Actors.begin(); itr != m_Actors.end(); ++itr)
+        for (vector<Actor *>::iterator itr = m_Actors.begin(); itr != m_Actors.end(); ++itr)
         {
             if (*itr == pActorToRem)
             {
-                m_Actors.erase(itr);
+                // Actor order doesn't matter, so swap-remove instead of shifting everything after it
+                *itr = m_Actors.back();
+                m_Actors.pop_back();
                 removed = true;
                 break;
             }
         }
-        // Try the newly added actors if we couldn't find it in the regular deque
+        // Try the newly added actors if we couldn't find it in the regular list
         if (!removed)
         {
-            for (deque<Actor *>::iterator itr = m_AddedActors.begin(); itr != m_AddedActors.end(); ++itr)
+            for (vector<Actor *>::iterator itr = m_AddedActors.begin(); itr != m_AddedActors.end(); ++itr)
             {
                 if (*itr == pActorToRem)
                 {
@@ -973,7 +1084,7 @@ bool MovableMan::RemoveItem(MovableObject *pItemToRem)
 
     if (pItemToRem)
     {
-        for (deque<MovableObject *>::iterator itr = m_Items.begin(); itr != m_Items.end(); ++itr)
+        for (vector<MovableObject *>::iterator itr = m_Items.begin(); itr != m_Items.end(); ++itr)
         {
             if (*itr == pItemToRem)
             {
@@ -982,10 +1093,10 @@ bool MovableMan::RemoveItem(MovableObject *pItemToRem)
                 break;
             }
         }
-        // Try the newly added items if we couldn't find it in the regular deque
+        // Try the newly added items if we couldn't find it in the regular list
         if (!removed)
         {
-            for (deque<MovableObject *>::iterator itr = m_AddedItems.begin(); itr != m_AddedItems.end(); ++itr)
+            for (vector<MovableObject *>::iterator itr = m_AddedItems.begin(); itr != m_AddedItems.end(); ++itr)
             {
                 if (*itr == pItemToRem)
                 {
@@ -1075,19 +1186,20 @@ bool MovableMan::RemoveParticle(MovableObject *pMOToRem)
 
     if (pMOToRem)
     {
-        for (deque<MovableObject *>::iterator itr = m_Particles.begin(); itr != m_Particles.end(); ++itr)
+        for (vector<MovableObject *>::iterator itr = m_Particles.begin(); itr != m_Particles.end(); ++itr)
         {
             if (*itr == pMOToRem)
             {
-                m_Particles.erase(itr);
+                *itr = m_Particles.back();
+                m_Particles.pop_back();
                 removed = true;
                 break;
             }
         }
-        // Try the newly added particles if we couldn't find it in the regular deque
+        // Try the newly added particles if we couldn't find it in the regular list
         if (!removed)
         {
-            for (deque<MovableObject *>::iterator itr = m_AddedParticles.begin(); itr != m_AddedParticles.end(); ++itr)
+            for (vector<MovableObject *>::iterator itr = m_AddedParticles.begin(); itr != m_AddedParticles.end(); ++itr)
             {
                 if (*itr == pMOToRem)
                 {
@@ -1173,7 +1285,7 @@ bool MovableMan::IsActor(const MovableObject *pMOToCheck)
 
     if (pMOToCheck)
     {
-        for (deque<Actor *>::iterator itr = m_Actors.begin(); !found && itr != m_Actors.end(); ++itr)
+        for (vector<Actor *>::iterator itr = m_Actors.begin(); !found && itr != m_Actors.end(); ++itr)
         {
             if (*itr == pMOToCheck)
             {
@@ -1184,7 +1296,7 @@ bool MovableMan::IsActor(const MovableObject *pMOToCheck)
         // Try the actors just added this frame
         if (!found)
         {
-            for (deque<Actor *>::iterator itr = m_AddedActors.begin(); !found && itr != m_AddedActors.end(); ++itr)
+            for (vector<Actor *>::iterator itr = m_AddedActors.begin(); !found && itr != m_AddedActors.end(); ++itr)
             {
                 if (*itr == pMOToCheck)
                 {
@@ -1210,7 +1322,7 @@ bool MovableMan::IsDevice(const MovableObject *pMOToCheck)
 
     if (pMOToCheck)
     {
-        for (deque<MovableObject *>::iterator itr = m_Items.begin(); !found && itr != m_Items.end(); ++itr)
+        for (vector<MovableObject *>::iterator itr = m_Items.begin(); !found && itr != m_Items.end(); ++itr)
         {
             if (*itr == pMOToCheck)
             {
@@ -1221,7 +1333,7 @@ bool MovableMan::IsDevice(const MovableObject *pMOToCheck)
         // Try the items just added this frame
         if (!found)
         {
-            for (deque<MovableObject *>::iterator itr = m_AddedItems.begin(); !found && itr != m_AddedItems.end(); ++itr)
+            for (vector<MovableObject *>::iterator itr = m_AddedItems.begin(); !found && itr != m_AddedItems.end(); ++itr)
             {
                 if (*itr == pMOToCheck)
                 {
@@ -1247,7 +1359,7 @@ bool MovableMan::IsParticle(const MovableObject *pMOToCheck)
 
     if (pMOToCheck)
     {
-        for (deque<MovableObject *>::iterator itr = m_Particles.begin(); !found && itr != m_Particles.end(); ++itr)
+        for (vector<MovableObject *>::iterator itr = m_Particles.begin(); !found && itr != m_Particles.end(); ++itr)
         {
             if (*itr == pMOToCheck)
             {
@@ -1258,7 +1370,7 @@ bool MovableMan::IsParticle(const MovableObject *pMOToCheck)
         // Try the items just added this frame
         if (!found)
         {
-            for (deque<MovableObject *>::iterator itr = m_AddedParticles.begin(); !found && itr != m_AddedParticles.end(); ++itr)
+            for (vector<MovableObject *>::iterator itr = m_AddedParticles.begin(); !found && itr != m_AddedParticles.end(); ++itr)
             {
                 if (*itr == pMOToCheck)
                 {
@@ -1291,7 +1403,7 @@ bool MovableMan::IsOfActor(MOID checkMOID)
         MOID rootMOID = pMO->GetRootID();
         if (checkMOID != g_NoMOID)
         {
-            for (deque<Actor *>::iterator itr = m_Actors.begin(); !found && itr != m_Actors.end(); ++itr)
+            for (vector<Actor *>::iterator itr = m_Actors.begin(); !found && itr != m_Actors.end(); ++itr)
             {
                 if ((*itr)->GetID() == checkMOID || (*itr)->GetID() == rootMOID)
                 {
@@ -1302,7 +1414,7 @@ bool MovableMan::IsOfActor(MOID checkMOID)
             // Check actors just added this frame
             if (!found)
             {
-                for (deque<Actor *>::iterator itr = m_AddedActors.begin(); !found && itr != m_AddedActors.end(); ++itr)
+                for (vector<Actor *>::iterator itr = m_AddedActors.begin(); !found && itr != m_AddedActors.end(); ++itr)
                 {
                     if ((*itr)->GetID() == checkMOID || (*itr)->GetID() == rootMOID)
                     {
@@ -1359,8 +1471,8 @@ bool MovableMan::RemoveMO(MovableObject *pMOToRem)
 int MovableMan::KillAllTeamActors(int teamToKill) const {
     int killCount = 0;
 
-    for (std::deque<Actor *> actorList : { m_Actors, m_AddedActors }) {
-        for (Actor *actor : actorList) {
+    for (const std::vector<Actor *> *actorList : { &m_Actors, &m_AddedActors }) {
+        for (Actor *actor : *actorList) {
             if (actor->GetTeam() == teamToKill) {
                 const AHuman *actorAsHuman = dynamic_cast<AHuman *>(actor);
                 if (actorAsHuman && actorAsHuman->GetHead()) {
@@ -1381,8 +1493,8 @@ int MovableMan::KillAllTeamActors(int teamToKill) const {
 int MovableMan::KillAllEnemyActors(int teamNotToKill) const {
     int killCount = 0;
 
-    for (std::deque<Actor *> actorList : { m_Actors, m_AddedActors }) {
-        for (Actor *actor : actorList) {
+    for (const std::vector<Actor *> *actorList : { &m_Actors, &m_AddedActors }) {
+        for (Actor *actor : *actorList) {
             if (actor->GetTeam() != teamNotToKill) {
                 const AHuman *actorAsHuman = dynamic_cast<AHuman *>(actor);
                 if (actorAsHuman && actorAsHuman->GetHead()) {
@@ -1412,7 +1524,7 @@ int MovableMan::EjectAllActors(list<SceneObject *> &actorList, int onlyTeam, boo
     int addedCount = 0;
 
     // Add all regular Actors
-    for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
     {
         // Only grab ones of a specific team; delete all others
         if ((onlyTeam == Activity::NoTeam || (*aIt)->GetTeam() == onlyTeam) && (!noBrains || !(*aIt)->HasObjectInGroup("Brains")))
@@ -1427,7 +1539,7 @@ int MovableMan::EjectAllActors(list<SceneObject *> &actorList, int onlyTeam, boo
     m_Actors.clear();
 
     // Add all Actors added this frame
-    for (deque<Actor *>::iterator aIt = m_AddedActors.begin(); aIt != m_AddedActors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_AddedActors.begin(); aIt != m_AddedActors.end(); ++aIt)
     {
         // Only grab ones of a specific team; delete all others
         if ((onlyTeam == Activity::NoTeam || (*aIt)->GetTeam() == onlyTeam) && (!noBrains || !(*aIt)->HasObjectInGroup("Brains")))
@@ -1460,7 +1572,7 @@ int MovableMan::EjectAllItems(list<SceneObject *> &itemList)
     int addedCount = 0;
 
     // Add all regular Items
-    for (deque<MovableObject *>::iterator iIt = m_Items.begin(); iIt != m_Items.end(); ++iIt)
+    for (vector<MovableObject *>::iterator iIt = m_Items.begin(); iIt != m_Items.end(); ++iIt)
     {
         itemList.push_back((*iIt));
         addedCount++;
@@ -1469,7 +1581,7 @@ int MovableMan::EjectAllItems(list<SceneObject *> &itemList)
     m_Items.clear();
 
     // Add all Items added this frame
-    for (deque<MovableObject *>::iterator iIt = m_AddedItems.begin(); iIt != m_AddedItems.end(); ++iIt)
+    for (vector<MovableObject *>::iterator iIt = m_AddedItems.begin(); iIt != m_AddedItems.end(); ++iIt)
     {
         itemList.push_back((*iIt));
         addedCount++;
@@ -1501,7 +1613,7 @@ int MovableMan::GetTeamMOIDCount(int team) const
 void MovableMan::OpenAllDoors(bool open, int team)
 {
     ADoor *pDoor = 0;
-    for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
     {
         pDoor = dynamic_cast<ADoor *>(*aIt);
         if (pDoor && (team == Activity::NoTeam || pDoor->GetTeam() == team))
@@ -1516,7 +1628,7 @@ void MovableMan::OpenAllDoors(bool open, int team)
         }
     }
     // Also check all doors added this frame
-    for (deque<Actor *>::iterator aIt = m_AddedActors.begin(); aIt != m_AddedActors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_AddedActors.begin(); aIt != m_AddedActors.end(); ++aIt)
     {
         pDoor = dynamic_cast<ADoor *>(*aIt);
         if (pDoor && (team == Activity::NoTeam || pDoor->GetTeam() == team))
@@ -1543,7 +1655,7 @@ void MovableMan::OpenAllDoors(bool open, int team)
 void MovableMan::OverrideMaterialDoors(bool enable, int team)
 {
     ADoor *pDoor = 0;
-    for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
     {
         pDoor = dynamic_cast<ADoor *>(*aIt);
         if (pDoor && (team == Activity::NoTeam || pDoor->GetTeam() == team))
@@ -1554,7 +1666,7 @@ void MovableMan::OverrideMaterialDoors(bool enable, int team)
         }
     }
     // Also check all doors added this frame
-    for (deque<Actor *>::iterator aIt = m_AddedActors.begin(); aIt != m_AddedActors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_AddedActors.begin(); aIt != m_AddedActors.end(); ++aIt)
     {
         pDoor = dynamic_cast<ADoor *>(*aIt);
         if (pDoor && (team == Activity::NoTeam || pDoor->GetTeam() == team))
@@ -1575,17 +1687,17 @@ void MovableMan::OverrideMaterialDoors(bool enable, int team)
 
 void MovableMan::RedrawOverlappingMOIDs(MovableObject *pOverlapsThis)
 {
-    for (deque<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
+    for (vector<Actor *>::iterator aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
     {
         (*aIt)->DrawMOIDIfOverlapping(pOverlapsThis);
     }
 
-    for (deque<MovableObject *>::iterator iIt = m_Items.begin(); iIt != m_Items.end(); ++iIt)
+    for (vector<MovableObject *>::iterator iIt = m_Items.begin(); iIt != m_Items.end(); ++iIt)
     {
         (*iIt)->DrawMOIDIfOverlapping(pOverlapsThis);
     }
 
-    for (deque<MovableObject *>::iterator parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
+    for (vector<MovableObject *>::iterator parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
     {
         (*parIt)->DrawMOIDIfOverlapping(pOverlapsThis);
     }
@@ -1594,9 +1706,9 @@ void MovableMan::RedrawOverlappingMOIDs(MovableObject *pOverlapsThis)
 
 void MovableMan::OnPieMenu(Actor * pActor)
 {
-	deque<Actor *>::iterator aIt;
-	deque<MovableObject *>::iterator iIt;
-	deque<MovableObject *>::iterator parIt;
+	vector<Actor *>::iterator aIt;
+	vector<MovableObject *>::iterator iIt;
+	vector<MovableObject *>::iterator parIt;
 
 	for (aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
 	{
@@ -1652,16 +1764,16 @@ void MovableMan::Update()
         m_AlarmEvents.push_back(*aeItr);
     m_AddedAlarmEvents.clear();
 
+    // Decide which AI Actors get to think this update, based on how close they are to the action
+    m_AIScheduler.ScheduleAIUpdates(m_Actors, m_AlarmEvents, m_SimUpdateFrameNumber);
+
     // Pre-lock Scene for all the accesses to its bitmaps
     g_SceneMan.LockScene();
 
     // Will use some common iterators
-    deque<Actor *>::iterator aIt;
-    deque<Actor *>::iterator amidIt;
-    deque<MovableObject *>::iterator iIt;
-    deque<MovableObject *>::iterator imidIt;
-    deque<MovableObject *>::iterator parIt;
-    deque<MovableObject *>::iterator midIt;
+    vector<Actor *>::iterator aIt;
+    vector<MovableObject *>::iterator iIt;
+    vector<MovableObject *>::iterator parIt;
 
     ////////////////////////////////////////////////////////////////////////////
     // First Pass
@@ -1670,9 +1782,11 @@ void MovableMan::Update()
         // Travel Actors
 		g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::ActorsTravel);
         {
+			ProfileZone profileZone("MovableMan Actors Travel");
             for (aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
             {
-                if (!((*aIt)->IsUpdated()))
+                // Sleeping MOs are resting and haven't been disturbed, so there's nothing to travel
+                if (!(*aIt)->IsUpdated() && !(*aIt)->IsAsleep())
                 {
                     (*aIt)->ApplyForces();
                     (*aIt)->PreTravel();
@@ -1696,7 +1810,8 @@ void MovableMan::Update()
         {
             for (iIt = m_Items.begin(); iIt != m_Items.end(); ++iIt)
             {
-                if (!((*iIt)->IsUpdated()))
+                // Sleeping MOs are resting and haven't been disturbed, so there's nothing to travel
+                if (!(*iIt)->IsUpdated() && !(*iIt)->IsAsleep())
                 {
                     (*iIt)->ApplyForces();
                     (*iIt)->PreTravel();
@@ -1710,9 +1825,11 @@ void MovableMan::Update()
         // Travel particles
 		g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::ParticlesTravel);
         {
+			ProfileZone profileZone("MovableMan Particles Travel");
             for (parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
             {
-                if (!((*parIt)->IsUpdated()))
+                // Sleeping MOs are resting and haven't been disturbed, so there's nothing to travel
+                if (!(*parIt)->IsUpdated() && !(*parIt)->IsAsleep())
                 {
                     (*parIt)->ApplyForces();
                     (*parIt)->PreTravel();
@@ -1736,6 +1853,7 @@ void MovableMan::Update()
         // Actors
 		g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::ActorsUpdate);
         {
+			ProfileZone profileZone("MovableMan Actors Update");
             for (aIt = m_Actors.begin(); aIt != m_Actors.end(); ++aIt)
             {
 				(*aIt)->Update();
@@ -1764,6 +1882,7 @@ void MovableMan::Update()
         // Particles
 		g_PerformanceMan.StartPerformanceMeasurement(PerformanceMan::ParticlesUpdate);
         {
+			ProfileZone profileZone("MovableMan Particles Update");
             for (parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
             {
                 (*parIt)->Update();
@@ -1779,8 +1898,43 @@ void MovableMan::Update()
             }
         }
 		g_PerformanceMan.StopPerformanceMeasurement(PerformanceMan::ParticlesUpdate);
+
+        // Thread-safe scripts queued their Update during the passes above, run them all in parallel now and apply what they deferred
+        g_LuaMan.RunParallelScriptUpdates();
+    }
+
+    ///////////////////////////////////////////////////
+    // Put MOs that have been resting long enough to sleep, and wake up the ones that were disturbed this update
+
+    {
+        int sleepingCount = 0;
+        int fellAsleepCount = 0;
+        int wokeUpCount = 0;
+        auto updateSleepState = [&sleepingCount, &fellAsleepCount, &wokeUpCount](MovableObject *movableObject) {
+            bool wasAsleep = movableObject->IsAsleep();
+            movableObject->UpdateSleepState();
+            if (movableObject->IsAsleep())
+            {
+                ++sleepingCount;
+                if (!wasAsleep) { ++fellAsleepCount; }
+            }
+            else if (wasAsleep)
+            {
+                ++wokeUpCount;
+            }
+        };
+        std::for_each(m_Actors.begin(), m_Actors.end(), updateSleepState);
+        std::for_each(m_Items.begin(), m_Items.end(), updateSleepState);
+        std::for_each(m_Particles.begin(), m_Particles.end(), updateSleepState);
+        g_SceneMan.ClearTerrainChanges();
+        g_PerformanceMan.SetSleepCounts(sleepingCount, fellAsleepCount, wokeUpCount);
     }
 
+    ///////////////////////////////////////////////////
+    // Apply finished field-of-view passes and hand this update's eye points over to the next ones
+
+    g_SceneMan.UpdateTeamVisibility();
+
     ///////////////////////////////////////////////////
     // Clear the MOID layer before starting to delete stuff which may be in the MOIDIndex
 
@@ -1814,7 +1968,7 @@ void MovableMan::Update()
 				if ((*aIt)->GetTeam() >= 0)
 					//m_ActorRoster[(*aIt)->GetTeam()].remove(*aIt);
 					RemoveActorFromTeamRoster(*aIt);
-                delete (*aIt);
+                m_MOsToDelete.push_back(*aIt);
 			}
         }
         m_AddedActors.clear();
@@ -1826,7 +1980,7 @@ void MovableMan::Update()
             if (!(*iIt)->IsSetToDelete())
                 m_Items.push_back(*iIt);
             else
-                delete (*iIt);
+                m_MOsToDelete.push_back(*iIt);
         }
         m_AddedItems.clear();
 
@@ -1837,138 +1991,119 @@ void MovableMan::Update()
             if (!(*parIt)->IsSetToDelete())
                 m_Particles.push_back(*parIt);
             else
-                delete (*parIt);
+                m_MOsToDelete.push_back(*parIt);
         }
         m_AddedParticles.clear();
     }
 
     ////////////////////////////////////////////////////////////////////////////
     // Copy (Settle) Pass
+    // Everything removed here is only queued for deletion, and deleted all together at the end of the update
 
     {
+		ProfileZone profileZone("MovableMan Settle");
         g_SceneMan.UnlockScene();
         acquire_bitmap(g_SceneMan.GetTerrain()->GetMaterialBitmap());
 
-        // DEATH //////////////////////////////////////////////////////////
-        // Transfer dead actors from Actor list to particle list
-        aIt = partition(m_Actors.begin(), m_Actors.end(), std::not_fn(std::mem_fn(&Actor::IsDead)));
-        amidIt = aIt;
-
-        // Move dead Actor to particles list
-        if (amidIt != m_Actors.end()/* && m_Actors.size() > 1*/)
+        // DEATH AND DELETE //////////////////////////////////////////////////////////
+        // Actor order doesn't matter, so removed Actors are swapped with the last one instead of shifting everything after them
+        for (size_t actorIndex = 0; actorIndex < m_Actors.size();)
         {
-            while (aIt != m_Actors.end())
+            Actor *pActor = m_Actors[actorIndex];
+            if (pActor->IsDead())
             {
                 // Report the death of the actor to the game
-                g_ActivityMan.GetActivity()->ReportDeath((*aIt)->GetTeam());
+                g_ActivityMan.GetActivity()->ReportDeath(pActor->GetTeam());
 
                 // Add to the particles list
-                m_Particles.push_back(*aIt);
+                m_Particles.push_back(pActor);
                 // Remove from the team roster
+                if (pActor->GetTeam() >= 0)
+                    RemoveActorFromTeamRoster(pActor);
+            }
+            else if (pActor->ToDelete())
+            {
+                // Set brain to 0 to avoid crasehs due to brain deletion
+                Activity * pActivity = g_ActivityMan.GetActivity();
+                if (pActivity)
+                {
+                    if (pActivity->IsAssignedBrain(pActor))
+                        pActivity->SetPlayerBrain(0, pActivity->IsBrainOfWhichPlayer(pActor));
 
-                if ((*aIt)->GetTeam() >= 0)
-                    //m_ActorRoster[(*aIt)->GetTeam()].remove(*aIt);
-					RemoveActorFromTeamRoster(*aIt);
-                aIt++;
+                    pActivity->ReportDeath(pActor->GetTeam());
+                }
+
+                // Remove from team rosters
+                if (pActor->GetTeam() >= Activity::TeamOne && pActor->GetTeam() < Activity::MaxTeamCount)
+                    RemoveActorFromTeamRoster(pActor);
+
+                m_MOsToDelete.push_back(pActor);
             }
-            // Try to set the existing iterator to a safer value, erase can crash in debug mode otherwise?
-            aIt = m_Actors.begin();
-            m_Actors.erase(amidIt, m_Actors.end());
+            else
+            {
+                ++actorIndex;
+                continue;
+            }
+            m_Actors[actorIndex] = m_Actors.back();
+            m_Actors.pop_back();
         }
 
-        // ITEM SETTLE //////////////////////////////////////////////////////////
-        // Transfer excess items to particle list - use stable partition, item orde is important
-        iIt = stable_partition(m_Items.begin(), m_Items.end(), std::not_fn(std::mem_fn(&MovableObject::ToSettle)));
-        imidIt = iIt;
-
-        // Move force-settled items to particles list
-        if (imidIt != m_Items.end()/* && m_Items.size() > 1*/)
+        // ITEM SETTLE AND DELETE //////////////////////////////////////////////////////////
+        // Item order is important, so the remaining items are compacted in place instead of swapped around
+        size_t keptItemCount = 0;
+        for (MovableObject *pItem : m_Items)
         {
-            while (iIt != m_Items.end())
+            if (pItem->ToSettle())
             {
-                (*iIt)->SetToSettle(false);
+                // Transfer excess items to particle list, they'll be deleted from there if they're also marked for it
+                pItem->SetToSettle(false);
 				// Disable TDExplosive's immunity to settling
-				if ((*iIt)->GetRestThreshold()< 0)
-					(*iIt)->SetRestThreshold(500);
-                m_Particles.push_back(*(iIt++));
+				if (pItem->GetRestThreshold() < 0)
+					pItem->SetRestThreshold(500);
+                m_Particles.push_back(pItem);
             }
-            m_Items.erase(imidIt, m_Items.end());
+            else if (pItem->ToDelete())
+                m_MOsToDelete.push_back(pItem);
+            else
+                m_Items[keptItemCount++] = pItem;
         }
+        m_Items.resize(keptItemCount);
 
-        // DELETE //////////////////////////////////////////////////////////
-        // Only delete after all travels & updates are done
-        // Actors
-        aIt = partition(m_Actors.begin(), m_Actors.end(), std::not_fn(std::mem_fn(&MovableObject::ToDelete)));
-        amidIt = aIt;
-
-        while (aIt != m_Actors.end())
+        // PARTICLE DELETE AND SETTLE //////////////////////////////////////////////////
+        // Particles settle only after all updates are done. Particle order doesn't matter either, so they're swap-removed like Actors
+        for (size_t particleIndex = 0; particleIndex < m_Particles.size();)
         {
-			// Set brain to 0 to avoid crasehs due to brain deletion
-			Activity * pActivity = g_ActivityMan.GetActivity();
-			if (pActivity)
-			{
-				if (pActivity->IsAssignedBrain(*aIt))
-					pActivity->SetPlayerBrain(0, pActivity->IsBrainOfWhichPlayer(*aIt));
-
-				pActivity->ReportDeath((*aIt)->GetTeam());
-			}
-
-            // Remove from team rosters
-			if ((*aIt)->GetTeam() >= Activity::TeamOne && (*aIt)->GetTeam() < Activity::MaxTeamCount)
-                //m_ActorRoster[(*aIt)->GetTeam()].remove(*aIt);
-				RemoveActorFromTeamRoster(*aIt);
-
-            // Delete
-            delete *aIt;
-            aIt++;
+            MovableObject *pParticle = m_Particles[particleIndex];
+            if (pParticle->ToDelete())
+                m_MOsToDelete.push_back(pParticle);
+            else if (m_SettlingEnabled && pParticle->ToSettle())
+            {
+                Vector parPos(pParticle->GetPos());
+                Material const * terrMat = g_SceneMan.GetMaterialFromID(g_SceneMan.GetTerrain()->GetMaterialPixel(parPos.GetFloorIntX(), parPos.GetFloorIntY()));
+                int piling = pParticle->GetMaterial()->GetPiling();
+                if (piling > 0) {
+                    for (int s = 0; s < piling && (terrMat->GetIndex() == pParticle->GetMaterial()->GetIndex() || terrMat->GetIndex() == pParticle->GetMaterial()->GetSettleMaterial()); ++s) {
+                        if ((piling - s) % 2 == 0) {
+                            parPos.m_Y -= 1.0F;
+                        } else {
+                            parPos.m_X += (RandomNum() >= 0.5F ? 1.0F : -1.0F);
+                        }
+                        terrMat = g_SceneMan.GetMaterialFromID(g_SceneMan.GetTerrain()->GetMaterialPixel(parPos.GetFloorIntX(), parPos.GetFloorIntY()));
+                    }
+                    pParticle->SetPos(parPos.GetFloored());
+                }
+                if (pParticle->GetDrawPriority() >= terrMat->GetPriority()) { g_SceneMan.GetTerrain()->ApplyMovableObject(pParticle); }
+                m_MOsToDelete.push_back(pParticle);
+            }
+            else
+            {
+                ++particleIndex;
+                continue;
+            }
+            m_Particles[particleIndex] = m_Particles.back();
+            m_Particles.pop_back();
         }
-        // Try to set the existing iterator to a safer value, erase can crash in debug mode otherwise?
-        aIt = m_Actors.begin();
-        m_Actors.erase(amidIt, m_Actors.end());
-
-        // Items
-        iIt = stable_partition(m_Items.begin(), m_Items.end(), std::not_fn(std::mem_fn(&MovableObject::ToDelete)));
-        imidIt = iIt;
-
-        while (iIt != m_Items.end())
-            delete *(iIt++);
-        m_Items.erase(imidIt, m_Items.end());
-
-        // Particles
-        parIt = partition(m_Particles.begin(), m_Particles.end(), std::not_fn(std::mem_fn(&MovableObject::ToDelete)));
-        midIt = parIt;
-
-        while (parIt != m_Particles.end())
-            delete *(parIt++);
-        m_Particles.erase(midIt, m_Particles.end());
-    }
-
-    // SETTLE PARTICLES //////////////////////////////////////////////////
-    // Only settle after all updates and deletions are done
-	if (m_SettlingEnabled) {
-		parIt = partition(m_Particles.begin(), m_Particles.end(), std::not_fn(std::mem_fn(&MovableObject::ToSettle)));
-		midIt = parIt;
-
-		while (parIt != m_Particles.end()) {
-			Vector parPos((*parIt)->GetPos());
-			Material const * terrMat = g_SceneMan.GetMaterialFromID(g_SceneMan.GetTerrain()->GetMaterialPixel(parPos.GetFloorIntX(), parPos.GetFloorIntY()));
-			int piling = (*parIt)->GetMaterial()->GetPiling();
-			if (piling > 0) {
-				for (int s = 0; s < piling && (terrMat->GetIndex() == (*parIt)->GetMaterial()->GetIndex() || terrMat->GetIndex() == (*parIt)->GetMaterial()->GetSettleMaterial()); ++s) {
-					if ((piling - s) % 2 == 0) {
-						parPos.m_Y -= 1.0F;
-					} else {
-						parPos.m_X += (RandomNum() >= 0.5F ? 1.0F : -1.0F);
-					}
-					terrMat = g_SceneMan.GetMaterialFromID(g_SceneMan.GetTerrain()->GetMaterialPixel(parPos.GetFloorIntX(), parPos.GetFloorIntY()));
-				}
-				(*parIt)->SetPos(parPos.GetFloored());
-			}
-			if ((*parIt)->GetDrawPriority() >= terrMat->GetPriority()) { g_SceneMan.GetTerrain()->ApplyMovableObject(*parIt); }
-			delete *(parIt++);
-		}
-		m_Particles.erase(midIt, m_Particles.end());
-	}
+    }
 
     release_bitmap(g_SceneMan.GetTerrain()->GetMaterialBitmap());
 
@@ -2003,7 +2138,7 @@ void MovableMan::Update()
     // Draw the MO colors ONLY if this is a drawn update!
 
     if (g_TimerMan.DrawnSimUpdate())
-        Draw(g_SceneMan.GetMOColorBitmap());
+        DrawWithinBoxes(g_SceneMan.GetMOColorBitmap(), g_SceneMan.GetMOColorLayerDrawBoxes());
 
     // Sort team rosters if necessary
     {
@@ -2016,6 +2151,23 @@ void MovableMan::Update()
         if (m_SortTeamRoster[Activity::TeamFour])
             m_ActorRoster[Activity::TeamFour].sort(MOXPosComparison());
     }
+
+    // Finally delete everything that was removed during this update in one go
+    DeleteQueuedMOs();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DeleteQueuedMOs
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Deletes all the MOs that were queued for deletion during the update.
+
+void MovableMan::DeleteQueuedMOs()
+{
+    // This has to stay on the main thread, since MO destruction touches Lua states and this manager's own bookkeeping
+    for (MovableObject *pMOToDelete : m_MOsToDelete)
+        delete pMOToDelete;
+    m_MOsToDelete.clear();
 }
 
 
@@ -2028,10 +2180,10 @@ void MovableMan::Update()
 void MovableMan::DrawMatter(BITMAP *pTargetBitmap, Vector &targetPos)
 {
     // Draw objects to accumulation bitmap
-    for (deque<Actor *>::iterator aIt = --m_Actors.end(); aIt != --m_Actors.begin(); --aIt)
+    for (vector<Actor *>::reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
         (*aIt)->Draw(pTargetBitmap, targetPos, g_DrawMaterial);
 
-    for (deque<MovableObject *>::iterator parIt = --m_Particles.end(); parIt != --m_Particles.begin(); --parIt)
+    for (vector<MovableObject *>::reverse_iterator parIt = m_Particles.rbegin(); parIt != m_Particles.rend(); ++parIt)
         (*parIt)->Draw(pTargetBitmap, targetPos, g_DrawMaterial);
 }
 
@@ -2057,13 +2209,13 @@ void MovableMan::VerifyMOIDIndex()
 	}
 
 
-	for (deque<MovableObject *>::iterator itr = m_Items.begin(); itr != m_Items.end(); ++itr)
+	for (vector<MovableObject *>::iterator itr = m_Items.begin(); itr != m_Items.end(); ++itr)
 	{
 		RTEAssert((*itr)->GetID() == g_NoMOID || (*itr)->GetID() < GetMOIDCount(), "MOIDIndex broken!");
 		RTEAssert((*itr)->GetRootID() == g_NoMOID || ((*itr)->GetRootID() >= 0 && (*itr)->GetRootID() < g_MovableMan.GetMOIDCount()), "MOIDIndex broken!");
 	}
 	// Try the items just added this frame
-	for (deque<MovableObject *>::iterator itr = m_AddedItems.begin(); itr != m_AddedItems.end(); ++itr)
+	for (vector<MovableObject *>::iterator itr = m_AddedItems.begin(); itr != m_AddedItems.end(); ++itr)
 	{
 		RTEAssert((*itr)->GetID() == g_NoMOID || (*itr)->GetID() < GetMOIDCount(), "MOIDIndex broken!");
 		RTEAssert((*itr)->GetRootID() == g_NoMOID || ((*itr)->GetRootID() >= 0 && (*itr)->GetRootID() < g_MovableMan.GetMOIDCount()), "MOIDIndex broken!");
@@ -2137,17 +2289,58 @@ void MovableMan::UpdateDrawMOIDs(BITMAP *pTargetBitmap)
 void MovableMan::Draw(BITMAP *pTargetBitmap, const Vector &targetPos)
 {
     // Draw objects to accumulation bitmap, in reverse order so actors appear on top.
-    for (deque<MovableObject *>::iterator parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
+    for (vector<MovableObject *>::iterator parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
         (*parIt)->Draw(pTargetBitmap, targetPos);
 
-	for (deque<MovableObject *>::reverse_iterator itmIt = m_Items.rbegin(); itmIt != m_Items.rend(); ++itmIt)
+	for (vector<MovableObject *>::reverse_iterator itmIt = m_Items.rbegin(); itmIt != m_Items.rend(); ++itmIt)
         (*itmIt)->Draw(pTargetBitmap, targetPos);
 
-    for (deque<Actor *>::reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
+    for (vector<Actor *>::reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
         (*aIt)->Draw(pTargetBitmap, targetPos);
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawWithinBoxes
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws only the MOs that reach into any of a list of scene areas to a
+//                  BITMAP of choice. Everything else is skipped entirely.
+
+void MovableMan::DrawWithinBoxes(BITMAP *pTargetBitmap, const std::list<Box> &drawBoxes, const Vector &targetPos)
+{
+    // MOs straddling a wrapped seam are caught by the parts of the boxes that were wrapped over to their side
+    auto isWithinDrawBoxes = [&drawBoxes](const MovableObject *pMO) {
+        const Vector &pos = pMO->GetPos();
+        float radius = pMO->GetRadius();
+        for (const Box &drawBox : drawBoxes)
+        {
+            if (pos.m_X + radius >= drawBox.GetCorner().m_X && pos.m_X - radius <= drawBox.GetCorner().m_X + drawBox.GetWidth() && pos.m_Y + radius >= drawBox.GetCorner().m_Y && pos.m_Y - radius <= drawBox.GetCorner().m_Y + drawBox.GetHeight())
+                return true;
+        }
+        return false;
+    };
+
+    // Same order as Draw, so actors appear on top.
+    for (vector<MovableObject *>::iterator parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
+    {
+        if (isWithinDrawBoxes(*parIt))
+            (*parIt)->Draw(pTargetBitmap, targetPos);
+    }
+
+    for (vector<MovableObject *>::reverse_iterator itmIt = m_Items.rbegin(); itmIt != m_Items.rend(); ++itmIt)
+    {
+        if (isWithinDrawBoxes(*itmIt))
+            (*itmIt)->Draw(pTargetBitmap, targetPos);
+    }
+
+    for (vector<Actor *>::reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
+    {
+        if (isWithinDrawBoxes(*aIt))
+            (*aIt)->Draw(pTargetBitmap, targetPos);
+    }
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          DrawHUD
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -2157,10 +2350,10 @@ void MovableMan::Draw(BITMAP *pTargetBitmap, const Vector &targetPos)
 void MovableMan::DrawHUD(BITMAP *pTargetBitmap, const Vector &targetPos, int which, bool playerControlled)
 {
     // Draw HUD elements
-	for (deque<MovableObject *>::reverse_iterator itmIt = m_Items.rbegin(); itmIt != m_Items.rend(); ++itmIt)
+	for (vector<MovableObject *>::reverse_iterator itmIt = m_Items.rbegin(); itmIt != m_Items.rend(); ++itmIt)
         (*itmIt)->DrawHUD(pTargetBitmap, targetPos, which);
 
-    for (deque<Actor *>::reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
+    for (vector<Actor *>::reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
         (*aIt)->DrawHUD(pTargetBitmap, targetPos, which);
 }
 
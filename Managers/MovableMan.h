@@ -20,6 +20,7 @@
 #include "SceneMan.h"
 #include "LuaMan.h"
 #include "Singleton.h"
+#include "AIScheduler.h"
 
 #define g_MovableMan MovableMan::Instance()
 
@@ -54,6 +55,38 @@ struct AlarmEvent {
 };
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Struct:          MOQuery
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     A struct describing a filter to match MO:s against when querying
+//                  MovableMan's lists in bulk, so scripts don't have to iterate and
+//                  narrow every MO themselves. Empty or default members don't filter.
+// Parent(s):       None.
+
+struct MOQuery {
+	MOQuery() { m_Team = Activity::NoTeam; m_NotOfTeam = Activity::NoTeam; m_Center.Reset(); m_Radius = 0; m_Limit = 0; }
+
+    // Only match MO:s of this team. NoTeam means any team
+    int m_Team;
+    // Only match MO:s NOT of this team, i.e. its enemies. NoTeam means any team
+    int m_NotOfTeam;
+    // Only match MO:s of this class or any class derived from it
+    std::string m_ClassName;
+    // Only match MO:s that are in this group
+    std::string m_Group;
+    // Only match MO:s with exactly this preset name
+    std::string m_PresetName;
+    // Only match MO:s within this box, taking scene wrapping into account. Empty box means anywhere
+    Box m_Box;
+    // Only match MO:s within m_Radius of this point, taking scene wrapping into account
+    Vector m_Center;
+    // The radius around m_Center to match within. 0 means anywhere. When set, matches are ordered closest first
+    float m_Radius;
+    // The maximum number of matches to return. 0 means no limit
+    int m_Limit;
+};
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Class:           MovableMan
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +96,9 @@ struct AlarmEvent {
 
 class MovableMan : public Singleton<MovableMan>, public Serializable {
 	friend class SettingsMan;
+	friend class SimulationSnapshot;
+	friend class InputReplay;
+	friend class LuaQueryBenchmark;
     friend struct ManagerLuaBindings;
 
 
@@ -369,6 +405,42 @@ public:
     Actor * GetUnassignedBrain(int team = 0) const;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryActors
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the Actors in the internal Actor list that match a query.
+// Arguments:       The MOQuery to match the Actors against.
+//                  A vector to fill out with the matching Actors. It is cleared first.
+//                  OWNERSHIP IS NOT TRANSFERRED!
+// Return value:    The number of matching Actors.
+
+    int QueryActors(const MOQuery &query, std::vector<Actor *> &matches) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryItems
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the items in the internal item list that match a query.
+// Arguments:       The MOQuery to match the items against.
+//                  A vector to fill out with the matching items. It is cleared first.
+//                  OWNERSHIP IS NOT TRANSFERRED!
+// Return value:    The number of matching items.
+
+    int QueryItems(const MOQuery &query, std::vector<MovableObject *> &matches) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryParticles
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the particles in the internal particle list that match a query.
+// Arguments:       The MOQuery to match the particles against.
+//                  A vector to fill out with the matching particles. It is cleared first.
+//                  OWNERSHIP IS NOT TRANSFERRED!
+// Return value:    The number of matching particles.
+
+    int QueryParticles(const MOQuery &query, std::vector<MovableObject *> &matches) const;
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetParticleCount
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -832,6 +904,19 @@ public:
     void Draw(BITMAP *pTargetBitmap, const Vector &targetPos = Vector());
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawWithinBoxes
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws only the MOs that reach into any of a list of scene areas to a
+//                  BITMAP of choice. Everything else is skipped entirely.
+// Arguments:       A pointer to a BITMAP to draw on.
+//                  The scene areas to draw within. Should already be wrapped.
+//                  The absolute position of the target bitmap's upper left corner in the scene.
+// Return value:    None.
+
+    void DrawWithinBoxes(BITMAP *pTargetBitmap, const std::list<Box> &drawBoxes, const Vector &targetPos = Vector());
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          DrawHUD
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -905,6 +990,17 @@ public:
 
 	unsigned int GetSimUpdateFrameNumber() const { return m_SimUpdateFrameNumber; }
 
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetAIScheduler
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the scheduler that decides which AI controlled Actors update
+//                  their AI on each sim update.
+// Arguments:       None.
+// Return value:    The AIScheduler.
+
+	AIScheduler & GetAIScheduler() { return m_AIScheduler; }
+
 	void OnPieMenu(Actor *pActor);
 
 
@@ -914,16 +1010,18 @@ public:
 protected:
 
     // All actors in the scene
-    std::deque<Actor *> m_Actors;
+    std::vector<Actor *> m_Actors;
     // List of items that are pickup-able by actors
-    std::deque<MovableObject *> m_Items;
+    std::vector<MovableObject *> m_Items;
     // List of free, dead particles flying around
-    std::deque<MovableObject *> m_Particles;
+    std::vector<MovableObject *> m_Particles;
     // These are the actors/items/particles which were added during a frame.
-    // They are moved to the containers above at the end of the frame.
-    std::deque<Actor *> m_AddedActors;
-    std::deque<MovableObject *> m_AddedItems;
-    std::deque<MovableObject *> m_AddedParticles;
+    // They are moved to the containers above at the end of the frame, and keep their capacity between frames.
+    std::vector<Actor *> m_AddedActors;
+    std::vector<MovableObject *> m_AddedItems;
+    std::vector<MovableObject *> m_AddedParticles;
+    // MOs that were removed during this update, to be deleted all together at the end of it
+    std::vector<MovableObject *> m_MOsToDelete;
 
     // Roster of each team's actors, sorted by their X positions in the scene. Actors not owned here
     std::list<Actor *> m_ActorRoster[Activity::MaxTeamCount];
@@ -966,6 +1064,9 @@ protected:
 
 	unsigned int m_SimUpdateFrameNumber;
 
+    // Decides which AI controlled Actors update their AI on each sim update
+    AIScheduler m_AIScheduler;
+
 	// Global map which stores all objects so they could be foud by their unique ID
 	std::map<long int, MovableObject *> m_KnownObjects;
 
@@ -976,6 +1077,7 @@ protected:
 private:
 
 	static const std::string c_ClassName; //!< A string with the friendly-formatted type name of this object.
+	static constexpr int c_AddQueueReserve = 1024; //!< How many MOs the add and deletion queues have room for before they need to grow.
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          Clear
@@ -988,6 +1090,28 @@ private:
     void Clear();
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          QueryMOList
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets all the MO:s in one of the internal lists that match a query.
+// Arguments:       The MOQuery to match the MO:s against.
+//                  The list of MO:s to search.
+//                  A vector to fill out with the matching MO:s. It is cleared first.
+// Return value:    The number of matching MO:s.
+
+    template <typename MOType> int QueryMOList(const MOQuery &query, const std::vector<MOType *> &moList, std::vector<MOType *> &matches) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DeleteQueuedMOs
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Deletes all the MOs that were queued for deletion during the update.
+// Arguments:       None.
+// Return value:    None.
+
+    void DeleteQueuedMOs();
+
+
     // Disallow the use of some implicit methods.
 	MovableMan(const MovableMan &reference) = delete;
 	MovableMan & operator=(const MovableMan &rhs) = delete;
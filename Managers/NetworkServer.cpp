@@ -13,6 +13,7 @@
 #include "UInputMan.h"
 #include "TimerMan.h"
 #include "AudioMan.h"
+#include "Profiler.h"
 
 #include "RakNetStatistics.h"
 #include "RakSleep.h"
@@ -25,17 +26,23 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkServer::BackgroundSendThreadFunction(NetworkServer *server, short player) {
+		Profiler::SetThreadName("Network Send Player " + std::to_string(player + 1));
 		const int sleepTime = 1000000 / server->m_EncodingFps;
 		while (server->IsServerModeEnabled() && server->IsPlayerConnected(player)) {
 			if (server->NeedToSendSceneSetupData(player) && server->IsSceneAvailable(player)) {
+				ProfileZone profileZone("NetworkServer::SendSceneSetupData");
 				server->SendSceneSetupData(player);
 			}
 			if (server->NeedToSendSceneData(player) && server->IsSceneAvailable(player)) {
+				ProfileZone profileZone("NetworkServer::SendSceneData");
 				server->ClearTerrainChangeQueue(player);
 				server->SendSceneData(player);
 			}
 			if (server->SendFrameData(player)) {
-				server->SendFrame(player);
+				{
+					ProfileZone profileZone("NetworkServer::SendFrame");
+					server->SendFrame(player);
+				}
 				std::this_thread::sleep_for(std::chrono::microseconds(sleepTime));
 			}
 			server->UpdateStats(player);
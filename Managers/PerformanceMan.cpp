@@ -2,6 +2,9 @@
 #include "MovableMan.h"
 #include "FrameMan.h"
 #include "AudioMan.h"
+#include "PrimitiveMan.h"
+#include "LuaMan.h"
+#include "ConsoleMan.h"
 #include "Timer.h"
 
 #include "GUI.h"
@@ -18,6 +21,9 @@ namespace RTE {
 		m_FrameTimer = nullptr;
 		m_MSPFs.clear();
 		m_MSPFAverage = 0;
+		m_SleepingCount = 0;
+		m_FellAsleepCount = 0;
+		m_WokeUpCount = 0;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +38,7 @@ namespace RTE {
 		}
 		m_PerfMeasureStart.fill(0);
 		m_PerfMeasureStop.fill(0);
+		ResetPerformanceTotals();
 
 		// Set up performance counter's names
 		m_PerfCounterNames.at(PerformanceCounters::SimTotal) = "Total";
@@ -41,6 +48,7 @@ namespace RTE {
 		m_PerfCounterNames.at(PerformanceCounters::ParticlesUpdate) = "Prt Update";
 		m_PerfCounterNames.at(PerformanceCounters::ActorsAIUpdate) = "Act AI";
 		m_PerfCounterNames.at(PerformanceCounters::ActivityUpdate) = "Activity";
+		m_PerfCounterNames.at(PerformanceCounters::LuaGarbageCollection) = "Lua GC";
 
 		return 0;
 	}
@@ -81,9 +89,24 @@ namespace RTE {
 		AddPerformanceSample(counter, m_PerfMeasureStop.at(counter) - m_PerfMeasureStart.at(counter));
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	long long PerformanceMan::GetElapsedMeasurementTime(PerformanceCounters counter) const {
+		return g_TimerMan.GetAbsoluteTime() - static_cast<long long>(m_PerfMeasureStart.at(counter));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PerformanceMan::NewPerformanceSample() {
+		// Samples that didn't measure a sim update, like the ones left over from the menus, would only drag the averages down.
+		if (m_PerfData.at(PerformanceCounters::SimTotal).at(m_Sample) > 0) {
+			for (int counter = 0; counter < PerformanceCounters::PerfCounterCount; ++counter) {
+				uint64_t sampleValue = m_PerfData.at(counter).at(m_Sample);
+				m_PerfTotals.at(counter) += sampleValue;
+				m_PerfMaxima.at(counter) = std::max(m_PerfMaxima.at(counter), sampleValue);
+			}
+			m_TotalSampleCount++;
+		}
 		m_Sample++;
 		if (m_Sample >= c_MaxSamples) { m_Sample = 0; }
 
@@ -93,6 +116,31 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PerformanceMan::ResetPerformanceTotals() {
+		m_TotalSampleCount = 0;
+		m_PerfTotals.fill(0);
+		m_PerfMaxima.fill(0);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PerformanceMan::PrintPerformanceTotals() const {
+		char outputString[128];
+		std::snprintf(outputString, sizeof(outputString), "PERF: %i sim updates measured", m_TotalSampleCount);
+		g_ConsoleMan.PrintString(outputString);
+		if (m_TotalSampleCount == 0) {
+			return;
+		}
+		for (int counter = 0; counter < PerformanceCounters::PerfCounterCount; ++counter) {
+			float averageTime = static_cast<float>(m_PerfTotals.at(counter)) / static_cast<float>(m_TotalSampleCount) / 1000.0F;
+			float maximumTime = static_cast<float>(m_PerfMaxima.at(counter)) / 1000.0F;
+			std::snprintf(outputString, sizeof(outputString), "PERF: %-24s avg %7.3f ms   max %8.3f ms", m_PerfCounterNames.at(counter).c_str(), averageTime, maximumTime);
+			g_ConsoleMan.PrintString(outputString);
+		}
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PerformanceMan::CalculateSamplePercentages() {
@@ -173,6 +221,22 @@ namespace RTE {
 			}
 			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 100, str, GUIFont::Left);
 
+			std::snprintf(str, sizeof(str), "Sleeping Bodies: %i (%i fell asleep, %i woke up)", m_SleepingCount, m_FellAsleepCount, m_WokeUpCount);
+			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 110, str, GUIFont::Left);
+
+			std::snprintf(str, sizeof(str), "Primitives: %i (%i drawn, %i culled) %.2f ms", g_PrimitiveMan.GetScheduledPrimitiveCount(), g_PrimitiveMan.GetDrawnPrimitiveCount(), g_PrimitiveMan.GetCulledPrimitiveCount(), g_PrimitiveMan.GetPrimitiveDrawTime());
+			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 120, str, GUIFont::Left);
+
+			std::snprintf(str, sizeof(str), "Lua Heap: %i KB (GC %.2f ms)", g_LuaMan.GetHeapSizeKB(), g_LuaMan.GetGarbageCollectionTime());
+			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 130, str, GUIFont::Left);
+
+			std::snprintf(str, sizeof(str), "Sound Voices: %i / %i (%i started, %i culled, %i merged per second)", g_AudioMan.GetSoundVoiceCount(), g_AudioMan.GetSoundVoiceBudget(), g_AudioMan.GetSoundVoiceStatPerSecond(AudioMan::VoicesStarted), g_AudioMan.GetSoundVoiceStatPerSecond(AudioMan::VoicesCulled), g_AudioMan.GetSoundVoiceStatPerSecond(AudioMan::VoicesMerged));
+			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 140, str, GUIFont::Left);
+
+			const AIScheduler &aiScheduler = g_MovableMan.GetAIScheduler();
+			std::snprintf(str, sizeof(str), "AI Updates: %i run, %i skipped, %i deferred (%.2f / %.2f ms)", aiScheduler.GetStat(AIScheduler::AIUpdatesRun), aiScheduler.GetStat(AIScheduler::AIUpdatesSkipped), aiScheduler.GetStat(AIScheduler::AIUpdatesDeferred), aiScheduler.GetLastUpdateTime(), aiScheduler.GetTimeBudget());
+			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 150, str, GUIFont::Left);
+
 			// If in split screen mode don't draw graphs because they don't fit anyway.
 			if (m_AdvancedPerfStats && g_FrameMan.GetScreenCount() == 1) { DrawPeformanceGraphs(bitmapToDrawTo); }
 		}
@@ -29,6 +29,7 @@ namespace RTE {
 			ParticlesTravel,
 			ParticlesUpdate,
 			ActivityUpdate,
+			LuaGarbageCollection,
 			PerfCounterCount
 		};
 
@@ -101,6 +102,14 @@ namespace RTE {
 		/// </summary>
 		/// <returns>The average value of the MSPF reading buffer.</returns>
 		int GetMSPFAverage() const { return m_MSPFAverage; }
+
+		/// <summary>
+		/// Sets how many MOs are asleep, and how many fell asleep and woke up during the last sim update, to be shown with the performance stats.
+		/// </summary>
+		/// <param name="sleepingCount">How many MOs are asleep.</param>
+		/// <param name="fellAsleepCount">How many MOs fell asleep during the last sim update.</param>
+		/// <param name="wokeUpCount">How many MOs woke up during the last sim update.</param>
+		void SetSleepCounts(int sleepingCount, int fellAsleepCount, int wokeUpCount) { m_SleepingCount = sleepingCount; m_FellAsleepCount = fellAsleepCount; m_WokeUpCount = wokeUpCount; }
 #pragma endregion
 
 #pragma region Performance Counter Handling
@@ -126,6 +135,23 @@ namespace RTE {
 		/// <param name="counter">Counter to stop and updated measurement for.</param>
 		void StopPerformanceMeasurement(PerformanceCounters counter);
 
+		/// <summary>
+		/// Gets how much time has passed since the last performance measurement of a counter was started.
+		/// </summary>
+		/// <param name="counter">Counter to get the elapsed time of.</param>
+		/// <returns>The time elapsed since the measurement was started, in microseconds.</returns>
+		long long GetElapsedMeasurementTime(PerformanceCounters counter) const;
+
+		/// <summary>
+		/// Clears the totals and maxima of all performance counters, so they only cover the sim updates from here on.
+		/// </summary>
+		void ResetPerformanceTotals();
+
+		/// <summary>
+		/// Prints the average and the maximum of every performance counter over all the sim updates since the totals were last reset to the console.
+		/// </summary>
+		void PrintPerformanceTotals() const;
+
 		/// <summary>
 		/// Sets the current ping value to display.
 		/// </summary>
@@ -142,7 +168,7 @@ namespace RTE {
 		const int c_StatsOffsetX = 17; //!< Offset of the stat text from the left edge of the screen.
 		const int c_StatsHeight = 14; //!< Height of each stat text line.
 		const int c_GraphsOffsetX = 14; //!< Offset of the graph from the left edge of the screen.
-		const int c_GraphsStartOffsetY = 134; //!< Position the first graph block will be drawn from the top edge of the screen.
+		const int c_GraphsStartOffsetY = 174; //!< Position the first graph block will be drawn from the top edge of the screen.
 		const int c_GraphHeight = 20; //!< Height of the performance graph.
 		const int c_GraphBlockHeight = 34; //!< Height of the whole graph block (text height and graph height combined).
 
@@ -154,6 +180,10 @@ namespace RTE {
 
 		std::deque<int> m_MSPFs; //!< History log of readings, for averaging the results.
 		int m_MSPFAverage; //!< The average of the MSPF reading buffer above, calculated each frame.
+
+		int m_SleepingCount; //!< How many MOs are asleep and skipped when traveling.
+		int m_FellAsleepCount; //!< How many MOs fell asleep during the last sim update.
+		int m_WokeUpCount; //!< How many MOs woke up during the last sim update.
 		int m_CurrentPing; //!< Current ping value to display on screen.
 
 		std::array<std::array<int, c_MaxSamples>, PerformanceCounters::PerfCounterCount>  m_PerfPercentages; //!< Array to store percentages from SimTotal.
@@ -162,6 +192,10 @@ namespace RTE {
 		std::array<uint64_t, PerformanceCounters::PerfCounterCount> m_PerfMeasureStop; //!< Current measurement stop time in microseconds.
 		std::array<std::string, PerformanceCounters::PerfCounterCount> m_PerfCounterNames; //!< Performance counter names displayed on screen.
 
+		int m_TotalSampleCount; //!< How many samples have gone into the totals since they were last reset.
+		std::array<uint64_t, PerformanceCounters::PerfCounterCount> m_PerfTotals; //!< The sum of each performance counter's samples since the totals were last reset, in microseconds.
+		std::array<uint64_t, PerformanceCounters::PerfCounterCount> m_PerfMaxima; //!< The largest of each performance counter's samples since the totals were last reset, in microseconds.
+
 	private:
 
 #pragma region Performance Counter Handling
@@ -3,6 +3,13 @@
 #include "Scene.h"
 #include "ContentFile.h"
 #include "Matrix.h"
+#include "ThreadMan.h"
+#include "Profiler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RTE_GLOW_SCAN_SSE2
+#endif
 
 namespace RTE {
 
@@ -18,6 +25,10 @@ namespace RTE {
 		m_BlueGlow = nullptr;
 		m_BlueGlowHash = 0;
 		m_TempEffectBitmaps.clear();
+		m_PaletteIndexBitmap = nullptr;
+		m_PaletteColorBitmap = nullptr;
+		m_PreparedPostEffects.clear();
+		m_EffectScratchBitmaps.clear();
 		for (int i = 0; i < c_MaxScreenCount; ++i) {
 			m_ScreenRelativeEffects.at(i).clear();
 		}
@@ -47,6 +58,12 @@ namespace RTE {
 			{512, create_bitmap(512, 512)}
 		};
 
+		m_PaletteIndexBitmap = create_bitmap_ex(8, c_PaletteEntriesNumber, 1);
+		for (int paletteIndex = 0; paletteIndex < c_PaletteEntriesNumber; ++paletteIndex) {
+			_putpixel(m_PaletteIndexBitmap, paletteIndex, 0, paletteIndex);
+		}
+		m_PaletteColorBitmap = create_bitmap_ex(32, c_PaletteEntriesNumber, 1);
+
 		return 0;
 	}
 
@@ -56,6 +73,13 @@ namespace RTE {
 		for (std::pair<int, BITMAP *> tempBitmapEntry : m_TempEffectBitmaps) {
 			destroy_bitmap(tempBitmapEntry.second);
 		}
+		for (const auto &[scratchSize, scratchBitmaps] : m_EffectScratchBitmaps) {
+			for (BITMAP *scratchBitmap : scratchBitmaps) {
+				destroy_bitmap(scratchBitmap);
+			}
+		}
+		destroy_bitmap(m_PaletteIndexBitmap);
+		destroy_bitmap(m_PaletteColorBitmap);
 		ClearScreenPostEffects();
 		ClearScenePostEffects();
 		Clear();
@@ -272,40 +296,120 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PostProcessMan::PostProcess() {
-		// First copy the current 8bpp backbuffer to the 32bpp buffer; we'll add effects to it
-		blit(g_FrameMan.GetBackBuffer8(), g_FrameMan.GetBackBuffer32(), 0, 0, 0, 0, g_FrameMan.GetBackBuffer8()->w, g_FrameMan.GetBackBuffer8()->h);
+		ProfileZone profileZone("PostProcessMan::PostProcess");
+		// Expand every palette index through blit, so the lookup table converts colors exactly like blitting the whole back-buffer would.
+		blit(m_PaletteIndexBitmap, m_PaletteColorBitmap, 0, 0, 0, 0, c_PaletteEntriesNumber, 1);
+		const uint32_t *paletteColors = reinterpret_cast<const uint32_t *>(m_PaletteColorBitmap->line[0]);
+
+		PreparePostScreenEffects();
 
-		// Set the screen blender mode for glows
-		set_screen_blender(128, 128, 128, 128);
+		// The shared RNG can't be used from the workers, so it only seeds the position hash that picks which pixels glow.
+		unsigned int glowSeed = static_cast<unsigned int>(RandomNum(0, std::numeric_limits<int>::max()));
 
 		// Reference. Do not remove.
 		//acquire_bitmap(m_BackBuffer8);
 		//acquire_bitmap(m_BackBuffer32);
 
-		DrawDotGlowEffects();
-		DrawPostScreenEffects();
+		// Each band converts its own rows and then blends the parts of all glows and effects that fall into them, so no two workers ever write the same pixel.
+		// Within a band everything is blended in the same order as drawing it all in sequence would, so the result doesn't depend on how the rows are split.
+		g_ThreadMan.ParallelFor(0, g_FrameMan.GetBackBuffer8()->h, [this, paletteColors, glowSeed](int rowBegin, int rowEnd) {
+			ConvertBackBufferRows(rowBegin, rowEnd, paletteColors);
+			DrawDotGlowEffects(rowBegin, rowEnd, glowSeed);
+			DrawPostScreenEffects(rowBegin, rowEnd);
+		}, c_MinRowsPerBand);
 
 		// Reference. Do not remove.
 		//release_bitmap(m_BackBuffer32);
 		//release_bitmap(m_BackBuffer8);
-		// Set blender mode back??
-		//set_trans_blender(128, 128, 128, 128);
+
+#ifdef DEBUG_BUILD
+		// Draw a rectangle around each glow box so we see it's position and size
+		for (const Box &glowBox : m_PostScreenGlowBoxes) {
+			int startX = glowBox.m_Corner.GetFloorIntX();
+			int startY = glowBox.m_Corner.GetFloorIntY();
+			rect(g_FrameMan.GetBackBuffer32(), startX, startY, startX + static_cast<int>(glowBox.m_Width), startY + static_cast<int>(glowBox.m_Height), g_WhiteColor);
+		}
+#endif
 
 		// Clear the effects list for this frame
 		m_PostScreenEffects.clear();
+		m_PreparedPostEffects.clear();
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void PostProcessMan::DrawDotGlowEffects() {
+	void PostProcessMan::PreparePostScreenEffects() {
+		ProfileZone profileZone("PostProcessMan::PreparePostScreenEffects");
+		m_PreparedPostEffects.clear();
+		m_PreparedPostEffects.reserve(m_PostScreenEffects.size());
+		std::unordered_map<int, size_t> usedScratchBitmapCounts;
+
+		for (const PostEffect &postEffect : m_PostScreenEffects) {
+			if (postEffect.m_Bitmap) {
+				BITMAP *effectBitmap = postEffect.m_Bitmap;
+				const BITMAP *sprite = effectBitmap;
+
+				// Rotating and converting use Allegro's global drawing state, so they're done here up front. Unrotated 32bpp effects, which is most of them, are blended straight from their own bitmap.
+				if (postEffect.m_Angle != 0 || bitmap_color_depth(effectBitmap) != 32) {
+					int scratchSize = GetTempEffectBitmap(effectBitmap)->w;
+					std::vector<BITMAP *> &scratchBitmaps = m_EffectScratchBitmaps[scratchSize];
+					size_t &usedScratchBitmapCount = usedScratchBitmapCounts[scratchSize];
+					if (usedScratchBitmapCount == scratchBitmaps.size()) { scratchBitmaps.push_back(create_bitmap_ex(32, scratchSize, scratchSize)); }
+					BITMAP *scratchBitmap = scratchBitmaps.at(usedScratchBitmapCount++);
+
+					if (postEffect.m_Angle != 0) {
+						clear_to_color(scratchBitmap, 0);
+						Matrix newAngle(postEffect.m_Angle);
+						rotate_sprite(scratchBitmap, effectBitmap, 0, 0, ftofix(newAngle.GetAllegroAngle()));
+					} else {
+						clear_to_color(scratchBitmap, bitmap_mask_color(scratchBitmap));
+						draw_sprite(scratchBitmap, effectBitmap, 0, 0);
+					}
+					sprite = scratchBitmap;
+				}
+				m_PreparedPostEffects.push_back({ sprite, postEffect.m_Pos.GetFloorIntX() - (effectBitmap->w / 2), postEffect.m_Pos.GetFloorIntY() - (effectBitmap->h / 2), postEffect.m_Strength });
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PostProcessMan::ConvertBackBufferRows(int rowBegin, int rowEnd, const uint32_t *paletteColors) const {
+		const BITMAP *backBuffer8 = g_FrameMan.GetBackBuffer8();
+		BITMAP *backBuffer32 = g_FrameMan.GetBackBuffer32();
+		int rowLength = std::min(backBuffer8->w, backBuffer32->w);
+
+		for (int y = rowBegin; y < std::min(rowEnd, backBuffer32->h); ++y) {
+			const unsigned char *sourceRow = backBuffer8->line[y];
+			uint32_t *targetRow = reinterpret_cast<uint32_t *>(backBuffer32->line[y]);
+			int x = 0;
+			// Unrolled so the loads of the next indices don't wait on the stores of the previous colors.
+			for (; x + 4 <= rowLength; x += 4) {
+				targetRow[x] = paletteColors[sourceRow[x]];
+				targetRow[x + 1] = paletteColors[sourceRow[x + 1]];
+				targetRow[x + 2] = paletteColors[sourceRow[x + 2]];
+				targetRow[x + 3] = paletteColors[sourceRow[x + 3]];
+			}
+			for (; x < rowLength; ++x) {
+				targetRow[x] = paletteColors[sourceRow[x]];
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PostProcessMan::DrawDotGlowEffects(int rowBegin, int rowEnd, unsigned int glowSeed) const {
+		const BITMAP *backBuffer8 = g_FrameMan.GetBackBuffer8();
+		BITMAP *backBuffer32 = g_FrameMan.GetBackBuffer32();
 		int startX = 0;
 		int startY = 0;
 		int endX = 0;
 		int endY = 0;
-		int testpixel = 0;
 
-		// Randomly sample the entire backbuffer, looking for pixels to put a glow on.
-		// NOTE THIS IS SLOW, especially on higher resolutions!
+		// Glows are drawn 2 pixels up and left of the glowing pixel, so glowing pixels a little outside of the band can still reach into it.
+		int scanRowBegin = rowBegin + 2 - m_YellowGlow->h + 1;
+		int scanRowEnd = rowEnd + 2;
+
 		for (const Box &glowBox : m_PostScreenGlowBoxes) {
 			startX = glowBox.m_Corner.GetFloorIntX();
 			startY = glowBox.m_Corner.GetFloorIntY();
@@ -313,35 +417,20 @@ namespace RTE {
 			endY = startY + static_cast<int>(glowBox.m_Height);
 
 			// Sanity check a little at least
-			if (startX < 0 || startX >= g_FrameMan.GetBackBuffer8()->w || startY < 0 || startY >= g_FrameMan.GetBackBuffer8()->h ||
-				endX < 0 || endX >= g_FrameMan.GetBackBuffer8()->w || endY < 0 || endY >= g_FrameMan.GetBackBuffer8()->h) {
+			if (startX < 0 || startX >= backBuffer8->w || startY < 0 || startY >= backBuffer8->h || endX < 0 || endX >= backBuffer8->w || endY < 0 || endY >= backBuffer8->h) {
 				continue;
 			}
 
-#ifdef DEBUG_BUILD
-			// Draw a rectangle around the glow box so we see it's position and size
-			rect(g_FrameMan.GetBackBuffer32(), startX, startY, endX, endY, g_WhiteColor);
-#endif
-
-			for (int y = startY; y < endY; ++y) {
-				for (int x = startX; x < endX; ++x) {
-					testpixel = _getpixel(g_FrameMan.GetBackBuffer8(), x, y);
+			for (int y = std::max(startY, scanRowBegin); y < std::min(endY, scanRowEnd); ++y) {
+				const unsigned char *row = backBuffer8->line[y];
+				for (int x = FindNextGlowPixel(row, startX, endX); x < endX; x = FindNextGlowPixel(row, x + 1, endX)) {
+					int testPixel = row[x];
 
 					// YELLOW
-					if ((testpixel == g_YellowGlowColor && RandomNum() < 0.9F) || testpixel == 98 || (testpixel == 120 && RandomNum() < 0.7F)) {
-						draw_trans_sprite(g_FrameMan.GetBackBuffer32(), m_YellowGlow, x - 2, y - 2);
-					}
-					// TODO: Enable and add more colors once we actually have something that needs these.
-					// RED
-					/*
-					if (testpixel == 13) {
-						draw_trans_sprite(m_BackBuffer32, m_RedGlow, x - 2, y - 2);
-					}
-					// BLUE
-					if (testpixel == 166) {
-						draw_trans_sprite(g_FrameMan.GetBackBuffer32(), m_BlueGlow, x - 2, y - 2);
+					if (testPixel == 98 || (testPixel == g_YellowGlowColor && GetGlowChance(x, y, glowSeed) < 0.9F) || (testPixel == 120 && GetGlowChance(x, y, glowSeed) < 0.7F)) {
+						BlendSpriteRows(backBuffer32, m_YellowGlow, x - 2, y - 2, 128, rowBegin, rowEnd);
 					}
-					*/
+					// TODO: Add red (13) and blue (166) glows to FindNextGlowPixel and here once we actually have something that needs them.
 				}
 			}
 		}
@@ -349,32 +438,103 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void PostProcessMan::DrawPostScreenEffects() const {
-		BITMAP *effectBitmap = nullptr;
-		int effectPosX = 0;
-		int effectPosY = 0;
-		int effectStrength = 0;
+	void PostProcessMan::DrawPostScreenEffects(int rowBegin, int rowEnd) const {
+		BITMAP *backBuffer32 = g_FrameMan.GetBackBuffer32();
 
-		for (const PostEffect &postEffect : m_PostScreenEffects) {
-			if (postEffect.m_Bitmap) {
-				effectBitmap = postEffect.m_Bitmap;
-				effectStrength = postEffect.m_Strength;
-				effectPosX = postEffect.m_Pos.GetFloorIntX() - (effectBitmap->w / 2);
-				effectPosY = postEffect.m_Pos.GetFloorIntY() - (effectBitmap->h / 2);
-				set_screen_blender(effectStrength, effectStrength, effectStrength, effectStrength);
-
-				// Draw all the scene screen effects accumulated this frame
-				if (postEffect.m_Angle == 0) {
-					draw_trans_sprite(g_FrameMan.GetBackBuffer32(), effectBitmap, effectPosX, effectPosY);
-				} else {
-					BITMAP *targetBitmap = GetTempEffectBitmap(effectBitmap);
-					clear_to_color(targetBitmap, 0);
-
-					Matrix newAngle(postEffect.m_Angle);
-					rotate_sprite(targetBitmap, effectBitmap, 0, 0, ftofix(newAngle.GetAllegroAngle()));
-					draw_trans_sprite(g_FrameMan.GetBackBuffer32(), targetBitmap, effectPosX, effectPosY);
-				}
+		// Draw all the scene screen effects accumulated this frame
+		for (const PreparedPostEffect &preparedPostEffect : m_PreparedPostEffects) {
+			BlendSpriteRows(backBuffer32, preparedPostEffect.Sprite, preparedPostEffect.PosX, preparedPostEffect.PosY, preparedPostEffect.Strength, rowBegin, rowEnd);
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int PostProcessMan::FindNextGlowPixel(const unsigned char *row, int startX, int endX) {
+		int x = startX;
+#ifdef RTE_GLOW_SCAN_SSE2
+		const __m128i yellowGlowColors = _mm_set1_epi8(static_cast<char>(g_YellowGlowColor));
+		const __m128i brightYellowGlowColors = _mm_set1_epi8(static_cast<char>(98));
+		const __m128i paleYellowGlowColors = _mm_set1_epi8(static_cast<char>(120));
+
+		for (; x + 16 <= endX; x += 16) {
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + x));
+			__m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(pixels, yellowGlowColors), _mm_cmpeq_epi8(pixels, brightYellowGlowColors)), _mm_cmpeq_epi8(pixels, paleYellowGlowColors));
+			if (_mm_movemask_epi8(matches) != 0) {
+				break;
+			}
+		}
+#else
+		// Without SSE2, test 8 pixels at a time for bytes equal to each glow color with the usual bit trick for finding zero bytes in a word.
+		const uint64_t lowBits = 0x0101010101010101;
+		const uint64_t highBits = 0x8080808080808080;
+		auto hasPixelOfColor = [lowBits, highBits](uint64_t pixels, uint64_t color) {
+			uint64_t difference = pixels ^ (color * lowBits);
+			return ((difference - lowBits) & ~difference & highBits) != 0;
+		};
+		for (; x + 8 <= endX; x += 8) {
+			uint64_t pixels;
+			memcpy(&pixels, row + x, sizeof(pixels));
+			if (hasPixelOfColor(pixels, g_YellowGlowColor) || hasPixelOfColor(pixels, 98) || hasPixelOfColor(pixels, 120)) {
+				break;
+			}
+		}
+#endif
+		// Pin down the match in the block that had one, and check the leftover pixels at the end of the row.
+		for (; x < endX; ++x) {
+			if (row[x] == g_YellowGlowColor || row[x] == 98 || row[x] == 120) {
+				return x;
 			}
 		}
+		return endX;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	float PostProcessMan::GetGlowChance(int pixelX, int pixelY, unsigned int glowSeed) {
+		uint32_t hash = glowSeed ^ (static_cast<uint32_t>(pixelX) * 0x9E3779B1U) ^ (static_cast<uint32_t>(pixelY) * 0x85EBCA77U);
+		hash ^= hash >> 15;
+		hash *= 0x2C1B3C6DU;
+		hash ^= hash >> 12;
+		hash *= 0x297A2D39U;
+		hash ^= hash >> 15;
+		return static_cast<float>(hash >> 8) / 16777216.0F;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PostProcessMan::BlendSpriteRows(BITMAP *targetBitmap, const BITMAP *sprite, int posX, int posY, int strength, int rowBegin, int rowEnd) {
+		int firstRow = std::max({ posY, rowBegin, 0 });
+		int lastRow = std::min({ posY + sprite->h, rowEnd, targetBitmap->h });
+		int firstColumn = std::max(posX, 0);
+		int lastColumn = std::min(posX + sprite->w, targetBitmap->w);
+		if (firstRow >= lastRow || firstColumn >= lastColumn) {
+			return;
+		}
+		// Allegro bumps non-zero blender alphas by one so that 255 is fully opaque.
+		uint32_t blendAlpha = static_cast<uint32_t>(std::clamp(strength, 0, 255));
+		if (blendAlpha != 0) { ++blendAlpha; }
+
+		for (int y = firstRow; y < lastRow; ++y) {
+			const uint32_t *spriteRow = reinterpret_cast<const uint32_t *>(sprite->line[y - posY]);
+			uint32_t *targetRow = reinterpret_cast<uint32_t *>(targetBitmap->line[y]);
+			for (int x = firstColumn; x < lastColumn; ++x) {
+				uint32_t spriteColor = spriteRow[x - posX];
+				if (spriteColor != MASK_COLOR_32) { targetRow[x] = ScreenBlend(spriteColor, targetRow[x], blendAlpha); }
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	uint32_t PostProcessMan::ScreenBlend(uint32_t spriteColor, uint32_t targetColor, uint32_t blendAlpha) {
+		uint32_t screenedRed = 255 - ((255 - getr32(spriteColor)) * (255 - getr32(targetColor))) / 256;
+		uint32_t screenedGreen = 255 - ((255 - getg32(spriteColor)) * (255 - getg32(targetColor))) / 256;
+		uint32_t screenedBlue = 255 - ((255 - getb32(spriteColor)) * (255 - getb32(targetColor))) / 256;
+		uint32_t screenedColor = (screenedRed << 16) | (screenedGreen << 8) | screenedBlue;
+
+		// Screening never darkens any channel, so the packed red and blue differences below can't borrow from each other.
+		uint32_t redBlue = ((screenedColor & 0xFF00FF) - (targetColor & 0xFF00FF)) * blendAlpha / 256 + targetColor;
+		uint32_t green = ((screenedColor & 0xFF00) - (targetColor & 0xFF00)) * blendAlpha / 256 + (targetColor & 0xFF00);
+		return (redBlue & 0xFF00FF) | (green & 0xFF00);
 	}
-}
\ No newline at end of file
+}
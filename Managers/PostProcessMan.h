@@ -200,8 +200,26 @@ namespace RTE {
 
 		std::unordered_map<int, BITMAP *> m_TempEffectBitmaps; //!< Stores temporary bitmaps to rotate post effects in for quick access.
 
+		BITMAP *m_PaletteIndexBitmap; //!< 8bpp bitmap holding every palette index once. Blitted to m_PaletteColorBitmap each frame to find out what each index converts to.
+		BITMAP *m_PaletteColorBitmap; //!< 32bpp bitmap holding the converted color of every palette index, used as the lookup table for converting the 8bpp back-buffer.
+
 	private:
 
+		static constexpr int c_MinRowsPerBand = 32; //!< The minimum number of back-buffer rows each worker processes in one go.
+
+		/// <summary>
+		/// A post screen effect resolved for blending, with everything that needed Allegro's global state (rotation, color depth conversion) already done.
+		/// </summary>
+		struct PreparedPostEffect {
+			const BITMAP *Sprite; //!< The 32bpp sprite to blend. Either the effect's own bitmap or one of the scratch bitmaps.
+			int PosX; //!< The X position of the sprite's upper left corner on the back-buffer.
+			int PosY; //!< The Y position of the sprite's upper left corner on the back-buffer.
+			int Strength; //!< How hard to blend the sprite in, 0 - 255.
+		};
+
+		std::vector<PreparedPostEffect> m_PreparedPostEffects; //!< The post screen effects of the frame being post-processed, ready for blending.
+		std::unordered_map<int, std::vector<BITMAP *>> m_EffectScratchBitmaps; //!< Pools of 32bpp bitmaps by size, to draw rotated or converted post effects into before blending. Kept between frames.
+
 #pragma region Post Effect Handling
 		/// <summary>
 		/// Gets all screen effects that are located within a box in the scene. Their coordinates will be returned relative to the upper left corner of the box passed in here.
@@ -245,14 +263,71 @@ namespace RTE {
 
 #pragma region PostProcess Breakdown
 		/// <summary>
-		/// Draws all the glow dot effects on pixels registered inside glow boxes for this frame. This is called from PostProcess().
+		/// Rotates and converts all the post screen effects registered for this frame that need it, and fills m_PreparedPostEffects. This is called from PostProcess() before any of the bands are processed.
+		/// </summary>
+		void PreparePostScreenEffects();
+
+		/// <summary>
+		/// Converts a band of rows of the 8bpp back-buffer into the 32bpp back-buffer. This is called from PostProcess() on a worker thread.
+		/// </summary>
+		/// <param name="rowBegin">The first row of the band.</param>
+		/// <param name="rowEnd">The row after the last row of the band.</param>
+		/// <param name="paletteColors">The 32bpp color of each palette index.</param>
+		void ConvertBackBufferRows(int rowBegin, int rowEnd, const uint32_t *paletteColors) const;
+
+		/// <summary>
+		/// Draws the parts of all the glow dot effects on pixels registered inside glow boxes for this frame that fall into a band of rows. This is called from PostProcess() on a worker thread.
+		/// </summary>
+		/// <param name="rowBegin">The first row of the band.</param>
+		/// <param name="rowEnd">The row after the last row of the band.</param>
+		/// <param name="glowSeed">The seed for deciding which of the candidate pixels glow this frame.</param>
+		void DrawDotGlowEffects(int rowBegin, int rowEnd, unsigned int glowSeed) const;
+
+		/// <summary>
+		/// Draws the parts of all the glow effects registered for this frame that fall into a band of rows. This is called from PostProcess() on a worker thread.
+		/// </summary>
+		/// <param name="rowBegin">The first row of the band.</param>
+		/// <param name="rowEnd">The row after the last row of the band.</param>
+		void DrawPostScreenEffects(int rowBegin, int rowEnd) const;
+
+		/// <summary>
+		/// Finds the next pixel in a row of the 8bpp back-buffer that has one of the colors that can glow. Skips over runs of other colors several pixels at a time.
+		/// </summary>
+		/// <param name="row">The row to search.</param>
+		/// <param name="startX">The X coordinate to start searching at.</param>
+		/// <param name="endX">The X coordinate to stop searching at.</param>
+		/// <returns>The X coordinate of the found pixel, or endX if there is none.</returns>
+		static int FindNextGlowPixel(const unsigned char *row, int startX, int endX);
+
+		/// <summary>
+		/// Gets a pseudo-random number for a pixel, used to decide whether it glows. The same pixel and seed always give the same number, so every band that reaches a glow gets the same answer.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the pixel.</param>
+		/// <param name="pixelY">The Y coordinate of the pixel.</param>
+		/// <param name="glowSeed">The seed for this frame.</param>
+		/// <returns>A number in the range [0, 1).</returns>
+		static float GetGlowChance(int pixelX, int pixelY, unsigned int glowSeed);
+
+		/// <summary>
+		/// Blends the part of a 32bpp sprite that falls into a band of rows onto a 32bpp bitmap, the same way draw_trans_sprite does with the screen blender.
 		/// </summary>
-		void DrawDotGlowEffects();
+		/// <param name="targetBitmap">The bitmap to blend onto.</param>
+		/// <param name="sprite">The sprite to blend. Pixels of the mask color are skipped.</param>
+		/// <param name="posX">The X position of the sprite's upper left corner on the target bitmap.</param>
+		/// <param name="posY">The Y position of the sprite's upper left corner on the target bitmap.</param>
+		/// <param name="strength">How hard to blend the sprite in, 0 - 255.</param>
+		/// <param name="rowBegin">The first row of the band.</param>
+		/// <param name="rowEnd">The row after the last row of the band.</param>
+		static void BlendSpriteRows(BITMAP *targetBitmap, const BITMAP *sprite, int posX, int posY, int strength, int rowBegin, int rowEnd);
 
 		/// <summary>
-		/// Draws all the glow effects registered for this frame. This is called from PostProcess().
+		/// Screen blends two 32bpp colors and mixes the result with the target color, bit for bit like Allegro's 32bpp screen blender.
 		/// </summary>
-		void DrawPostScreenEffects() const;
+		/// <param name="spriteColor">The color being drawn.</param>
+		/// <param name="targetColor">The color being drawn over.</param>
+		/// <param name="blendAlpha">The blender alpha, already incremented like Allegro does for non-zero alphas.</param>
+		/// <returns>The blended color.</returns>
+		static uint32_t ScreenBlend(uint32_t spriteColor, uint32_t targetColor, uint32_t blendAlpha);
 #pragma endregion
 
 		/// <summary>
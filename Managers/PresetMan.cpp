@@ -28,6 +28,7 @@
 #include "ConsoleMan.h"
 #include "LoadingScreen.h"
 #include "SettingsMan.h"
+#include "ThreadMan.h"
 
 namespace RTE {
 
@@ -163,20 +164,14 @@ bool PresetMan::LoadAllDataModules() {
 
 	FindAndExtractZippedModules();
 
-	// Load all the official modules first!
+	// Gather all the modules to load in the order they need to be loaded first, so the images of each module can be looked for before it is reached.
+	// Official modules are loaded first, then either the single specified module or all the other unofficial modules, and last scenes and MetaGames, which might be referring to stuff in user mods.
 	std::array<std::string, 10> officialModules = { "Base.rte", "Coalition.rte", "Imperatus.rte", "Techion.rte", "Dummy.rte", "Ronin.rte", "Browncoats.rte", "Uzira.rte", "MuIlaak.rte", "Missions.rte" };
-	for (const std::string &officialModule : officialModules) {
-		if (!LoadDataModule(officialModule, true, &LoadingScreen::LoadingSplashProgressReport)) {
-			return false;
-		}
-	}
+	std::vector<std::string> modulesToLoad(officialModules.begin(), officialModules.end());
+	bool loadSingleModule = !m_SingleModuleToLoad.empty() && std::find(officialModules.begin(), officialModules.end(), m_SingleModuleToLoad) == officialModules.end();
 
-	// If a single module is specified, skip loading all other unofficial modules and load specified module only.
-	if (!m_SingleModuleToLoad.empty() && std::find(officialModules.begin(), officialModules.end(), m_SingleModuleToLoad) == officialModules.end()) {
-		if (!LoadDataModule(m_SingleModuleToLoad, false, &LoadingScreen::LoadingSplashProgressReport)) {
-			g_ConsoleMan.PrintString("ERROR: Failed to load DataModule \"" + m_SingleModuleToLoad + "\"! Only official modules were loaded!");
-			return false;
-		}
+	if (loadSingleModule) {
+		modulesToLoad.emplace_back(m_SingleModuleToLoad);
 	} else {
 		std::vector<std::filesystem::directory_entry> workingDirectoryFolders;
 		std::copy_if(std::filesystem::directory_iterator(System::GetWorkingDirectory()), std::filesystem::directory_iterator(), std::back_inserter(workingDirectoryFolders),
@@ -189,28 +184,130 @@ bool PresetMan::LoadAllDataModules() {
 			if (std::regex_match(directoryEntryPath, std::regex(".*\.rte"))) {
 				std::string moduleName = directoryEntryPath.substr(directoryEntryPath.find_last_of('/') + 1, std::string::npos);
 				if (!g_SettingsMan.IsModDisabled(moduleName) && (std::find(officialModules.begin(), officialModules.end(), moduleName) == officialModules.end() && moduleName != "Metagames.rte" && moduleName != "Scenes.rte")) {
-					int moduleID = GetModuleID(moduleName);
-					// NOTE: LoadDataModule can return false (especially since it may try to load already loaded modules, which is okay) and shouldn't cause stop, so we can ignore its return value here.
-					if (moduleID < 0 || moduleID >= GetOfficialModuleCount()) { LoadDataModule(moduleName, false, &LoadingScreen::LoadingSplashProgressReport); }
+					modulesToLoad.emplace_back(moduleName);
 				}
 			}
 		}
-		// Load scenes and MetaGames AFTER all other techs etc are loaded; might be referring to stuff in user mods.
-		if (!LoadDataModule("Scenes.rte", false, &LoadingScreen::LoadingSplashProgressReport)) {
-			return false;
+		modulesToLoad.emplace_back("Scenes.rte");
+		modulesToLoad.emplace_back("Metagames.rte");
+	}
+
+	// While a module is being read, the images of the next one are looked for on a worker thread. Once a module is reached, its images are queued to be read and decoded on the worker threads while the module's presets are created, instead of each one being loaded from disk when the preset using it is.
+	std::vector<std::vector<std::string>> moduleImagePaths(modulesToLoad.size());
+	std::vector<std::future<void>> moduleImageSearches(modulesToLoad.size());
+	auto searchModuleImages = [&modulesToLoad, &moduleImagePaths, &moduleImageSearches](size_t moduleIndex) {
+		if (moduleIndex < modulesToLoad.size()) {
+			moduleImageSearches.at(moduleIndex) = g_ThreadMan.QueueJob([&moduleName = modulesToLoad.at(moduleIndex), &imagePaths = moduleImagePaths.at(moduleIndex)]() { imagePaths = FindModuleImagePaths(moduleName); });
+		}
+	};
+	searchModuleImages(0);
+
+	std::vector<std::string> moduleLoadDurationReport;
+	for (size_t moduleIndex = 0; moduleIndex < modulesToLoad.size(); ++moduleIndex) {
+		const std::string &moduleName = modulesToLoad.at(moduleIndex);
+		bool officialModule = moduleIndex < officialModules.size();
+		bool requiredModule = officialModule || loadSingleModule || moduleName == "Scenes.rte" || moduleName == "Metagames.rte";
+
+		auto singleModuleLoadTimerStart = std::chrono::high_resolution_clock::now();
+
+		moduleImageSearches.at(moduleIndex).wait();
+		searchModuleImages(moduleIndex + 1);
+		int prefetchedImageCount = 0;
+		for (const std::string &imagePath : moduleImagePaths.at(moduleIndex)) {
+			if (ContentFile(imagePath.c_str()).PrefetchBitmap()) { prefetchedImageCount++; }
 		}
-		if (!LoadDataModule("Metagames.rte", false, &LoadingScreen::LoadingSplashProgressReport)) {
-			return false;
+		moduleImagePaths.at(moduleIndex).clear();
+
+		if (requiredModule) {
+			if (!LoadDataModule(moduleName, officialModule, &LoadingScreen::LoadingSplashProgressReport)) {
+				if (loadSingleModule && !officialModule) { g_ConsoleMan.PrintString("ERROR: Failed to load DataModule \"" + m_SingleModuleToLoad + "\"! Only official modules were loaded!"); }
+				// The search for the next module's images is still using the vectors that are about to go out of scope.
+				if (moduleIndex + 1 < moduleImageSearches.size()) { moduleImageSearches.at(moduleIndex + 1).wait(); }
+				ContentFile::DiscardPrefetches();
+				return false;
+			}
+		} else {
+			int moduleID = GetModuleID(moduleName);
+			// NOTE: LoadDataModule can return false (especially since it may try to load already loaded modules, which is okay) and shouldn't cause stop, so we can ignore its return value here.
+			if (moduleID < 0 || moduleID >= GetOfficialModuleCount()) { LoadDataModule(moduleName, false, &LoadingScreen::LoadingSplashProgressReport); }
 		}
-	}
+		// Whatever wasn't picked up was either loaded some other way or isn't used by anything, and would only keep the next module's images waiting for room in the prefetch budget.
+		ContentFile::DiscardPrefetches();
 
+		if (g_SettingsMan.IsMeasuringModuleLoadTime()) {
+			std::chrono::milliseconds singleModuleLoadElapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - singleModuleLoadTimerStart);
+			moduleLoadDurationReport.emplace_back("\t" + moduleName + ": " + std::to_string(singleModuleLoadElapsedTime.count()) + "ms (" + std::to_string(prefetchedImageCount) + " images prefetched)");
+		}
+	}
 	if (g_SettingsMan.IsMeasuringModuleLoadTime()) {
 		std::chrono::milliseconds moduleLoadElapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - moduleLoadTimerStart);
 		g_ConsoleMan.PrintString("Module load duration is: " + std::to_string(moduleLoadElapsedTime.count()) + "ms");
+		for (const std::string &moduleLoadDuration : moduleLoadDurationReport) {
+			g_ConsoleMan.PrintString(moduleLoadDuration);
+		}
 	}
 	return true;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::string> PresetMan::FindModuleImagePaths(const std::string &moduleName) {
+	std::vector<std::string> imagePaths;
+	std::unordered_set<std::string> foundImagePaths;
+	std::error_code iterationErrorCode;
+	std::error_code fileErrorCode;
+
+	for (std::filesystem::recursive_directory_iterator moduleFileItr(System::GetWorkingDirectory() + moduleName, iterationErrorCode), moduleFileEnd; !iterationErrorCode && moduleFileItr != moduleFileEnd; moduleFileItr.increment(iterationErrorCode)) {
+		if (!moduleFileItr->is_regular_file(fileErrorCode) || moduleFileItr->path().extension() != ".ini") {
+			continue;
+		}
+		std::ifstream iniFile(moduleFileItr->path());
+		std::string iniLine;
+		while (std::getline(iniFile, iniLine)) {
+			// Only the plain "FilePath = Module.rte/Image.png" form matters here. Anything this misses is still loaded normally when its preset is created.
+			size_t equalsPos = iniLine.find('=');
+			if (equalsPos == std::string::npos) {
+				continue;
+			}
+			size_t propNameStart = iniLine.find_first_not_of(" \t");
+			size_t propNameEnd = iniLine.find_last_not_of(" \t", equalsPos - 1);
+			if (propNameStart >= equalsPos || propNameEnd == std::string::npos) {
+				continue;
+			}
+			std::string_view propName(iniLine.data() + propNameStart, propNameEnd - propNameStart + 1);
+			if (propName != "FilePath" && propName != "Path") {
+				continue;
+			}
+			size_t valueStart = iniLine.find_first_not_of(" \t", equalsPos + 1);
+			size_t valueEnd = iniLine.find_last_not_of(" \t\r");
+			if (valueStart == std::string::npos || valueEnd < valueStart) {
+				continue;
+			}
+			std::string imagePath = iniLine.substr(valueStart, valueEnd - valueStart + 1);
+			std::replace(imagePath.begin(), imagePath.end(), '\\', '/');
+			if (imagePath.length() <= 4 || imagePath.compare(imagePath.length() - 4, 4, ".png") != 0) {
+				continue;
+			}
+
+			// Animations name their frames with the frame number before the extension, and it's only known here whether that's the case by looking for the files.
+			if (std::filesystem::exists(imagePath, fileErrorCode)) {
+				if (foundImagePaths.emplace(imagePath).second) { imagePaths.emplace_back(imagePath); }
+			} else {
+				char framePath[1024];
+				const std::string imagePathWithoutExtension = imagePath.substr(0, imagePath.length() - 4);
+				for (int frameNum = 0; ; ++frameNum) {
+					std::snprintf(framePath, sizeof(framePath), "%s%03i.png", imagePathWithoutExtension.c_str(), frameNum);
+					if (!std::filesystem::exists(framePath, fileErrorCode)) {
+						break;
+					}
+					if (foundImagePaths.emplace(framePath).second) { imagePaths.emplace_back(framePath); }
+				}
+			}
+		}
+	}
+	return imagePaths;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetDataModule
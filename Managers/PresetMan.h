@@ -511,6 +511,13 @@ private:
 	/// </summary>
 	void FindAndExtractZippedModules() const;
 
+	/// <summary>
+	/// Looks through all the ini files of a module for the PNG images they refer to, including each frame of animations. Only reads files, so it's safe to do on a worker thread.
+	/// </summary>
+	/// <param name="moduleName">The name of the module to look through, e.g. "Base.rte".</param>
+	/// <returns>The paths of all the existing images the module refers to, in the order they're referred to.</returns>
+	static std::vector<std::string> FindModuleImagePaths(const std::string &moduleName);
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          Clear
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1,30 +1,109 @@
 #include "PrimitiveMan.h"
 #include "Entity.h"
 #include "MOSprite.h"
+#include "SceneMan.h"
 
 namespace RTE {
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PrimitiveMan::Clear() {
+		m_ArenaBlocks.clear();
+		m_ArenaBlockIndex = 0;
+		m_ArenaBlockOffset = 0;
+		m_ScheduledPrimitives.clear();
+		for (std::vector<GraphicalPrimitive *> &playerScheduledPrimitives : m_PlayerScheduledPrimitives) {
+			playerScheduledPrimitives.clear();
+		}
+		m_DrawnCount = 0;
+		m_CulledCount = 0;
+		m_DrawTime = 0;
+		m_LastFrameScheduledCount = 0;
+		m_LastFrameDrawnCount = 0;
+		m_LastFrameCulledCount = 0;
+		m_LastFrameDrawTime = 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PrimitiveMan::ClearPrimitivesQueue() {
+		std::lock_guard<std::mutex> scheduledPrimitivesLock(m_ScheduledPrimitivesMutex);
+
+		// The primitives live in the arena, so only destroy them and keep the memory around for the next frame.
+		for (GraphicalPrimitive *primitive : m_ScheduledPrimitives) {
+			primitive->~GraphicalPrimitive();
+		}
+		m_LastFrameScheduledCount = static_cast<int>(m_ScheduledPrimitives.size());
+		m_ScheduledPrimitives.clear();
+		for (std::vector<GraphicalPrimitive *> &playerScheduledPrimitives : m_PlayerScheduledPrimitives) {
+			playerScheduledPrimitives.clear();
+		}
+		m_ArenaBlockIndex = 0;
+		m_ArenaBlockOffset = 0;
+
+		m_LastFrameDrawnCount = m_DrawnCount;
+		m_LastFrameCulledCount = m_CulledCount;
+		m_LastFrameDrawTime = m_DrawTime;
+		m_DrawnCount = 0;
+		m_CulledCount = 0;
+		m_DrawTime = 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void * PrimitiveMan::AllocateFromArena(size_t size, size_t alignment) {
+		size_t alignedOffset = (m_ArenaBlockOffset + alignment - 1) & ~(alignment - 1);
+		if (m_ArenaBlockIndex >= m_ArenaBlocks.size() || alignedOffset + size > c_ArenaBlockSize) {
+			if (m_ArenaBlockIndex < m_ArenaBlocks.size()) { m_ArenaBlockIndex++; }
+			if (m_ArenaBlockIndex == m_ArenaBlocks.size()) { m_ArenaBlocks.emplace_back(std::make_unique<std::byte[]>(c_ArenaBlockSize)); }
+			alignedOffset = 0;
+		}
+		m_ArenaBlockOffset = alignedOffset + size;
+		return m_ArenaBlocks.at(m_ArenaBlockIndex).get() + alignedOffset;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PrimitiveMan::DrawBitmapPrimitive(int player, const Vector &centerPos, Entity *entity, float rotAngle, int frame, bool hFlipped, bool vFlipped) {
 		const MOSprite *moSprite = dynamic_cast<MOSprite *>(entity);
 		if (moSprite) {
 			BITMAP *bitmap = moSprite->GetSpriteFrame(frame);
-			if (bitmap) { m_ScheduledPrimitives.push_back(std::make_unique<BitmapPrimitive>(player, centerPos, bitmap, rotAngle, hFlipped, vFlipped)); }
+			if (bitmap) { SchedulePrimitive<BitmapPrimitive>(player, centerPos, bitmap, rotAngle, hFlipped, vFlipped); }
 		}
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PrimitiveMan::DrawIconPrimitive(int player, const Vector &centerPos, Entity *entity) {
-		if (const MOSprite *moSprite = dynamic_cast<MOSprite *>(entity)) { m_ScheduledPrimitives.push_back(std::make_unique<BitmapPrimitive>(player, centerPos, moSprite->GetGraphicalIcon(), 0, false, false)); }
+		if (const MOSprite *moSprite = dynamic_cast<MOSprite *>(entity)) { SchedulePrimitive<BitmapPrimitive>(player, centerPos, moSprite->GetGraphicalIcon(), 0, false, false); }
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PrimitiveMan::DrawPrimitives(int player, BITMAP *targetBitmap, const Vector &targetPos) const {
-		for (const std::unique_ptr<GraphicalPrimitive> &primitive : m_ScheduledPrimitives) {
-			if (primitive->m_Player == player || primitive->m_Player == -1) { primitive->Draw(targetBitmap, targetPos); }
+		if (player < 0 || player >= c_MaxScreenCount) {
+			return;
+		}
+		std::chrono::steady_clock::time_point drawStart = std::chrono::steady_clock::now();
+
+		Vector screenHalfSize(static_cast<float>(targetBitmap->w) * 0.5F, static_cast<float>(targetBitmap->h) * 0.5F);
+		Vector screenCenter = targetPos + screenHalfSize;
+		Vector primitiveTopLeft;
+		Vector primitiveBottomRight;
+
+		for (GraphicalPrimitive *primitive : m_PlayerScheduledPrimitives.at(player)) {
+			if (primitive->GetSceneBounds(primitiveTopLeft, primitiveBottomRight)) {
+				// Compare the wrapped distance between the centers against the combined half sizes, so primitives across a scene seam from the screen aren't culled.
+				Vector primitiveHalfSize = (primitiveBottomRight - primitiveTopLeft) * 0.5F;
+				Vector distance = g_SceneMan.ShortestDistance(screenCenter, primitiveTopLeft + primitiveHalfSize, true);
+				if (std::abs(distance.GetX()) > screenHalfSize.GetX() + primitiveHalfSize.GetX() + 1.0F || std::abs(distance.GetY()) > screenHalfSize.GetY() + primitiveHalfSize.GetY() + 1.0F) {
+					m_CulledCount++;
+					continue;
+				}
+			}
+			primitive->Draw(targetBitmap, targetPos);
+			m_DrawnCount++;
 		}
+		m_DrawTime += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - drawStart).count();
 	}
 }
\ No newline at end of file
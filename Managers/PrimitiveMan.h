@@ -21,14 +21,45 @@ namespace RTE {
 		/// <summary>
 		/// Constructor method used to instantiate a PrimitiveMan object in system memory.
 		/// </summary>
-		PrimitiveMan() { ClearPrimitivesQueue(); }
+		PrimitiveMan() { Clear(); }
 #pragma endregion
 
 #pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a PrimitiveMan object before deletion from system memory.
+		/// </summary>
+		~PrimitiveMan() { ClearPrimitivesQueue(); }
+
 		/// <summary>
 		/// Delete all scheduled primitives, called on every FrameMan sim update.
 		/// </summary>
-		void ClearPrimitivesQueue() { m_ScheduledPrimitives.clear(); }
+		void ClearPrimitivesQueue();
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets how many primitives were scheduled during the last frame.
+		/// </summary>
+		/// <returns>The number of primitives scheduled during the last frame.</returns>
+		int GetScheduledPrimitiveCount() const { return m_LastFrameScheduledCount; }
+
+		/// <summary>
+		/// Gets how many primitives were drawn during the last frame, counting once per player screen they were drawn on.
+		/// </summary>
+		/// <returns>The number of primitives drawn during the last frame.</returns>
+		int GetDrawnPrimitiveCount() const { return m_LastFrameDrawnCount; }
+
+		/// <summary>
+		/// Gets how many primitives were skipped during the last frame because they were entirely outside of the player screen being drawn, counting once per player screen.
+		/// </summary>
+		/// <returns>The number of primitives culled during the last frame.</returns>
+		int GetCulledPrimitiveCount() const { return m_LastFrameCulledCount; }
+
+		/// <summary>
+		/// Gets how long drawing primitives took during the last frame, for all player screens combined.
+		/// </summary>
+		/// <returns>The time spent drawing primitives during the last frame, in milliseconds.</returns>
+		float GetPrimitiveDrawTime() const { return m_LastFrameDrawTime; }
 #pragma endregion
 
 #pragma region Primitive Drawing
@@ -46,7 +77,7 @@ namespace RTE {
 		/// <param name="startPos">Start position of primitive in scene coordinates.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawLinePrimitive(const Vector &startPos, const Vector &endPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<LinePrimitive>(-1, startPos, endPos, color)); }
+		void DrawLinePrimitive(const Vector &startPos, const Vector &endPos, unsigned char color) { SchedulePrimitive<LinePrimitive>(-1, startPos, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a line primitive visible only to a specified player.
@@ -55,7 +86,7 @@ namespace RTE {
 		/// <param name="startPos">Start position of primitive in scene coordinates.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawLinePrimitive(int player, const Vector &startPos, const Vector &endPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<LinePrimitive>(player, startPos, endPos, color)); }
+		void DrawLinePrimitive(int player, const Vector &startPos, const Vector &endPos, unsigned char color) { SchedulePrimitive<LinePrimitive>(player, startPos, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive.
@@ -65,7 +96,7 @@ namespace RTE {
 		/// <param name="endAngle">The angle at which the arc drawing ends.</param>
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawArcPrimitive(const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<ArcPrimitive>(-1, centerPos, startAngle, endAngle, radius, 1, color)); }
+		void DrawArcPrimitive(const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color) { SchedulePrimitive<ArcPrimitive>(-1, centerPos, startAngle, endAngle, radius, 1, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive with the option to change thickness.
@@ -76,7 +107,7 @@ namespace RTE {
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
 		/// <param name="thickness">Thickness of the arc in pixels.</param>
-		void DrawArcPrimitive(const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color, int thickness) { m_ScheduledPrimitives.push_back(std::make_unique<ArcPrimitive>(-1, centerPos, startAngle, endAngle, radius, thickness, color)); }
+		void DrawArcPrimitive(const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color, int thickness) { SchedulePrimitive<ArcPrimitive>(-1, centerPos, startAngle, endAngle, radius, thickness, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive visible only to a specified player.
@@ -87,7 +118,7 @@ namespace RTE {
 		/// <param name="endAngle">The angle at which the arc drawing ends.</param>
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawArcPrimitive(int player, const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<ArcPrimitive>(player, centerPos, startAngle, endAngle, radius, 1, color)); }
+		void DrawArcPrimitive(int player, const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color) { SchedulePrimitive<ArcPrimitive>(player, centerPos, startAngle, endAngle, radius, 1, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive visible only to a specified player with the option to change thickness.
@@ -99,7 +130,7 @@ namespace RTE {
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
 		/// <param name="thickness">Thickness of the arc in pixels.</param>
-		void DrawArcPrimitive(int player, const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color, int thickness) { m_ScheduledPrimitives.push_back(std::make_unique<ArcPrimitive>(player, centerPos, startAngle, endAngle, radius, thickness, color)); }
+		void DrawArcPrimitive(int player, const Vector &centerPos, float startAngle, float endAngle, int radius, unsigned char color, int thickness) { SchedulePrimitive<ArcPrimitive>(player, centerPos, startAngle, endAngle, radius, thickness, color); }
 
 		/// <summary>
 		/// Schedule to draw a Bezier spline primitive.
@@ -109,7 +140,7 @@ namespace RTE {
 		/// <param name="guideB">The second guide point that controls the curve of the spline. The spline won't necessarily pass through this point, but it will affect it's shape.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawSplinePrimitive(const Vector &startPos, const Vector &guideA, const Vector &guideB, const Vector &endPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<SplinePrimitive>(-1, startPos, guideA, guideB, endPos, color)); }
+		void DrawSplinePrimitive(const Vector &startPos, const Vector &guideA, const Vector &guideB, const Vector &endPos, unsigned char color) { SchedulePrimitive<SplinePrimitive>(-1, startPos, guideA, guideB, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a Bezier spline primitive visible only to a specified player.
@@ -120,7 +151,7 @@ namespace RTE {
 		/// <param name="guideB">The second guide point that controls the curve of the spline. The spline won't necessarily pass through this point, but it will affect it's shape.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawSplinePrimitive(int player, const Vector &startPos, const Vector &guideA, const Vector &guideB, const Vector &endPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<SplinePrimitive>(player, startPos, guideA, guideB, endPos, color)); }
+		void DrawSplinePrimitive(int player, const Vector &startPos, const Vector &guideA, const Vector &guideB, const Vector &endPos, unsigned char color) { SchedulePrimitive<SplinePrimitive>(player, startPos, guideA, guideB, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a box primitive.
@@ -128,7 +159,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<BoxPrimitive>(-1, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { SchedulePrimitive<BoxPrimitive>(-1, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a box primitive visible only to a specified player.
@@ -137,7 +168,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<BoxPrimitive>(player, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { SchedulePrimitive<BoxPrimitive>(player, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled box primitive.
@@ -145,7 +176,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxFillPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<BoxFillPrimitive>(-1, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxFillPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { SchedulePrimitive<BoxFillPrimitive>(-1, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled box primitive visible only to a specified player.
@@ -154,7 +185,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxFillPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<BoxFillPrimitive>(player, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxFillPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, unsigned char color) { SchedulePrimitive<BoxFillPrimitive>(player, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a rounded box primitive.
@@ -163,7 +194,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<RoundedBoxPrimitive>(-1, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxPrimitive>(-1, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a rounded box primitive visible only to a specified player.
@@ -173,7 +204,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<RoundedBoxPrimitive>(player, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxPrimitive>(player, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled rounded box primitive.
@@ -182,7 +213,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxFillPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<RoundedBoxFillPrimitive>(-1, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxFillPrimitive(const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxFillPrimitive>(-1, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled rounded box primitive visible only to a specified player.
@@ -192,7 +223,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxFillPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<RoundedBoxFillPrimitive>(player, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxFillPrimitive(int player, const Vector &topLeftPos, const Vector &bottomRightPos, int cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxFillPrimitive>(player, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a circle primitive.
@@ -200,7 +231,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawCirclePrimitive(const Vector &centerPos, int radius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<CirclePrimitive>(-1, centerPos, radius, color)); }
+		void DrawCirclePrimitive(const Vector &centerPos, int radius, unsigned char color) { SchedulePrimitive<CirclePrimitive>(-1, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw a circle primitive visible only to a specified player.
@@ -209,7 +240,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawCirclePrimitive(int player, const Vector &centerPos, int radius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<CirclePrimitive>(player, centerPos, radius, color)); }
+		void DrawCirclePrimitive(int player, const Vector &centerPos, int radius, unsigned char color) { SchedulePrimitive<CirclePrimitive>(player, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled circle primitive.
@@ -217,7 +248,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawCircleFillPrimitive(const Vector &centerPos, int radius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<CircleFillPrimitive>(-1, centerPos, radius, color)); }
+		void DrawCircleFillPrimitive(const Vector &centerPos, int radius, unsigned char color) { SchedulePrimitive<CircleFillPrimitive>(-1, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled circle primitive visible only to a specified player.
@@ -226,7 +257,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawCircleFillPrimitive(int player, const Vector &centerPos, int radius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<CircleFillPrimitive>(player, centerPos, radius, color)); }
+		void DrawCircleFillPrimitive(int player, const Vector &centerPos, int radius, unsigned char color) { SchedulePrimitive<CircleFillPrimitive>(player, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw an ellipse primitive.
@@ -235,7 +266,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawEllipsePrimitive(const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<EllipsePrimitive>(-1, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipsePrimitive(const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { SchedulePrimitive<EllipsePrimitive>(-1, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw an ellipse primitive visible only to a specified player.
@@ -245,7 +276,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawEllipsePrimitive(int player, const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<EllipsePrimitive>(player, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipsePrimitive(int player, const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { SchedulePrimitive<EllipsePrimitive>(player, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled ellipse primitive.
@@ -254,7 +285,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawEllipseFillPrimitive(const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<EllipseFillPrimitive>(-1, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipseFillPrimitive(const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { SchedulePrimitive<EllipseFillPrimitive>(-1, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled ellipse primitive visible only to a specified player.
@@ -264,7 +295,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawEllipseFillPrimitive(int player, const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<EllipseFillPrimitive>(player, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipseFillPrimitive(int player, const Vector &centerPos, int horizRadius, int vertRadius, unsigned char color) { SchedulePrimitive<EllipseFillPrimitive>(player, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a triangle primitive.
@@ -273,7 +304,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTrianglePrimitive(const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<TrianglePrimitive>(-1, pointA, pointB, pointC, color)); }
+		void DrawTrianglePrimitive(const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { SchedulePrimitive<TrianglePrimitive>(-1, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a triangle primitive visible only to a specified player.
@@ -283,7 +314,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTrianglePrimitive(int player, const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<TrianglePrimitive>(player, pointA, pointB, pointC, color)); }
+		void DrawTrianglePrimitive(int player, const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { SchedulePrimitive<TrianglePrimitive>(player, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled triangle primitive.
@@ -292,7 +323,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTriangleFillPrimitive(const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<TriangleFillPrimitive>(-1, pointA, pointB, pointC, color)); }
+		void DrawTriangleFillPrimitive(const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { SchedulePrimitive<TriangleFillPrimitive>(-1, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled triangle primitive visible only to a specified player.
@@ -302,7 +333,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTriangleFillPrimitive(int player, const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { m_ScheduledPrimitives.push_back(std::make_unique<TriangleFillPrimitive>(player, pointA, pointB, pointC, color)); }
+		void DrawTriangleFillPrimitive(int player, const Vector &pointA, const Vector &pointB, const Vector &pointC, unsigned char color) { SchedulePrimitive<TriangleFillPrimitive>(player, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a text primitive.
@@ -311,7 +342,7 @@ namespace RTE {
 		/// <param name="text">Text string to draw.</param>
 		/// <param name="isSmall">Use small or large font. True for small font.</param>
 		/// <param name="alignment">Alignment of text.</param>
-		void DrawTextPrimitive(const Vector &start, const std::string &text, bool isSmall, int alignment) { m_ScheduledPrimitives.push_back(std::make_unique<TextPrimitive>(-1, start, text, isSmall, alignment)); }
+		void DrawTextPrimitive(const Vector &start, const std::string &text, bool isSmall, int alignment) { SchedulePrimitive<TextPrimitive>(-1, start, text, isSmall, alignment); }
 
 		/// <summary>
 		/// Schedule to draw a text primitive visible only to a specified player.
@@ -321,7 +352,7 @@ namespace RTE {
 		/// <param name="text">Text string to draw.</param>
 		/// <param name="isSmall">Use small or large font. True for small font.</param>
 		/// <param name="alignment">Alignment of text.</param>
-		void DrawTextPrimitive(int player, const Vector &start, const std::string &text, bool isSmall, int alignment) { m_ScheduledPrimitives.push_back(std::make_unique<TextPrimitive>(player, start, text, isSmall, alignment)); }
+		void DrawTextPrimitive(int player, const Vector &start, const std::string &text, bool isSmall, int alignment) { SchedulePrimitive<TextPrimitive>(player, start, text, isSmall, alignment); }
 
 		/// <summary>
 		/// Schedule to draw a bitmap primitive.
@@ -383,10 +414,57 @@ namespace RTE {
 
 	protected:
 
-		std::deque<std::unique_ptr<GraphicalPrimitive>> m_ScheduledPrimitives; //!< List of graphical primitives scheduled to draw this frame, cleared every frame during FrameMan::Draw().
+		static constexpr size_t c_ArenaBlockSize = 65536; //!< The size in bytes of each block of memory scheduled primitives are constructed in.
+
+		std::vector<std::unique_ptr<std::byte[]>> m_ArenaBlocks; //!< The blocks of memory scheduled primitives are constructed in. Kept between frames, so scheduling primitives stops allocating once there are enough blocks.
+		size_t m_ArenaBlockIndex; //!< The index of the arena block primitives are currently being constructed in.
+		size_t m_ArenaBlockOffset; //!< The offset into the current arena block the next primitive will be constructed at.
+
+		std::vector<GraphicalPrimitive *> m_ScheduledPrimitives; //!< List of graphical primitives scheduled to draw this frame, in the order they were scheduled. Cleared every frame during FrameMan::Update().
+		std::array<std::vector<GraphicalPrimitive *>, c_MaxScreenCount> m_PlayerScheduledPrimitives; //!< The scheduled primitives visible on each player screen, in the order they were scheduled. Primitives for all players are in each of these.
+		std::mutex m_ScheduledPrimitivesMutex; //!< Mutex so scripts updating in parallel on Lua worker states can schedule primitives at the same time.
+
+		mutable int m_DrawnCount; //!< How many primitives were drawn since the primitives queue was last cleared.
+		mutable int m_CulledCount; //!< How many primitives were culled since the primitives queue was last cleared.
+		mutable float m_DrawTime; //!< How long drawing primitives took since the primitives queue was last cleared, in milliseconds.
+		int m_LastFrameScheduledCount; //!< How many primitives were scheduled during the last frame.
+		int m_LastFrameDrawnCount; //!< How many primitives were drawn during the last frame.
+		int m_LastFrameCulledCount; //!< How many primitives were culled during the last frame.
+		float m_LastFrameDrawTime; //!< How long drawing primitives took during the last frame, in milliseconds.
 
 	private:
 
+		/// <summary>
+		/// Constructs a primitive in the arena and adds it to the lists of primitives scheduled to draw this frame.
+		/// </summary>
+		/// <param name="args">The arguments to construct the primitive with.</param>
+		template <typename PrimitiveType, typename... Args>
+		void SchedulePrimitive(Args &&...args) {
+			std::lock_guard<std::mutex> scheduledPrimitivesLock(m_ScheduledPrimitivesMutex);
+			GraphicalPrimitive *primitive = new (AllocateFromArena(sizeof(PrimitiveType), alignof(PrimitiveType))) PrimitiveType(std::forward<Args>(args)...);
+			m_ScheduledPrimitives.push_back(primitive);
+			if (primitive->m_Player < 0) {
+				for (std::vector<GraphicalPrimitive *> &playerScheduledPrimitives : m_PlayerScheduledPrimitives) {
+					playerScheduledPrimitives.push_back(primitive);
+				}
+			} else if (primitive->m_Player < c_MaxScreenCount) {
+				m_PlayerScheduledPrimitives.at(primitive->m_Player).push_back(primitive);
+			}
+		}
+
+		/// <summary>
+		/// Reserves memory for a primitive in the arena, adding a new block to it if the current one is full.
+		/// </summary>
+		/// <param name="size">The size of the primitive in bytes.</param>
+		/// <param name="alignment">The alignment the primitive requires.</param>
+		/// <returns>Pointer to the reserved memory.</returns>
+		void * AllocateFromArena(size_t size, size_t alignment);
+
+		/// <summary>
+		/// Clears all the member variables of this PrimitiveMan, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
 		// Disallow the use of some implicit methods.
 		PrimitiveMan(const PrimitiveMan &reference) = delete;
 		PrimitiveMan & operator=(const PrimitiveMan &rhs) = delete;
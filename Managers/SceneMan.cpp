@@ -20,6 +20,7 @@
 #include "ConsoleMan.h"
 #include "PrimitiveMan.h"
 #include "SettingsMan.h"
+#include "ThreadMan.h"
 #include "Scene.h"
 #include "SLTerrain.h"
 #include "TerrainObject.h"
@@ -30,6 +31,9 @@
 #include "MOPixel.h"
 #include "Atom.h"
 #include "Material.h"
+#include "MappedBitmap.h"
+#include "SceneRay.h"
+#include "Profiler.h"
 // Temp
 #include "Controller.h"
 
@@ -38,6 +42,8 @@ namespace RTE
 
 #define CLEANAIRINTERVAL 200000
 #define COMPACTINGHEIGHT 25
+// How many frames of scrolling ahead of the views the streamed layers are paged in
+#define STREAMINGPREFETCHFRAMES 8
 
 const std::string SceneMan::c_ClassName = "SceneMan";
 
@@ -78,8 +84,11 @@ void SceneMan::Clear()
 	m_PlaceUnits = true;
     m_pCurrentScene = 0;
     m_pMOColorLayer = 0;
+    m_MOColorLayerDrawBoxes.clear();
     m_pMOIDLayer = 0;
     m_MOIDDrawings.clear();
+    m_TerrainChangeCells.clear();
+    m_ChangedTerrainCellIndices.clear();
     m_pDebugLayer = nullptr;
     m_LastRayHitPos.Reset();
 
@@ -105,6 +114,10 @@ void SceneMan::Clear()
     }
 
     m_pUnseenRevealSound = 0;
+    for (TeamVisibility &teamVisibility : m_TeamVisibility) {
+        teamVisibility.Reset();
+    }
+    m_TeamVisibilityUpdateCount = 0;
     m_DrawRayCastVisualizations = false;
     m_DrawPixelCheckVisualizations = false;
     m_LastUpdatedScreen = 0;
@@ -164,6 +177,11 @@ int SceneMan::LoadScene(Scene *pNewScene, bool placeObjects, bool placeUnits) {
 	g_MovableMan.PurgeAllMOs();
 	g_PostProcessMan.ClearScenePostEffects();
 
+	// The passes in flight read the old terrain, so they have to be done with it before it's deleted.
+	for (TeamVisibility &teamVisibility : m_TeamVisibility) {
+		teamVisibility.Reset();
+	}
+
 	if (m_pCurrentScene) {
 		delete m_pCurrentScene;
 		m_pCurrentScene = nullptr;
@@ -204,7 +222,7 @@ int SceneMan::LoadScene(Scene *pNewScene, bool placeObjects, bool placeUnits) {
 
     // Re-create the MoveableObject:s color SceneLayer
     delete m_pMOColorLayer;
-    BITMAP *pBitmap = create_bitmap_ex(8, GetSceneWidth(), GetSceneHeight());
+    BITMAP *pBitmap = SceneLayer::CreateLayerBitmap(GetSceneWidth(), GetSceneHeight());
     clear_to_color(pBitmap, g_MaskColor);
     m_pMOColorLayer = new SceneLayer();
     m_pMOColorLayer->Create(pBitmap, true, Vector(), m_pCurrentScene->WrapsX(), m_pCurrentScene->WrapsY(), Vector(1.0, 1.0));
@@ -212,7 +230,7 @@ int SceneMan::LoadScene(Scene *pNewScene, bool placeObjects, bool placeUnits) {
 
     // Re-create the MoveableObject:s ID SceneLayer
     delete m_pMOIDLayer;
-    pBitmap = create_bitmap_ex(c_MOIDLayerBitDepth, GetSceneWidth(), GetSceneHeight());
+    pBitmap = SceneLayer::CreateLayerBitmap(GetSceneWidth(), GetSceneHeight(), c_MOIDLayerBitDepth);
     clear_to_color(pBitmap, g_NoMOID);
     m_pMOIDLayer = new SceneLayer();
     m_pMOIDLayer->Create(pBitmap, false, Vector(), m_pCurrentScene->WrapsX(), m_pCurrentScene->WrapsY(), Vector(1.0, 1.0));
@@ -397,6 +415,10 @@ int SceneMan::Save(Writer &writer) const {
 
 void SceneMan::Destroy()
 {
+    for (TeamVisibility &teamVisibility : m_TeamVisibility) {
+        teamVisibility.Reset();
+    }
+
     for (int i = 0; i < c_PaletteEntriesNumber; ++i)
         delete m_apMatPalette[i];
 
@@ -574,23 +596,8 @@ unsigned char SceneMan::GetTerrMatter(int pixelX, int pixelY)
 {
     RTEAssert(m_pCurrentScene, "Trying to get terrain matter before there is a scene or terrain!");
 
-    WrapPosition(pixelX, pixelY);
-
-    if (m_pDebugLayer && m_DrawPixelCheckVisualizations) { m_pDebugLayer->SetPixel(pixelX, pixelY, 5); }
-
-    BITMAP *pTMatBitmap = m_pCurrentScene->GetTerrain()->GetMaterialBitmap();
-
-    // If it's still below or to the sides out of bounds after
-    // what is supposed to be wrapped, shit is out of bounds.
-    if (pixelX < 0 || pixelX >= pTMatBitmap->w || pixelY >= pTMatBitmap->h)
-//        return g_MaterialOutOfBounds;
-        return g_MaterialAir;
-
-    // If above terrain bitmap, return air material.
-    if (pixelY < 0)
-        return g_MaterialAir;
-
-    return getpixel(pTMatBitmap, pixelX, pixelY);
+    // Anything out of bounds after what is supposed to be wrapped, including above the terrain, is air
+    return SceneSamplerBase::VisitCurrentScene([pixelX, pixelY](auto sceneSampler) { return sceneSampler.GetTerrMatter(pixelX, pixelY); });
 }
 
 
@@ -602,27 +609,7 @@ unsigned char SceneMan::GetTerrMatter(int pixelX, int pixelY)
 
 MOID SceneMan::GetMOIDPixel(int pixelX, int pixelY)
 {
-    WrapPosition(pixelX, pixelY);
-
-    if (m_pDebugLayer && m_DrawPixelCheckVisualizations) { m_pDebugLayer->SetPixel(pixelX, pixelY, 5); }
-
-    if (pixelX < 0 ||
-       pixelX >= m_pMOIDLayer->GetBitmap()->w ||
-       pixelY < 0 ||
-       pixelY >= m_pMOIDLayer->GetBitmap()->h)
-        return g_NoMOID;
-
-	MOID moid = getpixel(m_pMOIDLayer->GetBitmap(), pixelX, pixelY);
-	if (g_SettingsMan.SimplifiedCollisionDetection()) {
-		if (moid != ColorKeys::g_NoMOID && moid != ColorKeys::g_MOIDMaskColor) {
-			const MOSprite *mo = dynamic_cast<MOSprite *>(g_MovableMan.GetMOFromID(moid));
-			return (mo && !mo->GetTraveling()) ? moid : ColorKeys::g_NoMOID;
-		} else {
-			return ColorKeys::g_NoMOID;
-		}
-	} else {
-		return moid;
-	}
+    return SceneSamplerBase::VisitCurrentScene([pixelX, pixelY](auto sceneSampler) { return sceneSampler.GetMOIDPixel(pixelX, pixelY); });
 }
 
 
@@ -1100,6 +1087,9 @@ int SceneMan::RemoveOrphans(int posX, int posY,
 
 void SceneMan::RegisterTerrainChange(int x, int y, int w, int h, unsigned char color, bool back) 
 {
+	if (!back)
+		MarkTerrainChangeCells(x, y, w, h);
+
 	if (!g_NetworkServer.IsServerModeEnabled())
 		return;
 
@@ -1203,6 +1193,335 @@ void SceneMan::RegisterTerrainChange(int x, int y, int w, int h, unsigned char c
 	g_NetworkServer.RegisterTerrainChange(tc);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          WasTerrainChangedWithin
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether any foreground terrain change was registered inside or
+//                  near a scene area since the terrain changes were last cleared.
+
+bool SceneMan::WasTerrainChangedWithin(int left, int top, int right, int bottom) const
+{
+	if (m_ChangedTerrainCellIndices.empty())
+		return false;
+
+	int firstCellX, firstCellY, lastCellX, lastCellY, cellCountX, cellCountY;
+	if (!GetTerrainChangeCellRange(left, top, right, bottom, firstCellX, firstCellY, lastCellX, lastCellY, cellCountX, cellCountY) || m_TerrainChangeCells.size() != static_cast<size_t>(cellCountX * cellCountY))
+		return false;
+
+	for (int cellY = firstCellY; cellY <= lastCellY; ++cellY)
+	{
+		int wrappedCellY = ((cellY % cellCountY) + cellCountY) % cellCountY;
+		for (int cellX = firstCellX; cellX <= lastCellX; ++cellX)
+		{
+			int wrappedCellX = ((cellX % cellCountX) + cellCountX) % cellCountX;
+			if (m_TerrainChangeCells[wrappedCellY * cellCountX + wrappedCellX])
+				return true;
+		}
+	}
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ClearTerrainChanges
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Forgets all the terrain changes tracked for WasTerrainChangedWithin.
+
+void SceneMan::ClearTerrainChanges()
+{
+	for (int cellIndex : m_ChangedTerrainCellIndices)
+		m_TerrainChangeCells[cellIndex] = 0;
+	m_ChangedTerrainCellIndices.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          MarkTerrainChangeCells
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Marks all the terrain change cells a scene area overlaps as changed.
+
+void SceneMan::MarkTerrainChangeCells(int x, int y, int w, int h)
+{
+	int firstCellX, firstCellY, lastCellX, lastCellY, cellCountX, cellCountY;
+	if (w <= 0 || h <= 0 || !GetTerrainChangeCellRange(x, y, x + w - 1, y + h - 1, firstCellX, firstCellY, lastCellX, lastCellY, cellCountX, cellCountY))
+		return;
+
+	// The scene changed size since the cells were last used, so start over
+	if (m_TerrainChangeCells.size() != static_cast<size_t>(cellCountX * cellCountY))
+	{
+		m_TerrainChangeCells.assign(cellCountX * cellCountY, 0);
+		m_ChangedTerrainCellIndices.clear();
+	}
+
+	for (int cellY = firstCellY; cellY <= lastCellY; ++cellY)
+	{
+		int wrappedCellY = ((cellY % cellCountY) + cellCountY) % cellCountY;
+		for (int cellX = firstCellX; cellX <= lastCellX; ++cellX)
+		{
+			int cellIndex = wrappedCellY * cellCountX + (((cellX % cellCountX) + cellCountX) % cellCountX);
+			if (!m_TerrainChangeCells[cellIndex])
+			{
+				m_TerrainChangeCells[cellIndex] = 1;
+				m_ChangedTerrainCellIndices.push_back(cellIndex);
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetTerrainChangeCellRange
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the range of terrain change cells a scene area overlaps, cropped
+//                  to the scene on axes that don't wrap.
+
+bool SceneMan::GetTerrainChangeCellRange(int left, int top, int right, int bottom, int &firstCellX, int &firstCellY, int &lastCellX, int &lastCellY, int &cellCountX, int &cellCountY) const
+{
+	if (!m_pCurrentScene)
+		return false;
+
+	cellCountX = (GetSceneWidth() + c_TerrainChangeCellSize - 1) / c_TerrainChangeCellSize;
+	cellCountY = (GetSceneHeight() + c_TerrainChangeCellSize - 1) / c_TerrainChangeCellSize;
+	if (cellCountX <= 0 || cellCountY <= 0)
+		return false;
+
+	firstCellX = static_cast<int>(std::floor(static_cast<float>(left) / static_cast<float>(c_TerrainChangeCellSize)));
+	firstCellY = static_cast<int>(std::floor(static_cast<float>(top) / static_cast<float>(c_TerrainChangeCellSize)));
+	lastCellX = static_cast<int>(std::floor(static_cast<float>(right) / static_cast<float>(c_TerrainChangeCellSize)));
+	lastCellY = static_cast<int>(std::floor(static_cast<float>(bottom) / static_cast<float>(c_TerrainChangeCellSize)));
+
+	if (SceneWrapsX())
+	{
+		lastCellX = std::min(lastCellX, firstCellX + cellCountX - 1);
+	}
+	else
+	{
+		firstCellX = std::max(firstCellX, 0);
+		lastCellX = std::min(lastCellX, cellCountX - 1);
+	}
+	if (SceneWrapsY())
+	{
+		lastCellY = std::min(lastCellY, firstCellY + cellCountY - 1);
+	}
+	else
+	{
+		firstCellY = std::max(firstCellY, 0);
+		lastCellY = std::min(lastCellY, cellCountY - 1);
+	}
+	return firstCellX <= lastCellX && firstCellY <= lastCellY;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          CullOccludedScreenTiles
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Splits the screen about to be drawn into tiles, finds which of them
+//                  are entirely covered by opaque terrain foreground or unseen layer, and
+//                  gathers the areas the layers underneath still need to be drawn within
+//                  into m_BackLayerDrawBoxes and m_TerrainDrawBoxes.
+
+bool SceneMan::CullOccludedScreenTiles(BITMAP *pTargetBitmap, SceneLayer *pUnseenLayer)
+{
+	SLTerrain *pTerrain = m_pCurrentScene->GetTerrain();
+	BITMAP *pFGBitmap = pTerrain->GetFGColorBitmap();
+
+	// Only terrain that scrolls along with the view and covers the whole screen is handled, anything more exotic is just drawn everywhere
+	if (!pFGBitmap || bitmap_color_depth(pFGBitmap) != 8 || pTerrain->GetScrollRatio() != Vector(1, 1) || pFGBitmap->w < pTargetBitmap->w || pFGBitmap->h < pTargetBitmap->h)
+		return false;
+
+	// Same goes for the unseen layer, which just won't occlude anything if it can't be handled
+	if (pUnseenLayer && (!pUnseenLayer->GetBitmap() || bitmap_color_depth(pUnseenLayer->GetBitmap()) != 8 || pUnseenLayer->GetScrollRatio() != Vector(1, 1) ||
+		pUnseenLayer->GetBitmap()->w * pUnseenLayer->GetScaleFactor().m_X < pTargetBitmap->w || pUnseenLayer->GetBitmap()->h * pUnseenLayer->GetScaleFactor().m_Y < pTargetBitmap->h))
+		pUnseenLayer = nullptr;
+
+	// Work out the scroll offsets the same way the layers themselves do when drawing
+	int offsetX = pTerrain->GetOffset().GetFloorIntX();
+	int offsetY = pTerrain->GetOffset().GetFloorIntY();
+	pTerrain->WrapPosition(offsetX, offsetY);
+	int unseenOffsetX = 0;
+	int unseenOffsetY = 0;
+	if (pUnseenLayer)
+	{
+		unseenOffsetX = pUnseenLayer->GetOffset().GetFloorIntX();
+		unseenOffsetY = pUnseenLayer->GetOffset().GetFloorIntY();
+		pUnseenLayer->WrapPosition(unseenOffsetX, unseenOffsetY);
+	}
+
+	// Line the tiles up with the terrain so each one checks the same scene area no matter how the view scrolls within it
+	int originX = -(((offsetX % c_OcclusionTileSize) + c_OcclusionTileSize) % c_OcclusionTileSize);
+	int originY = -(((offsetY % c_OcclusionTileSize) + c_OcclusionTileSize) % c_OcclusionTileSize);
+	int tileCountX = (pTargetBitmap->w - originX + c_OcclusionTileSize - 1) / c_OcclusionTileSize;
+	int tileCountY = (pTargetBitmap->h - originY + c_OcclusionTileSize - 1) / c_OcclusionTileSize;
+	m_ScreenTileOcclusion.assign(tileCountX * tileCountY, NotOccluded);
+
+	// The tile rows only read the layer bitmaps and each write their own part of the occlusion, so they can be checked in parallel
+	g_ThreadMan.ParallelFor(0, tileCountY, [&](int firstTileY, int endTileY) {
+		for (int tileY = firstTileY; tileY < endTileY; ++tileY)
+		{
+			int top = std::max(originY + tileY * c_OcclusionTileSize, 0);
+			int height = std::min(originY + (tileY + 1) * c_OcclusionTileSize, pTargetBitmap->h) - top;
+			for (int tileX = 0; tileX < tileCountX; ++tileX)
+			{
+				int left = std::max(originX + tileX * c_OcclusionTileSize, 0);
+				int width = std::min(originX + (tileX + 1) * c_OcclusionTileSize, pTargetBitmap->w) - left;
+
+				unsigned char &tileOcclusion = m_ScreenTileOcclusion[tileY * tileCountX + tileX];
+				if (pUnseenLayer && IsUnseenAreaOpaque(pUnseenLayer, unseenOffsetX + left, unseenOffsetY + top, width, height))
+					tileOcclusion = OccludedByUnseen;
+				else if (IsTerrainAreaOpaque(pFGBitmap, offsetX + left, offsetY + top, width, height))
+					tileOcclusion = OccludedByTerrain;
+			}
+		}
+	}, 4);
+
+	GatherScreenDrawBoxes(tileCountX, tileCountY, originX, originY, pTargetBitmap->w, pTargetBitmap->h, OccludedByTerrain, m_BackLayerDrawBoxes);
+	GatherScreenDrawBoxes(tileCountX, tileCountY, originX, originY, pTargetBitmap->w, pTargetBitmap->h, OccludedByUnseen, m_TerrainDrawBoxes);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsTerrainAreaOpaque
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a scene area is entirely covered by terrain foreground,
+//                  without a single mask colored pixel in it.
+
+bool SceneMan::IsTerrainAreaOpaque(BITMAP *pFGBitmap, int x, int y, int width, int height) const
+{
+	if (SceneWrapsX())
+		x = ((x % pFGBitmap->w) + pFGBitmap->w) % pFGBitmap->w;
+	else if (x < 0 || x + width > pFGBitmap->w)
+		return false;
+
+	if (SceneWrapsY())
+		y = ((y % pFGBitmap->h) + pFGBitmap->h) % pFGBitmap->h;
+	else if (y < 0 || y + height > pFGBitmap->h)
+		return false;
+
+	// Checks eight pixels at a time for a mask colored one, which is a zero byte since the mask color is palette index 0
+	auto isSpanOpaque = [](const unsigned char *pixels, int spanWidth) {
+		int pixel = 0;
+		for (; pixel + 8 <= spanWidth; pixel += 8)
+		{
+			uint64_t eightPixels;
+			std::memcpy(&eightPixels, pixels + pixel, sizeof(eightPixels));
+			if (((eightPixels - 0x0101010101010101ULL) & ~eightPixels & 0x8080808080808080ULL) != 0)
+				return false;
+		}
+		for (; pixel < spanWidth; ++pixel)
+		{
+			if (pixels[pixel] == g_MaskColor)
+				return false;
+		}
+		return true;
+	};
+
+	// The part of each row past the seam continues from the left edge of the scene
+	int firstSpanWidth = std::min(width, pFGBitmap->w - x);
+	for (int row = 0; row < height; ++row)
+	{
+		const unsigned char *rowPixels = pFGBitmap->line[(y + row) % pFGBitmap->h];
+		if (!isSpanOpaque(rowPixels + x, firstSpanWidth) || !isSpanOpaque(rowPixels, width - firstSpanWidth))
+			return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsUnseenAreaOpaque
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a scene area is entirely covered by unseen pixels of an
+//                  unseen layer, including a margin of one unseen pixel all around to
+//                  make up for the rounding of the scaled drawing.
+
+bool SceneMan::IsUnseenAreaOpaque(const SceneLayer *pUnseenLayer, int x, int y, int width, int height) const
+{
+	BITMAP *pUnseenBitmap = pUnseenLayer->GetBitmap();
+	Vector scaleInverse = pUnseenLayer->GetScaleInverse();
+
+	int firstPixelX = static_cast<int>(std::floor(static_cast<float>(x) * scaleInverse.m_X)) - 1;
+	int lastPixelX = static_cast<int>(std::floor(static_cast<float>(x + width - 1) * scaleInverse.m_X)) + 1;
+	int firstPixelY = static_cast<int>(std::floor(static_cast<float>(y) * scaleInverse.m_Y)) - 1;
+	int lastPixelY = static_cast<int>(std::floor(static_cast<float>(y + height - 1) * scaleInverse.m_Y)) + 1;
+
+	for (int pixelY = firstPixelY; pixelY <= lastPixelY; ++pixelY)
+	{
+		int wrappedPixelY = pixelY;
+		if (pUnseenLayer->WrapsY())
+			wrappedPixelY = ((pixelY % pUnseenBitmap->h) + pUnseenBitmap->h) % pUnseenBitmap->h;
+		else if (pixelY < 0 || pixelY >= pUnseenBitmap->h)
+			return false;
+
+		for (int pixelX = firstPixelX; pixelX <= lastPixelX; ++pixelX)
+		{
+			int wrappedPixelX = pixelX;
+			if (pUnseenLayer->WrapsX())
+				wrappedPixelX = ((pixelX % pUnseenBitmap->w) + pUnseenBitmap->w) % pUnseenBitmap->w;
+			else if (pixelX < 0 || pixelX >= pUnseenBitmap->w)
+				return false;
+
+			if (_getpixel(pUnseenBitmap, wrappedPixelX, wrappedPixelY) == g_MaskColor)
+				return false;
+		}
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GatherScreenDrawBoxes
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gathers the screen areas covered by tiles below an occlusion level,
+//                  merging horizontal runs of tiles and identical runs on consecutive
+//                  tile rows so mostly unoccluded screens end up as few large boxes.
+
+void SceneMan::GatherScreenDrawBoxes(int tileCountX, int tileCountY, int originX, int originY, int screenWidth, int screenHeight, OcclusionLevel hiddenLevel, std::vector<Box> &drawBoxes) const
+{
+	drawBoxes.clear();
+
+	// The runs of tiles on the previous and current tile rows, as the first tile, one past the last tile and the index of the box the run went into
+	std::vector<std::array<int, 3>> previousRuns;
+	std::vector<std::array<int, 3>> currentRuns;
+
+	for (int tileY = 0; tileY < tileCountY; ++tileY)
+	{
+		int top = std::max(originY + tileY * c_OcclusionTileSize, 0);
+		int height = std::min(originY + (tileY + 1) * c_OcclusionTileSize, screenHeight) - top;
+		currentRuns.clear();
+
+		int tileX = 0;
+		while (tileX < tileCountX)
+		{
+			if (m_ScreenTileOcclusion[tileY * tileCountX + tileX] >= hiddenLevel)
+			{
+				++tileX;
+				continue;
+			}
+			int runStart = tileX;
+			while (tileX < tileCountX && m_ScreenTileOcclusion[tileY * tileCountX + tileX] < hiddenLevel)
+				++tileX;
+
+			// Grow the box of an identical run on the row above downward instead of starting a new one
+			int boxIndex = -1;
+			for (const std::array<int, 3> &previousRun : previousRuns)
+			{
+				if (previousRun[0] == runStart && previousRun[1] == tileX)
+				{
+					boxIndex = previousRun[2];
+					break;
+				}
+			}
+			if (boxIndex >= 0)
+			{
+				drawBoxes[boxIndex].SetHeight(drawBoxes[boxIndex].GetHeight() + static_cast<float>(height));
+			}
+			else
+			{
+				int left = std::max(originX + runStart * c_OcclusionTileSize, 0);
+				int right = std::min(originX + tileX * c_OcclusionTileSize, screenWidth);
+				drawBoxes.emplace_back(Vector(static_cast<float>(left), static_cast<float>(top)), static_cast<float>(right - left), static_cast<float>(height));
+				boxIndex = static_cast<int>(drawBoxes.size()) - 1;
+			}
+			currentRuns.push_back({ runStart, tileX, boxIndex });
+		}
+		std::swap(previousRuns, currentRuns);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          TryPenetrate
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1634,106 +1953,37 @@ void SceneMan::RestoreUnseenBox(const int posX, const int posY, const int width,
 //                  as long as the accumulated material strengths traced through the terrain
 //                  don't exceed a specific value.
 
-//TODO Every raycast should use some shared line drawing method (or maybe something more efficient if it exists, that needs looking into) instead of having a ton of duplicated code.
 bool SceneMan::CastUnseenRay(int team, const Vector &start, const Vector &ray, Vector &endPos, int strengthLimit, int skip, bool reveal)
 {
+    ProfileZone profileZone("SceneMan::CastUnseenRay");
+
     if (!m_pCurrentScene->GetUnseenLayer(team))
         return false;
 
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
     bool affectedAny = false;
-    unsigned char materialID;
-    Material const * foundMaterial;
     int totalStrength = 0;
     // Save the projected end of the ray pos
     endPos = start + ray;
 
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 &&  delta[Y] == 0)
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
         return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
+    bool blocked = sceneRay.March(true, [&](const auto &sceneSampler, int posX, int posY) {
+        // Reveal if we can, save the result
+        if (reveal)
+            affectedAny = RevealUnseen(posX, posY, team) || affectedAny;
+        else
+            affectedAny = RestoreUnseen(posX, posY, team) || affectedAny;
 
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
+        // Add the encountered material's strength to the tally, and see if we have hit the limits of our ray's strength
+        totalStrength += GetMaterialFromID(sceneSampler.GetTerrMatter(posX, posY))->GetIntegrity();
+        return totalStrength >= strengthLimit;
+    });
 
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-            // Reveal if we can, save the result
-			if (reveal)
-				affectedAny = RevealUnseen(intPos[X], intPos[Y], team) || affectedAny;
-			else
-				affectedAny = RestoreUnseen(intPos[X], intPos[Y], team) || affectedAny;
-
-            // Check the strength of the terrain to see if we can penetrate further
-            materialID = GetTerrMatter(intPos[X], intPos[Y]);
-            // Get the material object
-            foundMaterial = GetMaterialFromID(materialID);
-            // Add the encountered material's strength to the tally
-            totalStrength += foundMaterial->GetIntegrity();
-            // See if we have hit the limits of our ray's strength
-            if (totalStrength >= strengthLimit)
-            {
-                // Save the position of the end of the ray where blocked
-                endPos.SetXY(intPos[X], intPos[Y]);
-                break;
-            }
-            // Reset skip counter
-            skipped = 0;
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-    }
+    // Save the position of the end of the ray where blocked
+    if (blocked)
+        endPos.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
 
     return affectedAny;
 }
@@ -1765,99 +2015,80 @@ bool SceneMan::CastUnseeRay(int team, const Vector &start, const Vector &ray, Ve
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
-// Method:          CastMaterialRay
+// Method:          RegisterTeamEyePoint
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Traces along a vector and gets the location of the first encountered
-//                  pixel of a specific material in the terrain.
+// Description:     Adds an eye point to a team's next batched field-of-view pass.
 
-bool SceneMan::CastMaterialRay(const Vector &start, const Vector &ray, unsigned char material, Vector &result, int skip, bool wrap)
+void SceneMan::RegisterTeamEyePoint(int team, const Vector &eyePos, float range, const Vector &lookDirection, float spreadAngle)
 {
+    if (team < Activity::TeamOne || team >= Activity::MaxTeamCount)
+        return;
 
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool foundPixel = false;
+    m_TeamVisibility[team].AddEyePoint(eyePos, range, lookDirection, spreadAngle);
+}
 
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 &&  delta[Y] == 0)
-        return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          UpdateTeamVisibility
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Applies any finished field-of-view passes to the teams' unseen layers
+//                  and starts new ones when due.
 
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
+void SceneMan::UpdateTeamVisibility()
+{
+    if (!m_pCurrentScene)
+        return;
 
-    if (delta[Y] < 0)
+    for (int team = Activity::TeamOne; team < Activity::MaxTeamCount; ++team)
     {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
+        Vector revealedPos;
+        // Blip once per batch instead of once per revealed pixel like the see rays did
+        if (m_TeamVisibility[team].Update(team, m_TeamVisibilityUpdateCount, revealedPos) > 0 && g_SettingsMan.BlipOnRevealUnseen() && m_pUnseenRevealSound)
+            m_pUnseenRevealSound->Play(revealedPos);
     }
-    else
-        increment[Y] = 1;
+    ++m_TeamVisibilityUpdateCount;
+}
 
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
 
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsVisibleToTeam
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a position is currently in the field of view of any of
+//                  a team's eyes.
 
-    error = delta2[sub] - delta[dom];
+bool SceneMan::IsVisibleToTeam(const Vector &pos, int team) const
+{
+    if (team < Activity::TeamOne || team >= Activity::MaxTeamCount)
+        return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
+    return m_TeamVisibility[team].IsVisible(pos.GetFloorIntX(), pos.GetFloorIntY());
+}
 
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
 
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping, if necessary
-            if (wrap)
-                g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          CastMaterialRay
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Traces along a vector and gets the location of the first encountered
+//                  pixel of a specific material in the terrain.
 
-            // See if we found the looked-for pixel of the correct material
-            if (GetTerrMatter(intPos[X], intPos[Y]) == material)
-            {
-                // Save result and report success
-                foundPixel = true;
-                result.SetXY(intPos[X], intPos[Y]);
-                // Save last ray pos
-                m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                break;
-            }
+bool SceneMan::CastMaterialRay(const Vector &start, const Vector &ray, unsigned char material, Vector &result, int skip, bool wrap)
+{
+    ProfileZone profileZone("SceneMan::CastMaterialRay");
 
-            skipped = 0;
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
+        return false;
 
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
+    // See if we find the looked-for pixel of the correct material
+    if (sceneRay.MarchToMaterial(wrap, material, true))
+    {
+        // Save result and report success
+        result.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+        // Save last ray pos
+        m_LastRayHitPos = result;
+        return true;
     }
-
-    return foundPixel;
+    return false;
 }
 
 
@@ -1890,90 +2121,30 @@ float SceneMan::CastMaterialRay(const Vector &start, const Vector &ray, unsigned
 
 bool SceneMan::CastNotMaterialRay(const Vector &start, const Vector &ray, unsigned char material, Vector &result, int skip, bool checkMOs)
 {
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool foundPixel = false;
+    ProfileZone profileZone("SceneMan::CastNotMaterialRay");
 
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-
-    if (delta[X] == 0 &&  delta[Y] == 0)
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
         return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
+    bool foundPixel;
+    // See if we find a pixel of another material, or an MO blocking the way
+    if (checkMOs)
     {
-        increment[X] = -1;
-        delta[X] = -delta[X];
+        foundPixel = sceneRay.March(true, [material](const auto &sceneSampler, int posX, int posY) {
+            return sceneSampler.GetTerrMatter(posX, posY) != material || sceneSampler.GetMOIDPixel(posX, posY) != g_NoMOID;
+        });
     }
     else
-        increment[X] = 1;
+        foundPixel = sceneRay.MarchToMaterial(true, material, false);
 
-    if (delta[Y] < 0)
+    if (foundPixel)
     {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
+        // Save result and report success
+        result.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+        // Save last ray pos
+        m_LastRayHitPos = result;
     }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
-
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
-
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping, if necessary
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            // See if we found the looked-for pixel of the correct material,
-            // Or an MO is blocking the way
-            if (GetTerrMatter(intPos[X], intPos[Y]) != material ||
-                (checkMOs && g_SceneMan.GetMOIDPixel(intPos[X], intPos[Y]) != g_NoMOID))
-            {
-                // Save result and report success
-                foundPixel = true;
-                result.SetXY(intPos[X], intPos[Y]);
-                // Save last ray pos
-                m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                break;
-            }
-
-            skipped = 0;
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-    }
-
     return foundPixel;
 }
 
@@ -2007,88 +2178,22 @@ float SceneMan::CastNotMaterialRay(const Vector &start, const Vector &ray, unsig
 
 float SceneMan::CastStrengthSumRay(const Vector &start, const Vector &end, int skip, unsigned char ignoreMaterial)
 {
+    ProfileZone profileZone("SceneMan::CastStrengthSumRay");
+
     Vector ray = g_SceneMan.ShortestDistance(start, end);
     float strengthSum = 0;
 
-    int error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool foundPixel = false;
-    unsigned char materialID;
-    Material foundMaterial;
-
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 &&  delta[Y] == 0)
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
         return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else
-    {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
-
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
-
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping, if necessary
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            // Sum all strengths
-            materialID = GetTerrMatter(intPos[X], intPos[Y]);
-            if (materialID != g_MaterialAir && materialID != ignoreMaterial)
-                strengthSum += GetMaterialFromID(materialID)->GetIntegrity();
-
-            skipped = 0;
-
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-    }
+    sceneRay.March(true, [&](const auto &sceneSampler, int posX, int posY) {
+        // Sum all strengths
+        unsigned char materialID = sceneSampler.GetTerrMatter(posX, posY);
+        if (materialID != g_MaterialAir && materialID != ignoreMaterial)
+            strengthSum += GetMaterialFromID(materialID)->GetIntegrity();
+        return false;
+    });
 
     return strengthSum;
 }
@@ -2103,89 +2208,23 @@ float SceneMan::CastStrengthSumRay(const Vector &start, const Vector &end, int s
 
 float SceneMan::CastMaxStrengthRay(const Vector &start, const Vector &end, int skip)
 {
+    ProfileZone profileZone("SceneMan::CastMaxStrengthRay");
+
     Vector ray = g_SceneMan.ShortestDistance(start, end);
     float maxStrength = 0;
 
-    int error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool foundPixel = false;
-    unsigned char materialID;
-    Material foundMaterial;
-
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 &&  delta[Y] == 0)
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
         return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else
-    {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
-
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
-
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping, if necessary
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            // Sum all strengths
-            materialID = GetTerrMatter(intPos[X], intPos[Y]);
-            if (materialID != g_MaterialDoor)
-                maxStrength = std::max(maxStrength, GetMaterialFromID(materialID)->GetIntegrity());
-
-            skipped = 0;
+    sceneRay.March(true, [&](const auto &sceneSampler, int posX, int posY) {
+        // Find the strongest of all strengths, except doors
+        unsigned char materialID = sceneSampler.GetTerrMatter(posX, posY);
+        if (materialID != g_MaterialDoor)
+            maxStrength = std::max(maxStrength, GetMaterialFromID(materialID)->GetIntegrity());
+        return false;
+    });
 
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-    }
-    
     return maxStrength;
 }
 
@@ -2200,102 +2239,23 @@ float SceneMan::CastMaxStrengthRay(const Vector &start, const Vector &end, int s
 
 bool SceneMan::CastStrengthRay(const Vector &start, const Vector &ray, float strength, Vector &result, int skip, unsigned char ignoreMaterial, bool wrap)
 {
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool foundPixel = false;
-    unsigned char materialID;
-    Material const * foundMaterial;
-
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 &&  delta[Y] == 0)
-        return false;
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
-
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
-
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping, if necessary
-            if (wrap)
-                g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
+    ProfileZone profileZone("SceneMan::CastStrengthRay");
 
-            materialID = GetTerrMatter(intPos[X], intPos[Y]);
-            // Ignore the ignore material
-            if (materialID != ignoreMaterial)
-            {
-                // Get the material object
-                foundMaterial = GetMaterialFromID(materialID);
-
-                // See if we found a pixel of equal or more strength than the threshold
-                if (foundMaterial->GetIntegrity() >= strength)
-                {
-                    // Save result and report success
-                    foundPixel = true;
-                    result.SetXY(intPos[X], intPos[Y]);
-                    // Save last ray pos
-                    m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                    break;
-                }
-            }
-            skipped = 0;
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
+        return false;
 
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-    }
+    // See if we find a pixel of equal or more strength than the threshold, ignoring the ignore material
+    bool foundPixel = sceneRay.March(wrap, [&](const auto &sceneSampler, int posX, int posY) {
+        unsigned char materialID = sceneSampler.GetTerrMatter(posX, posY);
+        return materialID != ignoreMaterial && GetMaterialFromID(materialID)->GetIntegrity() >= strength;
+    });
 
-    // If no pixel of sufficient strength was found, set the result to the final tried position
-    if (!foundPixel)
-        result.SetXY(intPos[X], intPos[Y]);
+    // Save the found pixel, or if no pixel of sufficient strength was found, the final tried position
+    result.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+    // Save last ray pos
+    if (foundPixel)
+        m_LastRayHitPos = result;
 
     return foundPixel;
 }
@@ -2310,98 +2270,22 @@ bool SceneMan::CastStrengthRay(const Vector &start, const Vector &ray, float str
 
 bool SceneMan::CastWeaknessRay(const Vector &start, const Vector &ray, float strength, Vector &result, int skip, bool wrap)
 {
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool foundPixel = false;
-    unsigned char materialID;
-    Material const *foundMaterial;
-
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 &&  delta[Y] == 0)
-        return false;
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
-
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
+    ProfileZone profileZone("SceneMan::CastWeaknessRay");
 
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
-        {
-            // Scene wrapping, if necessary
-            if (wrap)
-                g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            materialID = GetTerrMatter(intPos[X], intPos[Y]);
-            foundMaterial = GetMaterialFromID(materialID);
-
-            // See if we found a pixel of equal or less strength than the threshold
-            if (foundMaterial->GetIntegrity() <= strength)
-            {
-                // Save result and report success
-                foundPixel = true;
-                result.SetXY(intPos[X], intPos[Y]);
-                // Save last ray pos
-                m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                break;
-            }
-
-            skipped = 0;
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
+        return false;
 
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-    }
+    // See if we find a pixel of equal or less strength than the threshold
+    bool foundPixel = sceneRay.March(wrap, [&](const auto &sceneSampler, int posX, int posY) {
+        return GetMaterialFromID(sceneSampler.GetTerrMatter(posX, posY))->GetIntegrity() <= strength;
+    });
 
-    // If no pixel of sufficient strength was found, set the result to the final tried position
-    if (!foundPixel)
-        result.SetXY(intPos[X], intPos[Y]);
+    // Save the found pixel, or if no pixel of sufficient weakness was found, the final tried position
+    result.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+    // Save last ray pos
+    if (foundPixel)
+        m_LastRayHitPos = result;
 
     return foundPixel;
 }
@@ -2416,124 +2300,46 @@ bool SceneMan::CastWeaknessRay(const Vector &start, const Vector &ray, float str
 
 MOID SceneMan::CastMORay(const Vector &start, const Vector &ray, MOID ignoreMOID, int ignoreTeam, unsigned char ignoreMaterial, bool ignoreAllTerrain, int skip)
 {
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    MOID hitMOID = g_NoMOID;
-    unsigned char hitTerrain = 0;
-
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 && delta[Y] == 0)
-        return g_NoMOID;
+    ProfileZone profileZone("SceneMan::CastMORay");
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
+    MOID hitMOID = g_NoMOID;
 
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
+        return g_NoMOID;
 
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
+    bool hitAnything = sceneRay.March(true, [&](const auto &sceneSampler, int posX, int posY) {
+        // Detect MOIDs
+        MOID checkMOID = sceneSampler.GetMOIDPixel(posX, posY);
+        if (checkMOID != g_NoMOID && checkMOID != ignoreMOID && g_MovableMan.GetRootMOID(checkMOID) != ignoreMOID)
         {
-
-            // Scene wrapping, if necessary
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            // Detect MOIDs
-            hitMOID = GetMOIDPixel(intPos[X], intPos[Y]);
-            if (hitMOID != g_NoMOID && hitMOID != ignoreMOID && g_MovableMan.GetRootMOID(hitMOID) != ignoreMOID)
-            {
-                // Check if we're supposed to ignore the team of what we hit
-                if (ignoreTeam != Activity::NoTeam)
-                {
-                    const MovableObject *pHitMO = g_MovableMan.GetMOFromID(hitMOID);
-                    pHitMO = pHitMO ? pHitMO->GetRootParent() : 0;
-                    // Yup, we are supposed to ignore this!
-                    if (pHitMO && pHitMO->IgnoresTeamHits() && pHitMO->GetTeam() == ignoreTeam)
-                    {
-                        ;
-                    }
-                    else
-                    {
-                        // Save last ray pos
-                        m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                        return hitMOID;
-                    }
-                }
-                // Legit hit
-                else
-                {
-                    // Save last ray pos
-                    m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                    return hitMOID;
-                }
-            }
-
-            // Detect terrain hits
-            if (!ignoreAllTerrain)
+            // Check if we're supposed to ignore the team of what we hit
+            const MovableObject *pHitMO = (ignoreTeam != Activity::NoTeam) ? g_MovableMan.GetMOFromID(checkMOID) : 0;
+            pHitMO = pHitMO ? pHitMO->GetRootParent() : 0;
+            // Legit hit, unless we are supposed to ignore this
+            if (!(pHitMO && pHitMO->IgnoresTeamHits() && pHitMO->GetTeam() == ignoreTeam))
             {
-                hitTerrain = g_SceneMan.GetTerrMatter(intPos[X], intPos[Y]);
-                if (hitTerrain != g_MaterialAir && hitTerrain != ignoreMaterial)
-                {
-                    // Save last ray pos
-                    m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                    return g_NoMOID;
-                }
+                hitMOID = checkMOID;
+                return true;
             }
+        }
 
-            skipped = 0;
-
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
+        // Detect terrain hits
+        if (!ignoreAllTerrain)
+        {
+            unsigned char hitTerrain = sceneSampler.GetTerrMatter(posX, posY);
+            if (hitTerrain != g_MaterialAir && hitTerrain != ignoreMaterial)
+                return true;
         }
-    }
+        return false;
+    });
 
-    // Didn't hit anything but air
-    return g_NoMOID;
+    // Save last ray pos
+    if (hitAnything)
+        m_LastRayHitPos.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+
+    // Terrain hits and only hitting air both give NoMOID
+    return hitMOID;
 }
 
 
@@ -2544,104 +2350,43 @@ MOID SceneMan::CastMORay(const Vector &start, const Vector &ray, MOID ignoreMOID
 
 bool SceneMan::CastFindMORay(const Vector &start, const Vector &ray, MOID targetMOID, Vector &resultPos, unsigned char ignoreMaterial, bool ignoreAllTerrain, int skip)
 {
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    MOID hitMOID = g_NoMOID;
-    unsigned char hitTerrain = 0;
-
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
-    
-    if (delta[X] == 0 && delta[Y] == 0)
-        return g_NoMOID;
+    ProfileZone profileZone("SceneMan::CastFindMORay");
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
+    bool foundTarget = false;
 
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
+    SceneRay sceneRay(start, ray, skip);
+    if (sceneRay.IsEmpty())
+        return g_NoMOID;
 
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
+    bool hitAnything = sceneRay.March(true, [&](const auto &sceneSampler, int posX, int posY) {
+        // Detect MOIDs
+        MOID hitMOID = sceneSampler.GetMOIDPixel(posX, posY);
+        if (hitMOID == targetMOID || g_MovableMan.GetRootMOID(hitMOID) == targetMOID)
         {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
+            foundTarget = true;
+            return true;
         }
-        error += delta2[sub];
 
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
+        // Detect terrain hits
+        if (!ignoreAllTerrain)
         {
-            // Scene wrapping, if necessary
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            // Detect MOIDs
-            hitMOID = GetMOIDPixel(intPos[X], intPos[Y]);
-            if (hitMOID == targetMOID || g_MovableMan.GetRootMOID(hitMOID) == targetMOID)
-            {
-                // Found target MOID, so save result and report success
-                resultPos.SetXY(intPos[X], intPos[Y]);
-                // Save last ray pos
-                m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
+            unsigned char hitTerrain = sceneSampler.GetTerrMatter(posX, posY);
+            if (hitTerrain != g_MaterialAir && hitTerrain != ignoreMaterial)
                 return true;
-            }
-
-            // Detect terrain hits
-            if (!ignoreAllTerrain)
-            {
-                hitTerrain = g_SceneMan.GetTerrMatter(intPos[X], intPos[Y]);
-                if (hitTerrain != g_MaterialAir && hitTerrain != ignoreMaterial)
-                {
-                    // Save last ray pos
-                    m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                    return false;
-                }
-            }
-
-            skipped = 0;
-
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
         }
+        return false;
+    });
+
+    if (hitAnything)
+    {
+        // Found target MOID, so save result
+        if (foundTarget)
+            resultPos.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+        // Save last ray pos
+        m_LastRayHitPos.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
     }
 
-    // Didn't hit the target
-    return false;
+    return foundTarget;
 }
 
 
@@ -2653,126 +2398,62 @@ bool SceneMan::CastFindMORay(const Vector &start, const Vector &ray, MOID target
 
 float SceneMan::CastObstacleRay(const Vector &start, const Vector &ray, Vector &obstaclePos, Vector &freePos, MOID ignoreMOID, int ignoreTeam, unsigned char ignoreMaterial, int skip)
 {
-    int hitCount = 0, error, dom, sub, domSteps, skipped = skip;
-    int intPos[2], delta[2], delta2[2], increment[2];
-    bool hitObstacle = false;
+    ProfileZone profileZone("SceneMan::CastObstacleRay");
 
-    intPos[X] = std::floor(start.m_X);
-    intPos[Y] = std::floor(start.m_Y);
-    delta[X] = std::floor(start.m_X + ray.m_X) - intPos[X];
-    delta[Y] = std::floor(start.m_Y + ray.m_Y) - intPos[Y];
+    SceneRay sceneRay(start, ray, skip);
     // The fraction of a pixel that we start from, to be added to the integer result positions for accuracy
-    Vector startFraction(start.m_X - intPos[X], start.m_Y - intPos[Y]);
+    Vector startFraction(start.m_X - std::floor(start.m_X), start.m_Y - std::floor(start.m_Y));
 
-    if (delta[X] == 0 && delta[Y] == 0)
+    if (sceneRay.IsEmpty())
         return false;
 
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm preparation
-
-    if (delta[X] < 0)
-    {
-        increment[X] = -1;
-        delta[X] = -delta[X];
-    }
-    else
-        increment[X] = 1;
-
-    if (delta[Y] < 0)
-    {
-        increment[Y] = -1;
-        delta[Y] = -delta[Y];
-    }
-    else
-        increment[Y] = 1;
-
-    // Scale by 2, for better accuracy of the error at the first pixel
-    delta2[X] = delta[X] << 1;
-    delta2[Y] = delta[Y] << 1;
-
-    // If X is dominant, Y is submissive, and vice versa.
-    if (delta[X] > delta[Y]) {
-        dom = X;
-        sub = Y;
-    }
-    else {
-        dom = Y;
-        sub = X;
-    }
-
-    error = delta2[sub] - delta[dom];
-
-    /////////////////////////////////////////////////////
-    // Bresenham's line drawing algorithm execution
+    // Skipped pixels count as free too
+    auto setFreePos = [&freePos](int posX, int posY) { freePos.SetXY(posX, posY); };
 
-    for (domSteps = 0; domSteps < delta[dom]; ++domSteps)
-    {
-        intPos[dom] += increment[dom];
-        if (error >= 0)
-        {
-            intPos[sub] += increment[sub];
-            error -= delta2[dom];
-        }
-        error += delta2[sub];
+    bool hitObstacle = sceneRay.March(true, [&](const auto &sceneSampler, int posX, int posY) {
+        unsigned char checkMat = sceneSampler.GetTerrMatter(posX, posY);
+        MOID checkMOID = sceneSampler.GetMOIDPixel(posX, posY);
 
-        // Only check pixel if we're not due to skip any, or if this is the last pixel
-        if (++skipped > skip || domSteps + 1 == delta[dom])
+        // Translate any found MOID into the root MOID of that hit MO
+        if (checkMOID != g_NoMOID)
         {
-            // Scene wrapping, if necessary
-            g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
-
-            unsigned char checkMat = GetTerrMatter(intPos[X], intPos[Y]);
-            MOID checkMOID = GetMOIDPixel(intPos[X], intPos[Y]);
-
-            // Translate any found MOID into the root MOID of that hit MO
-            if (checkMOID != g_NoMOID)
+            MovableObject *pHitMO = g_MovableMan.GetMOFromID(checkMOID);
+            if (pHitMO)
             {
-                MovableObject *pHitMO = g_MovableMan.GetMOFromID(checkMOID);
-                if (pHitMO)
+                checkMOID = pHitMO->GetRootID();
+                // Check if we're supposed to ignore the team of what we hit
+                if (ignoreTeam != Activity::NoTeam)
                 {
-                    checkMOID = pHitMO->GetRootID();
-                    // Check if we're supposed to ignore the team of what we hit
-                    if (ignoreTeam != Activity::NoTeam)
-                    {
-                        pHitMO = pHitMO->GetRootParent();
-                        // We are indeed supposed to ignore this object because of its ignoring of its specific team
-                        if (pHitMO && pHitMO->IgnoresTeamHits() && pHitMO->GetTeam() == ignoreTeam)
-                            checkMOID = g_NoMOID;
-                    }
+                    pHitMO = pHitMO->GetRootParent();
+                    // We are indeed supposed to ignore this object because of its ignoring of its specific team
+                    if (pHitMO && pHitMO->IgnoresTeamHits() && pHitMO->GetTeam() == ignoreTeam)
+                        checkMOID = g_NoMOID;
                 }
             }
+        }
 
-            // See if we found the looked-for pixel of the correct material,
-            // Or an MO is blocking the way
-            if ((checkMat != g_MaterialAir && checkMat != ignoreMaterial) || (checkMOID != g_NoMOID && checkMOID != ignoreMOID))
-            {
-                hitObstacle = true;
-                obstaclePos.SetXY(intPos[X], intPos[Y]);
-                // Save last ray pos
-                m_LastRayHitPos.SetXY(intPos[X], intPos[Y]);
-                break;
-            }
-            else
-                freePos.SetXY(intPos[X], intPos[Y]);
-
-            skipped = 0;
+        // See if we found the looked-for pixel of the correct material,
+        // Or an MO is blocking the way
+        if ((checkMat != g_MaterialAir && checkMat != ignoreMaterial) || (checkMOID != g_NoMOID && checkMOID != ignoreMOID))
+            return true;
 
-            if (m_pDebugLayer && m_DrawRayCastVisualizations) { m_pDebugLayer->SetPixel(intPos[X], intPos[Y], 13); }
-        }
-        else
-            freePos.SetXY(intPos[X], intPos[Y]);
-    }
+        setFreePos(posX, posY);
+        return false;
+    }, setFreePos);
 
     // Add the pixel fraction to the free position if there were any free pixels
-    if (domSteps != 0)
+    if (sceneRay.GetCompletedSteps() != 0)
         freePos += startFraction;
 
     if (hitObstacle)
     {
+        obstaclePos.SetXY(sceneRay.GetPosX(), sceneRay.GetPosY());
+        // Save last ray pos
+        m_LastRayHitPos = obstaclePos;
         // Add the pixel fraction to the obstacle position, to acoid losing precision
         obstaclePos += startFraction;
         // If there was an obstacle on the start position, return 0 as the distance to obstacle
-        if (domSteps == 0)
+        if (sceneRay.GetCompletedSteps() == 0)
             return 0;
         // Calculate the length between the start and the found material pixel coords
         else
@@ -3351,8 +3032,11 @@ void SceneMan::Update(int screen)
     m_LastUpdatedScreen = screen;
 
     // Update the scene, only if doing the first screen, since it only needs done once per update
-    if (screen == 0)
+    if (screen == 0) {
         m_pCurrentScene->Update();
+        // Hand the least recently viewed parts of the streamed layers back to the OS, and page in the ones the views are scrolling towards
+        MappedBitmap::Update(static_cast<long long>(g_SettingsMan.GetSceneLayerResidentBudget()) * 1024 * 1024);
+    }
 
     // Handy
     SLTerrain *pTerrain = m_pCurrentScene->GetTerrain();
@@ -3463,6 +3147,15 @@ void SceneMan::Update(int screen)
     // Calculate delta offset.
     m_DeltaOffset[screen] = m_Offset[screen] - oldOffset;
 
+    // Mark the parts of the streamed layers in view as used, and queue paging in the parts the view is scrolling towards
+    Box viewBox(m_Offset[screen], static_cast<float>(g_FrameMan.GetPlayerFrameBufferWidth(screen)), static_cast<float>(g_FrameMan.GetPlayerFrameBufferHeight(screen)));
+    Box prefetchBox(m_Offset[screen] + (m_DeltaOffset[screen] * STREAMINGPREFETCHFRAMES), viewBox.GetWidth(), viewBox.GetHeight());
+    for (const BITMAP *pLayerBitmap : { pTerrain->GetBitmap(), pTerrain->GetFGColorBitmap(), pTerrain->GetBGColorBitmap(), m_pMOColorLayer->GetBitmap(), m_pMOIDLayer->GetBitmap() })
+    {
+        MappedBitmap::TouchArea(pLayerBitmap, viewBox, false);
+        MappedBitmap::TouchArea(pLayerBitmap, prefetchBox, true);
+    }
+
     // Reset the timer so we can know the real time diff next frame
     m_ScrollTimer[screen].Reset();
 
@@ -3518,26 +3211,38 @@ void SceneMan::Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap, const Vecto
             break;
         // Draw normally
         default:
-			if (skipSkybox)
-			{
+            // Skip drawing the layers underneath wherever the screen is covered by opaque terrain or unseen layer, by clipping each layer's draw to the draw boxes
+            if (skipTerrain || targetBox != Box(Vector(0, 0), pTargetBitmap->w, pTargetBitmap->h) || !CullOccludedScreenTiles(pTargetBitmap, (pUnseenLayer && !g_FrameMan.IsInMultiplayerMode()) ? pUnseenLayer : nullptr))
+            {
+                m_BackLayerDrawBoxes.assign(1, targetBox);
+                m_TerrainDrawBoxes.assign(1, targetBox);
+            }
 
-			} 
-			else
-			{
-				// Background Layers
-				for (list<SceneLayer *>::reverse_iterator itr = m_pCurrentScene->GetBackLayers().rbegin(); itr != m_pCurrentScene->GetBackLayers().rend(); ++itr)
-					(*itr)->Draw(pTargetBitmap, targetBox);
-			}
+            // The draw boxes don't overlap, so the whole stack underneath the terrain foreground can be drawn box by box
+            for (const Box &drawBox : m_BackLayerDrawBoxes)
+            {
+                if (!skipSkybox)
+                {
+                    // Background Layers
+                    for (list<SceneLayer *>::reverse_iterator itr = m_pCurrentScene->GetBackLayers().rbegin(); itr != m_pCurrentScene->GetBackLayers().rend(); ++itr)
+                        (*itr)->Draw(pTargetBitmap, targetBox, Vector(-1, -1), drawBox);
+                }
+                if (!skipTerrain)
+                    // Terrain background
+                    pTerrain->DrawBackground(pTargetBitmap, targetBox, Vector(-1, -1), drawBox);
+                // Movables' color layer
+                m_pMOColorLayer->Draw(pTargetBitmap, targetBox, Vector(-1, -1), drawBox);
+            }
 
-			if (!skipTerrain)
-				// Terrain background
-				pTerrain->DrawBackground(pTargetBitmap, targetBox);
-            // Movables' color layer
-            m_pMOColorLayer->Draw(pTargetBitmap, targetBox);
             // Terrain foreground
             pTerrain->SetToDrawMaterial(false);
-			if (!skipTerrain)
-				pTerrain->Draw(pTargetBitmap, targetBox);
+            if (!skipTerrain)
+            {
+                for (const Box &drawBox : m_TerrainDrawBoxes)
+                {
+                    pTerrain->Draw(pTargetBitmap, targetBox, Vector(-1, -1), drawBox);
+                }
+            }
 
             // Obscure unexplored/unseen areas
             if (pUnseenLayer && !g_FrameMan.IsInMultiplayerMode())
@@ -3562,11 +3267,41 @@ void SceneMan::Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap, const Vecto
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          ClearMOColorLayer
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Clears the color MO layer. Should be done every frame.
+// Description:     Clears the color MO layer. Should be done every frame. Only the areas
+//                  around the player screens' views are cleared, and those are remembered
+//                  as the areas that MOs need to be drawn within this frame.
 
-void SceneMan::ClearMOColorLayer()
+void SceneMan::ClearMOColorLayer(bool entireLayer)
 {
-    clear_to_color(m_pMOColorLayer->GetBitmap(), g_MaskColor);
+    BITMAP *pMOColorBitmap = m_pMOColorLayer->GetBitmap();
+    m_MOColorLayerDrawBoxes.clear();
+
+    if (entireLayer)
+    {
+        clear_to_color(pMOColorBitmap, g_MaskColor);
+        m_MOColorLayerDrawBoxes.push_back(Box(Vector(), pMOColorBitmap->w, pMOColorBitmap->h));
+    }
+    else
+    {
+        // Network players each get their own view, regardless of the local split screen setup
+        int screenCount = g_FrameMan.IsInMultiplayerMode() ? c_MaxScreenCount : g_FrameMan.GetScreenCount();
+        Vector marginOffset(c_MOColorLayerViewMargin, c_MOColorLayerViewMargin);
+        for (int screen = 0; screen < screenCount; ++screen)
+        {
+            Vector viewSize(g_FrameMan.GetPlayerFrameBufferWidth(screen), g_FrameMan.GetPlayerFrameBufferHeight(screen));
+            WrapBox(Box(m_Offset[screen] - marginOffset, viewSize.m_X + c_MOColorLayerViewMargin * 2, viewSize.m_Y + c_MOColorLayerViewMargin * 2), m_MOColorLayerDrawBoxes);
+
+            // The view is only scrolled after the MOs have been drawn, so if it's about to jump further than the margin covers, cover where it's headed too
+            Vector offsetTarget = m_ScrollTarget[screen] - (viewSize / 2) - (m_ScreenOcclusion[screen] / 2);
+            if (std::abs(offsetTarget.m_X - m_Offset[screen].m_X) > c_MOColorLayerViewMargin || std::abs(offsetTarget.m_Y - m_Offset[screen].m_Y) > c_MOColorLayerViewMargin)
+                WrapBox(Box(offsetTarget - marginOffset, viewSize.m_X + c_MOColorLayerViewMargin * 2, viewSize.m_Y + c_MOColorLayerViewMargin * 2), m_MOColorLayerDrawBoxes);
+        }
+        // Boxes that still hang off the edges of a non-wrapping scene are clipped by rectfill itself
+        for (const Box &drawBox : m_MOColorLayerDrawBoxes)
+        {
+            rectfill(pMOColorBitmap, drawBox.GetCorner().GetFloorIntX(), drawBox.GetCorner().GetFloorIntY(), static_cast<int>(std::ceil(drawBox.GetCorner().m_X + drawBox.GetWidth())) - 1, static_cast<int>(std::ceil(drawBox.GetCorner().m_Y + drawBox.GetHeight())) - 1, g_MaskColor);
+        }
+    }
 
     if (m_pDebugLayer) { clear_to_color(m_pDebugLayer->GetBitmap(), g_MaskColor); }
 }
@@ -3601,6 +3336,9 @@ void SceneMan::ClearSeenPixels()
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void SceneMan::ClearCurrentScene() {
+    for (TeamVisibility &teamVisibility : m_TeamVisibility) {
+        teamVisibility.Reset();
+    }
     m_pCurrentScene = nullptr;
 }
 
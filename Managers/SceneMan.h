@@ -18,6 +18,7 @@
 #include "Timer.h"
 #include "Box.h"
 #include "Singleton.h"
+#include "TeamVisibility.h"
 
 #include "ActivityMan.h"
 
@@ -105,6 +106,12 @@ struct IntRect
 
 class SceneMan : public Singleton<SceneMan>, public Serializable {
 	friend class SettingsMan;
+	friend class SceneSamplerBase;
+	friend class SceneRay;
+	friend class SceneManCastTests;
+	friend class SceneRayBenchmark;
+	friend class LuaQueryBenchmark;
+	friend class AtomGroupTravelBenchmark;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Public member variable, method and friend function declarations
@@ -1080,6 +1087,47 @@ public:
 	bool CastUnseeRay(int team, const Vector &start, const Vector &ray, Vector &endPos, int strengthLimit, int skip = 0);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          RegisterTeamEyePoint
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Adds an eye point to a team's next batched field-of-view pass, which
+//                  reveals the team's unseen layer and answers IsVisibleToTeam.
+// Arguments:       The team the eye belongs to.
+//                  The absolute scene position of the eye.
+//                  How far the eye can see, in pixels.
+//                  The direction the eye looks in. A zero vector means all around.
+//                  How far to either side of the look direction the eye can see, in
+//                  radians. Pi or more means all around.
+// Return value:    None.
+
+    void RegisterTeamEyePoint(int team, const Vector &eyePos, float range, const Vector &lookDirection = Vector(), float spreadAngle = c_PI);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          UpdateTeamVisibility
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Applies any finished field-of-view passes to the teams' unseen layers
+//                  and starts new ones when due. Should be done once every sim update,
+//                  after the Actors have registered their eye points.
+// Arguments:       None.
+// Return value:    None.
+
+    void UpdateTeamVisibility();
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsVisibleToTeam
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a position is currently in the field of view of any of
+//                  a team's eyes, as of the team's last completed visibility pass. Much
+//                  cheaper than casting a see ray, and meant to be used by AI instead.
+// Arguments:       The absolute scene position to check.
+//                  The team to check for.
+// Return value:    Whether the position is visible to the team.
+
+    bool IsVisibleToTeam(const Vector &pos, int team) const;
+
+
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1597,11 +1645,24 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          ClearMOColorLayer
 //////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Clears the color MO layer. Should be done every frame.
-// Arguments:       None.
+// Description:     Clears the color MO layer. Should be done every frame. Only the areas
+//                  around the player screens' views are cleared, and those are remembered
+//                  as the areas that MOs need to be drawn within this frame.
+// Arguments:       Whether to clear the entire layer regardless of what the screens can see.
 // Return value:    None.
 
-    void ClearMOColorLayer();
+    void ClearMOColorLayer(bool entireLayer = false);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetMOColorLayerDrawBoxes
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the areas of the color MO layer that were cleared last and need
+//                  to be drawn within. Already wrapped, so none straddles a scene seam.
+// Arguments:       None.
+// Return value:    A list of the scene areas MOs should be drawn within this frame.
+
+    const std::list<Box> & GetMOColorLayerDrawBoxes() const { return m_MOColorLayerDrawBoxes; }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1647,6 +1708,32 @@ public:
 	void RegisterTerrainChange(int x, int y, int w, int h, unsigned char color, bool back);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          WasTerrainChangedWithin
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether any foreground terrain change was registered inside or
+//                  near a scene area since the terrain changes were last cleared. This is
+//                  tracked at a coarse resolution, so it may report changes just outside
+//                  the area too.
+// Arguments:       The edges of the scene area to check, inclusive. Can be out of scene
+//                  bounds, will be wrapped or cropped as appropriate.
+// Return value:    Whether the terrain in or around the area was changed.
+
+	bool WasTerrainChangedWithin(int left, int top, int right, int bottom) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ClearTerrainChanges
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Forgets all the terrain changes tracked for WasTerrainChangedWithin.
+//                  Should be done every sim update, after everything that cares about
+//                  terrain changes has checked for them.
+// Arguments:       None.
+// Return value:    None.
+
+	void ClearTerrainChanges();
+
+
 	//	Struct to register terrain change events
 	struct TerrainChange
 	{
@@ -1682,10 +1769,22 @@ public:
     Scene *m_pCurrentScene;
     // Color MO layer
     SceneLayer *m_pMOColorLayer;
+    // All the areas of the color MO layer cleared and drawn within this frame
+    std::list<Box> m_MOColorLayerDrawBoxes;
     // MovableObject ID layer
     SceneLayer *m_pMOIDLayer;
     // All the areas drawn within on the MOID layer since last Update
     std::list<IntRect> m_MOIDDrawings;
+    // Whether the foreground terrain was changed in each coarse cell of the scene since the terrain changes were last cleared. Row-major
+    std::vector<unsigned char> m_TerrainChangeCells;
+    // The indices of all the cells marked in m_TerrainChangeCells, so clearing them doesn't have to go through the whole scene
+    std::vector<int> m_ChangedTerrainCellIndices;
+    // How occluded each tile of the screen being drawn is, see OcclusionLevel. Row-major
+    std::vector<unsigned char> m_ScreenTileOcclusion;
+    // The areas of the screen being drawn where the back layers, terrain background and color MO layer aren't hidden behind anything opaque
+    std::vector<Box> m_BackLayerDrawBoxes;
+    // The areas of the screen being drawn where the terrain foreground isn't hidden behind the unseen layer
+    std::vector<Box> m_TerrainDrawBoxes;
 
     // Debug layer for seeing cast rays etc
     SceneLayer *m_pDebugLayer;
@@ -1728,6 +1827,10 @@ public:
 
     // Sound of an unseen pixel on an unseen layer being revealed.
     SoundContainer *m_pUnseenRevealSound;
+    // Batched field-of-view state of each team, fed by the eye points of its Actors.
+    std::array<TeamVisibility, Activity::MaxTeamCount> m_TeamVisibility;
+    // How many times UpdateTeamVisibility has been called, used to stagger the teams' visibility passes.
+    long m_TeamVisibilityUpdateCount;
 
     bool m_DrawRayCastVisualizations; //!< Whether to visibly draw RayCasts to the Scene debug Bitmap.
     bool m_DrawPixelCheckVisualizations; //!< Whether to visibly draw pixel checks (GetTerrMatter and GetMOIDPixel) to the Scene debug Bitmap.
@@ -1755,6 +1858,91 @@ public:
 private:
 
 	static const std::string c_ClassName; //!< A string with the friendly-formatted type name of this object.
+	static constexpr int c_MOColorLayerViewMargin = 64; //!< How many pixels beyond each screen's view the color MO layer is cleared and drawn within, to cover the view scrolling between the sim update and the draw.
+	static constexpr int c_TerrainChangeCellSize = 32; //!< The width and height in pixels of the cells terrain changes are tracked in for WasTerrainChangedWithin.
+	static constexpr int c_OcclusionTileSize = 32; //!< The width and height in pixels of the screen tiles that are checked for being hidden behind opaque layers when drawing.
+
+	/// <summary>
+	/// How much of the layer stack a screen tile is hidden behind. Each level hides all the layers drawn before the layer that causes it.
+	/// </summary>
+	enum OcclusionLevel { NotOccluded = 0, OccludedByTerrain, OccludedByUnseen };
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          MarkTerrainChangeCells
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Marks all the terrain change cells a scene area overlaps as changed.
+// Arguments:       x,y - scene coordinates of the area, w,h - size of the area.
+// Return value:    None.
+
+	void MarkTerrainChangeCells(int x, int y, int w, int h);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetTerrainChangeCellRange
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the range of terrain change cells a scene area overlaps, cropped
+//                  to the scene on axes that don't wrap.
+// Arguments:       The edges of the scene area, inclusive. The first and last cell
+//                  coordinates the area overlaps, unwrapped, and how many cells there
+//                  are across the scene, to be filled out.
+// Return value:    Whether the area overlaps any cells at all.
+
+	bool GetTerrainChangeCellRange(int left, int top, int right, int bottom, int &firstCellX, int &firstCellY, int &lastCellX, int &lastCellY, int &cellCountX, int &cellCountY) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          CullOccludedScreenTiles
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Splits the screen about to be drawn into tiles, finds which of them
+//                  are entirely covered by opaque terrain foreground or unseen layer, and
+//                  gathers the areas the layers underneath still need to be drawn within
+//                  into m_BackLayerDrawBoxes and m_TerrainDrawBoxes.
+// Arguments:       The bitmap the screen is being drawn to. The unseen layer that will be
+//                  drawn over the screen, if any.
+// Return value:    Whether the screen could be culled. If not, everything should be drawn
+//                  over the whole screen as usual.
+
+	bool CullOccludedScreenTiles(BITMAP *pTargetBitmap, SceneLayer *pUnseenLayer);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsTerrainAreaOpaque
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a scene area is entirely covered by terrain foreground,
+//                  without a single mask colored pixel in it.
+// Arguments:       The terrain foreground bitmap. The scene area to check, which may
+//                  straddle a wrapping seam but must not be larger than the scene.
+// Return value:    Whether the area is entirely opaque.
+
+	bool IsTerrainAreaOpaque(BITMAP *pFGBitmap, int x, int y, int width, int height) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsUnseenAreaOpaque
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Tells whether a scene area is entirely covered by unseen pixels of an
+//                  unseen layer, including a margin of one unseen pixel all around to
+//                  make up for the rounding of the scaled drawing.
+// Arguments:       The unseen layer. The scene area to check.
+// Return value:    Whether the area is entirely hidden by the unseen layer.
+
+	bool IsUnseenAreaOpaque(const SceneLayer *pUnseenLayer, int x, int y, int width, int height) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GatherScreenDrawBoxes
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gathers the screen areas covered by tiles below an occlusion level,
+//                  merging horizontal runs of tiles and identical runs on consecutive
+//                  tile rows so mostly unoccluded screens end up as few large boxes.
+// Arguments:       The number of tiles across and down the screen. The screen position of
+//                  the upper left corner of the first tile, which may be off screen. The
+//                  size of the screen. The occlusion level at which a tile is hidden. The
+//                  list to fill with the areas to draw within.
+// Return value:    None.
+
+	void GatherScreenDrawBoxes(int tileCountX, int tileCountY, int originX, int originY, int screenWidth, int screenHeight, OcclusionLevel hiddenLevel, std::vector<Box> &drawBoxes) const;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          Clear
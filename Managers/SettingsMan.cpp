@@ -42,6 +42,9 @@ namespace RTE {
 
 		m_RecommendedMOIDCount = 240;
 		m_SimplifiedCollisionDetection = false;
+		m_SceneLayerStreamingThreshold = 0;
+		m_SceneLayerResidentBudget = 256;
+		m_ContentPrefetchBudget = 128;
 
 		m_SkipIntro = true;
 		m_ShowToolTips = true;
@@ -123,6 +126,15 @@ namespace RTE {
 			reader >> g_AudioMan.m_MuteSounds;
 		} else if (propName == "SoundPanningEffectStrength") {
 			reader >> g_AudioMan.m_SoundPanningEffectStrength;
+		} else if (propName == "SoundVoiceBudget") {
+			reader >> g_AudioMan.m_SoundVoiceBudget;
+			g_AudioMan.m_SoundVoiceBudget = std::max(g_AudioMan.m_SoundVoiceBudget, 1);
+		} else if (propName == "SoundCoalescingWindow") {
+			reader >> g_AudioMan.m_SoundCoalescingWindow;
+		} else if (propName == "SoundCoalescingRadius") {
+			reader >> g_AudioMan.m_SoundCoalescingRadius;
+		} else if (propName == "UseNoSoundOutput") {
+			reader >> g_AudioMan.m_UseNoSoundOutput;
 
 		//////////////////////////////////////////////////
 		//TODO These need to be removed when our soundscape is sorted out. They're only here temporarily to allow for easier tweaking by pawnis.
@@ -168,14 +180,32 @@ namespace RTE {
 			reader >> g_SceneMan.m_DefaultSceneName;
 		} else if (propName == "DisableLuaJIT") {
 			reader >> g_LuaMan.m_DisableLuaJIT;
+		} else if (propName == "DisableLuaFastPath") {
+			reader >> g_LuaMan.m_DisableLuaFastPath;
+		} else if (propName == "LuaWorkerStateCount") {
+			reader >> g_LuaMan.m_WorkerStateCount;
 		} else if (propName == "RecommendedMOIDCount") {
 			reader >> m_RecommendedMOIDCount;
 		} else if (propName == "SimplifiedCollisionDetection") {
 			reader >> m_SimplifiedCollisionDetection;
+		} else if (propName == "SceneLayerStreamingThreshold") {
+			reader >> m_SceneLayerStreamingThreshold;
+		} else if (propName == "SceneLayerResidentBudget") {
+			reader >> m_SceneLayerResidentBudget;
+		} else if (propName == "ContentPrefetchBudget") {
+			reader >> m_ContentPrefetchBudget;
 		} else if (propName == "EnableParticleSettling") {
 			reader >> g_MovableMan.m_SettlingEnabled;
 		} else if (propName == "EnableMOSubtraction") {
 			reader >> g_MovableMan.m_MOSubtractionEnabled;
+		} else if (propName == "AILevelOfDetail") {
+			bool levelOfDetailEnabled;
+			reader >> levelOfDetailEnabled;
+			g_MovableMan.m_AIScheduler.SetLevelOfDetailEnabled(levelOfDetailEnabled);
+		} else if (propName == "AIUpdateBudget") {
+			float timeBudget;
+			reader >> timeBudget;
+			g_MovableMan.m_AIScheduler.SetTimeBudget(timeBudget);
 		} else if (propName == "DeltaTime") {
 			g_TimerMan.SetDeltaTimeSecs(std::stof(reader.ReadPropValue()));
 		} else if (propName == "RealToSimCap") {
@@ -305,6 +335,10 @@ namespace RTE {
 		writer.NewPropertyWithValue("SoundVolume", g_AudioMan.m_SoundsVolume * 100);
 		writer.NewPropertyWithValue("MuteSounds", g_AudioMan.m_MuteSounds);
 		writer.NewPropertyWithValue("SoundPanningEffectStrength", g_AudioMan.m_SoundPanningEffectStrength);
+		writer.NewPropertyWithValue("SoundVoiceBudget", g_AudioMan.m_SoundVoiceBudget);
+		writer.NewPropertyWithValue("SoundCoalescingWindow", g_AudioMan.m_SoundCoalescingWindow);
+		writer.NewPropertyWithValue("SoundCoalescingRadius", g_AudioMan.m_SoundCoalescingRadius);
+		writer.NewPropertyWithValue("UseNoSoundOutput", g_AudioMan.m_UseNoSoundOutput);
 
 		//////////////////////////////////////////////////
 		//TODO These need to be removed when our soundscape is sorted out. They're only here temporarily to allow for easier tweaking by pawnis.
@@ -344,10 +378,17 @@ namespace RTE {
 		writer.NewLineString("// Engine Settings", false);
 		writer.NewLine(false);
 		writer.NewPropertyWithValue("DisableLuaJIT", g_LuaMan.m_DisableLuaJIT);
+		writer.NewPropertyWithValue("DisableLuaFastPath", g_LuaMan.m_DisableLuaFastPath);
+		writer.NewPropertyWithValue("LuaWorkerStateCount", g_LuaMan.m_WorkerStateCount);
 		writer.NewPropertyWithValue("RecommendedMOIDCount", m_RecommendedMOIDCount);
 		writer.NewPropertyWithValue("SimplifiedCollisionDetection", m_SimplifiedCollisionDetection);
+		writer.NewPropertyWithValue("SceneLayerStreamingThreshold", m_SceneLayerStreamingThreshold);
+		writer.NewPropertyWithValue("SceneLayerResidentBudget", m_SceneLayerResidentBudget);
+		writer.NewPropertyWithValue("ContentPrefetchBudget", m_ContentPrefetchBudget);
 		writer.NewPropertyWithValue("EnableParticleSettling", g_MovableMan.m_SettlingEnabled);
 		writer.NewPropertyWithValue("EnableMOSubtraction", g_MovableMan.m_MOSubtractionEnabled);
+		writer.NewPropertyWithValue("AILevelOfDetail", g_MovableMan.m_AIScheduler.IsLevelOfDetailEnabled());
+		writer.NewPropertyWithValue("AIUpdateBudget", g_MovableMan.m_AIScheduler.GetTimeBudget());
 		writer.NewPropertyWithValue("DeltaTime", g_TimerMan.GetDeltaTimeSecs());
 		writer.NewPropertyWithValue("RealToSimCap", g_TimerMan.GetRealToSimCap());
 
@@ -68,6 +68,24 @@ namespace RTE {
 		/// </summary>
 		/// <returns>Whether simplified collision detection is enabled or not.</returns>
 		bool SimplifiedCollisionDetection() const { return m_SimplifiedCollisionDetection; }
+
+		/// <summary>
+		/// Gets the size from which Scene layers are backed by memory-mapped files that are paged in around the views, instead of being kept in memory whole.
+		/// </summary>
+		/// <returns>The streaming threshold in megapixels. 0 means streaming is disabled.</returns>
+		int GetSceneLayerStreamingThreshold() const { return m_SceneLayerStreamingThreshold; }
+
+		/// <summary>
+		/// Gets how much of the streamed Scene layers is kept paged in before the least recently viewed parts are handed back to the OS.
+		/// </summary>
+		/// <returns>The resident budget in megabytes.</returns>
+		int GetSceneLayerResidentBudget() const { return m_SceneLayerResidentBudget; }
+
+		/// <summary>
+		/// Gets how much memory BITMAPs that were read and decoded ahead of time can take up before they're requested, e.g. the layers of a Scene that is being loaded.
+		/// </summary>
+		/// <returns>The prefetch budget in megabytes. 0 means prefetching is disabled.</returns>
+		int GetContentPrefetchBudget() const { return m_ContentPrefetchBudget; }
 #pragma endregion
 
 #pragma region Gameplay Settings
@@ -457,6 +475,9 @@ namespace RTE {
 
 		int m_RecommendedMOIDCount; //!< Recommended max MOID's before removing actors from scenes.
 		bool m_SimplifiedCollisionDetection; //!< Whether simplified collision detection (reduced MOID layer sampling) is enabled.
+		int m_SceneLayerStreamingThreshold; //!< Size in megapixels from which Scene layers are backed by memory-mapped files. 0 disables streaming.
+		int m_SceneLayerResidentBudget; //!< How many megabytes of the streamed Scene layers are kept paged in.
+		int m_ContentPrefetchBudget; //!< How many megabytes of prefetched BITMAPs can wait to be requested. 0 disables prefetching.
 
 		bool m_SkipIntro; //!< Whether to play the intro of the game or skip directly to the main menu.
 		bool m_ShowToolTips; //!< Whether ToolTips are enabled or not.
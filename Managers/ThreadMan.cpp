@@ -1,62 +1,119 @@
-//////////////////////////////////////////////////////////////////////////////////////////
-// File:            ThreadMan.cpp
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Source file for the ThreadMan class.
-// Project:         Retro Terrain Engine
-// Author(s):       
-//                  
-//                  
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Inclusions of header files
-
-
 #include "ThreadMan.h"
-
-using namespace std;
-
-namespace RTE
-{
-
-#define DELTABUFFERSIZE 30
-
-const string ThreadMan::m_ClassName = "ThreadMan";
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Method:          Clear
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Clears all the member variables of this ThreadMan, effectively
-//                  resetting the members of this abstraction level only.
-
-void ThreadMan::Clear()
-{
+#include "Profiler.h"
+
+namespace RTE {
+
+	thread_local bool ThreadMan::s_IsWorkerThread = false;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadMan::Clear() {
+		m_Workers.clear();
+		m_Jobs = std::queue<std::packaged_task<void()>>();
+		m_Stopping = false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int ThreadMan::Initialize(int workerCount) {
+		if (workerCount <= 0) { workerCount = std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1); }
+
+		m_Stopping = false;
+		m_Workers.reserve(workerCount);
+		for (int worker = 0; worker < workerCount; ++worker) {
+			m_Workers.emplace_back(&ThreadMan::WorkerThreadFunction, this, worker);
+		}
+		return 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadMan::Destroy() {
+		{
+			std::lock_guard<std::mutex> jobsLock(m_JobsMutex);
+			m_Stopping = true;
+		}
+		m_JobsCondition.notify_all();
+		for (std::thread &worker : m_Workers) {
+			if (worker.joinable()) { worker.join(); }
+		}
+		Clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int ThreadMan::GetPendingJobCount() {
+		std::lock_guard<std::mutex> jobsLock(m_JobsMutex);
+		return static_cast<int>(m_Jobs.size());
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::future<void> ThreadMan::QueueJob(std::function<void()> job) {
+		std::packaged_task<void()> task(std::move(job));
+		std::future<void> result = task.get_future();
+
+		if (m_Workers.empty()) {
+			task();
+			return result;
+		}
+		{
+			std::lock_guard<std::mutex> jobsLock(m_JobsMutex);
+			m_Jobs.push(std::move(task));
+		}
+		m_JobsCondition.notify_one();
+		return result;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadMan::ParallelFor(int begin, int end, const std::function<void(int, int)> &chunkJob, int minChunkSize) {
+		int rangeSize = end - begin;
+		if (rangeSize <= 0) {
+			return;
+		}
+		// The calling thread takes a chunk too instead of idling while it waits.
+		int chunkCount = std::clamp(rangeSize / std::max(minChunkSize, 1), 1, GetWorkerCount() + 1);
+		if (chunkCount == 1 || s_IsWorkerThread) {
+			chunkJob(begin, end);
+			return;
+		}
+		int chunkSize = rangeSize / chunkCount;
+		int remainder = rangeSize % chunkCount;
+
+		std::vector<std::future<void>> chunkResults;
+		chunkResults.reserve(chunkCount - 1);
+		int chunkBegin = begin;
+		for (int chunk = 0; chunk < chunkCount - 1; ++chunk) {
+			int chunkEnd = chunkBegin + chunkSize + (chunk < remainder ? 1 : 0);
+			chunkResults.emplace_back(QueueJob([&chunkJob, chunkBegin, chunkEnd]() { chunkJob(chunkBegin, chunkEnd); }));
+			chunkBegin = chunkEnd;
+		}
+		chunkJob(chunkBegin, end);
+
+		for (std::future<void> &chunkResult : chunkResults) {
+			chunkResult.get();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadMan::WorkerThreadFunction(int workerIndex) {
+		Profiler::SetThreadName("Worker " + std::to_string(workerIndex + 1));
+		s_IsWorkerThread = true;
+		while (true) {
+			std::packaged_task<void()> job;
+			{
+				std::unique_lock<std::mutex> jobsLock(m_JobsMutex);
+				m_JobsCondition.wait(jobsLock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+				if (m_Jobs.empty()) {
+					return;
+				}
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop();
+			}
+			ProfileZone profileZone("ThreadMan Job");
+			job();
+		}
+	}
 }
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Method:          Create
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Makes the ThreadMan object ready for use.
-
-int ThreadMan::Create()
-{
-
-	return 0;
-}
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Method:          Destroy
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Destroys and resets (through Clear()) the ThreadMan object.
-
-void ThreadMan::Destroy()
-{
-
-
-    Clear();
-}
-
-} // namespace RTE
\ No newline at end of file
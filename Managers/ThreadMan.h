@@ -1,141 +1,111 @@
-#ifndef _RTEThreadMan_
-#define _RTEThreadMan_
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// File:            ThreadMan.h
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Header file for the ThreadMan class.
-// Project:         Retro Terrain Engine
-// Author(s):       
-//                  
-//                  
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Inclusions of header files
-
-#include "global_types.h"
-
-
-//#include <boost/thread.hpp>
+#ifndef _RTETHREADMAN_
+#define _RTETHREADMAN_
 
 #include "Singleton.h"
-#define g_ThreadMan ThreadMan::Instance()
-
-namespace RTE
-{
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Class:           ThreadMan
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     The centralized singleton manager of all threads.
-// Parent(s):       Singleton
-// Class history:   03/29/2014  ThreadMan created.
-
-
-class ThreadMan:
-    public Singleton<ThreadMan>
-{
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Public member variable, method and friend function declarations
-
-public:
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Constructor:     ThreadMan
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Constructor method used to instantiate a ThreadMan object in system
-//                  memory. Create() should be called before using the object.
-// Arguments:       None.
-
-    ThreadMan() { Clear(); Create(); }
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Destructor:      ~ThreadMan
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Destructor method used to clean up a ThreadMan object before deletion
-//                  from system memory.
-// Arguments:       None.
-
-    virtual ~ThreadMan() { Destroy(); }
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Method:          Create
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Makes the ThreadMan object ready for use.
-// Arguments:       None.
-// Return value:    An error return value signaling sucess or any particular failure.
-//                  Anything below 0 is an error signal.
 
-    virtual int Create();
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Virtual method:  Reset
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Resets the entire ThreadMan, including its inherited members, to
-//                  their default settings or values.
-// Arguments:       None.
-// Return value:    None.
-
-    virtual void Reset() { Clear(); }
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Method:          Destroy
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Destroys and resets (through Clear()) the ThreadMan object.
-// Arguments:       None.
-// Return value:    None.
-
-    void Destroy();
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Virtual method:  GetClassName
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Gets the class name of this Entity.
-// Arguments:       None.
-// Return value:    A string with the friendly-formatted type name of this object.
-
-    virtual const std::string & GetClassName() const { return m_ClassName; }
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Protected member variable and method declarations
-
-protected:
-
-    // Member variables
-    static const std::string m_ClassName;
-
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Private member variable and method declarations
-
-private:
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Method:          Clear
-//////////////////////////////////////////////////////////////////////////////////////////
-// Description:     Clears all the member variables of this ThreadMan, effectively
-//                  resetting the members of this abstraction level only.
-// Arguments:       None.
-// Return value:    None.
-
-    void Clear();
-
-    // Disallow the use of some implicit methods.
-    ThreadMan(const ThreadMan &reference);
-    ThreadMan & operator=(const ThreadMan &rhs);
-
-};
-
-} // namespace RTE
+#define g_ThreadMan ThreadMan::Instance()
 
-#endif // File
+namespace RTE {
+
+	/// <summary>
+	/// The centralized singleton manager of all worker threads. Owns a pool of workers that any system can push self-contained jobs onto.
+	/// Jobs must not touch Allegro bitmaps, Lua states or MovableMan containers that the main thread may be mutating at the same time.
+	/// </summary>
+	class ThreadMan : public Singleton<ThreadMan> {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a ThreadMan object in system memory. Initialize() should be called before using the object.
+		/// </summary>
+		ThreadMan() { Clear(); }
+
+		/// <summary>
+		/// Makes the ThreadMan object ready for use by spinning up the worker pool.
+		/// </summary>
+		/// <param name="workerCount">How many worker threads to create. 0 means one less than the number of hardware threads, with a minimum of one.</param>
+		/// <returns>An error return value signaling success or any particular failure. Anything below 0 is an error signal.</returns>
+		int Initialize(int workerCount = 0);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a ThreadMan object before deletion from system memory.
+		/// </summary>
+		~ThreadMan() { Destroy(); }
+
+		/// <summary>
+		/// Waits for all queued jobs to finish, joins the worker threads and resets (through Clear()) the ThreadMan object.
+		/// </summary>
+		void Destroy();
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets the number of worker threads in the pool.
+		/// </summary>
+		/// <returns>The number of worker threads in the pool. 0 if the pool isn't running and jobs will be executed inline.</returns>
+		int GetWorkerCount() const { return static_cast<int>(m_Workers.size()); }
+
+		/// <summary>
+		/// Gets the number of jobs that are queued and haven't been picked up by a worker yet.
+		/// </summary>
+		/// <returns>The number of pending jobs.</returns>
+		int GetPendingJobCount();
+
+		/// <summary>
+		/// Gets whether the calling thread is one of the worker threads in the pool. Jobs running there must not wait on other queued jobs, since all the workers could end up waiting.
+		/// </summary>
+		/// <returns>Whether the calling thread is a worker thread.</returns>
+		static bool IsWorkerThread() { return s_IsWorkerThread; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Queues a job to be executed on one of the worker threads. If the pool isn't running, the job is executed immediately on the calling thread.
+		/// </summary>
+		/// <param name="job">The job to execute.</param>
+		/// <returns>A future that becomes ready once the job has finished executing.</returns>
+		std::future<void> QueueJob(std::function<void()> job);
+
+		/// <summary>
+		/// Splits the range [begin, end) into contiguous chunks, executes them across the worker pool and the calling thread, and waits until all of them have finished.
+		/// When called from a worker thread, all the chunks are executed on it instead, so it never waits on jobs queued behind the one it's running.
+		/// </summary>
+		/// <param name="begin">The first index of the range.</param>
+		/// <param name="end">One past the last index of the range.</param>
+		/// <param name="chunkJob">The job to execute for each chunk. Gets passed the first index of the chunk and one past its last index.</param>
+		/// <param name="minChunkSize">The smallest number of indices a single chunk should cover, so tiny ranges aren't split needlessly.</param>
+		void ParallelFor(int begin, int end, const std::function<void(int, int)> &chunkJob, int minChunkSize = 1);
+#pragma endregion
+
+	protected:
+
+		static thread_local bool s_IsWorkerThread; //!< Whether the thread this is read on is one of the worker threads in the pool.
+
+		std::vector<std::thread> m_Workers; //!< The worker threads in the pool.
+		std::queue<std::packaged_task<void()>> m_Jobs; //!< The jobs waiting to be picked up by a worker.
+		std::mutex m_JobsMutex; //!< Mutex guarding the job queue and the stopping flag.
+		std::condition_variable m_JobsCondition; //!< Condition the workers wait on for new jobs or for the pool to stop.
+		bool m_Stopping; //!< Whether the pool is shutting down and workers should exit once the queue is empty.
+
+	private:
+
+		/// <summary>
+		/// The loop each worker thread runs, picking up and executing jobs until the pool is stopped.
+		/// </summary>
+		/// <param name="workerIndex">The index of the worker in the pool, used to tell the workers apart in profiler traces.</param>
+		void WorkerThreadFunction(int workerIndex);
+
+		/// <summary>
+		/// Clears all the member variables of this ThreadMan, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		ThreadMan(const ThreadMan &reference) = delete;
+		ThreadMan & operator=(const ThreadMan &rhs) = delete;
+	};
+}
+#endif
@@ -31,6 +31,7 @@ namespace RTE {
 		// This gets dynamically turned on for short periods when sim gets heavy (explosions) and slow-mo effect is appropriate
 		m_OneSimUpdatePerFrame = false;
 		m_SimSpeedLimited = true;
+		m_SimFreeRunning = false;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,6 +150,9 @@ namespace RTE {
 
 		RTEAssert(m_SimAccumulator >= 0, "Negative sim time accumulator?!");
 
+		// Free running ignores real time entirely, so the sim goes as fast as it can be updated, one fixed step per frame.
+		if (m_SimFreeRunning && !m_SimPaused) { m_SimAccumulator = m_DeltaTime; }
+
 		// Reset the counter since the last drawn update. Set it negative since we're counting full pure sim updates and this will be incremented to 0 on next SimUpdate
 		if (m_DrawnSimUpdate) { m_SimUpdatesSinceDrawn = -1; }
 
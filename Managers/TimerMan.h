@@ -132,6 +132,18 @@ namespace RTE {
 		/// <param name="simLimited">Whether the sim speed should be limited to not exceed 1.0.</param>
 		void SetSimSpeedLimited(bool simLimited = true) { m_SimSpeedLimited = simLimited; }
 
+		/// <summary>
+		/// Shows whether the sim is free running, doing exactly one sim update per frame no matter how much real time passed. Used for replaying input recordings as fast as possible.
+		/// </summary>
+		/// <returns>Whether the sim is free running.</returns>
+		bool IsSimFreeRunning() const { return m_SimFreeRunning; }
+
+		/// <summary>
+		/// Sets whether the sim is free running, doing exactly one sim update per frame no matter how much real time passed. Used for replaying input recordings as fast as possible.
+		/// </summary>
+		/// <param name="freeRunning">Whether the sim should be free running.</param>
+		void SetSimFreeRunning(bool freeRunning = true) { m_SimFreeRunning = freeRunning; }
+
 		/// <summary>
 		/// Gets the number of ticks per second (the resolution of the timer).
 		/// </summary>
@@ -235,6 +247,7 @@ namespace RTE {
 		bool m_SimPaused; //!< Simulation paused; no real time ticks will go to the sim accumulator.
 		bool m_OneSimUpdatePerFrame; //!< Whether to force this to artificially make time for only one single sim update for the graphics frame. Useful for debugging or profiling.
 		bool m_SimSpeedLimited; //!< Whether the simulation is limited to going at 1.0x and not faster.
+		bool m_SimFreeRunning; //!< Whether the sim does exactly one sim update per frame, regardless of how much real time passed.
 
 	private:
 
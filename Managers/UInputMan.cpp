@@ -6,6 +6,7 @@
 #include "ConsoleMan.h"
 #include "PresetMan.h"
 #include "PerformanceMan.h"
+#include "Profiler.h"
 #include "GUIInput.h"
 #include "Icon.h"
 #include "GameActivity.h"
@@ -728,23 +729,30 @@ namespace RTE {
 	int UInputMan::Update() {
 		m_LastDeviceWhichControlledGUICursor = InputDevice::DEVICE_KEYB_ONLY;
 
-		if (keyboard_needs_poll()) { poll_keyboard(); }
-		if (mouse_needs_poll()) { poll_mouse(); }
-		poll_joystick();
+		// During playback the recorded input takes the place of the input devices, which aren't read at all so nothing the user does gets mixed in.
+		if (m_InputReplay.IsPlayingBack() && g_ActivityMan.IsInActivity()) {
+			m_InputReplay.PlayFrame(m_RawMouseMovement);
+		} else {
+			if (keyboard_needs_poll()) { poll_keyboard(); }
+			if (mouse_needs_poll()) { poll_mouse(); }
+			poll_joystick();
+
+			// Store mouse movement
+			int mickeyX;
+			int mickeyY;
+			get_mouse_mickeys(&mickeyX, &mickeyY);
+			m_RawMouseMovement.SetXY(mickeyX, mickeyY);
+
+			// TODO: Add sensitivity slider to settings menu
+			m_RawMouseMovement *= m_MouseSensitivity;
+
+			if (m_InputReplay.GetState() == InputReplay::ReplayState::Recording && g_ActivityMan.IsInActivity()) { m_InputReplay.RecordFrame(m_RawMouseMovement); }
+		}
 
 		for (char keyToCheck = KEY_A; keyToCheck < KEY_MAX; ++keyToCheck) {
 			s_ChangedKeyStates[keyToCheck] = key[keyToCheck] != s_PrevKeyStates[keyToCheck];
 		}
 
-		// Store mouse movement
-		int mickeyX;
-		int mickeyY;
-		get_mouse_mickeys(&mickeyX, &mickeyY);
-		m_RawMouseMovement.SetXY(mickeyX, mickeyY);
-
-		// TODO: Add sensitivity slider to settings menu
-		m_RawMouseMovement *= m_MouseSensitivity;
-
 		// NETWORK SERVER: Apply mouse input received from client or collect mouse input
 		if (IsInMultiplayerMode()) {
 			UpdateNetworkMouseMovement();
@@ -769,6 +777,10 @@ namespace RTE {
 			return;
 		}
 
+		// Nothing that happens during playback was done by the user, so none of it should pause, restart or otherwise meddle with the Activity.
+		if (m_InputReplay.IsPlayingBack()) {
+			return;
+		}
 		if (g_ActivityMan.IsInActivity()) {
 			const GameActivity *gameActivity = dynamic_cast<GameActivity *>(g_ActivityMan.GetActivity());
 			// Don't allow pausing and returning to main menu when running in server mode to not disrupt the simulation for the clients
@@ -802,6 +814,13 @@ namespace RTE {
 			// Ctrl+O to toggle one sim update per frame
 			} else if (KeyPressed(KEY_O)) {
 				g_TimerMan.SetOneSimUpdatePerFrame(!g_TimerMan.IsOneSimUpdatePerFrame());
+			// Ctrl+T to start or stop capturing a profiler trace
+			} else if (KeyPressed(KEY_T)) {
+				if (Profiler::IsCapturing()) {
+					Profiler::StopCapture();
+				} else {
+					Profiler::StartCapture("ProfilerTrace.json");
+				}
 			}
 		} else if (!FlagCtrlState() && FlagAltState()) {
 			// Alt+Enter to switch resolution multiplier
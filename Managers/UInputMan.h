@@ -4,6 +4,7 @@
 #include "Singleton.h"
 #include "Vector.h"
 #include "InputScheme.h"
+#include "InputReplay.h"
 
 #define g_UInputMan UInputMan::Instance()
 
@@ -47,7 +48,7 @@ namespace RTE {
 		/// <summary>
 		/// Destroys and resets (through Clear()) the UInputMan object.
 		/// </summary>
-		void Destroy() { Clear(); }
+		void Destroy() { m_InputReplay.Destroy(); Clear(); }
 #pragma endregion
 
 #pragma region Concrete Methods
@@ -67,6 +68,12 @@ namespace RTE {
 		/// </summary>
 		/// <returns>An error return value signaling success or any particular failure. Anything below 0 is an error signal.</returns>
 		int Update();
+
+		/// <summary>
+		/// Gets the InputReplay that records and plays back the input of Activities.
+		/// </summary>
+		/// <returns>A reference to the InputReplay of this UInputMan.</returns>
+		InputReplay & GetInputReplay() { return m_InputReplay; }
 #pragma endregion
 
 #pragma region Control Scheme and Input Mapping Handling
@@ -637,6 +644,8 @@ namespace RTE {
 		std::array<InputScheme, Players::MaxPlayerCount> m_ControlScheme; //!< Which control scheme is being used by each player.
 		const Icon *m_DeviceIcons[InputDevice::DEVICE_COUNT]; //!< The Icons representing all different devices.
 
+		InputReplay m_InputReplay; //!< Records the input of an Activity, or plays back a recording in place of the input devices.
+
 		Vector m_RawMouseMovement; //!< The raw absolute movement of the mouse between the last two Updates.
 		Vector m_AnalogMouseData; //!< The emulated analog stick position of the mouse.
 		float m_MouseSensitivity; //!< Mouse sensitivity, to replace hardcoded 0.6 value in Update.
@@ -2953,13 +2953,13 @@ void MetagameGUI::CompletedActivity()
             pAlteredScene->RetrieveActorsAndDevices(winningTeam, autoResolved);
             // Save out the altered scene before clearing out its data from memory
             pAlteredScene->SaveData(METASAVEPATH + string(AUTOSAVENAME) + " - " + pAlteredScene->GetPresetName());
+            // Null the current scene, which is pointed to by pAlteredScene. Done before its data is cleared so nothing is still reading its terrain.
+            g_SceneMan.ClearCurrentScene();
             // Clear the bitmap data etc of the altered scene, we don't need to copy that over
             pAlteredScene->ClearData();
             // Deep copy over all the edits made to the newly played Scene
             m_pPlayingScene->Destroy();
             m_pPlayingScene->Create(*pAlteredScene);
-            // Null the current scene, which is pointed to by pAlteredScene.
-            g_SceneMan.ClearCurrentScene();
             // Scrub the module ID so the migration goes well.. this is a bit hacky, but ok in this special case
             m_pPlayingScene->SetModuleID(-1);
             m_pPlayingScene->GetTerrain()->SetModuleID(-1);
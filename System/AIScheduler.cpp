@@ -0,0 +1,138 @@
+#include "AIScheduler.h"
+#include "ActivityMan.h"
+#include "MovableMan.h"
+#include "FrameMan.h"
+#include "SceneMan.h"
+#include "Actor.h"
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void AIScheduler::Clear() {
+		m_LevelOfDetailEnabled = true;
+		m_TimeBudget = 5.0F;
+		m_ActorSchedules.clear();
+		m_SimUpdateNumber = 0;
+		m_BudgetOverrun = 0;
+		m_UpdateTime = 0;
+		m_LastUpdateTime = 0;
+		m_Stats.fill(0);
+		m_LastStats.fill(0);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void AIScheduler::ScheduleAIUpdates(const std::vector<Actor *> &actors, const std::list<AlarmEvent> &alarmEvents, unsigned int simUpdateNumber) {
+		const long long timeBudget = static_cast<long long>(m_TimeBudget * 1000.0F);
+		m_BudgetOverrun = (timeBudget > 0) ? std::max(m_UpdateTime - timeBudget, 0LL) : 0;
+		m_LastUpdateTime = m_UpdateTime;
+		m_LastStats = m_Stats;
+		m_UpdateTime = 0;
+		m_Stats.fill(0);
+		m_SimUpdateNumber = simUpdateNumber;
+
+		std::vector<Vector> viewCenters;
+		if (const Activity *activity = g_ActivityMan.GetActivity()) {
+			for (int player = Players::PlayerOne; player < Players::MaxPlayerCount; ++player) {
+				int screen = activity->ScreenOfPlayer(player);
+				if (activity->PlayerActive(player) && activity->PlayerHuman(player) && screen >= 0) { viewCenters.emplace_back(g_SceneMan.GetScrollTarget(screen)); }
+			}
+		}
+
+		// Rebuilding the schedules from the current Actors drops the ones of Actors that are gone or no longer AI controlled.
+		std::unordered_map<unsigned long, ActorSchedule> actorSchedules;
+		actorSchedules.reserve(m_ActorSchedules.size());
+		std::vector<std::pair<ActorSchedule *, unsigned int>> candidateSchedules;
+		long long budgetLeft = timeBudget - m_BudgetOverrun;
+
+		for (Actor *actor : actors) {
+			if (actor->GetController()->GetInputMode() != Controller::CIM_AI) {
+				continue;
+			}
+			const unsigned long actorID = actor->GetUniqueID();
+			std::unordered_map<unsigned long, ActorSchedule>::const_iterator previousSchedule = m_ActorSchedules.find(actorID);
+			ActorSchedule &schedule = actorSchedules.try_emplace(actorID, (previousSchedule != m_ActorSchedules.end()) ? previousSchedule->second : ActorSchedule()).first->second;
+
+			if (!m_LevelOfDetailEnabled) {
+				schedule.UpdateInterval = 1;
+			} else {
+				for (const AlarmEvent &alarmEvent : alarmEvents) {
+					if (g_SceneMan.ShortestDistance(actor->GetPos(), alarmEvent.m_ScenePos).GetMagnitude() < alarmEvent.m_Range) {
+						schedule.LastAlarm = simUpdateNumber;
+						schedule.EverAlarmed = true;
+						break;
+					}
+				}
+				bool inCombat = schedule.EverAlarmed && simUpdateNumber - schedule.LastAlarm < c_CombatDuration;
+				schedule.UpdateInterval = inCombat ? 1 : GetViewDistanceUpdateInterval(*actor, viewCenters);
+			}
+
+			const unsigned int updatesSinceLast = simUpdateNumber - schedule.LastUpdate;
+			if (!schedule.EverUpdated || schedule.UpdateInterval == 1) {
+				// Actors that matter right now always update, but still use up the budget the others have to fit into.
+				schedule.UpdateDue = true;
+				budgetLeft -= static_cast<long long>(schedule.EstimatedUpdateTime);
+			} else if (updatesSinceLast >= static_cast<unsigned int>(schedule.UpdateInterval) && (schedule.Deferred || (simUpdateNumber + actorID) % schedule.UpdateInterval == 0)) {
+				candidateSchedules.emplace_back(&schedule, updatesSinceLast - schedule.UpdateInterval);
+			} else {
+				schedule.UpdateDue = false;
+				m_Stats.at(AIUpdatesSkipped)++;
+			}
+		}
+
+		// The most overdue Actors get the budget first, so deferred updates are carried over instead of starved. Actors that are overdue by a whole interval update no matter what.
+		std::stable_sort(candidateSchedules.begin(), candidateSchedules.end(), [](const std::pair<ActorSchedule *, unsigned int> &lhs, const std::pair<ActorSchedule *, unsigned int> &rhs) { return lhs.second > rhs.second; });
+		for (const auto &[schedule, updatesOverdue] : candidateSchedules) {
+			schedule->UpdateDue = timeBudget <= 0 || budgetLeft > 0 || updatesOverdue >= static_cast<unsigned int>(schedule->UpdateInterval);
+			schedule->Deferred = !schedule->UpdateDue;
+			if (schedule->UpdateDue) {
+				budgetLeft -= static_cast<long long>(schedule->EstimatedUpdateTime);
+			} else {
+				m_Stats.at(AIUpdatesDeferred)++;
+			}
+		}
+		m_ActorSchedules = std::move(actorSchedules);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool AIScheduler::IsAIUpdateDue(const Actor &actor) const {
+		std::unordered_map<unsigned long, ActorSchedule>::const_iterator schedule = m_ActorSchedules.find(actor.GetUniqueID());
+		return schedule == m_ActorSchedules.end() || schedule->second.UpdateDue;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void AIScheduler::RecordAIUpdate(const Actor &actor, long long updateTime) {
+		m_UpdateTime += updateTime;
+		m_Stats.at(AIUpdatesRun)++;
+
+		std::unordered_map<unsigned long, ActorSchedule>::iterator schedule = m_ActorSchedules.find(actor.GetUniqueID());
+		if (schedule != m_ActorSchedules.end()) {
+			ActorSchedule &actorSchedule = schedule->second;
+			actorSchedule.EstimatedUpdateTime = actorSchedule.EverUpdated ? actorSchedule.EstimatedUpdateTime + (static_cast<float>(updateTime) - actorSchedule.EstimatedUpdateTime) * c_UpdateTimeSmoothing : static_cast<float>(updateTime);
+			actorSchedule.LastUpdate = m_SimUpdateNumber;
+			actorSchedule.EverUpdated = true;
+			actorSchedule.Deferred = false;
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int AIScheduler::GetViewDistanceUpdateInterval(const Actor &actor, const std::vector<Vector> &viewCenters) const {
+		// With nobody watching there's no telling what matters, so everything keeps updating at full rate.
+		if (viewCenters.empty()) {
+			return 1;
+		}
+		float closestViewDistance = std::numeric_limits<float>::max();
+		for (const Vector &viewCenter : viewCenters) {
+			closestViewDistance = std::min(closestViewDistance, g_SceneMan.ShortestDistance(viewCenter, actor.GetPos()).GetMagnitude());
+		}
+		const float playerScreenWidth = static_cast<float>(g_FrameMan.GetPlayerScreenWidth());
+		if (closestViewDistance < playerScreenWidth * c_NearViewDistance) {
+			return 1;
+		}
+		return (closestViewDistance < playerScreenWidth * c_FarViewDistance) ? 2 : c_MaxUpdateInterval;
+	}
+}
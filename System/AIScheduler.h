@@ -0,0 +1,154 @@
+#ifndef _RTEAISCHEDULER_
+#define _RTEAISCHEDULER_
+
+#include "Vector.h"
+
+namespace RTE {
+
+	class Actor;
+	struct AlarmEvent;
+
+	/// <summary>
+	/// Decides which AI controlled Actors get to update their AI on each sim update.
+	/// Actors in combat or in or near a human player's view update every sim update, the rest every few sim updates, staggered so they don't all update on the same one.
+	/// On top of that, the AI updates that are due are limited to a time budget per sim update. Whatever doesn't fit is deferred to the next one, where it goes first.
+	/// Actors that skip an AI update keep acting on the controls their AI last set.
+	/// </summary>
+	class AIScheduler {
+
+	public:
+
+		/// <summary>
+		/// Enumeration for the different things the scheduler keeps count of.
+		/// </summary>
+		enum AIUpdateStat { AIUpdatesRun, AIUpdatesSkipped, AIUpdatesDeferred, AIUpdateStatCount };
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate an AIScheduler object in system memory.
+		/// </summary>
+		AIScheduler() { Clear(); }
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Forgets the schedule of all Actors, without touching the settings.
+		/// </summary>
+		void Reset() { m_ActorSchedules.clear(); m_BudgetOverrun = 0; }
+#pragma endregion
+
+#pragma region Getters and Setters
+		/// <summary>
+		/// Gets whether Actors far from the action update their AI less often.
+		/// </summary>
+		/// <returns>Whether AI level of detail is enabled.</returns>
+		bool IsLevelOfDetailEnabled() const { return m_LevelOfDetailEnabled; }
+
+		/// <summary>
+		/// Sets whether Actors far from the action update their AI less often.
+		/// </summary>
+		/// <param name="enable">Whether AI level of detail is enabled.</param>
+		void SetLevelOfDetailEnabled(bool enable) { m_LevelOfDetailEnabled = enable; }
+
+		/// <summary>
+		/// Gets how much time all AI updates can take up on each sim update. Actors in combat or in view always update, so it's the others that get deferred when the budget runs out.
+		/// </summary>
+		/// <returns>The time budget in milliseconds. 0 means there is no budget.</returns>
+		float GetTimeBudget() const { return m_TimeBudget; }
+
+		/// <summary>
+		/// Sets how much time all AI updates can take up on each sim update. Actors in combat or in view always update, so it's the others that get deferred when the budget runs out.
+		/// </summary>
+		/// <param name="newTimeBudget">The new time budget in milliseconds. 0 means there is no budget.</param>
+		void SetTimeBudget(float newTimeBudget) { m_TimeBudget = std::max(newTimeBudget, 0.0F); }
+
+		/// <summary>
+		/// Gets one of the counts of the last sim update.
+		/// </summary>
+		/// <param name="stat">The count to get. See AIUpdateStat enumeration.</param>
+		/// <returns>The count of the last sim update.</returns>
+		int GetStat(AIUpdateStat stat) const { return m_LastStats.at(stat); }
+
+		/// <summary>
+		/// Gets how long all the AI updates of the last sim update took.
+		/// </summary>
+		/// <returns>The time the AI updates took, in milliseconds.</returns>
+		float GetLastUpdateTime() const { return static_cast<float>(m_LastUpdateTime) / 1000.0F; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Decides which AI controlled Actors update their AI on this sim update. Should be done once every sim update, before the Actors are updated.
+		/// </summary>
+		/// <param name="actors">All the Actors in the simulation.</param>
+		/// <param name="alarmEvents">The AlarmEvents of the last sim update.</param>
+		/// <param name="simUpdateNumber">The number of the sim update that is about to be done.</param>
+		void ScheduleAIUpdates(const std::vector<Actor *> &actors, const std::list<AlarmEvent> &alarmEvents, unsigned int simUpdateNumber);
+
+		/// <summary>
+		/// Tells whether an Actor should update its AI on this sim update. Actors that weren't scheduled always should.
+		/// </summary>
+		/// <param name="actor">The Actor to check.</param>
+		/// <returns>Whether the Actor should update its AI.</returns>
+		bool IsAIUpdateDue(const Actor &actor) const;
+
+		/// <summary>
+		/// Records that an Actor updated its AI and how long that took, so the time of its next AI updates can be estimated.
+		/// </summary>
+		/// <param name="actor">The Actor that updated its AI.</param>
+		/// <param name="updateTime">How long the AI update took, in microseconds.</param>
+		void RecordAIUpdate(const Actor &actor, long long updateTime);
+#pragma endregion
+
+	private:
+
+		static constexpr int c_MaxUpdateInterval = 4; //!< The number of sim updates between the AI updates of Actors that are far from every human player's view.
+		static constexpr float c_NearViewDistance = 1.0F; //!< The distance in player screen widths from the center of a human player's view within which Actors update their AI every sim update.
+		static constexpr float c_FarViewDistance = 2.0F; //!< The distance in player screen widths from the center of a human player's view beyond which Actors update their AI every c_MaxUpdateInterval sim updates. Actors in between update every other one.
+		static constexpr unsigned int c_CombatDuration = 120; //!< The number of sim updates an Actor is considered in combat for after an AlarmEvent reached it.
+		static constexpr float c_UpdateTimeSmoothing = 0.25F; //!< How much each new measurement of an Actor's AI update time counts towards its estimate.
+
+		/// <summary>
+		/// The scheduling state of a single Actor.
+		/// </summary>
+		struct ActorSchedule {
+			unsigned int LastUpdate = 0; //!< The number of the sim update the Actor last updated its AI on.
+			unsigned int LastAlarm = 0; //!< The number of the sim update an AlarmEvent last reached the Actor on.
+			bool EverUpdated = false; //!< Whether the Actor has updated its AI since it was first scheduled.
+			bool EverAlarmed = false; //!< Whether an AlarmEvent has reached the Actor since it was first scheduled.
+			int UpdateInterval = 1; //!< The number of sim updates between the Actor's AI updates, based on its distance to the human players' views and whether it's in combat.
+			float EstimatedUpdateTime = 0; //!< The estimated time an AI update of the Actor takes, in microseconds.
+			bool UpdateDue = true; //!< Whether the Actor should update its AI on this sim update.
+			bool Deferred = false; //!< Whether the Actor's last due AI update didn't fit into the time budget, so it should catch up as soon as possible instead of waiting for its staggered turn.
+		};
+
+		bool m_LevelOfDetailEnabled; //!< Whether Actors far from the action update their AI less often.
+		float m_TimeBudget; //!< How many milliseconds all AI updates can take up on each sim update. 0 means there is no budget.
+
+		std::unordered_map<unsigned long, ActorSchedule> m_ActorSchedules; //!< The scheduling state of each AI controlled Actor, by unique ID.
+		unsigned int m_SimUpdateNumber; //!< The number of the sim update that is being scheduled.
+		long long m_BudgetOverrun; //!< How many microseconds the AI updates of the last sim update went over its budget by, which is taken off the budget of the next one.
+		long long m_UpdateTime; //!< How long the AI updates of this sim update took so far, in microseconds.
+		long long m_LastUpdateTime; //!< How long the AI updates of the last sim update took, in microseconds.
+		std::array<int, AIUpdateStatCount> m_Stats; //!< The counts of this sim update so far.
+		std::array<int, AIUpdateStatCount> m_LastStats; //!< The counts of the last sim update.
+
+		/// <summary>
+		/// Gets the number of sim updates between the AI updates of an Actor, based on its distance to the human players' views.
+		/// </summary>
+		/// <param name="actor">The Actor to get the update interval for.</param>
+		/// <param name="viewCenters">The centers of the human players' views.</param>
+		/// <returns>The number of sim updates between the AI updates of the Actor.</returns>
+		int GetViewDistanceUpdateInterval(const Actor &actor, const std::vector<Vector> &viewCenters) const;
+
+		/// <summary>
+		/// Clears all the member variables of this AIScheduler, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		AIScheduler(const AIScheduler &reference) = delete;
+		AIScheduler & operator=(const AIScheduler &rhs) = delete;
+	};
+}
+#endif
@@ -4,6 +4,7 @@
 #include "MOSRotating.h"
 #include "PresetMan.h"
 #include "Actor.h"
+#include "SceneSampler.h"
 
 namespace RTE {
 
@@ -252,7 +253,7 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	bool Atom::MOHitResponse() {
+	bool Atom::MOHitResponse(const SceneSamplerBase &sceneSampler) {
 		RTEAssert(m_OwnerMO, "Stepping an Atom without a parent MO!");
 
 		if (m_OwnerMO->m_HitsMOs && m_MOIDHit != g_NoMOID /*&& IsIgnoringMOID(m_MOIDHit)*/) {
@@ -263,14 +264,14 @@ namespace RTE {
 			bool validHit = true;
 
 			// Check for the collision point in the dominant direction of travel.
-			if (m_Delta[m_Dom] && ((m_Dom == X && g_SceneMan.GetMOIDPixel(m_HitPos[X], m_IntPos[Y]) != g_NoMOID) || (m_Dom == Y && g_SceneMan.GetMOIDPixel(m_IntPos[X], m_HitPos[Y]) != g_NoMOID))) {
+			if (m_Delta[m_Dom] && ((m_Dom == X && sceneSampler.GetMOIDPixel(m_HitPos[X], m_IntPos[Y]) != g_NoMOID) || (m_Dom == Y && sceneSampler.GetMOIDPixel(m_IntPos[X], m_HitPos[Y]) != g_NoMOID))) {
 				hit[m_Dom] = true;
 				m_LastHit.HitPoint = (m_Dom == X) ? Vector(m_HitPos[X], m_IntPos[Y]) : Vector(m_IntPos[X], m_HitPos[Y]);
 				m_LastHit.BitmapNormal[m_Dom] = -m_Increment[m_Dom];
 			}
 
 			// Check for the collision point in the submissive direction of travel.
-			if (m_SubStepped && m_Delta[m_Sub] && ((m_Sub == X && g_SceneMan.GetMOIDPixel(m_HitPos[X], m_IntPos[Y]) != g_NoMOID) || (m_Sub == Y && g_SceneMan.GetMOIDPixel(m_IntPos[X], m_HitPos[Y]) != g_NoMOID))) {
+			if (m_SubStepped && m_Delta[m_Sub] && ((m_Sub == X && sceneSampler.GetMOIDPixel(m_HitPos[X], m_IntPos[Y]) != g_NoMOID) || (m_Sub == Y && sceneSampler.GetMOIDPixel(m_IntPos[X], m_HitPos[Y]) != g_NoMOID))) {
 				hit[m_Sub] = true;
 				if (m_LastHit.HitPoint.IsZero()) {
 					m_LastHit.HitPoint = (m_Sub == X) ? Vector(m_HitPos[X], m_IntPos[Y]) : Vector(m_IntPos[X], m_HitPos[Y]);
@@ -320,11 +321,11 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	HitData & Atom::TerrHitResponse() {
+	HitData & Atom::TerrHitResponse(const SceneSamplerBase &sceneSampler) {
 		RTEAssert(m_OwnerMO, "Stepping an Atom without a parent MO!");
 
 		if (m_TerrainMatHit) {
-			MID hitMaterialID = g_SceneMan.GetTerrMatter(m_HitPos[X], m_HitPos[Y]);
+			MID hitMaterialID = sceneSampler.GetTerrMatter(m_HitPos[X], m_HitPos[Y]);
 			MID domMaterialID = g_MaterialAir;
 			MID subMaterialID = g_MaterialAir;
 			m_LastHit.HitMaterial[HITOR] = m_Material;
@@ -337,9 +338,9 @@ namespace RTE {
 			Vector hitAcc = m_LastHit.HitVel[HITOR];
 
 			// Check for and react upon a collision in the dominant direction of travel.
-			if (m_Delta[m_Dom] && ((m_Dom == X && g_SceneMan.GetTerrMatter(m_HitPos[X], m_IntPos[Y])) || (m_Dom == Y && g_SceneMan.GetTerrMatter(m_IntPos[X], m_HitPos[Y])))) {
+			if (m_Delta[m_Dom] && ((m_Dom == X && sceneSampler.GetTerrMatter(m_HitPos[X], m_IntPos[Y])) || (m_Dom == Y && sceneSampler.GetTerrMatter(m_IntPos[X], m_HitPos[Y])))) {
 				hit[m_Dom] = true;
-				domMaterialID = (m_Dom == X) ? g_SceneMan.GetTerrMatter(m_HitPos[X], m_IntPos[Y]) : g_SceneMan.GetTerrMatter(m_IntPos[X], m_HitPos[Y]);
+				domMaterialID = (m_Dom == X) ? sceneSampler.GetTerrMatter(m_HitPos[X], m_IntPos[Y]) : sceneSampler.GetTerrMatter(m_IntPos[X], m_HitPos[Y]);
 				domMaterial = g_SceneMan.GetMaterialFromID(domMaterialID);
 
 				// Edit the normal accordingly.
@@ -349,9 +350,9 @@ namespace RTE {
 			}
 
 			// Check for and react upon a collision in the submissive direction of travel.
-			if (m_SubStepped && m_Delta[m_Sub] && ((m_Sub == X && g_SceneMan.GetTerrMatter(m_HitPos[X], m_IntPos[Y])) || (m_Sub == Y && g_SceneMan.GetTerrMatter(m_IntPos[X], m_HitPos[Y])))) {
+			if (m_SubStepped && m_Delta[m_Sub] && ((m_Sub == X && sceneSampler.GetTerrMatter(m_HitPos[X], m_IntPos[Y])) || (m_Sub == Y && sceneSampler.GetTerrMatter(m_IntPos[X], m_HitPos[Y])))) {
 				hit[m_Sub] = true;
-				subMaterialID = (m_Sub == X) ? g_SceneMan.GetTerrMatter(m_HitPos[X], m_IntPos[Y]) : g_SceneMan.GetTerrMatter(m_IntPos[X], m_HitPos[Y]);
+				subMaterialID = (m_Sub == X) ? sceneSampler.GetTerrMatter(m_HitPos[X], m_IntPos[Y]) : sceneSampler.GetTerrMatter(m_IntPos[X], m_HitPos[Y]);
 				subMaterial = g_SceneMan.GetMaterialFromID(subMaterialID);
 
 				// Edit the normal accordingly.
@@ -396,7 +397,7 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	bool Atom::SetupPos(Vector startPos) {
+	bool Atom::SetupPos(Vector startPos, const SceneSamplerBase &sceneSampler) {
 		RTEAssert(m_OwnerMO, "Stepping an Atom without a parent MO!");
 
 		// Only save the previous positions if they are in the scene
@@ -410,7 +411,7 @@ namespace RTE {
 			m_IntPos[Y] = m_PrevIntPos[Y] = std::floor(startPos.m_Y);
 		}
 
-		if ((m_TerrainMatHit = g_SceneMan.GetTerrMatter(m_IntPos[X], m_IntPos[Y])) != g_MaterialAir) {
+		if ((m_TerrainMatHit = sceneSampler.GetTerrMatter(m_IntPos[X], m_IntPos[Y])) != g_MaterialAir) {
 			m_OwnerMO->SetHitWhatTerrMaterial(m_TerrainMatHit);
 			if (m_OwnerMO->IntersectionWarning()) { m_TerrainHitsDisabled = true; }
 		} else {
@@ -483,7 +484,7 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	bool Atom::StepForward(int numSteps) {
+	bool Atom::StepForward(const SceneSamplerBase &sceneSampler, int numSteps) {
 		RTEAssert(m_OwnerMO, "Stepping an Atom without a parent MO!");
 
 		// Only take the step if the step ratio permits it
@@ -512,10 +513,10 @@ namespace RTE {
 				//}
 
 	// Scene wrapping, if necessary
-				g_SceneMan.WrapPosition(m_IntPos[X], m_IntPos[Y]);
+				sceneSampler.WrapPosition(m_IntPos[X], m_IntPos[Y]);
 
 				// Detect terrain hits, if not disabled.
-				if (g_MaterialAir != (m_TerrainMatHit = g_SceneMan.GetTerrMatter(m_IntPos[X], m_IntPos[Y]))) {
+				if (g_MaterialAir != (m_TerrainMatHit = sceneSampler.GetTerrMatter(m_IntPos[X], m_IntPos[Y]))) {
 					// Check if we're temporarily disabled from hitting terrain
 					if (!m_TerrainHitsDisabled) {
 						m_OwnerMO->SetHitWhatTerrMaterial(m_TerrainMatHit);
@@ -532,7 +533,7 @@ namespace RTE {
 
 				// Detect hits with non-ignored MO's, if enabled.
 				if (m_OwnerMO->m_HitsMOs) {
-					m_MOIDHit = g_SceneMan.GetMOIDPixel(m_IntPos[X], m_IntPos[Y]);
+					m_MOIDHit = sceneSampler.GetMOIDPixel(m_IntPos[X], m_IntPos[Y]);
 					if (IsIgnoringMOID(m_MOIDHit)) { m_MOIDHit = g_NoMOID; }
 
 					if (m_MOIDHit != g_NoMOID) {
@@ -646,6 +647,8 @@ namespace RTE {
 
 		// Lock all bitmaps involved outside the loop.
 		if (!scenePreLocked) { g_SceneMan.LockScene(); }
+		// One sampler for the whole travel, so the pixel samples of each step don't each go through SceneMan, the Scene and its layers.
+		const SceneSamplerBase sceneSampler;
 
 		// Loop for all the different straight segments (between bounces etc) that have to be traveled during the timeLeft.
 		do {
@@ -716,7 +719,7 @@ namespace RTE {
 			// Bresenham's line drawing algorithm execution
 			for (domSteps = 0; domSteps < delta[dom] && !(hit[X] || hit[Y]); ++domSteps) {
 				// Check for the special case if the Atom is starting out embedded in terrain. This can happen if something large gets copied to the terrain and embeds some Atoms.
-				if (domSteps == 0 && g_SceneMan.GetTerrMatter(intPos[X], intPos[Y]) != g_MaterialAir) {
+				if (domSteps == 0 && sceneSampler.GetTerrMatter(intPos[X], intPos[Y]) != g_MaterialAir) {
 					++hitCount;
 					hit[X] = hit[Y] = true;
 					if (g_SceneMan.TryPenetrate(intPos[X], intPos[Y], velocity * mass * sharpness, velocity, retardation, 0.5F, m_NumPenetrations, removeOrphansRadius, removeOrphansMaxArea, removeOrphansRate)) {
@@ -742,13 +745,13 @@ namespace RTE {
 				}
 				error += delta2[sub];
 
-				g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
+				sceneSampler.WrapPosition(intPos[X], intPos[Y]);
 
 				///////////////////////////////////////////////////////////////////////////////////////////////////
 				// Atom-MO collision detection and response.
 
 				// Detect hits with non-ignored MO's, if enabled.
-				m_MOIDHit = g_SceneMan.GetMOIDPixel(intPos[X], intPos[Y]);
+				m_MOIDHit = sceneSampler.GetMOIDPixel(intPos[X], intPos[Y]);
 
 				if (m_OwnerMO->m_HitsMOs && m_MOIDHit != g_NoMOID && !IsIgnoringMOID(m_MOIDHit)) {
 					m_OwnerMO->SetHitWhatMOID(m_MOIDHit);
@@ -801,14 +804,14 @@ namespace RTE {
 					}
 
 					// Check for the collision point in the dominant direction of travel.
-					if (delta[dom] && ((dom == X && g_SceneMan.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (dom == Y && g_SceneMan.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
+					if (delta[dom] && ((dom == X && sceneSampler.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (dom == Y && sceneSampler.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
 						hit[dom] = true;
 						m_LastHit.HitPoint = (dom == X) ? Vector(hitPos[X], intPos[Y]) : Vector(intPos[X], hitPos[Y]);
 						m_LastHit.BitmapNormal[dom] = -increment[dom];
 					}
 
 					// Check for the collision point in the submissive direction of travel.
-					if (subStepped && delta[sub] && ((sub == X && g_SceneMan.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (sub == Y && g_SceneMan.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
+					if (subStepped && delta[sub] && ((sub == X && sceneSampler.GetMOIDPixel(hitPos[X], intPos[Y]) != g_NoMOID) || (sub == Y && sceneSampler.GetMOIDPixel(intPos[X], hitPos[Y]) != g_NoMOID))) {
 						hit[sub] = true;
 						if (m_LastHit.HitPoint.IsZero()) {
 							m_LastHit.HitPoint = (sub == X) ? Vector(hitPos[X], intPos[Y]) : Vector(intPos[X], hitPos[Y]);
@@ -848,7 +851,7 @@ namespace RTE {
 				// Atom-Terrain collision detection and response.
 
 				// If there was no MO collision detected, then check for terrain hits.
-				else if ((hitMaterialID = g_SceneMan.GetTerrMatter(intPos[X], intPos[Y])) && !m_OwnerMO->m_IgnoreTerrain) {
+				else if ((hitMaterialID = sceneSampler.GetTerrMatter(intPos[X], intPos[Y])) && !m_OwnerMO->m_IgnoreTerrain) {
 					if (hitMaterialID != g_MaterialAir) { m_OwnerMO->SetHitWhatTerrMaterial(hitMaterialID); }
 
 					hitMaterial = g_SceneMan.GetMaterialFromID(hitMaterialID);
@@ -879,7 +882,7 @@ namespace RTE {
 						if (subStepped) { intPos[sub] -= increment[sub]; }
 
 						// Undo scene wrapping, if necessary
-						g_SceneMan.WrapPosition(intPos[X], intPos[Y]);
+						sceneSampler.WrapPosition(intPos[X], intPos[Y]);
 
 						// TODO: improve sticky logic!
 						// Check if particle is sticky and should adhere to where it collided
@@ -893,9 +896,9 @@ namespace RTE {
 						}
 
 						// Check for and react upon a collision in the dominant direction of travel.
-						if (delta[dom] && ((dom == X && g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y])) || (dom == Y && g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y])))) {
+						if (delta[dom] && ((dom == X && sceneSampler.GetTerrMatter(hitPos[X], intPos[Y])) || (dom == Y && sceneSampler.GetTerrMatter(intPos[X], hitPos[Y])))) {
 							hit[dom] = true;
-							domMaterialID = (dom == X) ? g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y]) : g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y]);
+							domMaterialID = (dom == X) ? sceneSampler.GetTerrMatter(hitPos[X], intPos[Y]) : sceneSampler.GetTerrMatter(intPos[X], hitPos[Y]);
 							domMaterial = g_SceneMan.GetMaterialFromID(domMaterialID);
 
 							// Bounce according to the collision.
@@ -903,9 +906,9 @@ namespace RTE {
 						}
 
 						// Check for and react upon a collision in the submissive direction of travel.
-						if (subStepped && delta[sub] && ((sub == X && g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y])) || (sub == Y && g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y])))) {
+						if (subStepped && delta[sub] && ((sub == X && sceneSampler.GetTerrMatter(hitPos[X], intPos[Y])) || (sub == Y && sceneSampler.GetTerrMatter(intPos[X], hitPos[Y])))) {
 							hit[sub] = true;
-							subMaterialID = (sub == X) ? g_SceneMan.GetTerrMatter(hitPos[X], intPos[Y]) : g_SceneMan.GetTerrMatter(intPos[X], hitPos[Y]);
+							subMaterialID = (sub == X) ? sceneSampler.GetTerrMatter(hitPos[X], intPos[Y]) : sceneSampler.GetTerrMatter(intPos[X], hitPos[Y]);
 							subMaterial = g_SceneMan.GetMaterialFromID(subMaterialID);
 
 							// Bounce according to the collision.
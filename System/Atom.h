@@ -9,6 +9,7 @@ namespace RTE {
 
 	class SLTerrain;
 	class MovableObject;
+	class SceneSamplerBase;
 
 	enum { HITOR = 0, HITEE = 1 };
 
@@ -336,8 +337,9 @@ namespace RTE {
 		/// The hit response is calculated and appropriate forces are applied to the hit MO and the impulse force imposed on the owner MO are returned, and also stored in this Atom to be later retrieved with GetHitImpulse().
 		/// </summary>
 		/// <remarks>Collision data should already be set by SetHitData().</remarks>
+		/// <param name="sceneSampler">The sampler of the current Scene's layers to find the collision point with, kept by the caller for its whole travel.</param>
 		/// <returns>Whether this collision is valid and should be considered further.</returns>
-		bool MOHitResponse();
+		bool MOHitResponse(const SceneSamplerBase &sceneSampler);
 
 		/// <summary>
 		/// Returns the terrain material the previously taken step by TakeStep hit, if any.
@@ -351,8 +353,9 @@ namespace RTE {
 		/// The resulting impulse vector is also stored in this Atom to be later retrieved with GetHitImpulse().
 		/// </summary>
 		/// <remarks>Collision data should already be set by SetHitData().</remarks>
+		/// <param name="sceneSampler">The sampler of the current Scene's layers to find the collision point with, kept by the caller for its whole travel.</param>
 		/// <returns>The resulting HitData of this Atom with all the information about the collision filled out.</returns>
-		HitData & TerrHitResponse();
+		HitData & TerrHitResponse(const SceneSamplerBase &sceneSampler);
 #pragma endregion
 
 #pragma region Travel
@@ -361,8 +364,9 @@ namespace RTE {
 		/// It will report whether the atom's position is inside the terrain or another MO. It also disables this' terrain and/or MO collisions when traveling, until the travel encounters an air/noMO pixel again.
 		/// </summary>
 		/// <param name="startPos">A Vector with the position to start from, in scene coordinates.</param>
+		/// <param name="sceneSampler">The sampler of the current Scene's layers to check the start position with.</param>
 		/// <returns>If the start pos is already intersecting the terrain or an MO, then this will return true. Do collision response as needed.</returns>
-		bool SetupPos(Vector startPos);
+		bool SetupPos(Vector startPos, const SceneSamplerBase &sceneSampler);
 
 		/// <summary>
 		/// Gets the absolute current position of this Atom, in scene coordinates. This includes the rotated offset, and any steps that may have been taken on a segment.
@@ -395,12 +399,13 @@ namespace RTE {
 		/// <summary>
 		/// Takes one step along the trajectory segment set up by SetupSeg(). The Scene MUST BE LOCKED before calling this!
 		/// </summary>
+		/// <param name="sceneSampler">The sampler of the current Scene's layers to step through, kept by the caller for its whole travel.</param>
 		/// <param name="numSteps">The number of steps to take.</param>
 		/// <returns>
 		/// Whether anything was hit during the steps or not. MO hits will only be reported if this Atom is set to hit them, and the MO hit is not ignored by this Atom (if the segment started on that MO).
 		/// Also if terrain hits are temporarily disabled, they will not be reported.
 		/// </returns>
-		bool StepForward(int numSteps = 1);
+		bool StepForward(const SceneSamplerBase &sceneSampler, int numSteps = 1);
 
 		/// <summary>
 		/// Takes one step back, or undos the step, if any, previously taken along the trajectory segment set up by SetupSeg().
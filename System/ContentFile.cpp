@@ -2,6 +2,8 @@
 #include "AudioMan.h"
 #include "PresetMan.h"
 #include "ConsoleMan.h"
+#include "SettingsMan.h"
+#include "ThreadMan.h"
 
 #include "fmod/fmod.hpp"
 #include "fmod/fmod_errors.h"
@@ -13,6 +15,10 @@ namespace RTE {
 	std::array<std::unordered_map<std::string, BITMAP *>, ContentFile::BitDepths::BitDepthCount> ContentFile::s_LoadedBitmaps;
 	std::unordered_map<std::string, FMOD::Sound *> ContentFile::s_LoadedSamples;
 	std::unordered_map<size_t, std::string> ContentFile::s_PathHashes;
+	std::array<std::unordered_map<std::string, std::unique_ptr<ContentFile::PrefetchedBitmap>>, ContentFile::BitDepths::BitDepthCount> ContentFile::s_PrefetchedBitmaps;
+	std::atomic<long long> ContentFile::s_PrefetchedBitmapsSize = 0;
+	std::deque<ContentFile::WaitingPrefetch> ContentFile::s_WaitingPrefetches;
+	std::shared_mutex ContentFile::s_BitmapLoadMutex;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,6 +54,8 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void ContentFile::FreeAllLoaded() {
+		DiscardPrefetches();
+
 		for (int depth = BitDepths::Eight; depth < BitDepths::BitDepthCount; ++depth) {
 			for (const auto &[bitmapPath, bitmapPtr] : s_LoadedBitmaps.at(depth)) {
 				destroy_bitmap(bitmapPtr);
@@ -115,6 +123,9 @@ namespace RTE {
 		std::unordered_map<std::string, BITMAP *>::iterator foundBitmap = s_LoadedBitmaps.at(bitDepth).find(dataPathToLoad);
 		if (foundBitmap != s_LoadedBitmaps.at(bitDepth).end()) {
 			returnBitmap = (*foundBitmap).second;
+		} else if (BITMAP *prefetchedBitmap = ClaimPrefetchedBitmap(conversionMode, dataPathToLoad)) {
+			returnBitmap = prefetchedBitmap;
+			if (storeBitmap) { s_LoadedBitmaps.at(bitDepth).try_emplace(dataPathToLoad, returnBitmap); }
 		} else {
 			if (!System::PathExistsCaseSensitive(dataPathToLoad)) {
 				const std::string dataPathWithoutExtension = dataPathToLoad.substr(0, dataPathToLoad.length() - m_DataPathExtension.length());
@@ -178,16 +189,185 @@ namespace RTE {
 
 		BITMAP *returnBitmap = nullptr;
 
+		std::unique_lock<std::shared_mutex> loadLock(s_BitmapLoadMutex);
+
 		PALETTE currentPalette;
 		get_palette(currentPalette);
 
+		int previousConversionMode = get_color_conversion();
 		set_color_conversion((conversionMode == 0) ? COLORCONV_MOST : conversionMode);
 		returnBitmap = load_bitmap(dataPathToLoad.c_str(), currentPalette);
+		set_color_conversion(previousConversionMode);
 		RTEAssert(returnBitmap, "Failed to load image file with following path and name:\n\n" + m_DataPathAndReaderPosition + "\nThe file may be corrupt, incorrectly converted or saved with unsupported parameters.");
 
 		return returnBitmap;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ContentFile::PrefetchBitmap(int conversionMode, const std::string &dataPathToSpecificFrame) {
+		const long long prefetchBudget = static_cast<long long>(g_SettingsMan.GetContentPrefetchBudget()) * 1024 * 1024;
+		if (m_DataPath.empty() || prefetchBudget <= 0) {
+			return false;
+		}
+		const int bitDepth = (conversionMode == COLORCONV_8_TO_32) ? BitDepths::ThirtyTwo : BitDepths::Eight;
+		const std::string dataPathToLoad = dataPathToSpecificFrame.empty() ? m_DataPath : dataPathToSpecificFrame;
+
+		if (s_LoadedBitmaps.at(bitDepth).find(dataPathToLoad) != s_LoadedBitmaps.at(bitDepth).end() || s_PrefetchedBitmaps.at(bitDepth).find(dataPathToLoad) != s_PrefetchedBitmaps.at(bitDepth).end()) {
+			return false;
+		}
+		// Only PNGs can be decoded from memory. Missing files are left for GetAsBitmap to look for alternatives or report.
+		if (std::filesystem::path(dataPathToLoad).extension() != ".png" || !System::PathExistsCaseSensitive(dataPathToLoad)) {
+			return false;
+		}
+		// Reserve the size of the file up front so jobs that are still in flight count against the budget too. The job corrects it once it knows what the prefetch actually takes up.
+		std::error_code fileSizeError;
+		const long long estimatedSize = static_cast<long long>(std::filesystem::file_size(dataPathToLoad, fileSizeError));
+		if (fileSizeError || estimatedSize > prefetchBudget) {
+			return false;
+		}
+		// Once the budget is full, later prefetches wait in line for picked up ones to make room instead of pushing out earlier ones, which are the ones needed next.
+		if (!s_WaitingPrefetches.empty() || s_PrefetchedBitmapsSize + estimatedSize > prefetchBudget) {
+			s_WaitingPrefetches.push_back({ dataPathToLoad, conversionMode, estimatedSize });
+		} else {
+			QueuePrefetch(conversionMode, dataPathToLoad, estimatedSize);
+		}
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::PrefetchAnimation(int frameCount, int conversionMode) {
+		if (m_DataPath.empty() || frameCount < 1) {
+			return;
+		}
+		if (frameCount == 1) {
+			PrefetchBitmap(conversionMode);
+		} else {
+			char framePath[1024];
+			for (int frameNum = 0; frameNum < frameCount; ++frameNum) {
+				std::snprintf(framePath, sizeof(framePath), "%s%03i%s", m_DataPathWithoutExtension.c_str(), frameNum, m_DataPathExtension.c_str());
+				PrefetchBitmap(conversionMode, framePath);
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::WaitForPrefetches() {
+		for (const std::unordered_map<std::string, std::unique_ptr<PrefetchedBitmap>> &prefetchedBitmaps : s_PrefetchedBitmaps) {
+			for (const auto &[bitmapPath, prefetchedBitmap] : prefetchedBitmaps) {
+				if (prefetchedBitmap->Job.valid()) { prefetchedBitmap->Job.wait(); }
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::DiscardPrefetches() {
+		WaitForPrefetches();
+		for (std::unordered_map<std::string, std::unique_ptr<PrefetchedBitmap>> &prefetchedBitmaps : s_PrefetchedBitmaps) {
+			for (const auto &[bitmapPath, prefetchedBitmap] : prefetchedBitmaps) {
+				if (prefetchedBitmap->Bitmap) { destroy_bitmap(prefetchedBitmap->Bitmap); }
+			}
+			prefetchedBitmaps.clear();
+		}
+		s_PrefetchedBitmapsSize = 0;
+		s_WaitingPrefetches.clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * ContentFile::ClaimPrefetchedBitmap(int conversionMode, const std::string &dataPathToLoad) {
+		std::unordered_map<std::string, std::unique_ptr<PrefetchedBitmap>> &prefetchedBitmaps = s_PrefetchedBitmaps.at((conversionMode == COLORCONV_8_TO_32) ? BitDepths::ThirtyTwo : BitDepths::Eight);
+		std::unordered_map<std::string, std::unique_ptr<PrefetchedBitmap>>::iterator foundPrefetch = prefetchedBitmaps.find(dataPathToLoad);
+		if (foundPrefetch == prefetchedBitmaps.end()) {
+			return nullptr;
+		}
+		std::unique_ptr<PrefetchedBitmap> prefetchedBitmap = std::move(foundPrefetch->second);
+		prefetchedBitmaps.erase(foundPrefetch);
+
+		prefetchedBitmap->Job.wait();
+		s_PrefetchedBitmapsSize -= prefetchedBitmap->Size;
+		QueueWaitingPrefetches();
+
+		if (prefetchedBitmap->ConversionMode != conversionMode) {
+			if (prefetchedBitmap->Bitmap) { destroy_bitmap(prefetchedBitmap->Bitmap); }
+			return nullptr;
+		}
+		if (!prefetchedBitmap->Bitmap && !prefetchedBitmap->FileData.empty()) {
+			std::unique_lock<std::shared_mutex> loadLock(s_BitmapLoadMutex);
+
+			PALETTE currentPalette;
+			get_palette(currentPalette);
+
+			int previousConversionMode = get_color_conversion();
+			set_color_conversion((conversionMode == 0) ? COLORCONV_MOST : conversionMode);
+			prefetchedBitmap->Bitmap = load_memory_png(prefetchedBitmap->FileData.data(), static_cast<int>(prefetchedBitmap->FileData.size()), currentPalette);
+			set_color_conversion(previousConversionMode);
+		}
+		return prefetchedBitmap->Bitmap;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::QueuePrefetch(int conversionMode, const std::string &dataPathToLoad, long long estimatedSize) {
+		PrefetchedBitmap *prefetchedBitmap = s_PrefetchedBitmaps.at((conversionMode == COLORCONV_8_TO_32) ? BitDepths::ThirtyTwo : BitDepths::Eight).try_emplace(dataPathToLoad, std::make_unique<PrefetchedBitmap>()).first->second.get();
+		prefetchedBitmap->ConversionMode = conversionMode;
+		prefetchedBitmap->Size = estimatedSize;
+		s_PrefetchedBitmapsSize += estimatedSize;
+
+		prefetchedBitmap->Job = g_ThreadMan.QueueJob([prefetchedBitmap, dataPathToLoad, conversionMode]() {
+			std::ifstream file(dataPathToLoad, std::ios::binary);
+			std::vector<char> fileData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+			// Indexed images that aren't expanded to true color come out of Allegro exactly as they are in the file, without touching any global state, so any number of them can be decoded at once as long as nobody changes the conversion mode meanwhile.
+			// Anything else is converted using Allegro's global palette and RGB map, which drawing on the main thread relies on, so those are only read here and decoded once claimed.
+			if (IsIndexedPNG(fileData)) {
+				std::shared_lock<std::shared_mutex> loadLock(s_BitmapLoadMutex);
+				if (((conversionMode | get_color_conversion()) & COLORCONV_EXPAND_256) == 0) {
+					PALETTE filePalette;
+					prefetchedBitmap->Bitmap = load_memory_png(fileData.data(), static_cast<int>(fileData.size()), filePalette);
+				}
+			}
+			// A file that couldn't be read ends up with no data and a size of 0, which releases the whole reservation.
+			long long actualSize = 0;
+			if (prefetchedBitmap->Bitmap) {
+				actualSize = static_cast<long long>(prefetchedBitmap->Bitmap->w) * prefetchedBitmap->Bitmap->h * bitmap_color_depth(prefetchedBitmap->Bitmap) / 8;
+			} else {
+				actualSize = static_cast<long long>(fileData.size());
+				prefetchedBitmap->FileData = std::move(fileData);
+			}
+			s_PrefetchedBitmapsSize += actualSize - prefetchedBitmap->Size;
+			prefetchedBitmap->Size = actualSize;
+		});
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::QueueWaitingPrefetches() {
+		const long long prefetchBudget = static_cast<long long>(g_SettingsMan.GetContentPrefetchBudget()) * 1024 * 1024;
+		while (!s_WaitingPrefetches.empty()) {
+			const WaitingPrefetch &waitingPrefetch = s_WaitingPrefetches.front();
+			const int bitDepth = (waitingPrefetch.ConversionMode == COLORCONV_8_TO_32) ? BitDepths::ThirtyTwo : BitDepths::Eight;
+			if (s_LoadedBitmaps.at(bitDepth).find(waitingPrefetch.DataPath) == s_LoadedBitmaps.at(bitDepth).end() && s_PrefetchedBitmaps.at(bitDepth).find(waitingPrefetch.DataPath) == s_PrefetchedBitmaps.at(bitDepth).end()) {
+				if (s_PrefetchedBitmapsSize + waitingPrefetch.EstimatedSize > prefetchBudget) {
+					break;
+				}
+				QueuePrefetch(waitingPrefetch.ConversionMode, waitingPrefetch.DataPath, waitingPrefetch.EstimatedSize);
+			}
+			s_WaitingPrefetches.pop_front();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ContentFile::IsIndexedPNG(const std::vector<char> &fileData) {
+		// The color type is the 26th byte of a PNG, right after the signature and the start of the IHDR chunk that always comes first. 3 means the image is palette indexed.
+		static const std::array<unsigned char, 8> pngSignature = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		return fileData.size() > 25 && std::equal(pngSignature.begin(), pngSignature.end(), fileData.begin(), [](unsigned char signatureByte, char fileByte) { return signatureByte == static_cast<unsigned char>(fileByte); }) && fileData.at(25) == 3;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	FMOD::Sound * ContentFile::GetAsSound(bool abortGameForInvalidSound, bool asyncLoading) {
@@ -145,6 +145,35 @@ namespace RTE {
 		FMOD::Sound * GetAsSound(bool abortGameForInvalidSound = true, bool asyncLoading = true);
 #pragma endregion
 
+#pragma region Prefetching
+		/// <summary>
+		/// Queues the data represented by this ContentFile object to be read from disk and decoded into an Allegro BITMAP on a ThreadMan worker, so a later GetAsBitmap with the same conversion mode only has to pick it up.
+		/// Does nothing if the BITMAP is already loaded or queued, the file isn't a PNG or doesn't exist, or the file alone is bigger than the prefetch budget.
+		/// If the prefetches that weren't picked up yet fill the prefetch budget, this one waits in line behind any others that are waiting and is queued once picked up prefetches make room for it.
+		/// </summary>
+		/// <param name="conversionMode">The Allegro color conversion mode the BITMAP will be requested with.</param>
+		/// <param name="dataPathToSpecificFrame">Path to a specific frame of an animation, same as with GetAsBitmap.</param>
+		/// <returns>Whether the BITMAP was queued to be prefetched or is waiting in line to be.</returns>
+		bool PrefetchBitmap(int conversionMode = 0, const std::string &dataPathToSpecificFrame = "");
+
+		/// <summary>
+		/// Queues all the frames of an animation to be prefetched. See PrefetchBitmap.
+		/// </summary>
+		/// <param name="frameCount">The number of frames of the animation, same as with GetAsAnimation.</param>
+		/// <param name="conversionMode">The Allegro color conversion mode the BITMAPs will be requested with.</param>
+		void PrefetchAnimation(int frameCount = 1, int conversionMode = 0);
+
+		/// <summary>
+		/// Waits until all queued prefetches have finished. Must be done before changing any global Allegro loading state, e.g. the color conversion mode, outside of ContentFile.
+		/// </summary>
+		static void WaitForPrefetches();
+
+		/// <summary>
+		/// Waits until all queued prefetches have finished, destroys all the prefetched BITMAPs that weren't picked up and drops the prefetches still waiting in line, e.g. once a batch of content is done loading.
+		/// </summary>
+		static void DiscardPrefetches();
+#pragma endregion
+
 	protected:
 
 		/// <summary>
@@ -169,6 +198,31 @@ namespace RTE {
 
 		static const std::string c_ClassName; //!< A string with the friendly-formatted type name of this object.
 
+		/// <summary>
+		/// A BITMAP that was queued to be read and decoded ahead of being requested.
+		/// </summary>
+		struct PrefetchedBitmap {
+			std::future<void> Job; //!< The future that becomes ready once the file has been read, and decoded if that was safe to do on the worker.
+			int ConversionMode = 0; //!< The Allegro color conversion mode the BITMAP was prefetched with.
+			BITMAP *Bitmap = nullptr; //!< The decoded BITMAP, if it was decoded on the worker.
+			std::vector<char> FileData; //!< The contents of the file, if it couldn't be decoded on the worker.
+			long long Size = 0; //!< The amount of memory this prefetch is counted as in s_PrefetchedBitmapsSize, in bytes. The size of the file while the prefetch is in flight, then what the decoded BITMAP or the file contents take up.
+		};
+
+		/// <summary>
+		/// A BITMAP that was requested to be prefetched while the prefetch budget was full.
+		/// </summary>
+		struct WaitingPrefetch {
+			std::string DataPath; //!< The path of the BITMAP.
+			int ConversionMode; //!< The Allegro color conversion mode the BITMAP will be requested with.
+			long long EstimatedSize; //!< The size of the file, which the prefetch is counted as until it's read.
+		};
+
+		static std::array<std::unordered_map<std::string, std::unique_ptr<PrefetchedBitmap>>, BitDepthCount> s_PrefetchedBitmaps; //!< Static map containing the prefetched BITMAPs that weren't picked up by GetAsBitmap yet and their paths for each bit depth.
+		static std::atomic<long long> s_PrefetchedBitmapsSize; //!< The total size of the prefetches that weren't picked up yet, including the estimated size of those still in flight, in bytes.
+		static std::deque<WaitingPrefetch> s_WaitingPrefetches; //!< The prefetches that didn't fit into the prefetch budget yet, in the order they were requested in.
+		static std::shared_mutex s_BitmapLoadMutex; //!< Mutex guarding Allegro's global color conversion mode and palette. Held shared while decoding BITMAPs on workers, and exclusively while changing the conversion mode to load one on the main thread.
+
 #pragma region Data Handling
 		/// <summary>
 		/// Loads and transfers the data represented by this ContentFile object as an Allegro BITMAP. Ownership of the BITMAP IS transferred!
@@ -179,6 +233,34 @@ namespace RTE {
 		/// <returns>Pointer to the BITMAP loaded from disk.</returns>
 		BITMAP * LoadAndReleaseBitmap(int conversionMode = 0, const std::string &dataPathToSpecificFrame = "");
 
+		/// <summary>
+		/// Takes a prefetched BITMAP out of the prefetch map, waiting for its prefetch to finish and decoding it if that wasn't done on the worker. Ownership of the BITMAP IS transferred!
+		/// </summary>
+		/// <param name="conversionMode">The Allegro color conversion mode the BITMAP is requested with. Prefetches made with a different mode are discarded.</param>
+		/// <param name="dataPathToLoad">The path of the BITMAP.</param>
+		/// <returns>Pointer to the prefetched BITMAP, or nullptr if there was no usable prefetch and the BITMAP needs to be loaded from disk.</returns>
+		static BITMAP * ClaimPrefetchedBitmap(int conversionMode, const std::string &dataPathToLoad);
+
+		/// <summary>
+		/// Queues a BITMAP to be read and decoded on a ThreadMan worker and counts it against the prefetch budget.
+		/// </summary>
+		/// <param name="conversionMode">The Allegro color conversion mode the BITMAP will be requested with.</param>
+		/// <param name="dataPathToLoad">The path of the BITMAP.</param>
+		/// <param name="estimatedSize">The size of the file, which the prefetch is counted as until it's read.</param>
+		static void QueuePrefetch(int conversionMode, const std::string &dataPathToLoad, long long estimatedSize);
+
+		/// <summary>
+		/// Queues the prefetches waiting in line, in order, for as long as they fit into the prefetch budget. Those that were loaded or queued some other way meanwhile are dropped.
+		/// </summary>
+		static void QueueWaitingPrefetches();
+
+		/// <summary>
+		/// Tells whether the contents of a file are a palette indexed PNG, which Allegro can decode on a worker as long as it doesn't need to be expanded to true color.
+		/// </summary>
+		/// <param name="fileData">The contents of the file.</param>
+		/// <returns>Whether the file is a palette indexed PNG.</returns>
+		static bool IsIndexedPNG(const std::vector<char> &fileData);
+
 		/// <summary>
 		/// Loads and transfers the data represented by this ContentFile object as an FMOD FSOUND_SAMPLE. Ownership of the FSOUND_SAMPLE is NOT transferred!
 		/// </summary>
@@ -1,6 +1,8 @@
 #include "Controller.h"
 #include "UInputMan.h"
 #include "ConsoleMan.h"
+#include "MovableMan.h"
+#include "TimerMan.h"
 #include "Actor.h"
 
 namespace RTE {
@@ -135,6 +137,14 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void Controller::Update() {
+		// AI Actors that aren't scheduled to think this update keep doing what they were last told to, except for one-off actions that shouldn't be repeated.
+		if (m_InputMode == CIM_AI && !m_Disabled && m_ControlledActor && !g_MovableMan.GetAIScheduler().IsAIUpdateDue(*m_ControlledActor)) {
+			for (ControlState oneOffState : { BODY_JUMPSTART, WEAPON_RELOAD, WEAPON_CHANGE_NEXT, WEAPON_CHANGE_PREV, WEAPON_PICKUP, WEAPON_DROP, PRESS_PRIMARY, PRESS_SECONDARY, PRESS_RIGHT, PRESS_LEFT, PRESS_UP, PRESS_DOWN, RELEASE_PRIMARY, RELEASE_SECONDARY, PRESS_FACEBUTTON }) {
+				m_ControlStates.at(oneOffState) = false;
+			}
+			return;
+		}
+
 		// Reset all command states.
 		m_ControlStates.fill(false);
 		m_AnalogMove.Reset();
@@ -162,9 +172,13 @@ namespace RTE {
 			}
 
 			// Update the AI state of the Actor we're controlling and to use any scripted AI defined for this Actor.
-			if (m_ControlledActor && m_ControlledActor->ObjectScriptsInitialized() && !m_ControlledActor->UpdateAIScripted()) {
-				// If we can't, fall back on the legacy C++ implementation
-				m_ControlledActor->UpdateAI();
+			if (m_ControlledActor && m_ControlledActor->ObjectScriptsInitialized()) {
+				long long aiUpdateStartTime = g_TimerMan.GetAbsoluteTime();
+				if (!m_ControlledActor->UpdateAIScripted()) {
+					// If we can't, fall back on the legacy C++ implementation
+					m_ControlledActor->UpdateAI();
+				}
+				g_MovableMan.GetAIScheduler().RecordAIUpdate(*m_ControlledActor, g_TimerMan.GetAbsoluteTime() - aiUpdateStartTime);
 			}
 		}
 	}
@@ -31,6 +31,18 @@ namespace RTE {
 		drawRightPos.m_Y -= targetPos.m_Y;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool GraphicalPrimitive::GetPointBounds(std::initializer_list<Vector> points, Vector &topLeft, Vector &bottomRight) {
+		topLeft = *points.begin();
+		bottomRight = *points.begin();
+		for (const Vector &point : points) {
+			topLeft.SetXY(std::min(topLeft.GetX(), point.GetX()), std::min(topLeft.GetY(), point.GetY()));
+			bottomRight.SetXY(std::max(bottomRight.GetX(), point.GetX()), std::max(bottomRight.GetY(), point.GetY()));
+		}
+		return true;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void LinePrimitive::Draw(BITMAP *drawScreen, const Vector &targetPos) {
@@ -400,6 +412,17 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool BitmapPrimitive::GetSceneBounds(Vector &topLeft, Vector &bottomRight) const {
+		if (!m_Bitmap) {
+			return false;
+		}
+		// The bitmap can be rotated any which way around its center, so use the radius of the circle it can sweep.
+		float radius = std::sqrt(static_cast<float>(m_Bitmap->w * m_Bitmap->w + m_Bitmap->h * m_Bitmap->h)) * 0.5F;
+		return GetRadialBounds(m_StartPos, radius, radius, topLeft, bottomRight);
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void BitmapPrimitive::Draw(BITMAP *drawScreen, const Vector &targetPos) {
@@ -407,9 +430,13 @@ namespace RTE {
 			return;
 		}
 
-		BITMAP *bitmapToDraw = create_bitmap_ex(8, m_Bitmap->w, m_Bitmap->h);
-		clear_to_color(bitmapToDraw, 0);
-		draw_sprite(bitmapToDraw, m_Bitmap, 0, 0);
+		// Only flipped or non-8bpp bitmaps need an intermediate copy, the rest can be pivoted straight from the source bitmap.
+		BITMAP *bitmapToDraw = m_Bitmap;
+		if (m_HFlipped || m_VFlipped || bitmap_color_depth(m_Bitmap) != 8) {
+			bitmapToDraw = create_bitmap_ex(8, m_Bitmap->w, m_Bitmap->h);
+			clear_to_color(bitmapToDraw, 0);
+			draw_sprite(bitmapToDraw, m_Bitmap, 0, 0);
+		}
 
 		if (m_HFlipped || m_VFlipped) {
 			BITMAP *flipBitmap = create_bitmap_ex(8, bitmapToDraw->w, bitmapToDraw->h);
@@ -443,6 +470,6 @@ namespace RTE {
 			pivot_scaled_sprite(drawScreen, bitmapToDraw, drawStartRight.GetFloorIntX(), drawStartRight.GetFloorIntY(), bitmapToDraw->w / 2, bitmapToDraw->h / 2, ftofix(rotation.GetAllegroAngle()), ftofix(1.0));
 		}
 
-		destroy_bitmap(bitmapToDraw);
+		if (bitmapToDraw != m_Bitmap) { destroy_bitmap(bitmapToDraw); }
 	}
 }
\ No newline at end of file
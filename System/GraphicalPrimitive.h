@@ -47,6 +47,36 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		virtual void Draw(BITMAP *drawScreen, const Vector &targetPos) = 0;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all. Primitives without them are never culled.</returns>
+		virtual bool GetSceneBounds(Vector &/*topLeft*/, Vector &/*bottomRight*/) const { return false; }
+
+	protected:
+
+		/// <summary>
+		/// Sets a box to the smallest one that contains all the passed in points.
+		/// </summary>
+		/// <param name="points">The points the box should contain.</param>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Always true, for convenience when returning from GetSceneBounds.</returns>
+		static bool GetPointBounds(std::initializer_list<Vector> points, Vector &topLeft, Vector &bottomRight);
+
+		/// <summary>
+		/// Sets a box to one centered on a point with the passed in extents.
+		/// </summary>
+		/// <param name="centerPos">The center of the box.</param>
+		/// <param name="horizRadius">Half the width of the box.</param>
+		/// <param name="vertRadius">Half the height of the box.</param>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Always true, for convenience when returning from GetSceneBounds.</returns>
+		static bool GetRadialBounds(const Vector &centerPos, float horizRadius, float vertRadius, Vector &topLeft, Vector &bottomRight) { topLeft = centerPos - Vector(horizRadius, vertRadius); bottomRight = centerPos + Vector(horizRadius, vertRadius); return true; }
 	};
 #pragma endregion
 
@@ -78,6 +108,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_StartPos, m_EndPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -117,6 +155,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetRadialBounds(m_StartPos, static_cast<float>(m_Radius + m_Thickness), static_cast<float>(m_Radius + m_Thickness), topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -155,6 +201,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_StartPos, m_GuidePointAPos, m_GuidePointBPos, m_EndPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -186,6 +240,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_StartPos, m_EndPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -217,6 +279,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_StartPos, m_EndPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -253,6 +323,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_StartPos, m_EndPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -289,6 +367,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_StartPos, m_EndPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -323,6 +409,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetRadialBounds(m_StartPos, static_cast<float>(m_Radius), static_cast<float>(m_Radius), topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -357,6 +451,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetRadialBounds(m_StartPos, static_cast<float>(m_Radius), static_cast<float>(m_Radius), topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -393,6 +495,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetRadialBounds(m_StartPos, static_cast<float>(m_HorizRadius), static_cast<float>(m_VertRadius), topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -428,6 +538,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetRadialBounds(m_StartPos, static_cast<float>(m_HorizRadius), static_cast<float>(m_VertRadius), topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -464,6 +582,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_PointAPos, m_PointBPos, m_PointCPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -500,6 +626,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override { return GetPointBounds({ m_PointAPos, m_PointBPos, m_PointCPos }, topLeft, bottomRight); }
 	};
 #pragma endregion
 
@@ -574,6 +708,14 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, const Vector &targetPos) override;
+
+		/// <summary>
+		/// Gets the box in scene coordinates this primitive draws within, so it can be culled when that's entirely outside of the screen being drawn.
+		/// </summary>
+		/// <param name="topLeft">Set to the top left corner of the box.</param>
+		/// <param name="bottomRight">Set to the bottom right corner of the box.</param>
+		/// <returns>Whether this primitive has known bounds at all.</returns>
+		bool GetSceneBounds(Vector &topLeft, Vector &bottomRight) const override;
 	};
 #pragma endregion
 }
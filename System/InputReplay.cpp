@@ -0,0 +1,521 @@
+#include "InputReplay.h"
+#include "ActivityMan.h"
+#include "ConsoleMan.h"
+#include "LuaMan.h"
+#include "MovableMan.h"
+#include "PerformanceMan.h"
+#include "PresetMan.h"
+#include "SceneMan.h"
+#include "TimerMan.h"
+#include "UInputMan.h"
+#include "GameActivity.h"
+#include "Scene.h"
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::Clear() {
+		m_State = ReplayState::Idle;
+		m_RecordingFilePath.clear();
+		m_PlaybackFilePath.clear();
+		m_FrameData.clear();
+		m_ReadPosition = 0;
+		m_Seed = 0;
+		m_PlaybackSeeded = false;
+		m_SuspendedAITimeBudget = 0;
+		m_FrameCount = 0;
+		m_StateHash = 0;
+		m_KeyStates.fill(0);
+		m_MouseButtons = 0;
+		m_MouseX = 0;
+		m_MouseY = 0;
+		m_MouseWheel = 0;
+		m_JoystickData.clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::Destroy() {
+		if (m_State == ReplayState::Recording) { EndReplay(); }
+		Clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool InputReplay::StartPlayback() {
+		std::ifstream playbackStream(m_PlaybackFilePath, std::ios::binary);
+		if (!playbackStream.is_open()) {
+			g_ConsoleMan.PrintString("ERROR: Failed to open input recording \"" + m_PlaybackFilePath + "\"!");
+			m_PlaybackFilePath.clear();
+			return false;
+		}
+		m_FrameData.assign(std::istreambuf_iterator<char>(playbackStream), std::istreambuf_iterator<char>());
+		m_ReadPosition = 0;
+
+		if (!ReadHeader()) {
+			g_ConsoleMan.PrintString("ERROR: \"" + m_PlaybackFilePath + "\" is not an input recording that can be played back!");
+			m_PlaybackFilePath.clear();
+			m_FrameData.clear();
+			return false;
+		}
+		g_ConsoleMan.PrintString("SYSTEM: Playing back input recording \"" + m_PlaybackFilePath + "\"");
+		m_PlaybackFilePath.clear();
+		m_State = ReplayState::PlayingBack;
+		m_PlaybackSeeded = false;
+
+		// Nothing is drawn during playback, so there's no point in holding the sim to real time.
+		g_TimerMan.SetSimFreeRunning(true);
+		g_ActivityMan.SetRestartActivity();
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::ActivityStarting(const Activity &startActivity) {
+		if (m_State == ReplayState::Recording) {
+			EndReplay();
+		} else if (m_State == ReplayState::PlayingBack) {
+			// The recording only covers one Activity, anything started after it isn't part of it. A recording stops when another Activity is started, so a playback that stayed in sync gets here right as the recording runs out.
+			if (m_PlaybackSeeded) {
+				FinishPlayback();
+			} else {
+				BeginReplay();
+				m_PlaybackSeeded = true;
+			}
+			return;
+		}
+		if (m_RecordingFilePath.empty()) {
+			return;
+		}
+		m_RecordingStream.open(m_RecordingFilePath, std::ios::binary | std::ios::trunc);
+		if (!m_RecordingStream.is_open()) {
+			g_ConsoleMan.PrintString("ERROR: Failed to create input recording \"" + m_RecordingFilePath + "\"!");
+			m_RecordingFilePath.clear();
+			return;
+		}
+		m_Seed = std::random_device()();
+		WriteHeader(startActivity);
+		m_RecordingStream.write(m_FrameData.data(), static_cast<std::streamsize>(m_FrameData.size()));
+
+		g_ConsoleMan.PrintString("SYSTEM: Recording input to \"" + m_RecordingFilePath + "\"");
+		m_RecordingFilePath.clear();
+		m_State = ReplayState::Recording;
+		BeginReplay();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::RecordFrame(const Vector &rawMouseMovement) {
+		// There's no telling which sim update is the last one until the recording stops, and by then the MovableObjects may be gone already, so the state is hashed as every sim update begins.
+		m_StateHash = GetSimStateHash();
+
+		m_FrameData.clear();
+		WriteValue(uint8_t(0));
+		uint8_t changeFlags = 0;
+
+		std::vector<uint8_t> changedKeys;
+		for (int keyToCheck = KEY_A; keyToCheck < KEY_MAX; ++keyToCheck) {
+			if (key[keyToCheck] != m_KeyStates[keyToCheck]) {
+				m_KeyStates[keyToCheck] = key[keyToCheck];
+				changedKeys.emplace_back(static_cast<uint8_t>(keyToCheck));
+			}
+		}
+		if (!changedKeys.empty()) {
+			changeFlags |= FrameChangeFlags::KeysChanged;
+			WriteValue(static_cast<uint8_t>(changedKeys.size()));
+			m_FrameData.insert(m_FrameData.end(), changedKeys.begin(), changedKeys.end());
+		}
+		if (mouse_b != m_MouseButtons) {
+			changeFlags |= FrameChangeFlags::MouseButtonsChanged;
+			m_MouseButtons = mouse_b;
+			WriteValue(static_cast<uint8_t>(m_MouseButtons));
+		}
+		if (!rawMouseMovement.IsZero()) {
+			changeFlags |= FrameChangeFlags::MouseMoved;
+			WriteValue(rawMouseMovement.GetX());
+			WriteValue(rawMouseMovement.GetY());
+		}
+		if (mouse_x != m_MouseX || mouse_y != m_MouseY) {
+			changeFlags |= FrameChangeFlags::MousePosChanged;
+			m_MouseX = mouse_x;
+			m_MouseY = mouse_y;
+			WriteValue(static_cast<int16_t>(m_MouseX));
+			WriteValue(static_cast<int16_t>(m_MouseY));
+		}
+		if (mouse_z != m_MouseWheel) {
+			changeFlags |= FrameChangeFlags::MouseWheelChanged;
+			m_MouseWheel = mouse_z;
+			WriteValue(static_cast<int16_t>(m_MouseWheel));
+		}
+		std::vector<char> joystickData = GetJoystickData();
+		if (joystickData != m_JoystickData) {
+			changeFlags |= FrameChangeFlags::JoysticksChanged;
+			m_FrameData.insert(m_FrameData.end(), joystickData.begin(), joystickData.end());
+			m_JoystickData = std::move(joystickData);
+		}
+		m_FrameData.front() = static_cast<char>(changeFlags);
+		m_RecordingStream.write(m_FrameData.data(), static_cast<std::streamsize>(m_FrameData.size()));
+		m_FrameCount++;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::PlayFrame(Vector &rawMouseMovement) {
+		rawMouseMovement.Reset();
+
+		if (m_ReadPosition >= m_FrameData.size() || (static_cast<uint8_t>(m_FrameData[m_ReadPosition]) & FrameChangeFlags::RecordingEnded)) {
+			FinishPlayback();
+			return;
+		}
+
+		uint8_t changeFlags = 0;
+		bool frameRead = ReadValue(changeFlags);
+		if (frameRead && (changeFlags & FrameChangeFlags::KeysChanged)) {
+			uint8_t changedKeyCount = 0;
+			frameRead = ReadValue(changedKeyCount);
+			for (int changedKey = 0; frameRead && changedKey < changedKeyCount; ++changedKey) {
+				uint8_t keyToToggle = 0;
+				frameRead = ReadValue(keyToToggle) && keyToToggle < KEY_MAX;
+				if (frameRead) { m_KeyStates[keyToToggle] = !m_KeyStates[keyToToggle]; }
+			}
+		}
+		if (frameRead && (changeFlags & FrameChangeFlags::MouseButtonsChanged)) {
+			uint8_t mouseButtons = 0;
+			frameRead = ReadValue(mouseButtons);
+			m_MouseButtons = mouseButtons;
+		}
+		if (frameRead && (changeFlags & FrameChangeFlags::MouseMoved)) {
+			float mouseMovementX = 0;
+			float mouseMovementY = 0;
+			frameRead = ReadValue(mouseMovementX) && ReadValue(mouseMovementY);
+			rawMouseMovement.SetXY(mouseMovementX, mouseMovementY);
+		}
+		if (frameRead && (changeFlags & FrameChangeFlags::MousePosChanged)) {
+			int16_t mouseX = 0;
+			int16_t mouseY = 0;
+			frameRead = ReadValue(mouseX) && ReadValue(mouseY);
+			m_MouseX = mouseX;
+			m_MouseY = mouseY;
+		}
+		if (frameRead && (changeFlags & FrameChangeFlags::MouseWheelChanged)) {
+			int16_t mouseWheel = 0;
+			frameRead = ReadValue(mouseWheel);
+			m_MouseWheel = mouseWheel;
+		}
+		if (frameRead && (changeFlags & FrameChangeFlags::JoysticksChanged)) { frameRead = ReadJoystickData(); }
+
+		if (!frameRead) {
+			FinishPlayback();
+			return;
+		}
+		// Only the last sim update's state is compared, so there's no need to spend time hashing the others.
+		if (m_ReadPosition < m_FrameData.size() && (static_cast<uint8_t>(m_FrameData[m_ReadPosition]) & FrameChangeFlags::RecordingEnded)) { m_StateHash = GetSimStateHash(); }
+
+		// The recorded state is put straight into Allegro's input state, so everything that reads input goes by it without knowing the difference.
+		for (int keyToSet = KEY_A; keyToSet < KEY_MAX; ++keyToSet) {
+			key[keyToSet] = m_KeyStates[keyToSet];
+		}
+		mouse_b = m_MouseButtons;
+		mouse_x = m_MouseX;
+		mouse_y = m_MouseY;
+		mouse_z = m_MouseWheel;
+		m_FrameCount++;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool InputReplay::ReadString(std::string &value) {
+		uint16_t stringLength = 0;
+		if (!ReadValue(stringLength) || m_ReadPosition + stringLength > m_FrameData.size()) {
+			return false;
+		}
+		value.assign(m_FrameData.data() + m_ReadPosition, stringLength);
+		m_ReadPosition += stringLength;
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::WriteHeader(const Activity &startActivity) {
+		m_FrameData.clear();
+		m_FrameData.insert(m_FrameData.end(), c_FileSignature.begin(), c_FileSignature.end());
+		WriteValue(c_FileVersion);
+		WriteValue(m_Seed);
+		WriteValue(g_TimerMan.GetDeltaTimeSecs());
+
+		const Scene *sceneToLoad = g_SceneMan.GetSceneToLoad();
+		WriteString(startActivity.GetClassName());
+		WriteString(startActivity.GetPresetName());
+		WriteString(sceneToLoad ? sceneToLoad->GetPresetName() : "");
+		WriteValue(static_cast<int32_t>(startActivity.GetDifficulty()));
+
+		for (int player = Players::PlayerOne; player < Players::MaxPlayerCount; ++player) {
+			const InputScheme *inputScheme = g_UInputMan.GetControlScheme(player);
+			WriteValue(static_cast<uint8_t>(startActivity.PlayerActive(player)));
+			WriteValue(static_cast<uint8_t>(startActivity.PlayerHuman(player)));
+			WriteValue(static_cast<int8_t>(startActivity.GetTeamOfPlayer(player)));
+			WriteValue(startActivity.GetPlayerFundsContribution(player));
+			WriteValue(static_cast<uint8_t>(inputScheme->GetDevice()));
+			WriteValue(static_cast<uint8_t>(inputScheme->GetPreset()));
+		}
+		for (int team = Activity::Teams::TeamOne; team < Activity::Teams::MaxTeamCount; ++team) {
+			WriteValue(startActivity.GetTeamFunds(team));
+			WriteValue(static_cast<int32_t>(startActivity.GetTeamAISkill(team)));
+		}
+
+		const GameActivity *gameActivity = dynamic_cast<const GameActivity *>(&startActivity);
+		WriteValue(static_cast<uint8_t>(gameActivity != nullptr));
+		if (gameActivity) {
+			WriteValue(static_cast<int8_t>(gameActivity->GetCPUTeam()));
+			WriteValue(static_cast<int32_t>(gameActivity->GetStartingGold()));
+			WriteValue(static_cast<uint8_t>(gameActivity->GetFogOfWarEnabled()));
+		}
+
+		// The joystick layout decides how the joystick state of each sim update is stored, and has to be the same during playback for the input mappings to work out the same.
+		const int joystickCount = std::min(num_joysticks, c_MaxJoystickCount);
+		WriteValue(static_cast<uint8_t>(joystickCount));
+		for (int joystick = 0; joystick < joystickCount; ++joystick) {
+			WriteValue(static_cast<uint8_t>(joy[joystick].num_sticks));
+			for (int stick = 0; stick < joy[joystick].num_sticks; ++stick) {
+				WriteValue(static_cast<int32_t>(joy[joystick].stick[stick].flags));
+				WriteValue(static_cast<uint8_t>(joy[joystick].stick[stick].num_axis));
+			}
+			WriteValue(static_cast<uint8_t>(joy[joystick].num_buttons));
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool InputReplay::ReadHeader() {
+		std::array<char, 4> fileSignature;
+		uint16_t fileVersion = 0;
+		if (!ReadValue(fileSignature) || fileSignature != c_FileSignature || !ReadValue(fileVersion) || fileVersion != c_FileVersion) {
+			return false;
+		}
+		float deltaTimeSecs = 0;
+		std::string activityClassName;
+		std::string activityPresetName;
+		std::string sceneName;
+		int32_t difficulty = 0;
+		bool headerRead = ReadValue(m_Seed) && ReadValue(deltaTimeSecs) && ReadString(activityClassName) && ReadString(activityPresetName) && ReadString(sceneName) && ReadValue(difficulty);
+
+		const Activity *activityPreset = headerRead ? dynamic_cast<const Activity *>(g_PresetMan.GetEntityPreset(activityClassName, activityPresetName)) : nullptr;
+		if (!activityPreset) {
+			return false;
+		}
+		std::unique_ptr<Activity> activity(dynamic_cast<Activity *>(activityPreset->Clone()));
+		activity->ClearPlayers(true);
+		activity->SetDifficulty(difficulty);
+
+		for (int player = Players::PlayerOne; headerRead && player < Players::MaxPlayerCount; ++player) {
+			uint8_t playerActive = 0;
+			uint8_t playerHuman = 0;
+			int8_t team = 0;
+			float fundsContribution = 0;
+			uint8_t inputDevice = 0;
+			uint8_t inputPreset = 0;
+			headerRead = ReadValue(playerActive) && ReadValue(playerHuman) && ReadValue(team) && ReadValue(fundsContribution) && ReadValue(inputDevice) && ReadValue(inputPreset) && inputDevice < InputDevice::DEVICE_COUNT && inputPreset < InputScheme::InputPreset::InputPresetCount;
+			if (headerRead && playerActive) {
+				activity->AddPlayer(player, playerHuman, team, fundsContribution);
+				InputScheme *inputScheme = g_UInputMan.GetControlScheme(player);
+				inputScheme->SetDevice(static_cast<InputDevice>(inputDevice));
+				inputScheme->SetPreset(static_cast<InputScheme::InputPreset>(inputPreset));
+			}
+		}
+		for (int team = Activity::Teams::TeamOne; headerRead && team < Activity::Teams::MaxTeamCount; ++team) {
+			float teamFunds = 0;
+			int32_t teamAISkill = 0;
+			headerRead = ReadValue(teamFunds) && ReadValue(teamAISkill);
+			activity->SetTeamFunds(teamFunds, team);
+			activity->SetTeamAISkill(team, teamAISkill);
+		}
+
+		uint8_t isGameActivity = 0;
+		headerRead = headerRead && ReadValue(isGameActivity);
+		if (headerRead && isGameActivity) {
+			int8_t cpuTeam = 0;
+			int32_t startingGold = 0;
+			uint8_t fogOfWarEnabled = 0;
+			headerRead = ReadValue(cpuTeam) && ReadValue(startingGold) && ReadValue(fogOfWarEnabled);
+			if (GameActivity *gameActivity = dynamic_cast<GameActivity *>(activity.get())) {
+				gameActivity->SetCPUTeam(cpuTeam);
+				gameActivity->SetStartingGold(startingGold);
+				gameActivity->SetFogOfWarEnabled(fogOfWarEnabled);
+			}
+		}
+
+		uint8_t joystickCount = 0;
+		headerRead = headerRead && ReadValue(joystickCount) && joystickCount <= c_MaxJoystickCount;
+		for (int joystick = 0; headerRead && joystick < joystickCount; ++joystick) {
+			uint8_t stickCount = 0;
+			headerRead = ReadValue(stickCount) && stickCount <= MAX_JOYSTICK_STICKS;
+			joy[joystick].num_sticks = stickCount;
+			for (int stick = 0; headerRead && stick < stickCount; ++stick) {
+				int32_t stickFlags = 0;
+				uint8_t axisCount = 0;
+				headerRead = ReadValue(stickFlags) && ReadValue(axisCount) && axisCount <= MAX_JOYSTICK_AXIS;
+				joy[joystick].stick[stick].flags = stickFlags;
+				joy[joystick].stick[stick].num_axis = axisCount;
+			}
+			uint8_t buttonCount = 0;
+			headerRead = headerRead && ReadValue(buttonCount) && buttonCount <= MAX_JOYSTICK_BUTTONS;
+			joy[joystick].num_buttons = buttonCount;
+		}
+		if (!headerRead) {
+			return false;
+		}
+		num_joysticks = joystickCount;
+
+		g_TimerMan.SetDeltaTimeSecs(deltaTimeSecs);
+		if (!sceneName.empty()) { g_SceneMan.SetSceneToLoad(sceneName); }
+		g_ActivityMan.SetStartActivity(activity.release());
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<char> InputReplay::GetJoystickData() const {
+		std::vector<char> joystickData;
+		const int joystickCount = std::min(num_joysticks, c_MaxJoystickCount);
+		for (int joystick = 0; joystick < joystickCount; ++joystick) {
+			uint32_t buttonStates = 0;
+			for (int button = 0; button < joy[joystick].num_buttons; ++button) {
+				if (joy[joystick].button[button].b) { buttonStates |= 1U << button; }
+			}
+			joystickData.insert(joystickData.end(), reinterpret_cast<const char *>(&buttonStates), reinterpret_cast<const char *>(&buttonStates) + sizeof(buttonStates));
+			for (int stick = 0; stick < joy[joystick].num_sticks; ++stick) {
+				for (int axis = 0; axis < joy[joystick].stick[stick].num_axis; ++axis) {
+					const JOYSTICK_AXIS_INFO &joystickAxis = joy[joystick].stick[stick].axis[axis];
+					int16_t axisPos = static_cast<int16_t>(joystickAxis.pos);
+					joystickData.insert(joystickData.end(), reinterpret_cast<const char *>(&axisPos), reinterpret_cast<const char *>(&axisPos) + sizeof(axisPos));
+					joystickData.emplace_back(static_cast<char>((joystickAxis.d1 ? 1 : 0) | (joystickAxis.d2 ? 2 : 0)));
+				}
+			}
+		}
+		return joystickData;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool InputReplay::ReadJoystickData() {
+		for (int joystick = 0; joystick < num_joysticks; ++joystick) {
+			uint32_t buttonStates = 0;
+			if (!ReadValue(buttonStates)) {
+				return false;
+			}
+			for (int button = 0; button < joy[joystick].num_buttons; ++button) {
+				joy[joystick].button[button].b = (buttonStates >> button) & 1;
+			}
+			for (int stick = 0; stick < joy[joystick].num_sticks; ++stick) {
+				for (int axis = 0; axis < joy[joystick].stick[stick].num_axis; ++axis) {
+					int16_t axisPos = 0;
+					uint8_t axisDirections = 0;
+					if (!ReadValue(axisPos) || !ReadValue(axisDirections)) {
+						return false;
+					}
+					JOYSTICK_AXIS_INFO &joystickAxis = joy[joystick].stick[stick].axis[axis];
+					joystickAxis.pos = axisPos;
+					joystickAxis.d1 = axisDirections & 1;
+					joystickAxis.d2 = (axisDirections >> 1) & 1;
+				}
+			}
+		}
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	uint64_t InputReplay::GetSimStateHash() {
+		// FNV-1a instead of std::hash, so the hash stored in a recording doesn't depend on the standard library the game was built with.
+		uint64_t stateHash = 14695981039346656037ULL;
+		auto hashValue = [&stateHash](const auto &value) {
+			const char *valueBytes = reinterpret_cast<const char *>(&value);
+			for (size_t valueByte = 0; valueByte < sizeof(value); ++valueByte) {
+				stateHash = (stateHash ^ static_cast<uint8_t>(valueBytes[valueByte])) * 1099511628211ULL;
+			}
+		};
+		auto hashMOs = [&hashValue](const auto &movableObjects) {
+			hashValue(static_cast<uint32_t>(movableObjects.size()));
+			for (const MovableObject *movableObject : movableObjects) {
+				hashValue(movableObject->GetPos().GetX());
+				hashValue(movableObject->GetPos().GetY());
+				hashValue(movableObject->GetVel().GetX());
+				hashValue(movableObject->GetVel().GetY());
+				hashValue(movableObject->GetRotAngle());
+				hashValue(movableObject->GetAngularVel());
+			}
+		};
+		hashMOs(g_MovableMan.m_Actors);
+		hashMOs(g_MovableMan.m_AddedActors);
+		hashMOs(g_MovableMan.m_Items);
+		hashMOs(g_MovableMan.m_AddedItems);
+		hashMOs(g_MovableMan.m_Particles);
+		hashMOs(g_MovableMan.m_AddedParticles);
+		return stateHash;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::FinishPlayback() {
+		uint8_t changeFlags = 0;
+		uint64_t recordedStateHash = 0;
+		if (ReadValue(changeFlags) && (changeFlags & FrameChangeFlags::RecordingEnded) && ReadValue(recordedStateHash)) {
+			g_ConsoleMan.PrintString((recordedStateHash == m_StateHash) ? "SYSTEM: Input playback stayed in sync with the recording" : "WARNING: Input playback went out of sync with the recording, the MovableObjects didn't end up the same!");
+		} else {
+			g_ConsoleMan.PrintString("WARNING: Input playback ended before the end of the recording, so it can't be told whether it stayed in sync!");
+		}
+		char outputString[128];
+		std::snprintf(outputString, sizeof(outputString), "SYSTEM: Input playback finished after %i sim updates", m_FrameCount);
+		g_ConsoleMan.PrintString(outputString);
+		g_PerformanceMan.PrintPerformanceTotals();
+		EndReplay();
+		System::SetQuit();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::BeginReplay() {
+		SeedRNG(m_Seed);
+		// Scripts that are updated in parallel run on the worker states, which each have their own math.random, so seed all of them. -1 is the master state.
+		for (int workerState = -1; workerState < g_LuaMan.GetWorkerStateCount(); ++workerState) {
+			LuaMan::WorkerStateScope workerStateScope(workerState);
+			g_LuaMan.RunScriptString("math.randomseed(" + std::to_string(m_Seed + static_cast<unsigned int>(workerState + 1)) + ")");
+		}
+
+		AIScheduler &aiScheduler = g_MovableMan.GetAIScheduler();
+		m_SuspendedAITimeBudget = aiScheduler.GetTimeBudget();
+		aiScheduler.SetTimeBudget(0);
+
+		m_FrameCount = 0;
+		m_StateHash = 0;
+		m_KeyStates.fill(0);
+		m_MouseButtons = 0;
+		m_MouseX = 0;
+		m_MouseY = 0;
+		m_MouseWheel = 0;
+		m_JoystickData.clear();
+		g_PerformanceMan.ResetPerformanceTotals();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void InputReplay::EndReplay() {
+		if (m_State == ReplayState::Recording) {
+			m_FrameData.clear();
+			WriteValue(static_cast<uint8_t>(FrameChangeFlags::RecordingEnded));
+			WriteValue(m_StateHash);
+			m_RecordingStream.write(m_FrameData.data(), static_cast<std::streamsize>(m_FrameData.size()));
+			m_RecordingStream.close();
+			char outputString[128];
+			std::snprintf(outputString, sizeof(outputString), "SYSTEM: Input recording finished after %i sim updates", m_FrameCount);
+			g_ConsoleMan.PrintString(outputString);
+		} else if (m_State == ReplayState::PlayingBack) {
+			g_TimerMan.SetSimFreeRunning(false);
+			m_FrameData.clear();
+			m_ReadPosition = 0;
+		}
+		g_MovableMan.GetAIScheduler().SetTimeBudget(m_SuspendedAITimeBudget);
+		m_State = ReplayState::Idle;
+	}
+}
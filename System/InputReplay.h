@@ -0,0 +1,237 @@
+#ifndef _RTEINPUTREPLAY_
+#define _RTEINPUTREPLAY_
+
+#include "Vector.h"
+
+namespace RTE {
+
+	class Activity;
+
+	/// <summary>
+	/// Records the raw keyboard, mouse and joystick input of an Activity to a file, and plays it back so the Activity can be run again exactly as it was played.
+	/// A recording starts with the setup of the Activity, the player and team settings and the RNG seed, followed by the input state of every sim update, stored as changes from the previous sim update.
+	/// Playback runs headless with the sim free running, so the recording is replayed as fast as possible through the normal update loop and the performance counters give the cost of each sim update.
+	/// The main thread's RNG and every Lua state's math.random are seeded, but anything that goes by real time instead of sim time will play out differently, so a playback can drift from the recorded session in those spots.
+	/// A recording ends with a hash of the state of the MovableObjects as its last sim update began, which the playback compares its own state against to tell whether it stayed in sync.
+	/// </summary>
+	class InputReplay {
+
+	public:
+
+		/// <summary>
+		/// Enumeration for what an InputReplay is doing.
+		/// </summary>
+		enum ReplayState { Idle, Recording, PlayingBack };
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate an InputReplay object in system memory.
+		/// </summary>
+		InputReplay() { Clear(); }
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up an InputReplay object before deletion from system memory.
+		/// </summary>
+		~InputReplay() { Destroy(); }
+
+		/// <summary>
+		/// Finishes any recording in progress and resets (through Clear()) the InputReplay object.
+		/// </summary>
+		void Destroy();
+#pragma endregion
+
+#pragma region Getters and Setters
+		/// <summary>
+		/// Gets what this InputReplay is doing.
+		/// </summary>
+		/// <returns>The current state of this InputReplay. See ReplayState enumeration.</returns>
+		ReplayState GetState() const { return m_State; }
+
+		/// <summary>
+		/// Gets whether input is being recorded or played back, in which case anything that would make the Activity play out differently, like pausing or quick loading, shouldn't be allowed.
+		/// </summary>
+		/// <returns>Whether input is being recorded or played back.</returns>
+		bool IsActive() const { return m_State != ReplayState::Idle; }
+
+		/// <summary>
+		/// Gets whether input is being played back, in which case the input devices shouldn't be read.
+		/// </summary>
+		/// <returns>Whether input is being played back.</returns>
+		bool IsPlayingBack() const { return m_State == ReplayState::PlayingBack; }
+
+		/// <summary>
+		/// Gets whether a recording is set to be played back once the data is loaded.
+		/// </summary>
+		/// <returns>Whether a recording is set to be played back.</returns>
+		bool IsSetToPlayBack() const { return !m_PlaybackFilePath.empty(); }
+
+		/// <summary>
+		/// Sets the input of the next Activity that is started to be recorded.
+		/// </summary>
+		/// <param name="filePath">The path of the file to record to. Overwritten if it exists.</param>
+		void SetToRecord(const std::string &filePath) { m_RecordingFilePath = filePath; }
+
+		/// <summary>
+		/// Sets a recording to be played back once the data is loaded. See StartPlayback().
+		/// </summary>
+		/// <param name="filePath">The path of the recording to play back.</param>
+		void SetToPlayBack(const std::string &filePath) { m_PlaybackFilePath = filePath; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Loads the recording that was set to be played back and sets the recorded Activity to be started, with the sim free running. Requires the data to be loaded.
+		/// </summary>
+		/// <returns>Whether the recording was loaded and its Activity set to be started.</returns>
+		bool StartPlayback();
+
+		/// <summary>
+		/// Lets this know an Activity is about to be started, which starts or stops recording and seeds the RNG of a recording or playback. Should be done after the Scene to load is set and before the Activity is started.
+		/// </summary>
+		/// <param name="startActivity">The Activity that is about to be started.</param>
+		void ActivityStarting(const Activity &startActivity);
+
+		/// <summary>
+		/// Records the input state of this sim update. Should be done right after the input devices were read.
+		/// </summary>
+		/// <param name="rawMouseMovement">The mouse movement of this sim update.</param>
+		void RecordFrame(const Vector &rawMouseMovement);
+
+		/// <summary>
+		/// Puts the recorded input state of the next sim update into effect, in place of reading the input devices. Ends the playback and quits once the recording runs out.
+		/// </summary>
+		/// <param name="rawMouseMovement">Vector to be filled with the recorded mouse movement of this sim update.</param>
+		void PlayFrame(Vector &rawMouseMovement);
+#pragma endregion
+
+	private:
+
+		static constexpr std::array<char, 4> c_FileSignature = { 'C', 'C', 'I', 'R' }; //!< The first bytes of every recording, to tell recordings from other files.
+		static constexpr uint16_t c_FileVersion = 2; //!< The version of the recording format. Recordings of other versions can't be played back.
+		static constexpr int c_MaxJoystickCount = 4; //!< The number of joysticks whose input is recorded, one for each player.
+
+		/// <summary>
+		/// Enumeration for the parts of the input state that can have changed in a recorded sim update. Only the parts that changed are stored.
+		/// </summary>
+		enum FrameChangeFlags : uint8_t {
+			KeysChanged = 1 << 0,
+			MouseButtonsChanged = 1 << 1,
+			MouseMoved = 1 << 2,
+			MousePosChanged = 1 << 3,
+			MouseWheelChanged = 1 << 4,
+			JoysticksChanged = 1 << 5,
+			RecordingEnded = 1 << 7 //!< Not a sim update, but the end of the recording, followed by the state hash.
+		};
+
+		ReplayState m_State; //!< What this InputReplay is doing.
+		std::string m_RecordingFilePath; //!< The path of the file to record the next Activity to, or empty if it shouldn't be recorded.
+		std::string m_PlaybackFilePath; //!< The path of the recording to play back once the data is loaded, or empty if there is none.
+
+		std::ofstream m_RecordingStream; //!< The file being recorded to.
+		std::vector<char> m_FrameData; //!< The data of the sim update being recorded, or the whole recording being played back.
+		size_t m_ReadPosition; //!< The position in m_FrameData the next sim update is played back from.
+
+		unsigned int m_Seed; //!< The seed of the RNG of the recording being recorded or played back.
+		bool m_PlaybackSeeded; //!< Whether the Activity of the recording being played back was started and seeded already.
+		float m_SuspendedAITimeBudget; //!< The AI time budget from before recording or playing back, which is suspended because it goes by real time.
+		int m_FrameCount; //!< The number of sim updates recorded or played back so far.
+		uint64_t m_StateHash; //!< The hash of the state of the MovableObjects as the last recorded sim update began, or as the last sim update of the recording being played back began. See GetSimStateHash().
+
+		std::array<char, KEY_MAX> m_KeyStates; //!< The state of each key in the last recorded or played back sim update.
+		int m_MouseButtons; //!< The state of the mouse buttons in the last recorded or played back sim update.
+		int m_MouseX; //!< The horizontal position of the mouse in the last recorded or played back sim update.
+		int m_MouseY; //!< The vertical position of the mouse in the last recorded or played back sim update.
+		int m_MouseWheel; //!< The position of the mouse wheel in the last recorded or played back sim update.
+		std::vector<char> m_JoystickData; //!< The state of all the joysticks in the last recorded sim update, as it was stored.
+
+		/// <summary>
+		/// Writes a value to the data of the sim update being recorded.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		template <typename Type> void WriteValue(const Type &value) { m_FrameData.insert(m_FrameData.end(), reinterpret_cast<const char *>(&value), reinterpret_cast<const char *>(&value) + sizeof(Type)); }
+
+		/// <summary>
+		/// Writes a string to the data of the sim update being recorded, preceded by its length.
+		/// </summary>
+		/// <param name="value">The string to write.</param>
+		void WriteString(const std::string &value) { WriteValue(static_cast<uint16_t>(value.size())); m_FrameData.insert(m_FrameData.end(), value.begin(), value.end()); }
+
+		/// <summary>
+		/// Reads a value from the recording being played back.
+		/// </summary>
+		/// <param name="value">The value to read into.</param>
+		/// <returns>Whether the value was read, or the recording ran out.</returns>
+		template <typename Type> bool ReadValue(Type &value) {
+			if (m_ReadPosition + sizeof(Type) > m_FrameData.size()) {
+				return false;
+			}
+			std::memcpy(&value, m_FrameData.data() + m_ReadPosition, sizeof(Type));
+			m_ReadPosition += sizeof(Type);
+			return true;
+		}
+
+		/// <summary>
+		/// Reads a string preceded by its length from the recording being played back.
+		/// </summary>
+		/// <param name="value">The string to read into.</param>
+		/// <returns>Whether the string was read, or the recording ran out.</returns>
+		bool ReadString(std::string &value);
+
+		/// <summary>
+		/// Writes the setup of the Activity that is about to be started and of its players and teams to the data of the recording.
+		/// </summary>
+		/// <param name="startActivity">The Activity that is about to be started.</param>
+		void WriteHeader(const Activity &startActivity);
+
+		/// <summary>
+		/// Reads the setup of the recorded Activity and of its players and teams from the recording being played back and sets it up to be started.
+		/// </summary>
+		/// <returns>Whether the setup was read and the Activity set to be started.</returns>
+		bool ReadHeader();
+
+		/// <summary>
+		/// Gets the state of all the joysticks, as it's stored in a recording.
+		/// </summary>
+		/// <returns>The state of all the joysticks.</returns>
+		std::vector<char> GetJoystickData() const;
+
+		/// <summary>
+		/// Reads the state of all the joysticks from the recording being played back and puts it into effect.
+		/// </summary>
+		/// <returns>Whether the state was read, or the recording ran out.</returns>
+		bool ReadJoystickData();
+
+		/// <summary>
+		/// Gets a hash of the number of MovableObjects and of the position, velocity, rotation and angular velocity of each of them, which tells apart sim states that went different ways.
+		/// </summary>
+		/// <returns>The hash of the state of all MovableObjects.</returns>
+		static uint64_t GetSimStateHash();
+
+		/// <summary>
+		/// Reads the end of the recording being played back and tells whether the playback stayed in sync with it, then finishes the playback, prints the performance totals and quits.
+		/// </summary>
+		void FinishPlayback();
+
+		/// <summary>
+		/// Seeds the RNG of the main thread and of the master and worker Lua states with the seed of the recording, and suspends the AI time budget.
+		/// </summary>
+		void BeginReplay();
+
+		/// <summary>
+		/// Finishes the recording or playback in progress and restores the AI time budget.
+		/// </summary>
+		void EndReplay();
+
+		/// <summary>
+		/// Clears all the member variables of this InputReplay, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		InputReplay(const InputReplay &reference) = delete;
+		InputReplay & operator=(const InputReplay &rhs) = delete;
+	};
+}
+#endif
@@ -0,0 +1,338 @@
+#include "MappedBitmap.h"
+#include "ThreadMan.h"
+#include "Box.h"
+
+#ifdef _WIN32
+#include "winalleg.h"
+#elif __unix__
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace RTE {
+
+	std::unordered_map<const BITMAP *, std::unique_ptr<MappedBitmap>> MappedBitmap::s_MappedBitmaps;
+	long MappedBitmap::s_FrameNumber = 0;
+	std::vector<MappedBitmap::PageRange> MappedBitmap::s_PendingPrefetches;
+	std::future<void> MappedBitmap::s_PagingJobResult;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::Clear() {
+		m_Bitmap = nullptr;
+		m_MappedData = nullptr;
+		m_MappedSize = 0;
+		m_Pitch = 0;
+		m_TileWidth = 0;
+		m_TileColumns = 0;
+		m_TileRows = 0;
+		m_Tiles.clear();
+#ifdef _WIN32
+		m_FileHandle = nullptr;
+		m_MappingHandle = nullptr;
+#else
+		m_FileDescriptor = -1;
+#endif
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * MappedBitmap::Create(int width, int height, int colorDepth) {
+		if (width <= 0 || height <= 0) {
+			return nullptr;
+		}
+		std::unique_ptr<MappedBitmap> mappedBitmap(new MappedBitmap());
+		if (!mappedBitmap->CreateMapping(width, height, colorDepth)) {
+			return nullptr;
+		}
+		BITMAP *bitmap = mappedBitmap->m_Bitmap;
+		s_MappedBitmaps.try_emplace(bitmap, std::move(mappedBitmap));
+		return bitmap;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool MappedBitmap::CreateMapping(int width, int height, int colorDepth) {
+		// Borrow the drawing functions and bank switchers for this color depth from a regular memory bitmap. If the platform made anything other than a plain memory bitmap, a shell can't stand in for it.
+		BITMAP *bitmapTemplate = create_bitmap_ex(colorDepth, 1, 1);
+		if (!bitmapTemplate) {
+			return false;
+		}
+		bool templateUsable = bitmapTemplate->id == 0 && !bitmapTemplate->extra;
+		GFX_VTABLE *vtable = bitmapTemplate->vtable;
+		void *writeBank = bitmapTemplate->write_bank;
+		void *readBank = bitmapTemplate->read_bank;
+		int segment = bitmapTemplate->seg;
+		destroy_bitmap(bitmapTemplate);
+		if (!templateUsable) {
+			return false;
+		}
+
+		size_t pageSize = GetPageSize();
+		int bytesPerPixel = (colorDepth + 7) / 8;
+		m_Pitch = ((static_cast<size_t>(width) * bytesPerPixel + pageSize - 1) / pageSize) * pageSize;
+		m_MappedSize = m_Pitch * static_cast<size_t>(height);
+		m_TileWidth = static_cast<int>(pageSize) / bytesPerPixel;
+		m_TileColumns = static_cast<int>(m_Pitch / pageSize);
+		m_TileRows = (height + c_TileHeight - 1) / c_TileHeight;
+
+#ifdef _WIN32
+		wchar_t tempDirectory[MAX_PATH];
+		wchar_t filePath[MAX_PATH];
+		if (GetTempPathW(MAX_PATH, tempDirectory) == 0 || GetTempFileNameW(tempDirectory, L"RTE", 0, filePath) == 0) {
+			return false;
+		}
+		HANDLE fileHandle = CreateFileW(filePath, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE) {
+			DeleteFileW(filePath);
+			return false;
+		}
+		m_FileHandle = fileHandle;
+		unsigned long long mappedSize = m_MappedSize;
+		m_MappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappedSize >> 32), static_cast<DWORD>(mappedSize & 0xFFFFFFFF), nullptr);
+		if (!m_MappingHandle) {
+			return false;
+		}
+		m_MappedData = static_cast<unsigned char *>(MapViewOfFile(m_MappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, m_MappedSize));
+		if (!m_MappedData) {
+			return false;
+		}
+#else
+		std::string filePath = (std::filesystem::temp_directory_path() / "RTEMappedBitmapXXXXXX").string();
+		m_FileDescriptor = mkstemp(filePath.data());
+		if (m_FileDescriptor < 0) {
+			return false;
+		}
+		// The file only needs to exist as long as the descriptor is open, so unlink it right away so it can't be left behind.
+		unlink(filePath.c_str());
+		if (ftruncate(m_FileDescriptor, static_cast<off_t>(m_MappedSize)) != 0) {
+			return false;
+		}
+		void *mappedData = mmap(nullptr, m_MappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_FileDescriptor, 0);
+		if (mappedData == MAP_FAILED) {
+			return false;
+		}
+		m_MappedData = static_cast<unsigned char *>(mappedData);
+#endif
+
+		// Same layout create_bitmap_ex uses, including the minimum of two line pointers some of Allegro's blitters rely on.
+		int linePointerCount = std::max(2, height);
+		m_Bitmap = static_cast<BITMAP *>(std::malloc(sizeof(BITMAP) + sizeof(unsigned char *) * linePointerCount));
+		if (!m_Bitmap) {
+			return false;
+		}
+		m_Bitmap->w = m_Bitmap->cr = width;
+		m_Bitmap->h = m_Bitmap->cb = height;
+		m_Bitmap->clip = TRUE;
+		m_Bitmap->cl = m_Bitmap->ct = 0;
+		m_Bitmap->vtable = vtable;
+		m_Bitmap->write_bank = writeBank;
+		m_Bitmap->read_bank = readBank;
+		m_Bitmap->dat = nullptr;
+		m_Bitmap->id = 0;
+		m_Bitmap->extra = nullptr;
+		m_Bitmap->x_ofs = 0;
+		m_Bitmap->y_ofs = 0;
+		m_Bitmap->seg = segment;
+		for (int line = 0; line < linePointerCount; ++line) {
+			m_Bitmap->line[line] = m_MappedData + m_Pitch * static_cast<size_t>(std::min(line, height - 1));
+		}
+
+		m_Tiles.resize(static_cast<size_t>(m_TileColumns) * m_TileRows);
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	MappedBitmap::~MappedBitmap() {
+#ifdef _WIN32
+		if (m_MappedData) { UnmapViewOfFile(m_MappedData); }
+		if (m_MappingHandle) { CloseHandle(m_MappingHandle); }
+		if (m_FileHandle) { CloseHandle(m_FileHandle); }
+#else
+		if (m_MappedData) { munmap(m_MappedData, m_MappedSize); }
+		if (m_FileDescriptor >= 0) { close(m_FileDescriptor); }
+#endif
+		std::free(m_Bitmap);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool MappedBitmap::Destroy(BITMAP *bitmap) {
+		auto mappedBitmapEntry = s_MappedBitmaps.find(bitmap);
+		if (mappedBitmapEntry == s_MappedBitmaps.end()) {
+			return false;
+		}
+		// The paging job works on raw pointers into the mapping, so it has to be done before the mapping can go away.
+		WaitForPagingJob();
+		const MappedBitmap &mappedBitmap = *mappedBitmapEntry->second;
+		s_PendingPrefetches.erase(std::remove_if(s_PendingPrefetches.begin(), s_PendingPrefetches.end(), [&mappedBitmap](const PageRange &pageRange) {
+			return pageRange.Start >= mappedBitmap.m_MappedData && pageRange.Start < mappedBitmap.m_MappedData + mappedBitmap.m_MappedSize;
+		}), s_PendingPrefetches.end());
+		s_MappedBitmaps.erase(mappedBitmapEntry);
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	long long MappedBitmap::GetResidentSize() {
+		long long residentTileCount = 0;
+		for (const auto &[bitmap, mappedBitmap] : s_MappedBitmaps) {
+			residentTileCount += std::count_if(mappedBitmap->m_Tiles.begin(), mappedBitmap->m_Tiles.end(), [](const Tile &tile) { return tile.Resident; });
+		}
+		return residentTileCount * static_cast<long long>(GetPageSize()) * c_TileHeight;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::TouchArea(const BITMAP *bitmap, const Box &area, bool prefetch) {
+		auto mappedBitmapEntry = s_MappedBitmaps.find(bitmap);
+		if (mappedBitmapEntry == s_MappedBitmaps.end()) {
+			return;
+		}
+		MappedBitmap &mappedBitmap = *mappedBitmapEntry->second;
+
+		int firstColumn = static_cast<int>(std::floor(area.GetCorner().m_X / static_cast<float>(mappedBitmap.m_TileWidth)));
+		int lastColumn = static_cast<int>(std::floor((area.GetCorner().m_X + area.GetWidth() - 1.0F) / static_cast<float>(mappedBitmap.m_TileWidth)));
+		int firstRow = static_cast<int>(std::floor(area.GetCorner().m_Y / static_cast<float>(c_TileHeight)));
+		int lastRow = static_cast<int>(std::floor((area.GetCorner().m_Y + area.GetHeight() - 1.0F) / static_cast<float>(c_TileHeight)));
+		lastColumn = std::min(lastColumn, firstColumn + mappedBitmap.m_TileColumns - 1);
+		lastRow = std::min(lastRow, firstRow + mappedBitmap.m_TileRows - 1);
+
+		for (int row = firstRow; row <= lastRow; ++row) {
+			int wrappedRow = ((row % mappedBitmap.m_TileRows) + mappedBitmap.m_TileRows) % mappedBitmap.m_TileRows;
+			for (int column = firstColumn; column <= lastColumn; ++column) {
+				int wrappedColumn = ((column % mappedBitmap.m_TileColumns) + mappedBitmap.m_TileColumns) % mappedBitmap.m_TileColumns;
+				int tileIndex = wrappedRow * mappedBitmap.m_TileColumns + wrappedColumn;
+				Tile &tile = mappedBitmap.m_Tiles[tileIndex];
+				tile.LastTouched = s_FrameNumber;
+				if (!tile.Resident) {
+					tile.Resident = true;
+					if (prefetch) { mappedBitmap.AddTilePageRanges(tileIndex, s_PendingPrefetches); }
+				}
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::Update(long long residentBudget) {
+		if (s_MappedBitmaps.empty()) {
+			s_PendingPrefetches.clear();
+			return;
+		}
+		// If the last job is still busy with the disk, leave the pending prefetches for the next update rather than stalling the frame.
+		if (s_PagingJobResult.valid() && s_PagingJobResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+			++s_FrameNumber;
+			return;
+		}
+
+		std::vector<PageRange> pendingEvictions;
+		long long residentSize = GetResidentSize();
+		if (residentSize > residentBudget) {
+			// Tiles touched during the frame that just ended are never evicted, whatever the budget, since they're about to be drawn again.
+			std::vector<std::tuple<long, MappedBitmap *, int>> evictionCandidates;
+			for (const auto &[bitmap, mappedBitmap] : s_MappedBitmaps) {
+				for (int tileIndex = 0; tileIndex < static_cast<int>(mappedBitmap->m_Tiles.size()); ++tileIndex) {
+					const Tile &tile = mappedBitmap->m_Tiles[tileIndex];
+					if (tile.Resident && tile.LastTouched < s_FrameNumber) { evictionCandidates.emplace_back(tile.LastTouched, mappedBitmap.get(), tileIndex); }
+				}
+			}
+			std::sort(evictionCandidates.begin(), evictionCandidates.end(), [](const auto &candidate, const auto &otherCandidate) { return std::get<0>(candidate) < std::get<0>(otherCandidate); });
+
+			long long tileSize = static_cast<long long>(GetPageSize()) * c_TileHeight;
+			for (const auto &[lastTouched, mappedBitmap, tileIndex] : evictionCandidates) {
+				if (residentSize <= residentBudget) {
+					break;
+				}
+				mappedBitmap->m_Tiles[tileIndex].Resident = false;
+				mappedBitmap->AddTilePageRanges(tileIndex, pendingEvictions);
+				residentSize -= tileSize;
+			}
+		}
+
+		if (!s_PendingPrefetches.empty() || !pendingEvictions.empty()) {
+			s_PagingJobResult = g_ThreadMan.QueueJob([prefetches = std::move(s_PendingPrefetches), evictions = std::move(pendingEvictions)]() {
+				EvictPageRanges(evictions);
+				PrefetchPageRanges(prefetches);
+			});
+			s_PendingPrefetches.clear();
+		}
+		++s_FrameNumber;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::AddTilePageRanges(int tileIndex, std::vector<PageRange> &pageRanges) const {
+		size_t pageSize = GetPageSize();
+		int firstLine = (tileIndex / m_TileColumns) * c_TileHeight;
+		int lastLine = std::min(firstLine + c_TileHeight, m_Bitmap->h);
+		size_t columnOffset = static_cast<size_t>(tileIndex % m_TileColumns) * pageSize;
+
+		for (int line = firstLine; line < lastLine; ++line) {
+			unsigned char *rangeStart = m_MappedData + m_Pitch * static_cast<size_t>(line) + columnOffset;
+			// When the bitmap is a single tile wide its rows are back to back, so the whole tile collapses into one range.
+			if (!pageRanges.empty() && pageRanges.back().Start + pageRanges.back().Length == rangeStart) {
+				pageRanges.back().Length += pageSize;
+			} else {
+				pageRanges.push_back({ rangeStart, pageSize });
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::WaitForPagingJob() {
+		if (s_PagingJobResult.valid()) { s_PagingJobResult.get(); }
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::PrefetchPageRanges(const std::vector<PageRange> &pageRanges) {
+#ifdef _WIN32
+		// Reading a byte of each page faults it in on this worker instead of on the main thread when it's first drawn.
+		size_t pageSize = GetPageSize();
+		for (const PageRange &pageRange : pageRanges) {
+			for (size_t pageOffset = 0; pageOffset < pageRange.Length; pageOffset += pageSize) {
+				static_cast<void>(*reinterpret_cast<volatile unsigned char *>(pageRange.Start + pageOffset));
+			}
+		}
+#else
+		for (const PageRange &pageRange : pageRanges) {
+			madvise(pageRange.Start, pageRange.Length, MADV_WILLNEED);
+		}
+#endif
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedBitmap::EvictPageRanges(const std::vector<PageRange> &pageRanges) {
+		// Writing the pages back first turns them into clean file cache the OS can drop at no cost, instead of dirty memory it has to hold on to.
+		for (const PageRange &pageRange : pageRanges) {
+#ifdef _WIN32
+			FlushViewOfFile(pageRange.Start, pageRange.Length);
+			// Unlocking pages that aren't locked fails, but still removes them from the working set, which is all that's wanted here.
+			VirtualUnlock(pageRange.Start, pageRange.Length);
+#else
+			msync(pageRange.Start, pageRange.Length, MS_SYNC);
+			madvise(pageRange.Start, pageRange.Length, MADV_DONTNEED);
+#endif
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	size_t MappedBitmap::GetPageSize() {
+#ifdef _WIN32
+		static const size_t pageSize = []() {
+			SYSTEM_INFO systemInfo;
+			GetSystemInfo(&systemInfo);
+			return static_cast<size_t>(systemInfo.dwPageSize);
+		}();
+#else
+		static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		return pageSize;
+	}
+}
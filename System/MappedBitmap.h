@@ -0,0 +1,170 @@
+#ifndef _RTEMAPPEDBITMAP_
+#define _RTEMAPPEDBITMAP_
+
+struct BITMAP;
+
+namespace RTE {
+
+	class Box;
+
+	/// <summary>
+	/// A memory BITMAP whose pixel data lives in a memory-mapped temporary file instead of the heap, so the OS can page it in and out on demand.
+	/// The rows are padded to whole pages, which splits the bitmap into tiles of one page width by c_TileHeight rows. Tiles around the views are marked as touched and prefetched ahead of scrolling,
+	/// and tiles that haven't been touched for the longest are handed back to the OS whenever the touched tiles of all mapped bitmaps exceed the resident budget.
+	/// The BITMAP itself is a regular Allegro memory bitmap as far as all drawing and pixel access is concerned.
+	/// </summary>
+	class MappedBitmap {
+
+	public:
+
+		static constexpr int c_TileHeight = 64; //!< The height of each tile in rows.
+
+#pragma region Creation
+		/// <summary>
+		/// Creates a new memory-mapped BITMAP. The contents are zeroed.
+		/// </summary>
+		/// <param name="width">The width of the BITMAP in pixels.</param>
+		/// <param name="height">The height of the BITMAP in pixels.</param>
+		/// <param name="colorDepth">The color depth of the BITMAP.</param>
+		/// <returns>The created BITMAP, or nullptr if the mapping couldn't be created. Must be destroyed with Destroy, not destroy_bitmap.</returns>
+		static BITMAP * Create(int width, int height, int colorDepth);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a MappedBitmap object before deletion from system memory.
+		/// </summary>
+		~MappedBitmap();
+
+		/// <summary>
+		/// Destroys a memory-mapped BITMAP and its backing file.
+		/// </summary>
+		/// <param name="bitmap">The BITMAP to destroy.</param>
+		/// <returns>Whether the BITMAP was memory-mapped and has been destroyed. If false, the BITMAP wasn't touched and should be destroyed with destroy_bitmap.</returns>
+		static bool Destroy(BITMAP *bitmap);
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Tells whether a BITMAP was created through Create.
+		/// </summary>
+		/// <param name="bitmap">The BITMAP to check.</param>
+		/// <returns>Whether the BITMAP is memory-mapped.</returns>
+		static bool IsMapped(const BITMAP *bitmap) { return bitmap && s_MappedBitmaps.find(bitmap) != s_MappedBitmaps.end(); }
+
+		/// <summary>
+		/// Gets the total size of the tiles of all mapped BITMAPs that are currently considered resident.
+		/// </summary>
+		/// <returns>The resident size in bytes.</returns>
+		static long long GetResidentSize();
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Marks the tiles of a memory-mapped BITMAP that overlap an area as used this frame, optionally asking the OS to start paging them in. Coordinates wrap around the BITMAP edges. Does nothing if the BITMAP isn't memory-mapped.
+		/// </summary>
+		/// <param name="bitmap">The BITMAP the area is on.</param>
+		/// <param name="area">The area on the BITMAP, in pixels.</param>
+		/// <param name="prefetch">Whether the tiles are about to be used rather than already in use, and should be paged in ahead of time.</param>
+		static void TouchArea(const BITMAP *bitmap, const Box &area, bool prefetch);
+
+		/// <summary>
+		/// Issues the prefetches gathered since the last update and hands the least recently touched tiles back to the OS until the resident tiles fit into the budget. Both are done on a ThreadMan worker. Should be done once every drawn frame.
+		/// </summary>
+		/// <param name="residentBudget">The maximum total size of resident tiles, in bytes.</param>
+		static void Update(long long residentBudget);
+#pragma endregion
+
+	private:
+
+		/// <summary>
+		/// Bookkeeping for a single tile.
+		/// </summary>
+		struct Tile {
+			long LastTouched = 0; //!< The frame number the tile was last touched on.
+			bool Resident = false; //!< Whether the tile is considered paged in.
+		};
+
+		/// <summary>
+		/// A contiguous range of a mapping to prefetch or evict.
+		/// </summary>
+		struct PageRange {
+			unsigned char *Start; //!< The page aligned start of the range.
+			size_t Length; //!< The length of the range in bytes.
+		};
+
+		static std::unordered_map<const BITMAP *, std::unique_ptr<MappedBitmap>> s_MappedBitmaps; //!< All the currently existing memory-mapped BITMAPs.
+		static long s_FrameNumber; //!< The number of updates done so far, used to time stamp tile touches.
+		static std::vector<PageRange> s_PendingPrefetches; //!< The ranges to prefetch on the next update.
+		static std::future<void> s_PagingJobResult; //!< The future that becomes ready when the last queued prefetch and eviction job is done.
+
+		BITMAP *m_Bitmap; //!< The Allegro BITMAP shell whose line pointers point into the mapping.
+		unsigned char *m_MappedData; //!< The start of the mapping.
+		size_t m_MappedSize; //!< The size of the mapping in bytes.
+		size_t m_Pitch; //!< The distance between the starts of two rows in bytes. Always a whole number of pages.
+		int m_TileWidth; //!< The width of each tile in pixels.
+		int m_TileColumns; //!< The number of tile columns.
+		int m_TileRows; //!< The number of tile rows.
+		std::vector<Tile> m_Tiles; //!< The bookkeeping for all the tiles. Row-major.
+#ifdef _WIN32
+		void *m_FileHandle; //!< The handle of the backing file.
+		void *m_MappingHandle; //!< The handle of the file mapping object.
+#else
+		int m_FileDescriptor; //!< The file descriptor of the backing file.
+#endif
+
+		/// <summary>
+		/// Constructor method used to instantiate a MappedBitmap object in system memory. Create should be used instead.
+		/// </summary>
+		MappedBitmap() { Clear(); }
+
+		/// <summary>
+		/// Creates the backing file and mapping, and builds the BITMAP shell over them.
+		/// </summary>
+		/// <param name="width">The width of the BITMAP in pixels.</param>
+		/// <param name="height">The height of the BITMAP in pixels.</param>
+		/// <param name="colorDepth">The color depth of the BITMAP.</param>
+		/// <returns>Whether the BITMAP was created successfully.</returns>
+		bool CreateMapping(int width, int height, int colorDepth);
+
+		/// <summary>
+		/// Gets the page ranges one tile is made of, one per row of the tile.
+		/// </summary>
+		/// <param name="tileIndex">The index of the tile.</param>
+		/// <param name="pageRanges">The vector to add the page ranges to.</param>
+		void AddTilePageRanges(int tileIndex, std::vector<PageRange> &pageRanges) const;
+
+		/// <summary>
+		/// Waits for the last queued prefetch and eviction job to finish, if there is one.
+		/// </summary>
+		static void WaitForPagingJob();
+
+		/// <summary>
+		/// Asks the OS to start paging in a set of page ranges. Safe to run on a worker thread.
+		/// </summary>
+		/// <param name="pageRanges">The ranges to page in.</param>
+		static void PrefetchPageRanges(const std::vector<PageRange> &pageRanges);
+
+		/// <summary>
+		/// Writes back a set of page ranges to their backing files and asks the OS to drop them from memory. Safe to run on a worker thread.
+		/// </summary>
+		/// <param name="pageRanges">The ranges to evict.</param>
+		static void EvictPageRanges(const std::vector<PageRange> &pageRanges);
+
+		/// <summary>
+		/// Gets the size of a memory page on this system.
+		/// </summary>
+		/// <returns>The page size in bytes.</returns>
+		static size_t GetPageSize();
+
+		/// <summary>
+		/// Clears all the member variables of this MappedBitmap, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		MappedBitmap(const MappedBitmap &reference) = delete;
+		MappedBitmap & operator=(const MappedBitmap &rhs) = delete;
+	};
+}
+#endif
@@ -0,0 +1,190 @@
+#include "Profiler.h"
+#include "ConsoleMan.h"
+
+namespace RTE {
+
+	std::atomic<bool> Profiler::s_Capturing = false;
+	std::chrono::steady_clock::time_point Profiler::s_CaptureStartTime;
+	std::string Profiler::s_CaptureFilePath;
+
+	std::mutex Profiler::s_ThreadBuffersMutex;
+	std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::s_ThreadBuffers;
+	thread_local Profiler::ThreadBuffer *Profiler::s_ThreadBuffer = nullptr;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void Profiler::SetThreadName(const std::string &threadName) {
+		ThreadBuffer &threadBuffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> eventsLock(threadBuffer.EventsMutex);
+		threadBuffer.ThreadName = threadName;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void Profiler::StartCapture(const std::string &filePath) {
+		s_Capturing.store(false, std::memory_order_release);
+		{
+			std::lock_guard<std::mutex> threadBuffersLock(s_ThreadBuffersMutex);
+			for (const std::unique_ptr<ThreadBuffer> &threadBuffer : s_ThreadBuffers) {
+				std::lock_guard<std::mutex> eventsLock(threadBuffer->EventsMutex);
+				threadBuffer->Events.clear();
+				threadBuffer->DroppedEventCount = 0;
+			}
+		}
+		s_CaptureFilePath = filePath;
+		s_CaptureStartTime = std::chrono::steady_clock::now();
+		s_Capturing.store(true, std::memory_order_release);
+		g_ConsoleMan.PrintString("SYSTEM: Started capturing profiler trace");
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool Profiler::StopCapture() {
+		if (!IsCapturing()) {
+			return false;
+		}
+		s_Capturing.store(false, std::memory_order_release);
+
+		std::ofstream traceStream(s_CaptureFilePath);
+		if (!traceStream.is_open()) {
+			g_ConsoleMan.PrintString("ERROR: Failed to create profiler trace \"" + s_CaptureFilePath + "\"!");
+			return false;
+		}
+		size_t eventCount = 0;
+		size_t droppedEventCount = 0;
+		char timeString[64];
+
+		// Complete events ("ph":"X") carry their own duration, so nesting is worked out by the viewer from the times alone and the events can be written in any order.
+		traceStream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool firstEvent = true;
+		std::lock_guard<std::mutex> threadBuffersLock(s_ThreadBuffersMutex);
+		for (const std::unique_ptr<ThreadBuffer> &threadBuffer : s_ThreadBuffers) {
+			std::vector<ProfileEvent> events;
+			std::string threadName;
+			{
+				std::lock_guard<std::mutex> eventsLock(threadBuffer->EventsMutex);
+				events.swap(threadBuffer->Events);
+				threadName = threadBuffer->ThreadName.empty() ? "Thread " + std::to_string(threadBuffer->ThreadID) : threadBuffer->ThreadName;
+				droppedEventCount += threadBuffer->DroppedEventCount;
+				threadBuffer->DroppedEventCount = 0;
+			}
+			traceStream << (firstEvent ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadBuffer->ThreadID << ",\"args\":{\"name\":";
+			WriteJSONString(traceStream, threadName);
+			traceStream << "}}";
+			firstEvent = false;
+
+			for (const ProfileEvent &profileEvent : events) {
+				traceStream << ",\n{\"name\":";
+				WriteJSONString(traceStream, profileEvent.Name ? std::string_view(profileEvent.Name) : std::string_view(profileEvent.DynamicName));
+				std::snprintf(timeString, sizeof(timeString), ",\"ts\":%.3f,\"dur\":%.3f", static_cast<double>(profileEvent.StartTime) / 1000.0, static_cast<double>(profileEvent.Duration) / 1000.0);
+				traceStream << ",\"ph\":\"X\"" << timeString << ",\"pid\":1,\"tid\":" << threadBuffer->ThreadID;
+				if (!profileEvent.Source.empty()) {
+					traceStream << ",\"args\":{\"source\":";
+					WriteJSONString(traceStream, profileEvent.Source);
+					traceStream << "}";
+				}
+				traceStream << "}";
+			}
+			eventCount += events.size();
+		}
+		traceStream << "\n]}\n";
+		traceStream.close();
+
+		char outputString[512];
+		std::snprintf(outputString, sizeof(outputString), "SYSTEM: Profiler trace with %zu zones saved to \"%s\"%s", eventCount, s_CaptureFilePath.c_str(), (droppedEventCount > 0) ? ", some zones were dropped because the capture ran too long" : "");
+		g_ConsoleMan.PrintString(outputString);
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Profiler::ThreadBuffer & Profiler::GetThreadBuffer() {
+		if (!s_ThreadBuffer) {
+			std::lock_guard<std::mutex> threadBuffersLock(s_ThreadBuffersMutex);
+			s_ThreadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+			s_ThreadBuffer = s_ThreadBuffers.back().get();
+			s_ThreadBuffer->ThreadID = static_cast<int>(s_ThreadBuffers.size());
+		}
+		return *s_ThreadBuffer;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void Profiler::RecordEvent(ProfileEvent &&profileEvent) {
+		ThreadBuffer &threadBuffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> eventsLock(threadBuffer.EventsMutex);
+		if (threadBuffer.Events.size() < c_MaxEventsPerThread) {
+			threadBuffer.Events.emplace_back(std::move(profileEvent));
+		} else {
+			threadBuffer.DroppedEventCount++;
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void Profiler::WriteJSONString(std::ostream &stream, const std::string_view &value) {
+		stream << '"';
+		for (char character : value) {
+			switch (character) {
+				case '"':
+					stream << "\\\"";
+					break;
+				case '\\':
+					stream << "\\\\";
+					break;
+				case '\n':
+					stream << "\\n";
+					break;
+				case '\t':
+					stream << "\\t";
+					break;
+				default:
+					if (static_cast<unsigned char>(character) < 0x20) {
+						char escapedCharacter[8];
+						std::snprintf(escapedCharacter, sizeof(escapedCharacter), "\\u%04x", static_cast<unsigned int>(character));
+						stream << escapedCharacter;
+					} else {
+						stream << character;
+					}
+					break;
+			}
+		}
+		stream << '"';
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	ProfileZone::ProfileZone(const char *name, const std::string &source) : m_Name(name), m_StartTime(-1) {
+		if (Profiler::IsCapturing()) {
+			m_Source = source;
+			m_StartTime = Profiler::GetCaptureTime();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	ProfileZone::ProfileZone(const std::string &name, const std::string &source) : m_Name(nullptr), m_StartTime(-1) {
+		if (Profiler::IsCapturing()) {
+			m_DynamicName = name;
+			m_Source = source;
+			m_StartTime = Profiler::GetCaptureTime();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	ProfileZone::ProfileZone(const std::string &namePrefix, const char *nameSuffix, const std::string &source) : m_Name(nullptr), m_StartTime(-1) {
+		if (Profiler::IsCapturing()) {
+			m_DynamicName = namePrefix + nameSuffix;
+			m_Source = source;
+			m_StartTime = Profiler::GetCaptureTime();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ProfileZone::End() {
+		// Zones that were still going when the capture was stopped are dropped, they'd only be cut off anyway.
+		if (Profiler::IsCapturing()) { Profiler::RecordEvent({ m_Name, std::move(m_DynamicName), std::move(m_Source), m_StartTime, Profiler::GetCaptureTime() - m_StartTime }); }
+	}
+}
@@ -0,0 +1,166 @@
+#ifndef _RTEPROFILER_
+#define _RTEPROFILER_
+
+namespace RTE {
+
+	/// <summary>
+	/// Captures how long named zones of code take on every thread, and writes them to a trace file that can be opened in Chrome's about:tracing or in Perfetto.
+	/// Zones are marked with ProfileZone objects, which are timed from their creation to their destruction. Zones that are created while another is alive on the same thread show up nested in it.
+	/// Each thread records into its own buffer, so threads don't wait on each other. While no capture is running, a ProfileZone does nothing but check a flag.
+	/// </summary>
+	class Profiler {
+
+	public:
+
+#pragma region Getters and Setters
+		/// <summary>
+		/// Gets whether a capture is running.
+		/// </summary>
+		/// <returns>Whether a capture is running.</returns>
+		static bool IsCapturing() { return s_Capturing.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// Sets the name the calling thread is shown with in the trace. Should be done when the thread starts.
+		/// </summary>
+		/// <param name="threadName">The name of the calling thread.</param>
+		static void SetThreadName(const std::string &threadName);
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Throws away whatever was captured before and starts capturing.
+		/// </summary>
+		/// <param name="filePath">The path of the trace file to write when the capture is stopped.</param>
+		static void StartCapture(const std::string &filePath);
+
+		/// <summary>
+		/// Stops capturing and writes everything that was captured to the trace file.
+		/// </summary>
+		/// <returns>Whether the trace file was written.</returns>
+		static bool StopCapture();
+#pragma endregion
+
+	private:
+
+		friend class ProfileZone;
+
+		static constexpr size_t c_MaxEventsPerThread = 1 << 21; //!< The number of zones each thread can capture before the rest are dropped, to keep a forgotten capture from eating up all the memory.
+
+		/// <summary>
+		/// A captured zone.
+		/// </summary>
+		struct ProfileEvent {
+			const char *Name; //!< The name of the zone, if it has a static one. Not owned.
+			std::string DynamicName; //!< The name of the zone, if it was made up at runtime.
+			std::string Source; //!< Where the code of the zone came from, like the path of a script, if it was given.
+			long long StartTime; //!< When the zone started, in nanoseconds since the capture was started.
+			long long Duration; //!< How long the zone took, in nanoseconds.
+		};
+
+		/// <summary>
+		/// The captured zones of a single thread.
+		/// </summary>
+		struct ThreadBuffer {
+			int ThreadID = 0; //!< The ID of the thread in the trace, in the order the threads first recorded anything.
+			std::string ThreadName; //!< The name of the thread in the trace.
+			std::mutex EventsMutex; //!< Mutex so the zones can be written out while the thread may still be recording. The thread is the only other one to take it, so it's never contended during a capture.
+			std::vector<ProfileEvent> Events; //!< The zones the thread captured.
+			size_t DroppedEventCount = 0; //!< The number of zones that were dropped because the buffer was full.
+		};
+
+		static std::atomic<bool> s_Capturing; //!< Whether a capture is running.
+		static std::chrono::steady_clock::time_point s_CaptureStartTime; //!< When the running capture was started.
+		static std::string s_CaptureFilePath; //!< The path of the trace file to write when the running capture is stopped.
+
+		static std::mutex s_ThreadBuffersMutex; //!< Mutex for safely registering the buffers of new threads.
+		static std::vector<std::unique_ptr<ThreadBuffer>> s_ThreadBuffers; //!< The buffers of all the threads that ever recorded anything. They're kept even after their threads are gone so nothing that was captured is lost.
+		static thread_local ThreadBuffer *s_ThreadBuffer; //!< The buffer of the calling thread, or nullptr if it hasn't recorded anything yet.
+
+		/// <summary>
+		/// Gets the buffer of the calling thread, registering a new one if it has none yet.
+		/// </summary>
+		/// <returns>The buffer of the calling thread.</returns>
+		static ThreadBuffer & GetThreadBuffer();
+
+		/// <summary>
+		/// Gets how much time has passed since the running capture was started.
+		/// </summary>
+		/// <returns>The time since the capture was started, in nanoseconds.</returns>
+		static long long GetCaptureTime() { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_CaptureStartTime).count(); }
+
+		/// <summary>
+		/// Adds a finished zone to the buffer of the calling thread.
+		/// </summary>
+		/// <param name="profileEvent">The finished zone.</param>
+		static void RecordEvent(ProfileEvent &&profileEvent);
+
+		/// <summary>
+		/// Writes a string to a stream as a JSON string, with quotes and escapes.
+		/// </summary>
+		/// <param name="stream">The stream to write to.</param>
+		/// <param name="value">The string to write.</param>
+		static void WriteJSONString(std::ostream &stream, const std::string_view &value);
+	};
+
+	/// <summary>
+	/// A named zone of code that is timed by the Profiler from the creation of this to its destruction.
+	/// </summary>
+	class ProfileZone {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to start a zone with a static name.
+		/// </summary>
+		/// <param name="name">The name of the zone. Has to outlive the capture, so should be a string literal.</param>
+		explicit ProfileZone(const char *name) : m_Name(name), m_StartTime(Profiler::IsCapturing() ? Profiler::GetCaptureTime() : -1) {}
+
+		/// <summary>
+		/// Constructor method used to start a zone with a static name and a source made up at runtime. The source is only copied while a capture is running.
+		/// </summary>
+		/// <param name="name">The name of the zone. Has to outlive the capture, so should be a string literal.</param>
+		/// <param name="source">Where the code of the zone came from, like the path of a script.</param>
+		ProfileZone(const char *name, const std::string &source);
+
+		/// <summary>
+		/// Constructor method used to start a zone with a name made up at runtime, like the name of a script function. The strings are only copied while a capture is running.
+		/// </summary>
+		/// <param name="name">The name of the zone.</param>
+		/// <param name="source">Where the code of the zone came from, like the path of a script.</param>
+		ProfileZone(const std::string &name, const std::string &source);
+
+		/// <summary>
+		/// Constructor method used to start a zone with a name made up at runtime from two parts, like a script's class name and the function being run. The name is only put together while a capture is running.
+		/// </summary>
+		/// <param name="namePrefix">The first part of the name of the zone.</param>
+		/// <param name="nameSuffix">The second part of the name of the zone.</param>
+		/// <param name="source">Where the code of the zone came from, like the path of a script.</param>
+		ProfileZone(const std::string &namePrefix, const char *nameSuffix, const std::string &source);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to end the zone and hand it to the Profiler.
+		/// </summary>
+		~ProfileZone() { if (m_StartTime >= 0) { End(); } }
+#pragma endregion
+
+	private:
+
+		const char *m_Name; //!< The static name of the zone, or nullptr if it has a dynamic one. Not owned.
+		std::string m_DynamicName; //!< The dynamic name of the zone, if it has one.
+		std::string m_Source; //!< Where the code of the zone came from, if it was given.
+		long long m_StartTime; //!< When the zone started, in nanoseconds since the capture was started, or -1 if no capture was running.
+
+		/// <summary>
+		/// Ends the zone and hands it to the Profiler.
+		/// </summary>
+		void End();
+
+		// Disallow the use of some implicit methods.
+		ProfileZone(const ProfileZone &reference) = delete;
+		ProfileZone & operator=(const ProfileZone &rhs) = delete;
+	};
+}
+#endif
@@ -3,7 +3,8 @@
 
 namespace RTE {
 
-	std::mt19937 g_RNG;
+	thread_local std::mt19937 g_RNG;
+	std::mt19937 g_DrawRNG(std::random_device{}());
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
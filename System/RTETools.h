@@ -10,7 +10,8 @@ namespace RTE {
 
 	class Vector;
 
-	extern std::mt19937 g_RNG; //!< The random number generator used for all random functions.
+	extern thread_local std::mt19937 g_RNG; //!< The random number generator used for all random functions. Each thread has its own so worker threads don't race on it, and should be seeded from the main thread's.
+	extern std::mt19937 g_DrawRNG; //!< The random number generator the random functions use while drawing, seeded separately so how many frames get drawn doesn't change the numbers the sim gets.
 
 #pragma region Physics Constants Getters
 	/// <summary>
@@ -50,6 +51,30 @@ namespace RTE {
 	/// <param name="seed">Seed for the random number generator.</param>
 	inline void SeedRNG(unsigned int seed) { g_RNG.seed(seed); }
 
+	/// <summary>
+	/// Makes the random functions use g_DrawRNG instead of g_RNG for as long as it exists. Drawing has to go through one of these, because frames are drawn as often as the frame rate allows while the sim updates at a fixed rate, and input playback doesn't draw at all.
+	/// </summary>
+	class DrawRNGScope {
+
+	public:
+
+		/// <summary>
+		/// Constructor method used to instantiate a DrawRNGScope object in system memory and hand the random functions over to g_DrawRNG.
+		/// </summary>
+		DrawRNGScope() { std::swap(g_RNG, g_DrawRNG); }
+
+		/// <summary>
+		/// Destructor method used to hand the random functions back to g_RNG.
+		/// </summary>
+		~DrawRNGScope() { std::swap(g_RNG, g_DrawRNG); }
+
+	private:
+
+		// Disallow the use of some implicit methods.
+		DrawRNGScope(const DrawRNGScope &reference) = delete;
+		DrawRNGScope & operator=(const DrawRNGScope &rhs) = delete;
+	};
+
 	/// <summary>
 	/// Function template which returns a uniformly distributed random number in the range [-1, 1].
 	/// </summary>
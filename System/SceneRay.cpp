@@ -0,0 +1,55 @@
+#include "SceneRay.h"
+#include "SceneLayer.h"
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	SceneRay::SceneRay(const Vector &start, const Vector &ray, int skip) {
+		m_Pos[X] = static_cast<int>(std::floor(start.m_X));
+		m_Pos[Y] = static_cast<int>(std::floor(start.m_Y));
+		m_Delta[X] = static_cast<int>(std::floor(start.m_X + ray.m_X) - m_Pos[X]);
+		m_Delta[Y] = static_cast<int>(std::floor(start.m_Y + ray.m_Y) - m_Pos[Y]);
+
+		for (int axis = X; axis <= Y; ++axis) {
+			m_Increment[axis] = (m_Delta[axis] < 0) ? -1 : 1;
+			m_Delta[axis] = std::abs(m_Delta[axis]);
+			m_Delta2[axis] = m_Delta[axis] << 1;
+		}
+		// If X is dominant, Y is submissive, and vice versa.
+		m_Dom = (m_Delta[X] > m_Delta[Y]) ? X : Y;
+		m_Sub = (m_Dom == X) ? Y : X;
+		m_Error = m_Delta2[m_Sub] - m_Delta[m_Dom];
+
+		m_Skip = skip;
+		m_CompletedSteps = 0;
+		m_RayCastVisualizationLayer = (g_SceneMan.m_pDebugLayer && g_SceneMan.m_DrawRayCastVisualizations) ? g_SceneMan.m_pDebugLayer : nullptr;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool SceneRay::MarchToMaterial(const SceneSamplerBase &layers, bool wrap, unsigned char material, bool stopAtMaterial) {
+		// Only horizontal rays that check every pixel run along a single contiguous stretch of a row of the material layer.
+		if (m_Delta[Y] != 0 || m_Skip > 0 || m_RayCastVisualizationLayer) {
+			return March(layers, wrap, [material, stopAtMaterial](const auto &sceneSampler, int posX, int posY) { return (sceneSampler.GetTerrMatter(posX, posY) == material) == stopAtMaterial; }, [](int, int) {});
+		}
+		return SceneSamplerBase::Visit(layers, [&](auto sceneSampler) {
+			const int pixelCount = m_Delta[X];
+			const int increment = m_Increment[X];
+			int hitIndex = sceneSampler.FindTerrMatterInRow(m_Pos[Y], m_Pos[X] + increment, pixelCount, increment, material, stopAtMaterial);
+			bool hit = hitIndex < pixelCount;
+
+			m_CompletedSteps = hit ? hitIndex : pixelCount;
+			m_Pos[X] += increment * (hit ? hitIndex + 1 : pixelCount);
+			// Wrapping every checked pixel along the way ends up in the same place as wrapping the last one.
+			if (wrap) { sceneSampler.WrapPosition(m_Pos[X], m_Pos[Y]); }
+			return hit;
+		});
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void SceneRay::VisualizeRayCastPixel(int pixelX, int pixelY) const {
+		m_RayCastVisualizationLayer->SetPixel(pixelX, pixelY, 13);
+	}
+}
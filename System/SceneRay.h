@@ -0,0 +1,176 @@
+#ifndef _RTESCENERAY_
+#define _RTESCENERAY_
+
+#include "SceneSampler.h"
+
+namespace RTE {
+
+	class SceneLayer;
+
+	/// <summary>
+	/// Steps along a ray through the Scene one pixel at a time with Bresenham's line algorithm, the way all of SceneMan's ray casts do, and stops at the first checked pixel a hit predicate accepts.
+	/// Every skip + 1th pixel is checked, as is the last one. Checked pixels are wrapped first if asked to, and drawn to the Scene debug layer if ray casts are being visualized.
+	/// The hit predicate is a template parameter, so it gets inlined into the stepping loop of every ray cast that uses it. A SceneRay can only be marched once.
+	/// </summary>
+	class SceneRay {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a SceneRay object in system memory.
+		/// </summary>
+		/// <param name="start">The position to start the ray from. The start pixel itself is never checked.</param>
+		/// <param name="ray">The vector to trace along.</param>
+		/// <param name="skip">How many pixels to skip between checked pixels. 0 means every pixel is checked.</param>
+		SceneRay(const Vector &start, const Vector &ray, int skip);
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets whether the ray starts and ends on the same pixel, in which case there is nothing to march along.
+		/// </summary>
+		/// <returns>Whether the ray is empty.</returns>
+		bool IsEmpty() const { return m_Delta[X] == 0 && m_Delta[Y] == 0; }
+
+		/// <summary>
+		/// Gets the X coordinate of the pixel the ray stopped at, or of the last pixel of the ray if nothing was hit.
+		/// </summary>
+		/// <returns>The X coordinate of the pixel the ray stopped at.</returns>
+		int GetPosX() const { return m_Pos[X]; }
+
+		/// <summary>
+		/// Gets the Y coordinate of the pixel the ray stopped at, or of the last pixel of the ray if nothing was hit.
+		/// </summary>
+		/// <returns>The Y coordinate of the pixel the ray stopped at.</returns>
+		int GetPosY() const { return m_Pos[Y]; }
+
+		/// <summary>
+		/// Gets the number of pixels the ray went past, not counting the one it stopped at. 0 means the first pixel after the start was hit.
+		/// </summary>
+		/// <returns>The number of pixels the ray went past.</returns>
+		int GetCompletedSteps() const { return m_CompletedSteps; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Marches along the ray until the hit predicate accepts a checked pixel or the ray runs out.
+		/// The hit predicate should be a generic lambda taking the SceneSampler of the current Scene and the coordinates of the checked pixel, and return whether the ray should stop there.
+		/// </summary>
+		/// <param name="wrap">Whether checked pixels are wrapped before they're handed to the hit predicate.</param>
+		/// <param name="hitPredicate">The function that decides whether the ray stops at a checked pixel.</param>
+		/// <returns>Whether the hit predicate accepted a pixel.</returns>
+		template <typename HitPredicate> bool March(bool wrap, HitPredicate &&hitPredicate) { return March(wrap, hitPredicate, [](int, int) {}); }
+
+		/// <summary>
+		/// Marches along the ray until the hit predicate accepts a checked pixel or the ray runs out, letting another function know about every pixel that was skipped.
+		/// The hit predicate should be a generic lambda taking the SceneSampler of the current Scene and the coordinates of the checked pixel, and return whether the ray should stop there.
+		/// </summary>
+		/// <param name="wrap">Whether checked pixels are wrapped before they're handed to the hit predicate.</param>
+		/// <param name="hitPredicate">The function that decides whether the ray stops at a checked pixel.</param>
+		/// <param name="skippedPixelFunction">The function that is called with the unwrapped coordinates of every pixel that isn't checked.</param>
+		/// <returns>Whether the hit predicate accepted a pixel.</returns>
+		template <typename HitPredicate, typename SkippedPixelFunction> bool March(bool wrap, HitPredicate &&hitPredicate, SkippedPixelFunction &&skippedPixelFunction) { return March(SceneSamplerBase(), wrap, hitPredicate, skippedPixelFunction); }
+
+		/// <summary>
+		/// Marches along the ray through a set of layers instead of the current Scene. See March.
+		/// </summary>
+		/// <param name="layers">The layers to march through.</param>
+		/// <param name="wrap">Whether checked pixels are wrapped before they're handed to the hit predicate.</param>
+		/// <param name="hitPredicate">The function that decides whether the ray stops at a checked pixel.</param>
+		/// <param name="skippedPixelFunction">The function that is called with the unwrapped coordinates of every pixel that isn't checked.</param>
+		/// <returns>Whether the hit predicate accepted a pixel.</returns>
+		template <typename HitPredicate, typename SkippedPixelFunction> bool March(const SceneSamplerBase &layers, bool wrap, HitPredicate &&hitPredicate, SkippedPixelFunction &&skippedPixelFunction);
+
+		/// <summary>
+		/// Marches along the ray until a checked pixel of the terrain is, or isn't, of a specific material. Same as March with a predicate comparing the terrain material,
+		/// but horizontal rays that check every pixel are scanned a whole span of the material layer at a time instead of stepping pixel by pixel.
+		/// </summary>
+		/// <param name="wrap">Whether checked pixels are wrapped.</param>
+		/// <param name="material">The material index to compare the terrain with.</param>
+		/// <param name="stopAtMaterial">Whether the ray stops at the first pixel of the material, or at the first pixel of any other material.</param>
+		/// <returns>Whether the ray stopped at a pixel.</returns>
+		bool MarchToMaterial(bool wrap, unsigned char material, bool stopAtMaterial) { return MarchToMaterial(SceneSamplerBase(), wrap, material, stopAtMaterial); }
+
+		/// <summary>
+		/// Marches along the ray through a set of layers instead of the current Scene until a checked pixel of the material layer is, or isn't, of a specific material. See MarchToMaterial.
+		/// </summary>
+		/// <param name="layers">The layers to march through.</param>
+		/// <param name="wrap">Whether checked pixels are wrapped.</param>
+		/// <param name="material">The material index to compare the material layer with.</param>
+		/// <param name="stopAtMaterial">Whether the ray stops at the first pixel of the material, or at the first pixel of any other material.</param>
+		/// <returns>Whether the ray stopped at a pixel.</returns>
+		bool MarchToMaterial(const SceneSamplerBase &layers, bool wrap, unsigned char material, bool stopAtMaterial);
+#pragma endregion
+
+	private:
+
+		int m_Pos[2]; //!< The pixel the ray is at.
+		int m_Delta[2]; //!< The length of the ray along each axis, in pixels.
+		int m_Delta2[2]; //!< The length of the ray along each axis, scaled by 2 for better accuracy of the error at the first pixel.
+		int m_Increment[2]; //!< The direction the ray steps in along each axis.
+		int m_Dom; //!< The dominant axis of the ray, which it steps along every pixel.
+		int m_Sub; //!< The submissive axis of the ray, which it only steps along when the error says so.
+		int m_Error; //!< The error of Bresenham's algorithm.
+		int m_Skip; //!< How many pixels are skipped between checked pixels.
+		int m_CompletedSteps; //!< The number of pixels the ray went past.
+
+		SceneLayer *m_RayCastVisualizationLayer; //!< The SceneLayer checked pixels are drawn to, if ray casts are being visualized.
+
+		/// <summary>
+		/// Marks a checked pixel on the ray cast visualization layer.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the checked pixel.</param>
+		/// <param name="pixelY">The Y coordinate of the checked pixel.</param>
+		void VisualizeRayCastPixel(int pixelX, int pixelY) const;
+
+		// Disallow the use of some implicit methods.
+		SceneRay(const SceneRay &reference) = delete;
+		SceneRay & operator=(const SceneRay &rhs) = delete;
+	};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <typename HitPredicate, typename SkippedPixelFunction>
+	bool SceneRay::March(const SceneSamplerBase &layers, bool wrap, HitPredicate &&hitPredicate, SkippedPixelFunction &&skippedPixelFunction) {
+		return SceneSamplerBase::Visit(layers, [&](auto sceneSampler) {
+			// Work on copies so they can stay in registers while the predicate calls out to other code.
+			int pos[2] = { m_Pos[X], m_Pos[Y] };
+			int error = m_Error;
+			const int dom = m_Dom;
+			const int sub = m_Sub;
+			const int domSteps = m_Delta[dom];
+			int skipped = m_Skip;
+			bool hit = false;
+
+			int step = 0;
+			for (; step < domSteps; ++step) {
+				pos[dom] += m_Increment[dom];
+				if (error >= 0) {
+					pos[sub] += m_Increment[sub];
+					error -= m_Delta2[dom];
+				}
+				error += m_Delta2[sub];
+
+				// Only check pixel if we're not due to skip any, or if this is the last pixel
+				if (++skipped > m_Skip || step + 1 == domSteps) {
+					if (wrap) { sceneSampler.WrapPosition(pos[X], pos[Y]); }
+					if (hitPredicate(sceneSampler, pos[X], pos[Y])) {
+						hit = true;
+						break;
+					}
+					skipped = 0;
+					if (m_RayCastVisualizationLayer) { VisualizeRayCastPixel(pos[X], pos[Y]); }
+				} else {
+					skippedPixelFunction(pos[X], pos[Y]);
+				}
+			}
+			m_Pos[X] = pos[X];
+			m_Pos[Y] = pos[Y];
+			m_Error = error;
+			m_CompletedSteps = step;
+			return hit;
+		});
+	}
+}
+#endif
@@ -0,0 +1,111 @@
+#include "SceneSampler.h"
+#include "SettingsMan.h"
+#include "MovableMan.h"
+#include "MOSprite.h"
+#include "Scene.h"
+#include "SceneLayer.h"
+#include "SLTerrain.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RTE_MATTER_SCAN_SSE2
+#endif
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	SceneSamplerBase::SceneSamplerBase() {
+		RTEAssert(g_SceneMan.m_pCurrentScene, "Trying to sample the scene before there is one!");
+
+		SLTerrain *terrain = g_SceneMan.m_pCurrentScene->GetTerrain();
+		m_WrapsX = terrain->WrapsX();
+		m_WrapsY = terrain->WrapsY();
+
+		const BITMAP *materialBitmap = terrain->GetMaterialBitmap();
+		m_MaterialRows = materialBitmap->line;
+		m_MaterialWidth = materialBitmap->w;
+		m_MaterialHeight = materialBitmap->h;
+
+		const BITMAP *moidBitmap = g_SceneMan.m_pMOIDLayer ? g_SceneMan.m_pMOIDLayer->GetBitmap() : nullptr;
+		m_MOIDRows = moidBitmap ? moidBitmap->line : nullptr;
+		m_MOIDWidth = moidBitmap ? moidBitmap->w : 0;
+		m_MOIDHeight = moidBitmap ? moidBitmap->h : 0;
+
+		m_PixelCheckVisualizationLayer = g_SceneMan.m_DrawPixelCheckVisualizations ? g_SceneMan.m_pDebugLayer : nullptr;
+		m_SimplifiedCollisionDetection = g_SettingsMan.SimplifiedCollisionDetection();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	SceneSamplerBase::SceneSamplerBase(const unsigned char * const *materialRows, int materialWidth, int materialHeight, bool wrapsX, bool wrapsY) {
+		m_WrapsX = wrapsX;
+		m_WrapsY = wrapsY;
+
+		m_MaterialRows = materialRows;
+		m_MaterialWidth = materialWidth;
+		m_MaterialHeight = materialHeight;
+
+		m_MOIDRows = nullptr;
+		m_MOIDWidth = 0;
+		m_MOIDHeight = 0;
+
+		m_PixelCheckVisualizationLayer = nullptr;
+		m_SimplifiedCollisionDetection = false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void SceneSamplerBase::VisualizePixelCheck(int pixelX, int pixelY) const {
+		m_PixelCheckVisualizationLayer->SetPixel(pixelX, pixelY, 5);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	MOID SceneSamplerBase::GetSimplifiedCollisionMOID(MOID moid) {
+		if (moid != g_NoMOID && moid != g_MOIDMaskColor) {
+			const MOSprite *mo = dynamic_cast<MOSprite *>(g_MovableMan.GetMOFromID(moid));
+			return (mo && !mo->GetTraveling()) ? moid : g_NoMOID;
+		}
+		return g_NoMOID;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int SceneSamplerBase::FindMatterInSpan(const unsigned char *row, int firstX, int spanLength, int increment, unsigned char material, bool findMaterial) {
+		int offset = 0;
+		// Going left, blocks are loaded from their lowest pixel, so they still lie within the span.
+#ifdef RTE_MATTER_SCAN_SSE2
+		const __m128i materials = _mm_set1_epi8(static_cast<char>(material));
+		const int foundMask = findMaterial ? 0 : 0xFFFF;
+
+		for (; offset + 16 <= spanLength; offset += 16) {
+			const unsigned char *block = row + firstX + ((increment > 0) ? offset : -offset - 15);
+			if ((_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block)), materials)) ^ foundMask) != 0) {
+				break;
+			}
+		}
+#else
+		// Without SSE2, test 8 pixels at a time for bytes equal to the material with the usual bit trick for finding zero bytes in a word.
+		const uint64_t lowBits = 0x0101010101010101;
+		const uint64_t highBits = 0x8080808080808080;
+		const uint64_t materials = material * lowBits;
+
+		for (; offset + 8 <= spanLength; offset += 8) {
+			uint64_t pixels;
+			memcpy(&pixels, row + firstX + ((increment > 0) ? offset : -offset - 7), sizeof(pixels));
+			uint64_t difference = pixels ^ materials;
+			if (findMaterial ? (((difference - lowBits) & ~difference & highBits) != 0) : (difference != 0)) {
+				break;
+			}
+		}
+#endif
+		// Pin down the pixel in the block that had one, and check the leftover pixels at the end of the span.
+		for (; offset < spanLength; ++offset) {
+			if ((row[firstX + offset * increment] == material) == findMaterial) {
+				return offset;
+			}
+		}
+		return spanLength;
+	}
+}
@@ -0,0 +1,285 @@
+#ifndef _RTESCENESAMPLER_
+#define _RTESCENESAMPLER_
+
+#include "SceneMan.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// The part of a SceneSampler that doesn't depend on how the Scene wraps. Grabs the dimensions and row pointers of the current Scene's material and MOID layers once,
+	/// so individual pixel samples don't have to go through SceneMan, the Scene, its layers and Allegro's getpixel every time.
+	/// The layers must not be recreated while a sampler made from them is in use, so samplers should be short-lived, e.g. for the duration of a single ray cast.
+	/// </summary>
+	class SceneSamplerBase {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a SceneSamplerBase object in system memory. Grabs the layers of the current Scene, which must exist.
+		/// </summary>
+		SceneSamplerBase();
+
+		/// <summary>
+		/// Constructor method used to instantiate a SceneSamplerBase object in system memory. Samples a material layer given by its rows instead of the current Scene's, with no MOID layer and no pixel check visualization.
+		/// </summary>
+		/// <param name="materialRows">The row pointers of the material layer.</param>
+		/// <param name="materialWidth">The width of the material layer, which is also the width it wraps at.</param>
+		/// <param name="materialHeight">The height of the material layer, which is also the height it wraps at.</param>
+		/// <param name="wrapsX">Whether the material layer wraps horizontally.</param>
+		/// <param name="wrapsY">Whether the material layer wraps vertically.</param>
+		SceneSamplerBase(const unsigned char * const *materialRows, int materialWidth, int materialHeight, bool wrapsX, bool wrapsY);
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Calls a function with the SceneSampler specialization matching the wrapping of the current Scene, which must exist.
+		/// The function should be a generic lambda taking the sampler by value, so its whole body gets compiled once for each specialization.
+		/// </summary>
+		/// <param name="samplerFunction">The function to call with the SceneSampler.</param>
+		/// <returns>Whatever the function returns.</returns>
+		template <typename SamplerFunction> static decltype(auto) VisitCurrentScene(SamplerFunction &&samplerFunction) { return Visit(SceneSamplerBase(), samplerFunction); }
+
+		/// <summary>
+		/// Calls a function with the SceneSampler specialization matching the wrapping of a set of layers. See VisitCurrentScene.
+		/// </summary>
+		/// <param name="layers">The layers to sample.</param>
+		/// <param name="samplerFunction">The function to call with the SceneSampler.</param>
+		/// <returns>Whatever the function returns.</returns>
+		template <typename SamplerFunction> static decltype(auto) Visit(const SceneSamplerBase &layers, SamplerFunction &&samplerFunction);
+
+		/// <summary>
+		/// Same as SceneSampler::WrapPosition, but goes by the wrapping of the layers at runtime. Meant for code that takes a few samples at a time from all over, like Atom and AtomGroup travel,
+		/// where compiling everything once per SceneSampler specialization isn't worth it, but holding on to one sampler per step or travel still skips going through SceneMan for every pixel.
+		/// </summary>
+		/// <param name="posX">The X coordinate of the position to wrap.</param>
+		/// <param name="posY">The Y coordinate of the position to wrap.</param>
+		/// <returns>Whether wrapping was performed or not.</returns>
+		bool WrapPosition(int &posX, int &posY) const;
+
+		/// <summary>
+		/// Same as SceneSampler::GetTerrMatter, but goes by the wrapping of the layers at runtime. See WrapPosition.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <param name="pixelY">The Y coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <returns>The material index of the pixel.</returns>
+		unsigned char GetTerrMatter(int pixelX, int pixelY) const;
+
+		/// <summary>
+		/// Same as SceneSampler::GetMOIDPixel, but goes by the wrapping of the layers at runtime. See WrapPosition.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <param name="pixelY">The Y coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <returns>The MOID at the pixel.</returns>
+		MOID GetMOIDPixel(int pixelX, int pixelY) const;
+#pragma endregion
+
+	protected:
+
+		/// <summary>
+		/// The pixel type of the MOID layer BITMAP.
+		/// </summary>
+		using MOIDPixel = std::conditional_t<c_MOIDLayerBitDepth == 8, uint8_t, std::conditional_t<c_MOIDLayerBitDepth == 16, uint16_t, uint32_t>>;
+
+		bool m_WrapsX; //!< Whether the Scene wraps horizontally.
+		bool m_WrapsY; //!< Whether the Scene wraps vertically.
+
+		const unsigned char * const *m_MaterialRows; //!< The row pointers of the material BITMAP.
+		int m_MaterialWidth; //!< The width of the material BITMAP, which is also the width the Scene wraps at.
+		int m_MaterialHeight; //!< The height of the material BITMAP, which is also the height the Scene wraps at.
+
+		const unsigned char * const *m_MOIDRows; //!< The row pointers of the MOID layer BITMAP, if there is one.
+		int m_MOIDWidth; //!< The width of the MOID layer BITMAP, or 0 if there is none.
+		int m_MOIDHeight; //!< The height of the MOID layer BITMAP, or 0 if there is none.
+
+		SceneLayer *m_PixelCheckVisualizationLayer; //!< The SceneLayer sampled pixels are drawn to, if pixel checks are being visualized.
+		bool m_SimplifiedCollisionDetection; //!< Whether MOID samples ignore MOs that are traveling.
+
+		/// <summary>
+		/// Marks a sampled pixel on the pixel check visualization layer.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the sampled pixel.</param>
+		/// <param name="pixelY">The Y coordinate of the sampled pixel.</param>
+		void VisualizePixelCheck(int pixelX, int pixelY) const;
+
+		/// <summary>
+		/// Filters a sampled MOID for simplified collision detection, where only MOs that aren't traveling can be hit.
+		/// </summary>
+		/// <param name="moid">The sampled MOID.</param>
+		/// <returns>The sampled MOID if it belongs to an MO that can be hit, g_NoMOID otherwise.</returns>
+		static MOID GetSimplifiedCollisionMOID(MOID moid);
+
+		/// <summary>
+		/// Finds the first pixel in a span of a row of the material layer that is, or isn't, of a specific material. Tests 16 pixels at a time where SSE2 is available, 8 otherwise.
+		/// </summary>
+		/// <param name="row">The row of the material layer.</param>
+		/// <param name="firstX">The X coordinate of the first pixel of the span.</param>
+		/// <param name="spanLength">The number of pixels in the span. All of them must be within the row.</param>
+		/// <param name="increment">The direction of the span from the first pixel, 1 for right or -1 for left.</param>
+		/// <param name="material">The material index to compare the pixels with.</param>
+		/// <param name="findMaterial">Whether to find the first pixel of the material, or the first pixel of any other material.</param>
+		/// <returns>The offset of the found pixel from the first pixel, or spanLength if there is none.</returns>
+		static int FindMatterInSpan(const unsigned char *row, int firstX, int spanLength, int increment, unsigned char material, bool findMaterial);
+	};
+
+	/// <summary>
+	/// Samples the material and MOID layers of the current Scene, with the Scene's wrapping baked in at compile time so each sample is a handful of inlined compares and a single read.
+	/// Behaves exactly like SceneMan::WrapPosition, SceneMan::GetTerrMatter and SceneMan::GetMOIDPixel. Cheap to copy, so it should be passed by value.
+	/// Use SceneSamplerBase::VisitCurrentScene to get the specialization matching the current Scene.
+	/// </summary>
+	template <bool WrapsX, bool WrapsY>
+	class SceneSampler : public SceneSamplerBase {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a SceneSampler object in system memory.
+		/// </summary>
+		/// <param name="layers">The layers to sample.</param>
+		explicit SceneSampler(const SceneSamplerBase &layers) : SceneSamplerBase(layers) {}
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Only wraps a position coordinate if it is off bounds of the Scene and wrapping in the corresponding axis is turned on.
+		/// </summary>
+		/// <param name="posX">The X coordinate of the position to wrap.</param>
+		/// <param name="posY">The Y coordinate of the position to wrap.</param>
+		/// <returns>Whether wrapping was performed or not.</returns>
+		bool WrapPosition(int &posX, int &posY) const {
+			bool wrapped = false;
+			if constexpr (WrapsX) {
+				if (posX < 0) {
+					posX = (posX % m_MaterialWidth + m_MaterialWidth) % m_MaterialWidth;
+					wrapped = true;
+				} else if (posX >= m_MaterialWidth) {
+					posX %= m_MaterialWidth;
+					wrapped = true;
+				}
+			}
+			if constexpr (WrapsY) {
+				if (posY < 0) {
+					posY = (posY % m_MaterialHeight + m_MaterialHeight) % m_MaterialHeight;
+					wrapped = true;
+				} else if (posY >= m_MaterialHeight) {
+					posY %= m_MaterialHeight;
+					wrapped = true;
+				}
+			}
+			return wrapped;
+		}
+
+		/// <summary>
+		/// Gets the material index of a pixel of the Scene's terrain. Positions above the terrain or out of bounds on a non-wrapping axis are air.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <param name="pixelY">The Y coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <returns>The material index of the pixel.</returns>
+		unsigned char GetTerrMatter(int pixelX, int pixelY) const {
+			WrapPosition(pixelX, pixelY);
+			if (m_PixelCheckVisualizationLayer) { VisualizePixelCheck(pixelX, pixelY); }
+
+			if (static_cast<unsigned int>(pixelX) >= static_cast<unsigned int>(m_MaterialWidth) || static_cast<unsigned int>(pixelY) >= static_cast<unsigned int>(m_MaterialHeight)) {
+				return g_MaterialAir;
+			}
+			return m_MaterialRows[pixelY][pixelX];
+		}
+
+		/// <summary>
+		/// Gets the MOID at a pixel of the Scene's MOID layer. Positions out of bounds on a non-wrapping axis have no MOID.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <param name="pixelY">The Y coordinate of the pixel. Doesn't need to be wrapped.</param>
+		/// <returns>The MOID at the pixel.</returns>
+		MOID GetMOIDPixel(int pixelX, int pixelY) const {
+			WrapPosition(pixelX, pixelY);
+			if (m_PixelCheckVisualizationLayer) { VisualizePixelCheck(pixelX, pixelY); }
+
+			if (static_cast<unsigned int>(pixelX) >= static_cast<unsigned int>(m_MOIDWidth) || static_cast<unsigned int>(pixelY) >= static_cast<unsigned int>(m_MOIDHeight)) {
+				return g_NoMOID;
+			}
+			MOID moid = reinterpret_cast<const MOIDPixel *>(m_MOIDRows[pixelY])[pixelX];
+			return m_SimplifiedCollisionDetection ? GetSimplifiedCollisionMOID(moid) : moid;
+		}
+
+		/// <summary>
+		/// Finds the first pixel along a horizontal run of the Scene's terrain that is, or isn't, of a specific material. Gives the same result as calling GetTerrMatter on each pixel of the run in order,
+		/// but the parts of the run that lie within the material layer are scanned a whole span at a time.
+		/// </summary>
+		/// <param name="pixelY">The Y coordinate of the run. Doesn't need to be wrapped.</param>
+		/// <param name="startX">The X coordinate of the first pixel of the run. Doesn't need to be wrapped.</param>
+		/// <param name="pixelCount">The number of pixels in the run.</param>
+		/// <param name="increment">The direction of the run, 1 for right or -1 for left.</param>
+		/// <param name="material">The material index to compare the terrain with.</param>
+		/// <param name="findMaterial">Whether to find the first pixel of the material, or the first pixel of any other material.</param>
+		/// <returns>The index of the found pixel in the run, or pixelCount if there is none.</returns>
+		int FindTerrMatterInRow(int pixelY, int startX, int pixelCount, int increment, unsigned char material, bool findMaterial) const {
+			if (m_PixelCheckVisualizationLayer) {
+				for (int index = 0; index < pixelCount; ++index) {
+					if ((GetTerrMatter(startX + index * increment, pixelY) == material) == findMaterial) {
+						return index;
+					}
+				}
+				return pixelCount;
+			}
+			int rowX = 0;
+			WrapPosition(rowX, pixelY);
+			const unsigned char *row = (static_cast<unsigned int>(pixelY) < static_cast<unsigned int>(m_MaterialHeight)) ? m_MaterialRows[pixelY] : nullptr;
+			const bool airIsFound = (g_MaterialAir == material) == findMaterial;
+
+			int index = 0;
+			while (index < pixelCount) {
+				int pixelX = startX + index * increment;
+				int rowY = 0;
+				WrapPosition(pixelX, rowY);
+
+				int spanLength = pixelCount - index;
+				if (!row || pixelX < 0 || pixelX >= m_MaterialWidth) {
+					// Everything out of bounds is air, up to where the run enters the material layer, if it ever does.
+					if (airIsFound) {
+						return index;
+					}
+					if (row && pixelX < 0 && increment > 0) {
+						spanLength = std::min(spanLength, -pixelX);
+					} else if (row && pixelX >= m_MaterialWidth && increment < 0) {
+						spanLength = std::min(spanLength, pixelX - m_MaterialWidth + 1);
+					}
+				} else {
+					// Scan up to the edge of the material layer, where the run either wraps around or leaves the layer.
+					spanLength = std::min(spanLength, (increment > 0) ? m_MaterialWidth - pixelX : pixelX + 1);
+					int foundOffset = FindMatterInSpan(row, pixelX, spanLength, increment, material, findMaterial);
+					if (foundOffset < spanLength) {
+						return index + foundOffset;
+					}
+				}
+				index += spanLength;
+			}
+			return pixelCount;
+		}
+#pragma endregion
+	};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <typename SamplerFunction>
+	decltype(auto) SceneSamplerBase::Visit(const SceneSamplerBase &layers, SamplerFunction &&samplerFunction) {
+		if (layers.m_WrapsX) {
+			return layers.m_WrapsY ? samplerFunction(SceneSampler<true, true>(layers)) : samplerFunction(SceneSampler<true, false>(layers));
+		}
+		return layers.m_WrapsY ? samplerFunction(SceneSampler<false, true>(layers)) : samplerFunction(SceneSampler<false, false>(layers));
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	inline bool SceneSamplerBase::WrapPosition(int &posX, int &posY) const { return Visit(*this, [&posX, &posY](auto sceneSampler) { return sceneSampler.WrapPosition(posX, posY); }); }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	inline unsigned char SceneSamplerBase::GetTerrMatter(int pixelX, int pixelY) const { return Visit(*this, [pixelX, pixelY](auto sceneSampler) { return sceneSampler.GetTerrMatter(pixelX, pixelY); }); }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	inline MOID SceneSamplerBase::GetMOIDPixel(int pixelX, int pixelY) const { return Visit(*this, [pixelX, pixelY](auto sceneSampler) { return sceneSampler.GetMOIDPixel(pixelX, pixelY); }); }
+}
+#endif
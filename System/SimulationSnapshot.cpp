@@ -0,0 +1,337 @@
+#include "SimulationSnapshot.h"
+#include "ActivityMan.h"
+#include "MovableMan.h"
+#include "SceneMan.h"
+#include "ThreadMan.h"
+#include "TimerMan.h"
+#include "Scene.h"
+#include "SLTerrain.h"
+#include "Actor.h"
+#include "GAScripted.h"
+#include "MappedBitmap.h"
+
+#include <lz4.h>
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void SimulationSnapshot::Clear() {
+		m_Scene = nullptr;
+		m_Actors.clear();
+		m_Items.clear();
+		m_Particles.clear();
+		m_TerrainLayers.fill(TiledLayer());
+		m_UnseenLayers.fill(TiledLayer());
+		m_PlayerBrains.fill(-1);
+		m_ControlledActors.fill(-1);
+		m_TeamFunds.fill(0);
+		m_TeamDeaths.fill(0);
+		m_RNG = std::mt19937();
+		m_SharedTileCount = 0;
+		m_CaptureTime = 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void SimulationSnapshot::Destroy() {
+		for (const Actor *actor : m_Actors) {
+			delete actor;
+		}
+		for (const MovableObject *item : m_Items) {
+			delete item;
+		}
+		for (const MovableObject *particle : m_Particles) {
+			delete particle;
+		}
+		Clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool SimulationSnapshot::Capture(const SimulationSnapshot *previousSnapshot) {
+		Activity *activity = g_ActivityMan.GetActivity();
+		const Scene *scene = g_SceneMan.GetScene();
+		if (!activity || !scene || !g_SceneMan.GetTerrain()) {
+			return false;
+		}
+		const long long captureStartTime = g_TimerMan.GetAbsoluteTime();
+		Destroy();
+		m_Scene = scene;
+
+		// Copying some MovableObjects draws random numbers, so the RNG has to be captured before that to hand out the same ones again after restoring.
+		m_RNG = g_RNG;
+
+		for (int team = Activity::Teams::TeamOne; team < Activity::Teams::MaxTeamCount; ++team) {
+			m_TeamFunds.at(team) = activity->GetTeamFunds(team);
+			m_TeamDeaths.at(team) = activity->GetTeamDeathCount(team);
+		}
+
+		for (const std::vector<Actor *> *actors : { &g_MovableMan.m_Actors, &g_MovableMan.m_AddedActors }) {
+			for (const Actor *actor : *actors) {
+				if (actor->IsSetToDelete()) {
+					continue;
+				}
+				for (int player = Players::PlayerOne; player < Players::MaxPlayerCount; ++player) {
+					if (activity->GetPlayerBrain(player) == actor) { m_PlayerBrains.at(player) = static_cast<int>(m_Actors.size()); }
+					if (activity->GetControlledActor(player) == actor) { m_ControlledActors.at(player) = static_cast<int>(m_Actors.size()); }
+				}
+				m_Actors.emplace_back(dynamic_cast<Actor *>(actor->Clone()));
+			}
+		}
+		for (const std::vector<MovableObject *> *items : { &g_MovableMan.m_Items, &g_MovableMan.m_AddedItems }) {
+			for (const MovableObject *item : *items) {
+				if (!item->IsSetToDelete()) { m_Items.emplace_back(dynamic_cast<MovableObject *>(item->Clone())); }
+			}
+		}
+		for (const std::vector<MovableObject *> *particles : { &g_MovableMan.m_Particles, &g_MovableMan.m_AddedParticles }) {
+			for (const MovableObject *particle : *particles) {
+				if (!particle->IsSetToDelete()) { m_Particles.emplace_back(dynamic_cast<MovableObject *>(particle->Clone())); }
+			}
+		}
+
+		const bool previousSnapshotOfScene = previousSnapshot && previousSnapshot->m_Scene == m_Scene;
+		for (int layerType = MaterialLayer; layerType < TerrainLayerCount; ++layerType) {
+			m_SharedTileCount += CaptureLayer(GetTerrainLayerBitmap(static_cast<TerrainLayerType>(layerType)), m_TerrainLayers.at(layerType), previousSnapshotOfScene ? &previousSnapshot->m_TerrainLayers.at(layerType) : nullptr);
+		}
+		for (int team = Activity::Teams::TeamOne; team < Activity::Teams::MaxTeamCount; ++team) {
+			if (const BITMAP *unseenBitmap = GetUnseenLayerBitmap(team)) { m_SharedTileCount += CaptureLayer(unseenBitmap, m_UnseenLayers.at(team), previousSnapshotOfScene ? &previousSnapshot->m_UnseenLayers.at(team) : nullptr); }
+		}
+
+		m_CaptureTime = g_TimerMan.GetAbsoluteTime() - captureStartTime;
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool SimulationSnapshot::IsRestoreBlockedByScripts() {
+		// The scripts of MovableObjects go away with them and start over on the restored copies, but the Activity and global scripts keep running and may have stored any of the replaced MovableObjects.
+		return dynamic_cast<const GAScripted *>(g_ActivityMan.GetActivity()) != nullptr;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool SimulationSnapshot::IsOfCurrentScene() const {
+		if (!m_Scene || m_Scene != g_SceneMan.GetScene() || !g_SceneMan.GetTerrain()) {
+			return false;
+		}
+		for (int layerType = MaterialLayer; layerType < TerrainLayerCount; ++layerType) {
+			if (!LayerFitsBitmap(GetTerrainLayerBitmap(static_cast<TerrainLayerType>(layerType)), m_TerrainLayers.at(layerType))) {
+				return false;
+			}
+		}
+		for (int team = Activity::Teams::TeamOne; team < Activity::Teams::MaxTeamCount; ++team) {
+			if (!LayerFitsBitmap(GetUnseenLayerBitmap(team), m_UnseenLayers.at(team))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	size_t SimulationSnapshot::GetTerrainSize() const {
+		size_t terrainSize = 0;
+		for (const TiledLayer &layer : m_TerrainLayers) {
+			for (const std::shared_ptr<const LayerTile> &tile : layer.Tiles) {
+				terrainSize += tile->CompressedData.size();
+			}
+		}
+		return terrainSize;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool SimulationSnapshot::Restore() const {
+		Activity *activity = g_ActivityMan.GetActivity();
+		if (!activity || !IsOfCurrentScene() || IsRestoreBlockedByScripts()) {
+			return false;
+		}
+
+		// Terrain is written back through the same terrain change registration as any other terrain edit, so networked clients and everything waiting on terrain changes see it.
+		for (int layerType = MaterialLayer; layerType < TerrainLayerCount; ++layerType) {
+			for (const Box &changedArea : RestoreLayer(m_TerrainLayers.at(layerType), GetTerrainLayerBitmap(static_cast<TerrainLayerType>(layerType)))) {
+				g_SceneMan.RegisterTerrainChange(static_cast<int>(changedArea.GetCorner().m_X), static_cast<int>(changedArea.GetCorner().m_Y), static_cast<int>(changedArea.GetWidth()), static_cast<int>(changedArea.GetHeight()), g_MaskColor, layerType == BGColorLayer);
+			}
+		}
+		for (int team = Activity::Teams::TeamOne; team < Activity::Teams::MaxTeamCount; ++team) {
+			if (BITMAP *unseenBitmap = GetUnseenLayerBitmap(team)) {
+				// Pixels revealed since the last frame would otherwise be revealed again on the restored layer.
+				g_SceneMan.GetScene()->GetSeenPixels(team).clear();
+				RestoreLayer(m_UnseenLayers.at(team), unseenBitmap);
+			}
+		}
+		g_SceneMan.GetScene()->ResetPathFinding();
+
+		// The old MovableObjects' drawings have to be cleared off the MOID layer before they're gone, then the copies are put straight into MovableMan as they are, instead of being added like new ones.
+		g_SceneMan.ClearAllMOIDDrawings();
+		g_MovableMan.PurgeAllMOs();
+
+		std::vector<Actor *> restoredActors;
+		restoredActors.reserve(m_Actors.size());
+		for (const Actor *actor : m_Actors) {
+			Actor *restoredActor = dynamic_cast<Actor *>(actor->Clone());
+			restoredActor->SetAsAddedToMovableMan();
+			g_MovableMan.m_Actors.emplace_back(restoredActor);
+			g_MovableMan.AddActorToTeamRoster(restoredActor);
+			restoredActors.emplace_back(restoredActor);
+		}
+		for (const MovableObject *item : m_Items) {
+			MovableObject *restoredItem = dynamic_cast<MovableObject *>(item->Clone());
+			restoredItem->SetAsAddedToMovableMan();
+			g_MovableMan.m_Items.emplace_back(restoredItem);
+		}
+		for (const MovableObject *particle : m_Particles) {
+			MovableObject *restoredParticle = dynamic_cast<MovableObject *>(particle->Clone());
+			restoredParticle->SetAsAddedToMovableMan();
+			g_MovableMan.m_Particles.emplace_back(restoredParticle);
+		}
+		g_MovableMan.UpdateDrawMOIDs(g_SceneMan.GetMOIDBitmap());
+
+		// The Activity still points at the purged Actors, so it has to be pointed at their copies before anything else looks at it.
+		for (int player = Players::PlayerOne; player < Players::MaxPlayerCount; ++player) {
+			Actor *brain = (m_PlayerBrains.at(player) >= 0) ? restoredActors.at(m_PlayerBrains.at(player)) : nullptr;
+			activity->SetPlayerBrain(brain, player);
+			if (Actor *controlledActor = (m_ControlledActors.at(player) >= 0) ? restoredActors.at(m_ControlledActors.at(player)) : brain) {
+				activity->SwitchToActor(controlledActor, player, activity->GetTeamOfPlayer(player));
+			}
+		}
+		for (int team = Activity::Teams::TeamOne; team < Activity::Teams::MaxTeamCount; ++team) {
+			activity->SetTeamFunds(m_TeamFunds.at(team), team);
+			activity->ReportDeath(team, m_TeamDeaths.at(team) - activity->GetTeamDeathCount(team));
+		}
+
+		g_RNG = m_RNG;
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * SimulationSnapshot::GetTerrainLayerBitmap(TerrainLayerType layerType) {
+		SLTerrain *terrain = g_SceneMan.GetTerrain();
+		switch (layerType) {
+			case FGColorLayer:
+				return terrain->GetFGColorBitmap();
+			case BGColorLayer:
+				return terrain->GetBGColorBitmap();
+			default:
+				return terrain->GetMaterialBitmap();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * SimulationSnapshot::GetUnseenLayerBitmap(int team) {
+		const SceneLayer *unseenLayer = g_SceneMan.GetScene()->GetUnseenLayer(team);
+		return unseenLayer ? unseenLayer->GetBitmap() : nullptr;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool SimulationSnapshot::LayerFitsBitmap(const BITMAP *bitmap, const TiledLayer &layer) {
+		if (!bitmap) {
+			return layer.Width == 0;
+		}
+		return bitmap->w == layer.Width && bitmap->h == layer.Height && (bitmap_color_depth(const_cast<BITMAP *>(bitmap)) + 7) / 8 == layer.BytesPerPixel;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int SimulationSnapshot::CaptureLayer(const BITMAP *bitmap, TiledLayer &layer, const TiledLayer *previousLayer) {
+		layer.Width = bitmap->w;
+		layer.Height = bitmap->h;
+		layer.BytesPerPixel = (bitmap_color_depth(const_cast<BITMAP *>(bitmap)) + 7) / 8;
+		layer.TilesPerRow = (layer.Width + c_TileSize - 1) / c_TileSize;
+		layer.Tiles.resize(static_cast<size_t>(layer.TilesPerRow) * static_cast<size_t>((layer.Height + c_TileSize - 1) / c_TileSize));
+
+		if (previousLayer && (previousLayer->Width != layer.Width || previousLayer->Height != layer.Height || previousLayer->BytesPerPixel != layer.BytesPerPixel)) {
+			previousLayer = nullptr;
+		}
+
+		// Nothing else touches the layer while the sim is waiting on this, so the tiles can be hashed and compressed straight out of the BITMAP.
+		g_ThreadMan.ParallelFor(0, static_cast<int>(layer.Tiles.size()), [&layer, bitmap, previousLayer](int firstTile, int lastTile) {
+			std::vector<char> tilePixels;
+			std::vector<char> previousTilePixels;
+			for (int tileIndex = firstTile; tileIndex < lastTile; ++tileIndex) {
+				const int tileX = (tileIndex % layer.TilesPerRow) * c_TileSize;
+				const int tileY = (tileIndex / layer.TilesPerRow) * c_TileSize;
+				const int rowSize = std::min(c_TileSize, layer.Width - tileX) * layer.BytesPerPixel;
+				const int tileHeight = std::min(c_TileSize, layer.Height - tileY);
+
+				tilePixels.resize(static_cast<size_t>(rowSize) * static_cast<size_t>(tileHeight));
+				for (int row = 0; row < tileHeight; ++row) {
+					std::memcpy(tilePixels.data() + row * rowSize, bitmap->line[tileY + row] + tileX * layer.BytesPerPixel, rowSize);
+				}
+				const size_t tileHash = std::hash<std::string_view>()(std::string_view(tilePixels.data(), tilePixels.size()));
+
+				if (previousLayer) {
+					const std::shared_ptr<const LayerTile> &previousTile = previousLayer->Tiles.at(tileIndex);
+					if (previousTile->Hash == tileHash && previousTile->UncompressedSize == static_cast<int>(tilePixels.size())) {
+						// Hashes can collide, so the hash only says which tiles are worth comparing. Only tiles with identical pixels are shared.
+						previousTilePixels.resize(tilePixels.size());
+						if (LZ4_decompress_safe(previousTile->CompressedData.data(), previousTilePixels.data(), static_cast<int>(previousTile->CompressedData.size()), previousTile->UncompressedSize) == previousTile->UncompressedSize && memcmp(previousTilePixels.data(), tilePixels.data(), tilePixels.size()) == 0) {
+							layer.Tiles.at(tileIndex) = previousTile;
+							continue;
+						}
+					}
+				}
+				std::shared_ptr<LayerTile> tile = std::make_shared<LayerTile>();
+				tile->Hash = tileHash;
+				tile->UncompressedSize = static_cast<int>(tilePixels.size());
+				tile->CompressedData.resize(LZ4_compressBound(tile->UncompressedSize));
+				tile->CompressedData.resize(LZ4_compress_default(tilePixels.data(), tile->CompressedData.data(), tile->UncompressedSize, static_cast<int>(tile->CompressedData.size())));
+				tile->CompressedData.shrink_to_fit();
+				layer.Tiles.at(tileIndex) = std::move(tile);
+			}
+		}, 16);
+
+		int sharedTileCount = 0;
+		if (previousLayer) {
+			for (size_t tileIndex = 0; tileIndex < layer.Tiles.size(); ++tileIndex) {
+				if (layer.Tiles.at(tileIndex) == previousLayer->Tiles.at(tileIndex)) { sharedTileCount++; }
+			}
+		}
+		return sharedTileCount;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<Box> SimulationSnapshot::RestoreLayer(const TiledLayer &layer, BITMAP *bitmap) {
+		MappedBitmap::TouchArea(bitmap, Box(Vector(), static_cast<float>(layer.Width), static_cast<float>(layer.Height)), false);
+
+		std::vector<unsigned char> changedTiles(layer.Tiles.size(), 0);
+		g_ThreadMan.ParallelFor(0, static_cast<int>(layer.Tiles.size()), [&layer, bitmap, &changedTiles](int firstTile, int lastTile) {
+			std::vector<char> tilePixels;
+			for (int tileIndex = firstTile; tileIndex < lastTile; ++tileIndex) {
+				const LayerTile &tile = *layer.Tiles.at(tileIndex);
+				const int tileX = (tileIndex % layer.TilesPerRow) * c_TileSize;
+				const int tileY = (tileIndex / layer.TilesPerRow) * c_TileSize;
+				const int rowSize = std::min(c_TileSize, layer.Width - tileX) * layer.BytesPerPixel;
+				const int tileHeight = std::min(c_TileSize, layer.Height - tileY);
+
+				tilePixels.resize(tile.UncompressedSize);
+				if (LZ4_decompress_safe(tile.CompressedData.data(), tilePixels.data(), static_cast<int>(tile.CompressedData.size()), tile.UncompressedSize) != tile.UncompressedSize) {
+					RTEAbort("Failed to decompress layer tile " + std::to_string(tileIndex) + " of a simulation snapshot!");
+				}
+				for (int row = 0; row < tileHeight; ++row) {
+					unsigned char *bitmapRow = bitmap->line[tileY + row] + tileX * layer.BytesPerPixel;
+					const char *tileRow = tilePixels.data() + row * rowSize;
+					if (memcmp(bitmapRow, tileRow, rowSize) != 0) {
+						std::memcpy(bitmapRow, tileRow, rowSize);
+						changedTiles.at(tileIndex) = 1;
+					}
+				}
+			}
+		}, 16);
+
+		std::vector<Box> changedAreas;
+		for (size_t tileIndex = 0; tileIndex < changedTiles.size(); ++tileIndex) {
+			if (changedTiles.at(tileIndex)) {
+				const int tileX = (static_cast<int>(tileIndex) % layer.TilesPerRow) * c_TileSize;
+				const int tileY = (static_cast<int>(tileIndex) / layer.TilesPerRow) * c_TileSize;
+				changedAreas.emplace_back(Vector(static_cast<float>(tileX), static_cast<float>(tileY)), static_cast<float>(std::min(c_TileSize, layer.Width - tileX)), static_cast<float>(std::min(c_TileSize, layer.Height - tileY)));
+			}
+		}
+		return changedAreas;
+	}
+}
@@ -0,0 +1,191 @@
+#ifndef _RTESIMULATIONSNAPSHOT_
+#define _RTESIMULATIONSNAPSHOT_
+
+#include "Activity.h"
+
+namespace RTE {
+
+	class Scene;
+	class Box;
+	class Actor;
+	class MovableObject;
+
+	/// <summary>
+	/// A copy of the state of a running Activity that can be put back into effect later, without reloading the Scene. Used for quick saving and loading.
+	/// Holds deep copies of all MovableObjects and their Attachables, the terrain and unseen layers as LZ4 compressed tiles, the players' brains and controlled Actors, the teams' funds and deaths, and the state of the RNG.
+	/// Tiles that haven't changed since the previous snapshot are shared with it instead of being compressed again, so keeping several snapshots around only costs the tiles that changed between them.
+	/// The state of Lua scripts isn't captured. MovableObject scripts start over on the restored copies, but the scripts of a scripted Activity would be left holding on to the replaced MovableObjects, so snapshots can't be restored into one.
+	/// </summary>
+	class SimulationSnapshot {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a SimulationSnapshot object in system memory. Capture() should be called before using the object.
+		/// </summary>
+		SimulationSnapshot() { Clear(); }
+
+		/// <summary>
+		/// Captures the state of the current Activity and Scene. Should only be done between sim updates.
+		/// </summary>
+		/// <param name="previousSnapshot">A previous snapshot of the same Scene to share unchanged terrain tiles with. Can be nullptr.</param>
+		/// <returns>Whether there was anything to capture.</returns>
+		bool Capture(const SimulationSnapshot *previousSnapshot = nullptr);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a SimulationSnapshot object before deletion from system memory.
+		/// </summary>
+		~SimulationSnapshot() { Destroy(); }
+
+		/// <summary>
+		/// Destroys and resets (through Clear()) the SimulationSnapshot object.
+		/// </summary>
+		void Destroy();
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets whether the current Activity runs scripts that may hold on to MovableObjects, in which case no snapshot can be restored into it.
+		/// </summary>
+		/// <returns>Whether restoring snapshots is blocked by the current Activity's scripts.</returns>
+		static bool IsRestoreBlockedByScripts();
+
+		/// <summary>
+		/// Gets whether this snapshot was captured from the Scene that is currently loaded, so it can be restored.
+		/// </summary>
+		/// <returns>Whether this snapshot can be restored.</returns>
+		bool IsOfCurrentScene() const;
+
+		/// <summary>
+		/// Gets the number of MovableObjects in this snapshot, not counting Attachables.
+		/// </summary>
+		/// <returns>The number of MovableObjects in this snapshot.</returns>
+		int GetMOCount() const { return static_cast<int>(m_Actors.size() + m_Items.size() + m_Particles.size()); }
+
+		/// <summary>
+		/// Gets how much memory the compressed terrain tiles of this snapshot take up, including the ones shared with other snapshots.
+		/// </summary>
+		/// <returns>The size of the compressed terrain tiles, in bytes.</returns>
+		size_t GetTerrainSize() const;
+
+		/// <summary>
+		/// Gets how many of the terrain tiles of this snapshot were shared with the previous snapshot instead of being compressed again.
+		/// </summary>
+		/// <returns>The number of shared terrain tiles.</returns>
+		int GetSharedTileCount() const { return m_SharedTileCount; }
+
+		/// <summary>
+		/// Gets how long capturing this snapshot took.
+		/// </summary>
+		/// <returns>The time capturing took, in milliseconds.</returns>
+		float GetCaptureTime() const { return static_cast<float>(m_CaptureTime) / 1000.0F; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Puts this snapshot back into effect. Replaces all MovableObjects with copies of the captured ones, writes the captured terrain and unseen layers back and rebuilds the MOID layer and the pathfinding data.
+		/// Terrain tiles that differ from the current terrain are registered as terrain changes, so clients and everything else tracking terrain changes pick them up. The snapshot itself is left untouched, so it can be restored again.
+		/// </summary>
+		/// <returns>Whether the snapshot was restored. Fails if it wasn't captured from the current Scene, or if restoring is blocked by scripts.</returns>
+		bool Restore() const;
+#pragma endregion
+
+	private:
+
+		static constexpr int c_TileSize = 64; //!< The width and height of the tiles the captured layers are split into, in pixels.
+
+		/// <summary>
+		/// Enumeration for the terrain layers that are captured.
+		/// </summary>
+		enum TerrainLayerType { MaterialLayer, FGColorLayer, BGColorLayer, TerrainLayerCount };
+
+		/// <summary>
+		/// A compressed tile of a captured layer. Immutable once created, so it can be shared between snapshots.
+		/// </summary>
+		struct LayerTile {
+			size_t Hash = 0; //!< The hash of the uncompressed pixels of the tile, used to find out whether it changed since the previous snapshot.
+			int UncompressedSize = 0; //!< The size of the uncompressed pixels of the tile, in bytes.
+			std::vector<char> CompressedData; //!< The LZ4 compressed pixels of the tile, row after row.
+		};
+
+		/// <summary>
+		/// A captured layer BITMAP, split into tiles.
+		/// </summary>
+		struct TiledLayer {
+			int Width = 0; //!< The width of the layer, in pixels. 0 if there was no layer to capture.
+			int Height = 0; //!< The height of the layer, in pixels.
+			int BytesPerPixel = 0; //!< The number of bytes each pixel of the layer takes up.
+			int TilesPerRow = 0; //!< The number of tiles in each row of tiles.
+			std::vector<std::shared_ptr<const LayerTile>> Tiles; //!< The tiles of the layer, row after row.
+		};
+
+		const Scene *m_Scene; //!< The Scene this snapshot was captured from. Not owned.
+
+		std::vector<Actor *> m_Actors; //!< Copies of all the Actors, including the ones waiting to be added. Owned by this.
+		std::vector<MovableObject *> m_Items; //!< Copies of all the items, including the ones waiting to be added. Owned by this.
+		std::vector<MovableObject *> m_Particles; //!< Copies of all the particles, including the ones waiting to be added. Owned by this.
+		std::array<TiledLayer, TerrainLayerCount> m_TerrainLayers; //!< The captured terrain layers.
+		std::array<TiledLayer, Activity::Teams::MaxTeamCount> m_UnseenLayers; //!< The captured unseen layers of each team. Empty for teams that had none.
+
+		std::array<int, Players::MaxPlayerCount> m_PlayerBrains; //!< The index into m_Actors of each player's brain, or -1 if the player has no brain among them.
+		std::array<int, Players::MaxPlayerCount> m_ControlledActors; //!< The index into m_Actors of the Actor each player controls, or -1 if the player controls none of them.
+		std::array<float, Activity::Teams::MaxTeamCount> m_TeamFunds; //!< The funds of each team.
+		std::array<int, Activity::Teams::MaxTeamCount> m_TeamDeaths; //!< The death count of each team.
+		std::mt19937 m_RNG; //!< The state of the main thread's RNG.
+
+		int m_SharedTileCount; //!< How many tiles were shared with the previous snapshot.
+		long long m_CaptureTime; //!< How long capturing took, in microseconds.
+
+		/// <summary>
+		/// Gets the BITMAP of one of the current Scene's terrain layers.
+		/// </summary>
+		/// <param name="layerType">The terrain layer to get the BITMAP of. See TerrainLayerType enumeration.</param>
+		/// <returns>The BITMAP of the terrain layer.</returns>
+		static BITMAP * GetTerrainLayerBitmap(TerrainLayerType layerType);
+
+		/// <summary>
+		/// Gets the BITMAP of one of the current Scene's unseen layers.
+		/// </summary>
+		/// <param name="team">The team whose unseen layer to get the BITMAP of.</param>
+		/// <returns>The BITMAP of the unseen layer, or nullptr if the team has none.</returns>
+		static BITMAP * GetUnseenLayerBitmap(int team);
+
+		/// <summary>
+		/// Tells whether a BITMAP has the same dimensions and color depth as a captured layer, so the layer can be written back into it.
+		/// </summary>
+		/// <param name="bitmap">The BITMAP to check. Can be nullptr, which matches a layer that wasn't captured.</param>
+		/// <param name="layer">The captured layer to check against.</param>
+		/// <returns>Whether the layer fits the BITMAP.</returns>
+		static bool LayerFitsBitmap(const BITMAP *bitmap, const TiledLayer &layer);
+
+		/// <summary>
+		/// Splits a BITMAP into tiles and compresses them, sharing the tiles that are identical to the same tiles of a previous capture of it.
+		/// </summary>
+		/// <param name="bitmap">The BITMAP to capture.</param>
+		/// <param name="layer">The layer to capture the BITMAP into.</param>
+		/// <param name="previousLayer">A previous capture of the same BITMAP to share unchanged tiles with. Can be nullptr.</param>
+		/// <returns>The number of tiles shared with the previous capture.</returns>
+		static int CaptureLayer(const BITMAP *bitmap, TiledLayer &layer, const TiledLayer *previousLayer);
+
+		/// <summary>
+		/// Writes the tiles of a captured layer back into its BITMAP, skipping the ones whose pixels didn't change. Every tile is read to compare it, so the whole BITMAP is touched first in case it's memory-mapped.
+		/// </summary>
+		/// <param name="layer">The captured layer to write back.</param>
+		/// <param name="bitmap">The BITMAP to write the layer into. Must fit the layer.</param>
+		/// <returns>The areas of the BITMAP that changed, one per written tile.</returns>
+		static std::vector<Box> RestoreLayer(const TiledLayer &layer, BITMAP *bitmap);
+
+		/// <summary>
+		/// Clears all the member variables of this SimulationSnapshot, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		SimulationSnapshot(const SimulationSnapshot &reference) = delete;
+		SimulationSnapshot & operator=(const SimulationSnapshot &rhs) = delete;
+	};
+}
+#endif
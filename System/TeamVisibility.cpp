@@ -0,0 +1,305 @@
+#include "TeamVisibility.h"
+#include "SceneMan.h"
+#include "SettingsMan.h"
+#include "ThreadMan.h"
+#include "Scene.h"
+#include "SceneLayer.h"
+#include "SLTerrain.h"
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::Clear() {
+		m_CellWidth = c_DefaultCellSize;
+		m_CellHeight = c_DefaultCellSize;
+		m_GatheredEyePoints.clear();
+		m_PassInFlight = nullptr;
+		m_PassInFlightResult = std::future<void>();
+		m_LastCompletedPass = nullptr;
+		m_CompletedPassCount = 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::Reset() {
+		if (m_PassInFlightResult.valid()) { m_PassInFlightResult.wait(); }
+		Clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::AddEyePoint(const Vector &eyePos, float range, const Vector &lookDirection, float spreadAngle) {
+		if (range > 0) { m_GatheredEyePoints.push_back({ eyePos, range, lookDirection, spreadAngle }); }
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int TeamVisibility::Update(int team, long simUpdateNumber, Vector &revealedPos) {
+		const Scene *scene = g_SceneMan.GetScene();
+		if (!scene) {
+			return 0;
+		}
+		SceneLayer *unseenLayer = scene->GetUnseenLayer(team);
+
+		int revealedCount = 0;
+		if (m_PassInFlight && m_PassInFlightResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready) { revealedCount = ApplyPass(team, unseenLayer, revealedPos); }
+
+		if (!m_PassInFlight && (simUpdateNumber + team) % c_UpdatesPerPass == 0) {
+			if (m_GatheredEyePoints.empty()) {
+				// Nobody on the team is looking, so nothing is in view anymore.
+				m_LastCompletedPass = nullptr;
+			} else {
+				StartPass(unseenLayer);
+			}
+		}
+		return revealedCount;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool TeamVisibility::IsVisible(int pixelX, int pixelY) const {
+		std::shared_ptr<const VisibilityPass> pass = m_LastCompletedPass;
+		if (!pass) {
+			return false;
+		}
+		int cellX = pixelX / pass->CellWidth;
+		int cellY = pixelY / pass->CellHeight;
+
+		// The box is in unwrapped coordinates, so a wrapped position may be found one scene width or height away from where it is.
+		for (int wrapX = -1; wrapX <= 1; ++wrapX) {
+			if (wrapX != 0 && pass->WrapCellsX == 0) {
+				continue;
+			}
+			for (int wrapY = -1; wrapY <= 1; ++wrapY) {
+				if (wrapY != 0 && pass->WrapCellsY == 0) {
+					continue;
+				}
+				int boxX = cellX + wrapX * pass->WrapCellsX - pass->BoxLeft;
+				int boxY = cellY + wrapY * pass->WrapCellsY - pass->BoxTop;
+				if (boxX >= 0 && boxX < pass->BoxWidth && boxY >= 0 && boxY < pass->BoxHeight && pass->Visible[boxY * pass->BoxWidth + boxX]) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::StartPass(const SceneLayer *unseenLayer) {
+		if (unseenLayer) {
+			Vector unseenScale = unseenLayer->GetScaleFactor();
+			m_CellWidth = std::max(static_cast<int>(std::round(unseenScale.m_X)), 1);
+			m_CellHeight = std::max(static_cast<int>(std::round(unseenScale.m_Y)), 1);
+		} else {
+			m_CellWidth = c_DefaultCellSize;
+			m_CellHeight = c_DefaultCellSize;
+		}
+		std::shared_ptr<VisibilityPass> pass = std::make_shared<VisibilityPass>();
+		pass->CellWidth = m_CellWidth;
+		pass->CellHeight = m_CellHeight;
+
+		BITMAP *materialBitmap = g_SceneMan.GetTerrain()->GetMaterialBitmap();
+		int sceneCellsX = (materialBitmap->w + m_CellWidth - 1) / m_CellWidth;
+		int sceneCellsY = (materialBitmap->h + m_CellHeight - 1) / m_CellHeight;
+		pass->WrapCellsX = g_SceneMan.SceneWrapsX() ? sceneCellsX : 0;
+		pass->WrapCellsY = g_SceneMan.SceneWrapsY() ? sceneCellsY : 0;
+
+		pass->EyePoints.reserve(m_GatheredEyePoints.size());
+		for (const GatheredEyePoint &gatheredEyePoint : m_GatheredEyePoints) {
+			EyePoint eyePoint = { gatheredEyePoint.Pos.GetFloorIntX() / m_CellWidth, gatheredEyePoint.Pos.GetFloorIntY() / m_CellHeight, gatheredEyePoint.Range, true, 0, 0, -1.0F };
+			if (!gatheredEyePoint.LookDirection.IsZero() && gatheredEyePoint.SpreadAngle < c_PI) {
+				Vector lookDirection = gatheredEyePoint.LookDirection.GetNormalized();
+				eyePoint.SeesAllAround = false;
+				eyePoint.LookX = lookDirection.m_X;
+				eyePoint.LookY = lookDirection.m_Y;
+				eyePoint.SpreadCosine = std::cos(std::max(gatheredEyePoint.SpreadAngle, 0.0F));
+			}
+			pass->EyePoints.push_back(eyePoint);
+		}
+		m_GatheredEyePoints.clear();
+
+		// Merge the eye points gathered over the last few updates that ended up in the same cell looking the same way, since an actor standing still registers the same eye every update.
+		auto eyePointLooks = [](const EyePoint &eyePoint) { return std::make_tuple(eyePoint.CellY, eyePoint.CellX, eyePoint.SeesAllAround, eyePoint.LookX, eyePoint.LookY, eyePoint.SpreadCosine); };
+		std::sort(pass->EyePoints.begin(), pass->EyePoints.end(), [&eyePointLooks](const EyePoint &lhs, const EyePoint &rhs) { return eyePointLooks(lhs) != eyePointLooks(rhs) ? eyePointLooks(lhs) < eyePointLooks(rhs) : lhs.Range > rhs.Range; });
+		pass->EyePoints.erase(std::unique(pass->EyePoints.begin(), pass->EyePoints.end(), [&eyePointLooks](const EyePoint &lhs, const EyePoint &rhs) { return eyePointLooks(lhs) == eyePointLooks(rhs); }), pass->EyePoints.end());
+
+		int boxLeft = std::numeric_limits<int>::max();
+		int boxTop = std::numeric_limits<int>::max();
+		int boxRight = std::numeric_limits<int>::min();
+		int boxBottom = std::numeric_limits<int>::min();
+		for (const EyePoint &eyePoint : pass->EyePoints) {
+			int rangeCellsX = static_cast<int>(std::ceil(eyePoint.Range / static_cast<float>(m_CellWidth)));
+			int rangeCellsY = static_cast<int>(std::ceil(eyePoint.Range / static_cast<float>(m_CellHeight)));
+			boxLeft = std::min(boxLeft, eyePoint.CellX - rangeCellsX);
+			boxTop = std::min(boxTop, eyePoint.CellY - rangeCellsY);
+			boxRight = std::max(boxRight, eyePoint.CellX + rangeCellsX + 1);
+			boxBottom = std::max(boxBottom, eyePoint.CellY + rangeCellsY + 1);
+		}
+		if (pass->WrapCellsX == 0) {
+			boxLeft = std::max(boxLeft, 0);
+			boxRight = std::min(boxRight, sceneCellsX);
+		}
+		if (pass->WrapCellsY == 0) {
+			boxTop = std::max(boxTop, 0);
+			boxBottom = std::min(boxBottom, sceneCellsY);
+		}
+		pass->BoxLeft = boxLeft;
+		pass->BoxTop = boxTop;
+		pass->BoxWidth = std::max(boxRight - boxLeft, 0);
+		pass->BoxHeight = std::max(boxBottom - boxTop, 0);
+
+		// The terrain itself is read by the worker, which can take a while for large boxes, but the material palette is looked up here.
+		pass->MaterialBitmap = materialBitmap;
+		for (int materialID = 0; materialID < c_PaletteEntriesNumber; ++materialID) {
+			pass->OpaqueMaterials[materialID] = g_SceneMan.GetMaterialFromID(static_cast<unsigned char>(materialID))->GetIntegrity() >= c_OpaqueStrength ? 1 : 0;
+		}
+
+		m_PassInFlight = pass;
+		m_PassInFlightResult = g_ThreadMan.QueueJob([pass]() { ComputePass(*pass); });
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int TeamVisibility::ApplyPass(int team, SceneLayer *unseenLayer, Vector &revealedPos) {
+		std::shared_ptr<VisibilityPass> pass = m_PassInFlight;
+		m_PassInFlight = nullptr;
+		m_PassInFlightResult.get();
+
+		int revealedCount = 0;
+		if (unseenLayer && unseenLayer->GetBitmap()) {
+			BITMAP *unseenBitmap = unseenLayer->GetBitmap();
+			Vector unseenScaleInverse = unseenLayer->GetScaleInverse();
+			std::list<Vector> &seenPixels = g_SceneMan.GetScene()->GetSeenPixels(team);
+
+			for (int boxY = 0; boxY < pass->BoxHeight; ++boxY) {
+				int unseenY = static_cast<int>(static_cast<float>((pass->BoxTop + boxY) * pass->CellHeight + pass->CellHeight / 2) * unseenScaleInverse.m_Y);
+				if (unseenLayer->WrapsY()) { unseenY = ((unseenY % unseenBitmap->h) + unseenBitmap->h) % unseenBitmap->h; }
+
+				for (int boxX = 0; boxX < pass->BoxWidth; ++boxX) {
+					if (!pass->Visible[boxY * pass->BoxWidth + boxX]) {
+						continue;
+					}
+					int unseenX = static_cast<int>(static_cast<float>((pass->BoxLeft + boxX) * pass->CellWidth + pass->CellWidth / 2) * unseenScaleInverse.m_X);
+					if (unseenLayer->WrapsX()) { unseenX = ((unseenX % unseenBitmap->w) + unseenBitmap->w) % unseenBitmap->w; }
+
+					// getpixel returns -1 for anything off the bitmap, so positions past non-wrapping edges are skipped here as well.
+					int pixel = getpixel(unseenBitmap, unseenX, unseenY);
+					if (pixel != g_MaskColor && pixel != -1) {
+						putpixel(unseenBitmap, unseenX, unseenY, g_MaskColor);
+						seenPixels.push_back(Vector(static_cast<float>(unseenX), static_cast<float>(unseenY)));
+						if (revealedCount == 0) { revealedPos.SetXY(static_cast<float>(unseenX) * unseenLayer->GetScaleFactor().m_X, static_cast<float>(unseenY) * unseenLayer->GetScaleFactor().m_Y); }
+						++revealedCount;
+					}
+				}
+			}
+		}
+		m_LastCompletedPass = pass;
+		++m_CompletedPassCount;
+		return revealedCount;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::ComputePass(VisibilityPass &pass) {
+		ReadOpacity(pass);
+		pass.Visible.assign(pass.BoxWidth * pass.BoxHeight, 0);
+
+		// Transforms mapping the generic octant's column and row onto each of the eight real octants.
+		static constexpr std::array<int, 8> octantXX = { 1, 0, 0, -1, -1, 0, 0, 1 };
+		static constexpr std::array<int, 8> octantXY = { 0, 1, -1, 0, 0, -1, 1, 0 };
+		static constexpr std::array<int, 8> octantYX = { 0, 1, 1, 0, 0, -1, -1, 0 };
+		static constexpr std::array<int, 8> octantYY = { 1, 0, 0, 1, -1, 0, 0, -1 };
+
+		for (const EyePoint &eyePoint : pass.EyePoints) {
+			int eyeBoxX = eyePoint.CellX - pass.BoxLeft;
+			int eyeBoxY = eyePoint.CellY - pass.BoxTop;
+			if (eyeBoxX < 0 || eyeBoxX >= pass.BoxWidth || eyeBoxY < 0 || eyeBoxY >= pass.BoxHeight) {
+				continue;
+			}
+			pass.Visible[eyeBoxY * pass.BoxWidth + eyeBoxX] = 1;
+
+			int radius = static_cast<int>(std::ceil(eyePoint.Range / static_cast<float>(std::min(pass.CellWidth, pass.CellHeight))));
+			for (int octant = 0; octant < 8; ++octant) {
+				CastOctant(pass, eyePoint, radius, 1, 1.0F, 0.0F, octantXX[octant], octantXY[octant], octantYX[octant], octantYY[octant]);
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::ReadOpacity(VisibilityPass &pass) {
+		const BITMAP *materialBitmap = pass.MaterialBitmap;
+		pass.Opaque.resize(pass.BoxWidth * pass.BoxHeight);
+		for (int boxY = 0; boxY < pass.BoxHeight; ++boxY) {
+			int pixelY = (pass.BoxTop + boxY) * pass.CellHeight + pass.CellHeight / 2;
+			if (pass.WrapCellsY != 0) { pixelY = ((pixelY % materialBitmap->h) + materialBitmap->h) % materialBitmap->h; }
+			pixelY = std::min(pixelY, materialBitmap->h - 1);
+			const unsigned char *materialRow = materialBitmap->line[pixelY];
+
+			for (int boxX = 0; boxX < pass.BoxWidth; ++boxX) {
+				int pixelX = (pass.BoxLeft + boxX) * pass.CellWidth + pass.CellWidth / 2;
+				if (pass.WrapCellsX != 0) { pixelX = ((pixelX % materialBitmap->w) + materialBitmap->w) % materialBitmap->w; }
+				pixelX = std::min(pixelX, materialBitmap->w - 1);
+
+				pass.Opaque[boxY * pass.BoxWidth + boxX] = pass.OpaqueMaterials[materialRow[pixelX]];
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void TeamVisibility::CastOctant(VisibilityPass &pass, const EyePoint &eye, int radius, int row, float startSlope, float endSlope, int xx, int xy, int yx, int yy) {
+		if (startSlope < endSlope) {
+			return;
+		}
+		float rangeSquared = eye.Range * eye.Range;
+		float newStartSlope = 0;
+
+		for (int distance = row; distance <= radius; ++distance) {
+			bool blocked = false;
+			int deltaY = -distance;
+
+			for (int deltaX = -distance; deltaX <= 0; ++deltaX) {
+				float leftSlope = (static_cast<float>(deltaX) - 0.5F) / (static_cast<float>(deltaY) + 0.5F);
+				float rightSlope = (static_cast<float>(deltaX) + 0.5F) / (static_cast<float>(deltaY) - 0.5F);
+				if (startSlope < rightSlope) {
+					continue;
+				} else if (endSlope > leftSlope) {
+					break;
+				}
+				int offsetX = deltaX * xx + deltaY * xy;
+				int offsetY = deltaX * yx + deltaY * yy;
+				int boxX = eye.CellX + offsetX - pass.BoxLeft;
+				int boxY = eye.CellY + offsetY - pass.BoxTop;
+				bool inBox = boxX >= 0 && boxX < pass.BoxWidth && boxY >= 0 && boxY < pass.BoxHeight;
+
+				float pixelOffsetX = static_cast<float>(offsetX * pass.CellWidth);
+				float pixelOffsetY = static_cast<float>(offsetY * pass.CellHeight);
+				float distanceSquared = pixelOffsetX * pixelOffsetX + pixelOffsetY * pixelOffsetY;
+				// Cells outside the eye's cone still cast shadows, they just aren't seen themselves.
+				bool inCone = eye.SeesAllAround || pixelOffsetX * eye.LookX + pixelOffsetY * eye.LookY >= std::sqrt(distanceSquared) * eye.SpreadCosine;
+				if (inBox && inCone && distanceSquared <= rangeSquared) { pass.Visible[boxY * pass.BoxWidth + boxX] = 1; }
+
+				// Anything outside the snapshot box is past a non-wrapping scene edge, so treat it as a wall.
+				bool opaque = !inBox || pass.Opaque[boxY * pass.BoxWidth + boxX];
+				if (blocked) {
+					if (opaque) {
+						newStartSlope = rightSlope;
+						continue;
+					}
+					blocked = false;
+					startSlope = newStartSlope;
+				} else if (opaque && distance < radius) {
+					blocked = true;
+					CastOctant(pass, eye, radius, distance + 1, startSlope, leftSlope, xx, xy, yx, yy);
+					newStartSlope = rightSlope;
+				}
+			}
+			if (blocked) {
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,175 @@
+#ifndef _RTETEAMVISIBILITY_
+#define _RTETEAMVISIBILITY_
+
+#include "Vector.h"
+
+namespace RTE {
+
+	class SceneLayer;
+
+	/// <summary>
+	/// Computes what one team can see by running a recursive shadowcasting field-of-view from all of the team's eye points, at the resolution of the team's unseen layer.
+	/// Eye points are gathered over several sim updates and processed in one batch on a ThreadMan worker, and the resulting reveal mask is applied to the unseen layer in bulk.
+	/// Each eye point can be limited to a cone around the direction it looks in. The terrain around the eyes is read by the worker while the pass runs, so the Scene's terrain must outlive any pass in flight, see Reset().
+	/// </summary>
+	class TeamVisibility {
+
+	public:
+
+		static constexpr int c_UpdatesPerPass = 4; //!< How many sim updates eye points are gathered for before a new visibility pass is started.
+		static constexpr int c_DefaultCellSize = 8; //!< The cell size in pixels used when the team has no unseen layer to take the resolution from.
+		static constexpr float c_OpaqueStrength = 25.0F; //!< Material integrity at or above which a cell blocks sight. Matches the strength limit the old per-actor see rays used.
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a TeamVisibility object in system memory.
+		/// </summary>
+		TeamVisibility() { Clear(); }
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Drops all gathered eye points, any pass in flight and the last computed visibility. Waits for the pass in flight to finish first, since it reads the terrain.
+		/// Should be done whenever the Scene changes, before the old Scene's terrain is destroyed.
+		/// </summary>
+		void Reset();
+#pragma endregion
+
+#pragma region Getters and Setters
+		/// <summary>
+		/// Gets how many visibility passes have been completed and applied since the last reset.
+		/// </summary>
+		/// <returns>The number of completed passes.</returns>
+		long GetCompletedPassCount() const { return m_CompletedPassCount; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Adds an eye point to be included in the next visibility pass.
+		/// </summary>
+		/// <param name="eyePos">The absolute scene position of the eye.</param>
+		/// <param name="range">How far the eye can see, in pixels.</param>
+		/// <param name="lookDirection">The direction the eye looks in. A zero Vector makes the eye see all around.</param>
+		/// <param name="spreadAngle">How far to either side of the look direction the eye can see, in radians. Pi or more makes the eye see all around.</param>
+		void AddEyePoint(const Vector &eyePos, float range, const Vector &lookDirection, float spreadAngle);
+
+		/// <summary>
+		/// Applies the results of a finished pass to the unseen layer, and starts a new pass if it's this team's turn and no pass is in flight. Should be done once every sim update.
+		/// </summary>
+		/// <param name="team">The team this TeamVisibility is for.</param>
+		/// <param name="simUpdateNumber">The number of the current sim update, used to stagger passes of different teams across updates.</param>
+		/// <param name="revealedPos">Set to the scene position of the first unseen pixel revealed this update, if any.</param>
+		/// <returns>How many unseen pixels were revealed this update.</returns>
+		int Update(int team, long simUpdateNumber, Vector &revealedPos);
+
+		/// <summary>
+		/// Tells whether a scene position was in the field of view of any of the team's eyes as of the last completed pass.
+		/// </summary>
+		/// <param name="pixelX">The X coordinate of the scene position to check.</param>
+		/// <param name="pixelY">The Y coordinate of the scene position to check.</param>
+		/// <returns>Whether the position is visible to the team.</returns>
+		bool IsVisible(int pixelX, int pixelY) const;
+#pragma endregion
+
+	private:
+
+		/// <summary>
+		/// A single eye point, as it was added.
+		/// </summary>
+		struct GatheredEyePoint {
+			Vector Pos; //!< The absolute scene position of the eye.
+			float Range; //!< How far the eye can see, in pixels.
+			Vector LookDirection; //!< The direction the eye looks in, or a zero Vector if it sees all around.
+			float SpreadAngle; //!< How far to either side of the look direction the eye can see, in radians.
+		};
+
+		/// <summary>
+		/// A single eye point, in cell coordinates.
+		/// </summary>
+		struct EyePoint {
+			int CellX; //!< The X coordinate of the cell the eye is in.
+			int CellY; //!< The Y coordinate of the cell the eye is in.
+			float Range; //!< How far the eye can see, in pixels.
+			bool SeesAllAround; //!< Whether the eye sees all around, in which case the look direction and spread are ignored.
+			float LookX; //!< The X component of the normalized direction the eye looks in.
+			float LookY; //!< The Y component of the normalized direction the eye looks in.
+			float SpreadCosine; //!< The cosine of how far to either side of the look direction the eye can see.
+		};
+
+		/// <summary>
+		/// Everything a visibility pass needs as input and produces as output. Shared between the main thread and the worker so neither has to touch the other's data while the pass runs.
+		/// </summary>
+		struct VisibilityPass {
+			int CellWidth; //!< The width of each cell in pixels.
+			int CellHeight; //!< The height of each cell in pixels.
+			int BoxLeft; //!< The left edge of the snapshot box, in unwrapped cell coordinates.
+			int BoxTop; //!< The top edge of the snapshot box, in unwrapped cell coordinates.
+			int BoxWidth; //!< The width of the snapshot box, in cells.
+			int BoxHeight; //!< The height of the snapshot box, in cells.
+			int WrapCellsX; //!< The scene width in cells if the scene wraps horizontally, 0 otherwise.
+			int WrapCellsY; //!< The scene height in cells if the scene wraps vertically, 0 otherwise.
+			std::vector<EyePoint> EyePoints; //!< The eye points to cast the field of view from.
+			const BITMAP *MaterialBitmap; //!< The material bitmap of the Scene's terrain, read by the worker to fill in Opaque. Not owned.
+			std::array<unsigned char, c_PaletteEntriesNumber> OpaqueMaterials; //!< Whether each material blocks sight, looked up on the main thread since the material palette isn't thread safe.
+			std::vector<unsigned char> Opaque; //!< Whether each cell in the snapshot box blocks sight. Row-major. Filled in by the worker.
+			std::vector<unsigned char> Visible; //!< Whether each cell in the snapshot box is visible. Row-major. This is the result of the pass.
+		};
+
+		int m_CellWidth; //!< The width of each cell in pixels, as of the last started pass.
+		int m_CellHeight; //!< The height of each cell in pixels, as of the last started pass.
+		std::vector<GatheredEyePoint> m_GatheredEyePoints; //!< The eye points gathered since the last pass was started.
+		std::shared_ptr<VisibilityPass> m_PassInFlight; //!< The pass currently being computed by a worker, if any.
+		std::future<void> m_PassInFlightResult; //!< The future that becomes ready when the pass in flight is done.
+		std::shared_ptr<const VisibilityPass> m_LastCompletedPass; //!< The last pass that was completed and applied, used for visibility queries.
+		long m_CompletedPassCount; //!< How many passes have been completed and applied since the last reset.
+
+		/// <summary>
+		/// Snapshots the gathered eye points and works out the box of cells around them, and queues a new pass on a worker thread.
+		/// </summary>
+		/// <param name="unseenLayer">The team's unseen layer, if any. The cell size is taken from its resolution.</param>
+		void StartPass(const SceneLayer *unseenLayer);
+
+		/// <summary>
+		/// Reveals all the cells a completed pass found visible on the team's unseen layer, and makes the pass the one visibility queries are answered from.
+		/// </summary>
+		/// <param name="team">The team this TeamVisibility is for.</param>
+		/// <param name="unseenLayer">The team's unseen layer, if any.</param>
+		/// <param name="revealedPos">Set to the scene position of the first unseen pixel revealed, if any.</param>
+		/// <returns>How many unseen pixels were revealed.</returns>
+		int ApplyPass(int team, SceneLayer *unseenLayer, Vector &revealedPos);
+
+		/// <summary>
+		/// Computes the field of view of all the eye points of a pass. Safe to run on a worker thread since it only touches the pass itself and reads the terrain.
+		/// </summary>
+		/// <param name="pass">The pass to compute.</param>
+		static void ComputePass(VisibilityPass &pass);
+
+		/// <summary>
+		/// Fills in whether each cell in the box of a pass blocks sight, going by the terrain material at the center of the cell.
+		/// The sim may be changing the terrain while this reads it, in which case a changed cell counts as either its old or its new material until the next pass.
+		/// </summary>
+		/// <param name="pass">The pass to fill in the opacity of.</param>
+		static void ReadOpacity(VisibilityPass &pass);
+
+		/// <summary>
+		/// Recursively casts light through one octant around an eye, marking lit cells as visible. This is the classic recursive shadowcasting algorithm.
+		/// </summary>
+		/// <param name="pass">The pass being computed.</param>
+		/// <param name="eye">The eye point being cast from.</param>
+		/// <param name="radius">The range of the eye in cells along the shorter cell axis.</param>
+		/// <param name="row">The row distance from the eye to start at.</param>
+		/// <param name="startSlope">The slope of the start of the lit wedge.</param>
+		/// <param name="endSlope">The slope of the end of the lit wedge.</param>
+		/// <param name="xx">Octant transform component mapping column to X.</param>
+		/// <param name="xy">Octant transform component mapping row to X.</param>
+		/// <param name="yx">Octant transform component mapping column to Y.</param>
+		/// <param name="yy">Octant transform component mapping row to Y.</param>
+		static void CastOctant(VisibilityPass &pass, const EyePoint &eye, int radius, int row, float startSlope, float endSlope, int xx, int xy, int yx, int yy);
+
+		/// <summary>
+		/// Clears all the member variables of this TeamVisibility, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+	};
+}
+#endif
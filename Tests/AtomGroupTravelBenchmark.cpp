@@ -0,0 +1,209 @@
+#include "AtomGroup.h"
+#include "MOSRotating.h"
+#include "Scene.h"
+#include "SLTerrain.h"
+#include "Material.h"
+#include "Reader.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// Measures how many AtomGroup travels per second a crowd of AHuman sized bodies gets through, dropped onto generated terrain and left to fall, bounce and come to rest on it, so both airborne and resting travel are covered.
+	/// Loading an actual AHuman needs the data modules, so each body is a bare MOSRotating with an AtomGroup generated the same way AutoGenerate does, off the outline of a standing AHuman sized silhouette.
+	/// </summary>
+	class AtomGroupTravelBenchmark {
+
+	public:
+
+		/// <summary>
+		/// Sets up the Scene, runs the crowd for a few crowd sizes and prints the results.
+		/// </summary>
+		static void Run() {
+			install_allegro(SYSTEM_NONE, &errno, std::atexit);
+			CreateMaterials();
+			CreateScene();
+			CreateSilhouette();
+
+			for (int bodyCount : { 20, 100, 400 }) {
+				RunCase(bodyCount);
+			}
+
+			destroy_bitmap(s_Silhouette);
+			DestroyScene();
+		}
+
+	private:
+
+		static constexpr int c_SceneWidth = 2048; //!< The width of the generated Scene.
+		static constexpr int c_SceneHeight = 1024; //!< The height of the generated Scene.
+		static constexpr int c_SilhouetteWidth = 14; //!< The width of the body silhouette, about that of an AHuman's torso and arms.
+		static constexpr int c_SilhouetteHeight = 44; //!< The height of the body silhouette, about that of a standing AHuman.
+		static constexpr int c_AtomResolution = 3; //!< The spacing of the Atoms along the silhouette's outline, in pixels.
+		static constexpr int c_FrameCount = 300; //!< How many sim updates the crowd is run for in each case.
+		static constexpr float c_TimeStep = 1.0F / 60.0F; //!< The length of each sim update, in seconds.
+
+		static constexpr unsigned char c_Dirt = 5; //!< The ground material, strong enough that the bodies never dig into it.
+		static constexpr unsigned char c_Flesh = 12; //!< The material of the bodies' Atoms.
+
+		static BITMAP *s_Silhouette; //!< The silhouette of a body, a mask colored BITMAP with a capsule in the middle.
+
+		/// <summary>
+		/// Reads the materials into SceneMan's material palette, the same way SceneMan reads AddMaterial properties.
+		/// </summary>
+		static void CreateMaterials() {
+			const std::string materialFile = (std::filesystem::temp_directory_path() / "AtomGroupTravelBenchmarkMaterial.ini").generic_string();
+			for (const auto &[index, integrity] : { std::make_pair(static_cast<int>(g_MaterialAir), 0), std::make_pair(static_cast<int>(c_Dirt), 1000), std::make_pair(static_cast<int>(c_Flesh), 50) }) {
+				std::ofstream(materialFile) << "AddMaterial = Material\n\tIndex = " << index << "\n\tIntegrity = " << integrity << "\n\tRestitution = 0.3\n\tFriction = 0.8\n";
+				// The file is outside of any data module, so it's opened without the case sensitive path check against the working directory.
+				Reader reader(materialFile, false, nullptr, true);
+				reader.NextProperty();
+				reader.ReadPropName();
+				Material *material = new Material();
+				material->Serializable::Create(reader);
+				g_SceneMan.m_apMatPalette.at(index) = material;
+			}
+			std::filesystem::remove(materialFile);
+		}
+
+		/// <summary>
+		/// Makes a generated Scene, which wraps horizontally, the current Scene. It has gently rolling ground and an empty MOID layer.
+		/// </summary>
+		static void CreateScene() {
+			BITMAP *materialBitmap = create_bitmap_ex(8, c_SceneWidth, c_SceneHeight);
+			clear_to_color(materialBitmap, g_MaterialAir);
+			for (int pixelX = 0; pixelX < c_SceneWidth; ++pixelX) {
+				int groundHeight = c_SceneHeight * 3 / 4 + static_cast<int>(std::sin(static_cast<float>(pixelX) / 120.0F) * 40.0F);
+				vline(materialBitmap, pixelX, groundHeight, c_SceneHeight - 1, c_Dirt);
+			}
+			SLTerrain *terrain = new SLTerrain();
+			terrain->SceneLayer::Create(materialBitmap, false, Vector(), true, false, Vector(1.0F, 1.0F));
+			Scene *scene = new Scene();
+			scene->Create(terrain);
+			g_SceneMan.m_pCurrentScene = scene;
+
+			BITMAP *moidBitmap = create_bitmap_ex(c_MOIDLayerBitDepth, c_SceneWidth, c_SceneHeight);
+			clear_to_color(moidBitmap, g_NoMOID);
+			g_SceneMan.m_pMOIDLayer = new SceneLayer();
+			g_SceneMan.m_pMOIDLayer->Create(moidBitmap, false, Vector(), true, false, Vector(1.0F, 1.0F));
+		}
+
+		/// <summary>
+		/// Removes the generated Scene and its MOID layer from SceneMan.
+		/// </summary>
+		static void DestroyScene() {
+			delete g_SceneMan.m_pMOIDLayer;
+			g_SceneMan.m_pMOIDLayer = nullptr;
+			delete g_SceneMan.m_pCurrentScene;
+			g_SceneMan.m_pCurrentScene = nullptr;
+		}
+
+		/// <summary>
+		/// Draws the body silhouette, a capsule standing upright.
+		/// </summary>
+		static void CreateSilhouette() {
+			s_Silhouette = create_bitmap_ex(8, c_SilhouetteWidth, c_SilhouetteHeight);
+			clear_to_color(s_Silhouette, g_MaskColor);
+			const int radius = c_SilhouetteWidth / 2 - 1;
+			rectfill(s_Silhouette, 1, radius, c_SilhouetteWidth - 2, c_SilhouetteHeight - 1 - radius, c_Flesh);
+			circlefill(s_Silhouette, c_SilhouetteWidth / 2, radius, radius, c_Flesh);
+			circlefill(s_Silhouette, c_SilhouetteWidth / 2, c_SilhouetteHeight - 1 - radius, radius, c_Flesh);
+		}
+
+		/// <summary>
+		/// Makes the Atoms for a body, one every few pixels along the left and right edges of each row of the silhouette and the top and bottom edges of each column, the way AtomGroup generates them off a sprite.
+		/// </summary>
+		/// <param name="body">The body to make the Atoms for.</param>
+		/// <returns>The Atoms of the body. Owned by the caller.</returns>
+		static std::vector<Atom *> CreateAtoms(MOSRotating *body) {
+			const Vector silhouetteCenter(static_cast<float>(c_SilhouetteWidth / 2), static_cast<float>(c_SilhouetteHeight / 2));
+			std::set<std::pair<int, int>> edgePixels;
+			for (int pixelY = 0; pixelY < c_SilhouetteHeight; pixelY += c_AtomResolution) {
+				for (int pixelX = 0; pixelX < c_SilhouetteWidth; ++pixelX) {
+					if (getpixel(s_Silhouette, pixelX, pixelY) != g_MaskColor) { edgePixels.insert({ pixelX, pixelY }); break; }
+				}
+				for (int pixelX = c_SilhouetteWidth - 1; pixelX >= 0; --pixelX) {
+					if (getpixel(s_Silhouette, pixelX, pixelY) != g_MaskColor) { edgePixels.insert({ pixelX, pixelY }); break; }
+				}
+			}
+			for (int pixelX = 0; pixelX < c_SilhouetteWidth; pixelX += c_AtomResolution) {
+				for (int pixelY = 0; pixelY < c_SilhouetteHeight; ++pixelY) {
+					if (getpixel(s_Silhouette, pixelX, pixelY) != g_MaskColor) { edgePixels.insert({ pixelX, pixelY }); break; }
+				}
+				for (int pixelY = c_SilhouetteHeight - 1; pixelY >= 0; --pixelY) {
+					if (getpixel(s_Silhouette, pixelX, pixelY) != g_MaskColor) { edgePixels.insert({ pixelX, pixelY }); break; }
+				}
+			}
+			std::vector<Atom *> atoms;
+			for (const auto &[pixelX, pixelY] : edgePixels) {
+				Atom *atom = new Atom(Vector(static_cast<float>(pixelX), static_cast<float>(pixelY)) - silhouetteCenter, c_Flesh, body);
+				atom->CalculateNormal(s_Silhouette, silhouetteCenter);
+				atoms.push_back(atom);
+			}
+			return atoms;
+		}
+
+		/// <summary>
+		/// Drops a crowd of bodies over the Scene and travels all of them every sim update for a while, then prints how many travels per second got made.
+		/// </summary>
+		/// <param name="bodyCount">How many bodies are in the crowd.</param>
+		static void RunCase(int bodyCount) {
+			std::mt19937 randomGenerator(7331);
+			std::vector<MOSRotating *> bodies;
+			std::vector<AtomGroup *> atomGroups;
+			int atomCount = 0;
+			for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+				MOSRotating *body = new MOSRotating();
+				body->SetMass(80.0F);
+				body->SetToHitMOs(false);
+				body->SetPos(Vector(static_cast<float>(randomGenerator() % c_SceneWidth), static_cast<float>(c_SceneHeight / 2 + static_cast<int>(randomGenerator() % 100))));
+				body->SetVel(Vector(static_cast<float>(static_cast<int>(randomGenerator() % 21) - 10), 0));
+
+				AtomGroup *atomGroup = new AtomGroup();
+				atomGroup->Create();
+				atomGroup->SetOwner(body);
+				std::vector<Atom *> atoms = CreateAtoms(body);
+				atomGroup->AddAtoms(atoms);
+				atomCount += static_cast<int>(atoms.size());
+				for (const Atom *atom : atoms) {
+					delete atom;
+				}
+				bodies.push_back(body);
+				atomGroups.push_back(atomGroup);
+			}
+
+			const Vector gravity(0, 9.8F * c_TimeStep);
+			const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			for (int frame = 0; frame < c_FrameCount; ++frame) {
+				for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+					bodies[bodyIndex]->SetVel(bodies[bodyIndex]->GetVel() + gravity);
+					atomGroups[bodyIndex]->Travel(c_TimeStep);
+				}
+			}
+			const std::chrono::duration<double> elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+			// The checksum is of where the bodies came to rest, so runs of the same case can be checked for giving the same results.
+			long long checksum = 0;
+			for (const MOSRotating *body : bodies) {
+				checksum += body->GetPos().GetFloorIntX() * 3 + body->GetPos().GetFloorIntY();
+			}
+			std::printf("%4i bodies, %5i Atoms: %10.0f travels/sec, %6.2f ms per update (checksum %lld)\n", bodyCount, atomCount, static_cast<double>(bodyCount) * c_FrameCount / elapsedTime.count(), elapsedTime.count() * 1000.0 / c_FrameCount, checksum);
+
+			for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex) {
+				delete atomGroups[bodyIndex];
+				delete bodies[bodyIndex];
+			}
+		}
+	};
+
+	BITMAP *AtomGroupTravelBenchmark::s_Silhouette = nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Implementation of the main function that runs the AtomGroup travel benchmark.
+/// </summary>
+int main() {
+	RTE::AtomGroupTravelBenchmark::Run();
+	return 0;
+}
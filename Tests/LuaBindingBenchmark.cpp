@@ -0,0 +1,121 @@
+#include "LuaMan.h"
+#include "LuaBindDefinitions.h"
+#include "Actor.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// Measures how many property gets and sets, method calls and Vector operations per second scripts get through on the most used bindings, once with the LuaFastPathBindings handlers and once through LuaBind alone.
+	/// The object is a bare Actor, so no data modules or Scene need to be loaded.
+	/// </summary>
+	class LuaBindingBenchmark {
+
+	public:
+
+		/// <summary>
+		/// Runs all the cases with and without the fast path and prints their results side by side.
+		/// </summary>
+		static void Run() {
+			install_allegro(SYSTEM_NONE, &errno, std::atexit);
+			Actor *actor = new Actor();
+			actor->SetPos(Vector(100.0F, 200.0F));
+			actor->SetNumberValue("Ammo", 30.0);
+
+			std::vector<double> luaBindRates = RunCases(actor, true);
+			std::vector<double> fastPathRates = RunCases(actor, false);
+
+			std::printf("%-32s %14s %14s %8s\n", "", "LuaBind", "Fast path", "Speedup");
+			for (size_t caseIndex = 0; caseIndex < c_Cases.size(); ++caseIndex) {
+				std::printf("%-32s %10.2f M/s %10.2f M/s %7.2fx\n", c_Cases[caseIndex].first, luaBindRates[caseIndex] / 1.0e6, fastPathRates[caseIndex] / 1.0e6, fastPathRates[caseIndex] / luaBindRates[caseIndex]);
+			}
+			delete actor;
+		}
+
+	private:
+
+		static constexpr int c_Iterations = 100000; //!< How many times each timed run of a case does its operation.
+		static constexpr double c_CaseDuration = 0.3; //!< How long each case is run for, in seconds.
+
+		/// <summary>
+		/// The name and loop body of each case. The body can use the Actor as actor, two Vectors as vector and otherVector, the loop counter i, and should add whatever it reads to result.
+		/// </summary>
+		static const std::array<std::pair<const char *, const char *>, 11> c_Cases;
+
+		/// <summary>
+		/// Creates a Lua state the way the game does, runs all the cases in it and destroys it again.
+		/// </summary>
+		/// <param name="actor">The Actor to run the cases on.</param>
+		/// <param name="disableFastPath">Whether to leave out the fast path handlers, so everything goes through LuaBind.</param>
+		/// <returns>The operations per second of each case.</returns>
+		static std::vector<double> RunCases(Actor *actor, bool disableFastPath) {
+			// Set the same way the Settings.ini property sets it. Destroy resets it again.
+			g_LuaMan.m_DisableLuaFastPath = disableFastPath;
+			g_LuaMan.Initialize();
+			luabind::globals(g_LuaMan.m_MasterState)["actor"] = actor;
+
+			std::vector<double> rates;
+			for (const auto &[caseName, caseBody] : c_Cases) {
+				rates.push_back(RunCase(caseName, caseBody));
+			}
+			g_LuaMan.Destroy();
+			return rates;
+		}
+
+		/// <summary>
+		/// Runs a case over and over for a while.
+		/// </summary>
+		/// <param name="caseName">The name of the case, to report errors with.</param>
+		/// <param name="caseBody">The Lua code to run in each iteration.</param>
+		/// <returns>How many operations per second got done, or 0 if the case failed.</returns>
+		static double RunCase(const std::string &caseName, const std::string &caseBody) {
+			const std::string caseScript =
+				"function BenchmarkCase(iterations)\n"
+				"	local vector = Vector(3, 4);\n"
+				"	local otherVector = Vector(-2, 7);\n"
+				"	local result = 0;\n"
+				"	for i = 1, iterations do\n"
+				"		" + caseBody + "\n"
+				"	end\n"
+				"	BenchmarkResult = result;\n"
+				"end\n";
+			const std::string runScript = "BenchmarkCase(" + std::to_string(c_Iterations) + ");";
+			if (g_LuaMan.RunScriptString(caseScript, false) < 0 || g_LuaMan.RunScriptString(runScript, false) < 0) {
+				std::printf("%-32s failed: %s\n", caseName.c_str(), g_LuaMan.GetLastError().c_str());
+				return 0;
+			}
+			const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			std::chrono::duration<double> elapsedTime(0);
+			long long operationCount = 0;
+			while (elapsedTime.count() < c_CaseDuration) {
+				g_LuaMan.RunScriptString(runScript, false);
+				operationCount += c_Iterations;
+				elapsedTime = std::chrono::steady_clock::now() - startTime;
+			}
+			return static_cast<double>(operationCount) / elapsedTime.count();
+		}
+	};
+
+	const std::array<std::pair<const char *, const char *>, 11> LuaBindingBenchmark::c_Cases = { {
+		{ "Vector.X get", "result = result + vector.X;" },
+		{ "Vector.X set", "vector.X = i;" },
+		{ "Vector:Dot()", "result = result + vector:Dot(otherVector);" },
+		{ "Vector + Vector", "result = result + (vector + otherVector).Y;" },
+		{ "Actor.Pos get", "result = result + actor.Pos.X;" },
+		{ "Actor.Pos set", "actor.Pos = vector;" },
+		{ "Actor.Health get", "result = result + actor.Health;" },
+		{ "Actor.Health set", "actor.Health = i;" },
+		{ "Actor.Team get", "result = result + actor.Team;" },
+		{ "Actor:IsDead()", "if not actor:IsDead() then result = result + 1; end" },
+		{ "Actor:GetNumberValue()", "result = result + actor:GetNumberValue(\"Ammo\");" }
+	} };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Implementation of the main function that runs the Lua binding benchmark.
+/// </summary>
+int main() {
+	RTE::LuaBindingBenchmark::Run();
+	return 0;
+}
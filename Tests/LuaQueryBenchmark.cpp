@@ -0,0 +1,154 @@
+#include "LuaMan.h"
+#include "lua.hpp"
+#include "MovableMan.h"
+#include "Scene.h"
+#include "SLTerrain.h"
+#include "Actor.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// Measures how many times per second a typical "find all enemies within 500px" script gets through, once iterating MovableMan.Actors in Lua the way scripts always have and once through MovableMan:QueryActors.
+	/// The Actors are bare ones scattered over a generated wrapping Scene, so no data modules need to be loaded.
+	/// </summary>
+	class LuaQueryBenchmark {
+
+	public:
+
+		/// <summary>
+		/// Sets up the Scene, the Actors and the Lua state, runs both cases for a few crowd sizes and prints their results.
+		/// </summary>
+		static void Run() {
+			install_allegro(SYSTEM_NONE, &errno, std::atexit);
+			CreateScene();
+			g_LuaMan.Initialize();
+			g_LuaMan.RunScriptString(c_FindEnemiesScript);
+
+			for (int actorCount : { 50, 200, 800 }) {
+				CreateActors(actorCount);
+				std::printf("%i Actors:\n", actorCount);
+				RunCase("Iterating MovableMan.Actors", "FindEnemiesByIterating");
+				RunCase("MovableMan:QueryActors", "FindEnemiesByQuery");
+				DestroyActors();
+			}
+
+			g_LuaMan.Destroy();
+			DestroyScene();
+		}
+
+	private:
+
+		static constexpr int c_SceneWidth = 4096; //!< The width of the generated Scene.
+		static constexpr int c_SceneHeight = 1024; //!< The height of the generated Scene.
+		static constexpr int c_SearchCount = 256; //!< How many searches each timed run of the script makes, from different centers and teams.
+		static constexpr double c_CaseDuration = 0.5; //!< How long each case is run for, in seconds.
+
+		/// <summary>
+		/// Both ways of finding the enemies, and the loop that times them. Every search is made for a different team from a different center, and the number of all the enemies found is kept as a checksum.
+		/// </summary>
+		static constexpr const char *c_FindEnemiesScript =
+			"function FindEnemiesByIterating(team, center)\n"
+			"	local enemies = {};\n"
+			"	for actor in MovableMan.Actors do\n"
+			"		if actor.Team ~= team and SceneMan:ShortestDistance(center, actor.Pos, SceneMan.SceneWrapsX).Magnitude < 500 then\n"
+			"			enemies[#enemies + 1] = actor;\n"
+			"		end\n"
+			"	end\n"
+			"	return enemies;\n"
+			"end\n"
+			"function FindEnemiesByQuery(team, center)\n"
+			"	local query = MOQuery();\n"
+			"	query.NotOfTeam = team;\n"
+			"	query.Center = center;\n"
+			"	query.Radius = 500;\n"
+			"	return MovableMan:QueryActors(query);\n"
+			"end\n"
+			"function RunSearches(findEnemies, searchCount)\n"
+			"	local foundCount = 0;\n"
+			"	for search = 1, searchCount do\n"
+			"		local enemies = findEnemies(search % 4, Vector((search * 397) % 4096, (search * 131) % 1024));\n"
+			"		foundCount = foundCount + #enemies;\n"
+			"	end\n"
+			"	BenchmarkFoundCount = foundCount;\n"
+			"end\n";
+
+		/// <summary>
+		/// Makes a generated empty Scene, which wraps horizontally, the current Scene.
+		/// </summary>
+		static void CreateScene() {
+			BITMAP *materialBitmap = create_bitmap_ex(8, c_SceneWidth, c_SceneHeight);
+			clear_to_color(materialBitmap, g_MaterialAir);
+			SLTerrain *terrain = new SLTerrain();
+			terrain->SceneLayer::Create(materialBitmap, false, Vector(), true, false, Vector(1.0F, 1.0F));
+			Scene *scene = new Scene();
+			scene->Create(terrain);
+			g_SceneMan.m_pCurrentScene = scene;
+		}
+
+		/// <summary>
+		/// Removes the generated Scene from SceneMan.
+		/// </summary>
+		static void DestroyScene() {
+			delete g_SceneMan.m_pCurrentScene;
+			g_SceneMan.m_pCurrentScene = nullptr;
+		}
+
+		/// <summary>
+		/// Scatters bare Actors of four teams over the Scene and puts them straight into MovableMan's Actor list.
+		/// </summary>
+		/// <param name="actorCount">How many Actors to make.</param>
+		static void CreateActors(int actorCount) {
+			std::mt19937 randomGenerator(1987);
+			for (int actorIndex = 0; actorIndex < actorCount; ++actorIndex) {
+				Actor *actor = new Actor();
+				actor->SetPos(Vector(static_cast<float>(randomGenerator() % c_SceneWidth), static_cast<float>(randomGenerator() % c_SceneHeight)));
+				actor->SetTeam(actorIndex % 4);
+				g_MovableMan.m_Actors.push_back(actor);
+			}
+		}
+
+		/// <summary>
+		/// Removes and deletes all the Actors in MovableMan's Actor list.
+		/// </summary>
+		static void DestroyActors() {
+			for (const Actor *actor : g_MovableMan.m_Actors) {
+				delete actor;
+			}
+			g_MovableMan.m_Actors.clear();
+		}
+
+		/// <summary>
+		/// Runs the searches with one of the ways of finding enemies over and over for a while, and prints how many searches per second got made.
+		/// </summary>
+		/// <param name="caseName">The name of the case to print.</param>
+		/// <param name="findEnemiesFunction">The name of the Lua function that finds the enemies.</param>
+		static void RunCase(const std::string &caseName, const std::string &findEnemiesFunction) {
+			const std::string searchScript = "RunSearches(" + findEnemiesFunction + ", " + std::to_string(c_SearchCount) + ");";
+			const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			std::chrono::duration<double> elapsedTime(0);
+			long long searchCount = 0;
+			while (elapsedTime.count() < c_CaseDuration) {
+				if (g_LuaMan.RunScriptString(searchScript, false) < 0) {
+					std::printf("  %-32s failed: %s\n", caseName.c_str(), g_LuaMan.GetLastError().c_str());
+					return;
+				}
+				searchCount += c_SearchCount;
+				elapsedTime = std::chrono::steady_clock::now() - startTime;
+			}
+			lua_getglobal(g_LuaMan.m_MasterState, "BenchmarkFoundCount");
+			long long foundCount = static_cast<long long>(lua_tonumber(g_LuaMan.m_MasterState, -1));
+			lua_pop(g_LuaMan.m_MasterState, 1);
+			std::printf("  %-32s %10.0f searches/sec (%lld enemies found per run)\n", caseName.c_str(), static_cast<double>(searchCount) / elapsedTime.count(), foundCount);
+		}
+	};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Implementation of the main function that runs the Lua MO query benchmark.
+/// </summary>
+int main() {
+	RTE::LuaQueryBenchmark::Run();
+	return 0;
+}
@@ -0,0 +1,1503 @@
+#include "SceneMan.h"
+#include "Scene.h"
+#include "SLTerrain.h"
+#include "Material.h"
+#include "Reader.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// Pins the results of every SceneMan Cast*Ray entry point to what the hand-written Bresenham loops they used to be gave, on small fixture Scenes with terrain, MOIDs and an unseen layer.
+	/// The golden results at the bottom of this file were recorded from those loops. Run with --record to print the results of the current ray casts in the same format instead of checking them.
+	/// </summary>
+	class SceneManCastTests {
+
+	public:
+
+		/// <summary>
+		/// Sets up the fixture Scenes one after another and runs all the ray casts on each.
+		/// </summary>
+		/// <param name="record">Whether to print the results instead of checking them against the golden results.</param>
+		/// <returns>The number of results that didn't match.</returns>
+		static int Run(bool record) {
+			install_allegro(SYSTEM_NONE, &errno, std::atexit);
+			CreateMaterials();
+
+			std::vector<std::string> results;
+			for (const auto &[wrapsX, wrapsY] : { std::make_pair(true, true), std::make_pair(false, false), std::make_pair(true, false) }) {
+				CreateScene(wrapsX, wrapsY);
+				CastAllRays(std::string(wrapsX ? "X" : "-") + (wrapsY ? "Y" : "-"), results);
+				DestroyScene();
+			}
+			if (record) {
+				for (const std::string &result : results) {
+					std::printf("\t\t\"%s\",\n", result.c_str());
+				}
+				return 0;
+			}
+
+			const size_t goldenCount = c_GoldenResults.size();
+			int failureCount = (results.size() == goldenCount) ? 0 : 1;
+			if (failureCount > 0) { std::printf("FAILED: got %zu results instead of %zu\n", results.size(), goldenCount); }
+			for (size_t index = 0; index < std::min(results.size(), goldenCount); ++index) {
+				if (results[index] != c_GoldenResults[index]) {
+					std::printf("FAILED: expected \"%s\"\n             got \"%s\"\n", c_GoldenResults[index].c_str(), results[index].c_str());
+					failureCount++;
+				}
+			}
+			std::printf("%zu results, %i failed\n", results.size(), failureCount);
+			return failureCount;
+		}
+
+	private:
+
+		static constexpr int c_SceneWidth = 96; //!< The width of the fixture Scenes.
+		static constexpr int c_SceneHeight = 64; //!< The height of the fixture Scenes.
+		static constexpr int c_UnseenScale = 2; //!< How many times smaller than the Scenes the fixture unseen layer is.
+		static constexpr int c_RayCount = 24; //!< How many rays are cast on each fixture Scene.
+
+		static constexpr unsigned char c_Sand = 5; //!< A weak fixture material.
+		static constexpr unsigned char c_Concrete = 12; //!< A strong fixture material.
+
+		static const std::vector<std::string> c_GoldenResults; //!< The results the hand-written ray casts gave, in the order they are cast in.
+
+		/// <summary>
+		/// Reads the fixture materials into SceneMan's material palette, the same way SceneMan reads AddMaterial properties.
+		/// </summary>
+		static void CreateMaterials() {
+			const std::string materialFile = (std::filesystem::temp_directory_path() / "SceneManCastTestsMaterial.ini").generic_string();
+			for (const auto &[index, integrity] : { std::make_pair(static_cast<int>(g_MaterialAir), 0), std::make_pair(static_cast<int>(c_Sand), 30), std::make_pair(static_cast<int>(c_Concrete), 100), std::make_pair(static_cast<int>(g_MaterialDoor), 500) }) {
+				std::ofstream(materialFile) << "AddMaterial = Material\n\tIndex = " << index << "\n\tIntegrity = " << integrity << "\n";
+				// The file is outside of any data module, so it's opened without the case sensitive path check against the working directory.
+				Reader reader(materialFile, false, nullptr, true);
+				reader.NextProperty();
+				reader.ReadPropName();
+				Material *material = new Material();
+				material->Serializable::Create(reader);
+				g_SceneMan.m_apMatPalette.at(index) = material;
+			}
+			std::filesystem::remove(materialFile);
+		}
+
+		/// <summary>
+		/// Makes a fixture Scene the current Scene. It has ground, a wall with a door, scattered pixels of every material, MOs straddling the seams and an unseen layer for team one.
+		/// </summary>
+		/// <param name="wrapsX">Whether the Scene wraps horizontally.</param>
+		/// <param name="wrapsY">Whether the Scene wraps vertically.</param>
+		static void CreateScene(bool wrapsX, bool wrapsY) {
+			BITMAP *materialBitmap = create_bitmap_ex(8, c_SceneWidth, c_SceneHeight);
+			std::mt19937 randomGenerator(20201);
+			for (int pixelY = 0; pixelY < c_SceneHeight; ++pixelY) {
+				for (int pixelX = 0; pixelX < c_SceneWidth; ++pixelX) {
+					int material = g_MaterialAir;
+					if (pixelY >= 50) {
+						material = (pixelY >= 58) ? c_Concrete : c_Sand;
+					} else if (pixelX >= 70 && pixelX < 73 && pixelY >= 12) {
+						material = (pixelY >= 30 && pixelY < 38) ? g_MaterialDoor : c_Concrete;
+					} else if (randomGenerator() % 16 == 0) {
+						const int scatteredMaterials[] = { c_Sand, c_Concrete, g_MaterialDoor };
+						material = scatteredMaterials[randomGenerator() % 3];
+					}
+					putpixel(materialBitmap, pixelX, pixelY, material);
+				}
+			}
+			SLTerrain *terrain = new SLTerrain();
+			terrain->SceneLayer::Create(materialBitmap, false, Vector(), wrapsX, wrapsY, Vector(1.0F, 1.0F));
+			Scene *scene = new Scene();
+			scene->Create(terrain);
+			g_SceneMan.m_pCurrentScene = scene;
+
+			BITMAP *moidBitmap = create_bitmap_ex(c_MOIDLayerBitDepth, c_SceneWidth, c_SceneHeight);
+			clear_to_color(moidBitmap, g_NoMOID);
+			rectfill(moidBitmap, 20, 20, 27, 35, 3);
+			rectfill(moidBitmap, 40, 5, 45, 14, 7);
+			rectfill(moidBitmap, 92, 40, 95, 47, 3);
+			rectfill(moidBitmap, 0, 40, 3, 47, 3);
+			rectfill(moidBitmap, 60, 0, 63, 3, 7);
+			rectfill(moidBitmap, 60, 60, 63, 63, 7);
+			g_SceneMan.m_pMOIDLayer = new SceneLayer();
+			g_SceneMan.m_pMOIDLayer->Create(moidBitmap, false, Vector(), wrapsX, wrapsY, Vector(1.0F, 1.0F));
+
+			SceneLayer *unseenLayer = new SceneLayer();
+			unseenLayer->Create(create_bitmap_ex(8, c_SceneWidth / c_UnseenScale, c_SceneHeight / c_UnseenScale), false, Vector(), wrapsX, wrapsY, Vector(1.0F, 1.0F));
+			scene->SetUnseenLayer(unseenLayer, Activity::TeamOne);
+		}
+
+		/// <summary>
+		/// Fills the unseen layer of the current fixture Scene with a checkerboard of unseen and seen pixels, and forgets which pixels were seen.
+		/// </summary>
+		static void ResetUnseenLayer() {
+			BITMAP *unseenBitmap = g_SceneMan.m_pCurrentScene->GetUnseenLayer(Activity::TeamOne)->GetBitmap();
+			for (int pixelY = 0; pixelY < unseenBitmap->h; ++pixelY) {
+				for (int pixelX = 0; pixelX < unseenBitmap->w; ++pixelX) {
+					putpixel(unseenBitmap, pixelX, pixelY, ((pixelX / 4 + pixelY / 4) % 2 == 0) ? g_BlackColor : g_MaskColor);
+				}
+			}
+			g_SceneMan.m_pCurrentScene->ClearSeenPixels(Activity::TeamOne);
+		}
+
+		/// <summary>
+		/// Describes the unseen layer of the current fixture Scene by a hash of its pixels and the number of pixels that were seen.
+		/// </summary>
+		/// <returns>The description of the unseen layer.</returns>
+		static std::string DescribeUnseenLayer() {
+			BITMAP *unseenBitmap = g_SceneMan.m_pCurrentScene->GetUnseenLayer(Activity::TeamOne)->GetBitmap();
+			uint32_t hash = 2166136261U;
+			for (int pixelY = 0; pixelY < unseenBitmap->h; ++pixelY) {
+				for (int pixelX = 0; pixelX < unseenBitmap->w; ++pixelX) {
+					hash = (hash ^ static_cast<uint32_t>(getpixel(unseenBitmap, pixelX, pixelY))) * 16777619U;
+				}
+			}
+			char description[64];
+			std::snprintf(description, sizeof(description), " unseen %08x seen %zu", hash, g_SceneMan.m_pCurrentScene->GetSeenPixels(Activity::TeamOne).size());
+			return description;
+		}
+
+		/// <summary>
+		/// Removes the current fixture Scene and its MOID layer from SceneMan.
+		/// </summary>
+		static void DestroyScene() {
+			delete g_SceneMan.m_pMOIDLayer;
+			g_SceneMan.m_pMOIDLayer = nullptr;
+			delete g_SceneMan.m_pCurrentScene;
+			g_SceneMan.m_pCurrentScene = nullptr;
+		}
+
+		/// <summary>
+		/// Formats a float so that it reads back to exactly the same value.
+		/// </summary>
+		static std::string Describe(float value) {
+			char description[32];
+			std::snprintf(description, sizeof(description), "%.9g", value);
+			return description;
+		}
+
+		/// <summary>
+		/// Formats a Vector so that it reads back to exactly the same value.
+		/// </summary>
+		static std::string Describe(const Vector &vector) { return Describe(vector.m_X) + "," + Describe(vector.m_Y); }
+
+		/// <summary>
+		/// Casts every kind of ray along a fixed set of rays on the current fixture Scene and describes the results, including SceneMan's last ray hit position after each cast.
+		/// </summary>
+		/// <param name="sceneName">The name of the fixture Scene, to start the descriptions with.</param>
+		/// <param name="results">The list to add the descriptions of the results to.</param>
+		static void CastAllRays(const std::string &sceneName, std::vector<std::string> &results) {
+			g_SceneMan.m_LastRayHitPos.Reset();
+
+			std::mt19937 randomGenerator(5150);
+			for (int rayIndex = 0; rayIndex < c_RayCount; ++rayIndex) {
+				Vector start;
+				Vector ray;
+				// Start with the rays most likely to go wrong: along the axes, across both seams, empty and within a single pixel, then random ones.
+				switch (rayIndex) {
+					case 0: start.SetXY(-10.5F, 30.5F); ray.SetXY(200.0F, 0); break;
+					case 1: start.SetXY(90.25F, 21.75F); ray.SetXY(-130.0F, 0); break;
+					case 2: start.SetXY(24.5F, -6.5F); ray.SetXY(0, 150.0F); break;
+					case 3: start.SetXY(42.5F, 70.5F); ray.SetXY(0, -90.0F); break;
+					case 4: start.SetXY(85.5F, 55.5F); ray.SetXY(40.0F, -40.0F); break;
+					case 5: start.SetXY(10.75F, 44.25F); ray.SetXY(-37.0F, 5.0F); break;
+					case 6: start.SetXY(30.0F, 30.0F); ray.SetXY(0, 0); break;
+					case 7: start.SetXY(30.1F, 30.1F); ray.SetXY(0.3F, 0.4F); break;
+					default:
+						start.SetXY(static_cast<float>(static_cast<int>(randomGenerator() % (c_SceneWidth + 48)) - 24) + static_cast<float>(randomGenerator() % 4) * 0.25F, static_cast<float>(static_cast<int>(randomGenerator() % (c_SceneHeight + 48)) - 24) + static_cast<float>(randomGenerator() % 4) * 0.25F);
+						ray.SetXY(static_cast<float>(static_cast<int>(randomGenerator() % 301) - 150), static_cast<float>(static_cast<int>(randomGenerator() % 301) - 150));
+						// Keep a good share of the random rays horizontal, so the span scans get hit from random places too.
+						if (randomGenerator() % 3 == 0) { ray.SetY(0); }
+						break;
+				}
+				const int skip = (rayIndex % 4 == 3) ? 1 + rayIndex % 3 : 0;
+
+				const std::string caseName = sceneName + " ray " + std::to_string(rayIndex) + " from " + Describe(start) + " along " + Describe(ray) + " skip " + std::to_string(skip) + ": ";
+				auto addResult = [&results, &caseName](const std::string &castName, const std::string &result) { results.emplace_back(caseName + castName + " " + result + " last " + Describe(g_SceneMan.GetLastRayHitPos())); };
+
+				Vector result(-1.0F, -1.0F);
+				bool hit = g_SceneMan.CastMaterialRay(start, ray, c_Concrete, result, skip, true);
+				addResult("CastMaterialRay", std::to_string(hit) + " " + Describe(result));
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastMaterialRay(start, ray, c_Concrete, result, skip, false);
+				addResult("CastMaterialRay unwrapped", std::to_string(hit) + " " + Describe(result));
+				addResult("CastMaterialRay distance", Describe(g_SceneMan.CastMaterialRay(start, ray, c_Sand, skip)));
+
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastNotMaterialRay(start, ray, g_MaterialAir, result, skip, false);
+				addResult("CastNotMaterialRay", std::to_string(hit) + " " + Describe(result));
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastNotMaterialRay(start, ray, g_MaterialAir, result, skip, true);
+				addResult("CastNotMaterialRay with MOs", std::to_string(hit) + " " + Describe(result));
+				addResult("CastNotMaterialRay distance", Describe(g_SceneMan.CastNotMaterialRay(start, ray, c_Sand, skip, false)));
+
+				addResult("CastStrengthSumRay", Describe(g_SceneMan.CastStrengthSumRay(start, start + ray, skip, c_Sand)));
+				addResult("CastMaxStrengthRay", Describe(g_SceneMan.CastMaxStrengthRay(start, start + ray, skip)));
+
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastStrengthRay(start, ray, 50.0F, result, skip, c_Sand, true);
+				addResult("CastStrengthRay", std::to_string(hit) + " " + Describe(result));
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastStrengthRay(start, ray, 50.0F, result, skip, g_MaterialAir, false);
+				addResult("CastStrengthRay unwrapped", std::to_string(hit) + " " + Describe(result));
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastWeaknessRay(start, ray, 40.0F, result, skip, true);
+				addResult("CastWeaknessRay", std::to_string(hit) + " " + Describe(result));
+
+				addResult("CastMORay", std::to_string(g_SceneMan.CastMORay(start, ray, 7, Activity::NoTeam, c_Sand, false, skip)));
+				addResult("CastMORay through terrain", std::to_string(g_SceneMan.CastMORay(start, ray, 3, Activity::TeamOne, g_MaterialAir, true, skip)));
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastFindMORay(start, ray, 3, result, c_Sand, false, skip);
+				addResult("CastFindMORay", std::to_string(hit) + " " + Describe(result));
+
+				Vector obstaclePos(-1.0F, -1.0F);
+				Vector freePos(-1.0F, -1.0F);
+				float obstacleDistance = g_SceneMan.CastObstacleRay(start, ray, obstaclePos, freePos, 7, Activity::NoTeam, c_Sand, skip);
+				addResult("CastObstacleRay", Describe(obstacleDistance) + " " + Describe(obstaclePos) + " " + Describe(freePos));
+
+				ResetUnseenLayer();
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastSeeRay(Activity::TeamOne, start, ray, result, 150, skip);
+				addResult("CastSeeRay", std::to_string(hit) + " " + Describe(result) + DescribeUnseenLayer());
+				ResetUnseenLayer();
+				result.SetXY(-1.0F, -1.0F);
+				hit = g_SceneMan.CastUnseeRay(Activity::TeamOne, start, ray, result, 150, skip);
+				addResult("CastUnseeRay", std::to_string(hit) + " " + Describe(result) + DescribeUnseenLayer());
+			}
+		}
+	};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const std::vector<std::string> SceneManCastTests::c_GoldenResults = {
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay 1 24,30 last 24,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay unwrapped 1 24,30 last 24,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay distance 14.5086184 last 4,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay 1 4,30 last 4,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay with MOs 1 4,30 last 4,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay distance 96.501297 last 86,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthSumRay 2300 last 86,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaxStrengthRay 100 last 86,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthRay 1 24,30 last 24,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthRay unwrapped 1 24,30 last 24,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastWeaknessRay 1 86,30 last 86,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastMORay 3 last 20,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastMORay through terrain 255 last 20,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastFindMORay 1 20,30 last 20,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastObstacleRay 31 20.5,30.5 19.5,30.5 last 20,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastSeeRay 1 26,30 unseen 2f548f93 seen 10 last 20,30",
+		"XY ray 0 from -10.5,30.5 along 200,0 skip 0: CastUnseeRay 1 26,30 unseen 6dabf7ec seen 31 last 20,30",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay 1 72,21 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay unwrapped 1 72,21 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay distance 22.2626362 last 68,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay 1 72,21 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay with MOs 1 72,21 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay distance 1.45773792 last 89,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthSumRay 300 last 89,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaxStrengthRay 100 last 89,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthRay 1 72,21 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthRay unwrapped 1 72,21 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastWeaknessRay 1 89,21 last 89,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastMORay 255 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastMORay through terrain 255 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastFindMORay 0 -1,-1 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastObstacleRay 18 72.25,21.75 73.25,21.75 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastSeeRay 1 71,21 unseen 7569210a seen 17 last 72,21",
+		"XY ray 1 from 90.25,21.75 along -130,0 skip 0: CastUnseeRay 1 71,21 unseen 75e87be4 seen 29 last 72,21",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay 1 24,58 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay unwrapped 1 24,-6 last 24,-6",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay distance 56.5022125 last 24,50",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay 1 24,58 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay with MOs 1 24,58 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay distance 64.5019379 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthSumRay 2300 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaxStrengthRay 100 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthRay 1 24,58 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthRay unwrapped 1 24,-6 last 24,-6",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastWeaknessRay 1 24,0 last 24,0",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMORay 255 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMORay through terrain 255 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastFindMORay 0 -1,-1 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastObstacleRay 0 24.5,58.5 -1,-1 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastSeeRay 1 24,59 unseen a4b00e46 seen 29 last 24,58",
+		"XY ray 2 from 24.5,-6.5 along 0,150 skip 0: CastUnseeRay 1 24,59 unseen 520ca72e seen 30 last 24,58",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay 1 42,63 last 42,63",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay unwrapped 1 42,63 last 42,63",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay distance 13.5092564 last 42,57",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay 1 42,1 last 42,1",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay with MOs 1 42,5 last 42,5",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay distance 65.5019073 last 42,5",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthSumRay 800 last 42,5",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaxStrengthRay 100 last 42,5",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthRay 1 42,1 last 42,1",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthRay unwrapped 1 42,65 last 42,65",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastWeaknessRay 1 42,5 last 42,5",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMORay 255 last 42,1",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMORay through terrain 7 last 42,5",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastFindMORay 0 -1,-1 last 42,1",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastObstacleRay 5 42.5,1.5 42.5,2.5 last 42,1",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastSeeRay 0 42,1 unseen 20ae4114 seen 31 last 42,1",
+		"XY ray 3 from 42.5,70.5 along 0,-90 skip 1: CastUnseeRay 1 42,1 unseen 09ef2a85 seen 35 last 42,1",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay 1 22,22 last 22,22",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay unwrapped 1 118,22 last 118,22",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay distance 1.58113885 last 86,54",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay 1 86,54 last 86,54",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay with MOs 1 86,54 last 86,54",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay distance 8.51469326 last 91,49",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthSumRay 1000 last 91,49",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaxStrengthRay 100 last 91,49",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthRay 1 1,43 last 1,43",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthRay unwrapped 1 97,43 last 97,43",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastWeaknessRay 1 86,54 last 86,54",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMORay 3 last 93,47",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMORay through terrain 255 last 93,47",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastFindMORay 1 93,47 last 93,47",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastObstacleRay 11.3137083 93.5,47.5 92.5,48.5 last 93,47",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastSeeRay 1 90,50 unseen b229490e seen 38 last 93,47",
+		"XY ray 4 from 85.5,55.5 along 40,-40 skip 0: CastUnseeRay 1 90,50 unseen a87f60b4 seen 41 last 93,47",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay 1 88,46 last 88,46",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay unwrapped 1 -8,46 last -8,46",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay distance -1 last -8,46",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay 1 88,46 last 88,46",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay with MOs 1 3,45 last 3,45",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay distance 1.76776695 last 9,44",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthSumRay 500 last 9,44",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaxStrengthRay 100 last 9,44",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthRay 1 88,46 last 88,46",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthRay unwrapped 1 -8,46 last -8,46",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastWeaknessRay 1 9,44 last 9,44",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastMORay 3 last 3,45",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastMORay through terrain 255 last 3,45",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastFindMORay 1 3,45 last 3,45",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastObstacleRay 7.07106781 3.75,45.25 4.75,45.25 last 3,45",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastSeeRay 1 73,48 unseen 935a82b4 seen 46 last 3,45",
+		"XY ray 5 from 10.75,44.25 along -37,5 skip 0: CastUnseeRay 1 73,48 unseen 128306cd seen 64 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay distance -1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay distance -1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastStrengthSumRay 0 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastMaxStrengthRay 0 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastStrengthRay 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastStrengthRay unwrapped 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastWeaknessRay 0 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastMORay 255 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastMORay through terrain 255 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastFindMORay 1 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastObstacleRay 0 -1,-1 -1,-1 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastSeeRay 0 30,30 unseen e2f88e39 seen 51 last 3,45",
+		"XY ray 6 from 30,30 along 0,0 skip 0: CastUnseeRay 0 30,30 unseen 31c56f01 seen 51 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay unwrapped 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay distance -1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay with MOs 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay distance -1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthSumRay 0 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaxStrengthRay 0 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthRay 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthRay unwrapped 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastWeaknessRay 0 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMORay 255 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMORay through terrain 255 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastFindMORay 1 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastObstacleRay 0 -1,-1 -1,-1 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastSeeRay 0 30.3999996,30.5 unseen b0a27d42 seen 56 last 3,45",
+		"XY ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastUnseeRay 0 30.3999996,30.5 unseen 25fa33d1 seen 53 last 3,45",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay 1 59,58 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay unwrapped 1 59,-6 last 59,-6",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay distance 64.5019379 last 55,50",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay 1 55,50 last 55,50",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay with MOs 1 55,50 last 55,50",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay distance 72.6395187 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthSumRay 1200 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaxStrengthRay 100 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthRay 1 59,58 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthRay unwrapped 1 59,-6 last 59,-6",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastWeaknessRay 1 55,50 last 55,50",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMORay 255 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMORay through terrain 7 last 60,60",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastFindMORay 0 -1,-1 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastObstacleRay 10.2956305 59.5,58.5 58.5,57.5 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastSeeRay 1 57,54 unseen 1d87b92e seen 58 last 59,58",
+		"XY ray 8 from 54.5,-14.5 along 59,115 skip 0: CastUnseeRay 1 57,54 unseen 1291171b seen 58 last 59,58",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay 1 3,6 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay unwrapped 1 99,6 last 99,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay distance 99.4868088 last 5,57",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay 1 3,6 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay with MOs 1 3,6 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay distance 96.2659073 last 1,18",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthSumRay 700 last 1,18",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaxStrengthRay 100 last 1,18",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthRay 1 3,6 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthRay unwrapped 1 99,6 last 99,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastWeaknessRay 1 1,18 last 1,18",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMORay 255 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMORay through terrain 255 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastFindMORay 0 -1,-1 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastObstacleRay 13.1529465 3.25,6.75 3.25,7.75 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastSeeRay 1 4,63 unseen 80f881fd seen 65 last 3,6",
+		"XY ray 9 from 97.25,19.75 along 17,-106 skip 0: CastUnseeRay 1 4,63 unseen 0df7229f seen 81 last 3,6",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay 1 16,9 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay unwrapped 1 16,73 last 16,73",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay distance 69.4055099 last 41,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay 1 16,9 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay with MOs 1 16,9 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay distance 64.2504883 last 15,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthSumRay 0 last 15,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaxStrengthRay 0 last 15,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthRay 1 16,9 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthRay unwrapped 1 16,73 last 16,73",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastWeaknessRay 1 15,9 last 15,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastMORay 255 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastMORay through terrain 7 last 40,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastFindMORay 0 -1,-1 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastObstacleRay 2 16.75,9.25 15.75,9.25 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastSeeRay 1 45,9 unseen 0a9f3761 seen 83 last 16,9",
+		"XY ray 10 from 14.75,73.25 along 90,0 skip 0: CastUnseeRay 1 45,9 unseen e0643dac seen 98 last 16,9",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay 1 72,13 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay unwrapped 1 72,77 last 72,77",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay distance -1 last 72,77",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay 1 72,13 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay with MOs 1 72,13 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay distance 64.5077515 last 36,17",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthSumRay 0 last 36,17",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastMaxStrengthRay 30 last 36,17",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthRay 1 72,13 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthRay unwrapped 1 72,77 last 72,77",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastWeaknessRay 1 36,17 last 36,17",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastMORay 255 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastMORay through terrain 7 last 40,6",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastFindMORay 0 -1,-1 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastObstacleRay 37.2155876 72,13.5 71,13.5 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastSeeRay 1 16,9 unseen e0746db8 seen 95 last 72,13",
+		"XY ray 11 from 35,81.5 along 136,-15 skip 3: CastUnseeRay 1 16,9 unseen 0c248ca1 seen 123 last 72,13",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay 1 70,21 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay unwrapped 1 70,85 last 70,85",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay distance 64.0824661 last 68,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay 1 70,21 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay with MOs 1 70,21 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay distance 64.012207 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthSumRay 200 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastMaxStrengthRay 100 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthRay 1 70,21 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthRay unwrapped 1 70,85 last 70,85",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastWeaknessRay 1 69,21 last 69,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastMORay 255 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastMORay through terrain 255 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastFindMORay 0 -1,-1 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastObstacleRay 0 70.25,21 -1,-1 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastSeeRay 1 39,21 unseen e837394e seen 125 last 70,21",
+		"XY ray 12 from 71.25,85 along -131,0 skip 0: CastUnseeRay 1 39,21 unseen a19892a4 seen 151 last 70,21",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay 0 -1,-1 last 70,21",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 70,21",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay distance 65.0048065 last 27,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay 1 27,10 last 27,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay with MOs 1 27,10 last 27,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay distance 64.7543411 last 22,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthSumRay 0 last 22,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaxStrengthRay 30 last 22,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthRay 1 13,10 last 13,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthRay unwrapped 1 109,74 last 109,74",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastWeaknessRay 1 22,10 last 22,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastMORay 255 last 13,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastMORay through terrain 7 last 40,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastFindMORay 0 -1,-1 last 13,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastObstacleRay 8 13.25,10.75 12.25,10.75 last 13,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastSeeRay 1 13,10 unseen 87bbe4cf seen 150 last 13,10",
+		"XY ray 13 from 21.25,74.75 along 139,0 skip 0: CastUnseeRay 1 13,10 unseen a9e4bb35 seen 193 last 13,10",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay 0 -1,-1 last 13,10",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 13,10",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay distance -1 last 13,10",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay 0 -1,-1 last 13,10",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay with MOs 1 27,20 last 27,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay distance 1.82002747 last 48,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthSumRay 900 last 48,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaxStrengthRay 100 last 48,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthRay 0 93,20 last 48,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthRay unwrapped 0 -3,20 last 48,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastWeaknessRay 1 48,20 last 48,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastMORay 3 last 27,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastMORay through terrain 255 last 27,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastFindMORay 1 27,20 last 27,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastObstacleRay 22 27.75,20.5 28.75,20.5 last 27,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastSeeRay 1 -2.25,20.5 unseen 153d34f9 seen 177 last 27,20",
+		"XY ray 14 from 49.75,20.5 along -52,0 skip 0: CastUnseeRay 1 -2.25,20.5 unseen f4d1f1d0 seen 214 last 27,20",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay 1 77,63 last 77,63",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay unwrapped 1 77,63 last 77,63",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay distance 41.6203079 last 85,57",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay 1 57,15 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay with MOs 1 57,15 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay distance 65.0019226 last 53,18",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthSumRay 0 last 53,18",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastMaxStrengthRay 0 last 53,18",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthRay 1 57,15 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthRay unwrapped 1 57,79 last 57,79",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastWeaknessRay 1 53,18 last 53,18",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastMORay 255 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastMORay through terrain 255 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastFindMORay 0 -1,-1 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastObstacleRay 6.40312433 57.5,15 56.5,16 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastSeeRay 0 57,15 unseen b4be0af7 seen 199 last 57,15",
+		"XY ray 15 from 52.5,83 along 71,-56 skip 1: CastUnseeRay 1 57,15 unseen 77187d7b seen 198 last 57,15",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay 1 70,46 last 70,46",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay unwrapped 1 70,46 last 70,46",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay distance 35.4691772 last 90,50",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay 1 60,45 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay with MOs 1 60,45 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay distance 1.03077638 last 56,44",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthSumRay 400 last 56,44",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastMaxStrengthRay 100 last 56,44",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthRay 1 60,45 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthRay unwrapped 1 60,45 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastWeaknessRay 1 56,44 last 56,44",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastMORay 255 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastMORay through terrain 7 last 60,60",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastFindMORay 0 -1,-1 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastObstacleRay 5.09901953 60,45.25 59,45.25 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastSeeRay 1 60,45 unseen 57d6f758 seen 208 last 60,45",
+		"XY ray 16 from 55,44.25 along 107,17 skip 0: CastUnseeRay 1 60,45 unseen 0f9a2ddf seen 213 last 60,45",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay 1 52,63 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay unwrapped 1 52,-1 last 52,-1",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay distance 47.7126808 last 50,57",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay 1 52,63 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay with MOs 1 52,63 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay distance 1.58113885 last 54,8",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthSumRay 2500 last 54,8",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaxStrengthRay 100 last 54,8",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthRay 1 52,63 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthRay unwrapped 1 52,-1 last 52,-1",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastWeaknessRay 1 54,8 last 54,8",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMORay 255 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMORay through terrain 7 last 41,14",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastFindMORay 0 -1,-1 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastObstacleRay 10.1980391 52.5,63.5 52.5,0.5 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastSeeRay 1 52,62 unseen c5702c83 seen 230 last 52,63",
+		"XY ray 17 from 54.5,9.5 along -34,-150 skip 0: CastUnseeRay 1 52,62 unseen dc2cee36 seen 239 last 52,63",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay 0 -1,-1 last 52,63",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 52,63",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay distance 73.6040955 last 14,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay 1 14,7 last 14,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay with MOs 1 14,7 last 14,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay distance 64.7577209 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthSumRay 0 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastMaxStrengthRay 0 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthRay 0 0,7 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthRay unwrapped 0 192,71 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastWeaknessRay 1 50,7 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastMORay 255 last 50,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastMORay through terrain 7 last 40,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastFindMORay 0 -1,-1 last 40,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastObstacleRay -1 -1,-1 0,7.75 last 40,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastSeeRay 1 192,71.75 unseen 37164f0a seen 249 last 40,7",
+		"XY ray 18 from 49,71.75 along 143,0 skip 0: CastUnseeRay 1 192,71.75 unseen e63ff00d seen 295 last 40,7",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay 1 0,63 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay unwrapped 1 96,63 last 96,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay distance 86.8288574 last 3,57",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay 1 0,63 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay with MOs 1 0,63 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay distance 65.5076294 last 87,17",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthSumRay 400 last 87,17",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastMaxStrengthRay 100 last 87,17",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthRay 1 0,63 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthRay unwrapped 1 96,63 last 96,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastWeaknessRay 1 87,17 last 87,17",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastMORay 255 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastMORay through terrain 255 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastFindMORay 0 -1,-1 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastObstacleRay 21.470911 0,63.5 95,0.5 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastSeeRay 0 1,60 unseen 9d40eebd seen 250 last 0,63",
+		"XY ray 19 from 86,82.5 along 67,-133 skip 2: CastUnseeRay 1 1,60 unseen df813e45 seen 249 last 0,63",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay 1 61,58 last 61,58",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay unwrapped 1 61,58 last 61,58",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay distance 21.9160328 last 23,50",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay 1 14,48 last 14,48",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay with MOs 1 2,45 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay distance 0.901387811 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthSumRay 600 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaxStrengthRay 100 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthRay 1 14,48 last 14,48",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthRay unwrapped 1 14,48 last 14,48",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastWeaknessRay 1 2,45 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastMORay 3 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastMORay through terrain 255 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastFindMORay 1 2,45 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastObstacleRay 0 2.5,45.75 -1,-1 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastSeeRay 1 14,48 unseen d18715e8 seen 250 last 2,45",
+		"XY ray 20 from 1.5,45.75 along 120,25 skip 0: CastUnseeRay 1 14,48 unseen 2785bc8c seen 251 last 2,45",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay 1 4,59 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay unwrapped 1 100,-5 last 100,-5",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay distance -1 last 100,-5",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay 1 4,59 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay with MOs 1 4,59 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay distance 115.169708 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthSumRay 3800 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastMaxStrengthRay 100 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthRay 1 4,59 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthRay unwrapped 1 100,-5 last 100,-5",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastWeaknessRay 0 41,59 last 100,-5",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastMORay 255 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastMORay through terrain 255 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastFindMORay 0 -1,-1 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastObstacleRay 0 4.75,59 -1,-1 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastSeeRay 0 5,59 unseen 080879e5 seen 252 last 4,59",
+		"XY ray 21 from 99.75,-5 along 134,0 skip 0: CastUnseeRay 1 5,59 unseen 6c5e2280 seen 244 last 4,59",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay 1 87,63 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay unwrapped 1 87,-1 last 87,-1",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay distance 44.2295151 last 86,57",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay 1 87,63 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay with MOs 1 87,63 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay distance 1.11803401 last 90,12",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthSumRay 0 last 90,12",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastMaxStrengthRay 30 last 90,12",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthRay 1 87,63 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthRay unwrapped 1 87,-1 last 87,-1",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastWeaknessRay 1 90,12 last 90,12",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastMORay 255 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastMORay through terrain 255 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastFindMORay 0 -1,-1 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastObstacleRay 14.3178215 87.5,63 87.5,0 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastSeeRay 1 87,62 unseen f7ea4166 seen 253 last 87,63",
+		"XY ray 22 from 90.5,13 along -12,-57 skip 0: CastUnseeRay 1 87,62 unseen 5e167765 seen 254 last 87,63",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay 0 -1,-1 last 87,63",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay unwrapped 0 -1,-1 last 87,63",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay distance 66.000946 last 37,17",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay 1 37,17 last 37,17",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay with MOs 1 37,17 last 37,17",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay distance 64.7736435 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthSumRay 0 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaxStrengthRay 0 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthRay 0 88,17 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthRay unwrapped 0 -104,81 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastWeaknessRay 1 41,18 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMORay 255 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMORay through terrain 255 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastFindMORay 0 -1,-1 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastObstacleRay -1 -1,-1 88.75,17.75 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastSeeRay 0 -103.25,81.75 unseen 9c2b2575 seen 256 last 41,18",
+		"XY ray 23 from 42.75,82.75 along -146,-1 skip 3: CastUnseeRay 1 -103.25,81.75 unseen 6ec420b3 seen 286 last 41,18",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay 1 24,30 last 24,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay unwrapped 1 24,30 last 24,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay distance 14.5086184 last 4,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay 1 4,30 last 4,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay with MOs 1 4,30 last 4,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay distance 0.707106769 last -10,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthSumRay 2300 last -10,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaxStrengthRay 100 last -10,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthRay 1 24,30 last 24,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthRay unwrapped 1 24,30 last 24,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastWeaknessRay 1 -10,30 last -10,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMORay 3 last 20,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMORay through terrain 255 last 20,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastFindMORay 1 20,30 last 20,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastObstacleRay 31 20.5,30.5 19.5,30.5 last 20,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastSeeRay 1 26,30 unseen 7fbc252f seen 6 last 20,30",
+		"-- ray 0 from -10.5,30.5 along 200,0 skip 0: CastUnseeRay 1 26,30 unseen c5e5ee13 seen 21 last 20,30",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay 1 72,21 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay unwrapped 1 72,21 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay distance 22.2626362 last 68,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay 1 72,21 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay with MOs 1 72,21 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay distance 1.45773792 last 89,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthSumRay 1000 last 89,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaxStrengthRay 100 last 89,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthRay 1 72,21 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthRay unwrapped 1 72,21 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastWeaknessRay 1 89,21 last 89,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMORay 255 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMORay through terrain 255 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastFindMORay 0 -1,-1 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastObstacleRay 18 72.25,21.75 73.25,21.75 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastSeeRay 1 71,21 unseen 4eab660e seen 12 last 72,21",
+		"-- ray 1 from 90.25,21.75 along -130,0 skip 0: CastUnseeRay 1 71,21 unseen 26d0e4f8 seen 25 last 72,21",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay 1 24,30 last 24,30",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay unwrapped 1 24,30 last 24,30",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay distance 56.5022125 last 24,50",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay 1 24,13 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay with MOs 1 24,13 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay distance 0.707106769 last 24,-6",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthSumRay 1200 last 24,-6",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaxStrengthRay 100 last 24,-6",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthRay 1 24,13 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthRay unwrapped 1 24,13 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastWeaknessRay 1 24,-6 last 24,-6",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMORay 255 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMORay through terrain 255 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastFindMORay 0 -1,-1 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastObstacleRay 20 24.5,13.5 24.5,12.5 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastSeeRay 1 24,13 unseen 811d962e seen 26 last 24,13",
+		"-- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastUnseeRay 1 24,13 unseen 400f77cb seen 33 last 24,13",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay 1 42,63 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay unwrapped 1 42,63 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay distance 13.5092564 last 42,57",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay 1 42,63 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay with MOs 1 42,63 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay distance 1.58113885 last 42,69",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthSumRay 1900 last 42,69",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaxStrengthRay 100 last 42,69",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthRay 1 42,63 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthRay unwrapped 1 42,63 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastWeaknessRay 1 42,69 last 42,69",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMORay 255 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMORay through terrain 7 last 42,13",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastFindMORay 0 -1,-1 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastObstacleRay 7 42.5,63.5 42.5,64.5 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastSeeRay 1 42,61 unseen c21d032d seen 28 last 42,63",
+		"-- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastUnseeRay 1 42,61 unseen 82455168 seen 30 last 42,63",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay 0 -1,-1 last 42,63",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 42,63",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay distance 1.58113885 last 86,54",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay 1 86,54 last 86,54",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay with MOs 1 86,54 last 86,54",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay distance 8.51469326 last 91,49",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthSumRay 0 last 91,49",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaxStrengthRay 30 last 91,49",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthRay 0 125,15 last 91,49",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthRay unwrapped 0 125,15 last 91,49",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastWeaknessRay 1 86,54 last 86,54",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMORay 3 last 93,47",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMORay through terrain 255 last 93,47",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastFindMORay 1 93,47 last 93,47",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastObstacleRay 11.3137083 93.5,47.5 92.5,48.5 last 93,47",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastSeeRay 1 90,50 unseen b0aaf645 seen 31 last 93,47",
+		"-- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastUnseeRay 1 90,50 unseen 7a4251b5 seen 36 last 93,47",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay 0 -1,-1 last 93,47",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 93,47",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay distance -1 last 93,47",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay 0 -1,-1 last 93,47",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay with MOs 1 3,45 last 3,45",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay distance 1.76776695 last 9,44",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthSumRay 0 last 9,44",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaxStrengthRay 0 last 9,44",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthRay 0 -27,49 last 9,44",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthRay unwrapped 0 -27,49 last 9,44",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastWeaknessRay 1 9,44 last 9,44",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMORay 3 last 3,45",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMORay through terrain 255 last 3,45",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastFindMORay 1 3,45 last 3,45",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastObstacleRay 7.07106781 3.75,45.25 4.75,45.25 last 3,45",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastSeeRay 1 -26.25,49.25 unseen c0f72edf seen 34 last 3,45",
+		"-- ray 5 from 10.75,44.25 along -37,5 skip 0: CastUnseeRay 1 -26.25,49.25 unseen 854de5d4 seen 41 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay distance -1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay distance -1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastStrengthSumRay 0 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastMaxStrengthRay 0 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastStrengthRay 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastStrengthRay unwrapped 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastWeaknessRay 0 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastMORay 255 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastMORay through terrain 255 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastFindMORay 1 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastObstacleRay 0 -1,-1 -1,-1 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastSeeRay 0 30,30 unseen fa5fe71d seen 36 last 3,45",
+		"-- ray 6 from 30,30 along 0,0 skip 0: CastUnseeRay 0 30,30 unseen fa5fe71d seen 36 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay unwrapped 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay distance -1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay with MOs 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay distance -1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthSumRay 0 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaxStrengthRay 0 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthRay 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthRay unwrapped 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastWeaknessRay 0 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMORay 255 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMORay through terrain 255 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastFindMORay 1 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastObstacleRay 0 -1,-1 -1,-1 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastSeeRay 0 30.3999996,30.5 unseen fa5fe71d seen 36 last 3,45",
+		"-- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastUnseeRay 0 30.3999996,30.5 unseen fa5fe71d seen 36 last 3,45",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay 1 68,12 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay unwrapped 1 68,12 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay distance 72.2253418 last 87,50",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay 1 68,12 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay with MOs 1 62,0 last 62,0",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay distance 0.707106769 last 55,-14",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthSumRay 1400 last 55,-14",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaxStrengthRay 100 last 55,-14",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthRay 1 68,12 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthRay unwrapped 1 68,12 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastWeaknessRay 1 55,-14 last 55,-14",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMORay 255 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMORay through terrain 7 last 62,0",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastFindMORay 0 -1,-1 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastObstacleRay 30.4138126 68.5,12.5 67.5,11.5 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastSeeRay 1 69,14 unseen a3994449 seen 38 last 68,12",
+		"-- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastUnseeRay 1 69,14 unseen 0623aa20 seen 48 last 68,12",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay 0 -1,-1 last 68,12",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 68,12",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay distance -1 last 68,12",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay 0 -1,-1 last 68,12",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 68,12",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay distance 1.76776695 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthSumRay 0 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaxStrengthRay 0 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthRay 0 114,-87 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthRay unwrapped 0 114,-87 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastWeaknessRay 1 97,18 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMORay 255 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMORay through terrain 255 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastFindMORay 0 -1,-1 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastObstacleRay -1 -1,-1 114.25,-86.25 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastSeeRay 0 114.25,-86.25 unseen cd2164b9 seen 38 last 97,18",
+		"-- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastUnseeRay 0 114.25,-86.25 unseen cd2164b9 seen 38 last 97,18",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay 0 -1,-1 last 97,18",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 97,18",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay distance -1 last 97,18",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay 0 -1,-1 last 97,18",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 97,18",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay distance 0.353553385 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthSumRay 0 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaxStrengthRay 0 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthRay 0 104,73 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthRay unwrapped 0 104,73 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastWeaknessRay 1 15,73 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMORay 255 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMORay through terrain 255 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastFindMORay 0 -1,-1 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastObstacleRay -1 -1,-1 104.75,73.25 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastSeeRay 0 104.75,73.25 unseen cd2164b9 seen 38 last 15,73",
+		"-- ray 10 from 14.75,73.25 along 90,0 skip 0: CastUnseeRay 0 104.75,73.25 unseen cd2164b9 seen 38 last 15,73",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay 0 -1,-1 last 15,73",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay unwrapped 0 -1,-1 last 15,73",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay distance -1 last 15,73",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay 0 -1,-1 last 15,73",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay with MOs 0 -1,-1 last 15,73",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay distance 1.11803401 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthSumRay 0 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaxStrengthRay 0 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthRay 0 171,66 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthRay unwrapped 0 171,66 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastWeaknessRay 1 36,81 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastMORay 255 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastMORay through terrain 255 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastFindMORay 0 -1,-1 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastObstacleRay -1 -1,-1 171,66.5 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastSeeRay 0 171,66.5 unseen cd2164b9 seen 38 last 36,81",
+		"-- ray 11 from 35,81.5 along 136,-15 skip 3: CastUnseeRay 0 171,66.5 unseen cd2164b9 seen 38 last 36,81",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay 0 -1,-1 last 36,81",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 36,81",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay distance -1 last 36,81",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay 0 -1,-1 last 36,81",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 36,81",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay distance 1.25 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthSumRay 0 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastMaxStrengthRay 0 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthRay 0 -60,85 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthRay unwrapped 0 -60,85 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastWeaknessRay 1 70,85 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastMORay 255 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastMORay through terrain 255 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastFindMORay 0 -1,-1 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastObstacleRay -1 -1,-1 -59.75,85 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastSeeRay 0 -59.75,85 unseen cd2164b9 seen 38 last 70,85",
+		"-- ray 12 from 71.25,85 along -131,0 skip 0: CastUnseeRay 0 -59.75,85 unseen cd2164b9 seen 38 last 70,85",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay 0 -1,-1 last 70,85",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 70,85",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay distance -1 last 70,85",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay 0 -1,-1 last 70,85",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 70,85",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay distance 1.06066012 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthSumRay 0 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaxStrengthRay 0 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthRay 0 160,74 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthRay unwrapped 0 160,74 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastWeaknessRay 1 22,74 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMORay 255 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMORay through terrain 255 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastFindMORay 0 -1,-1 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastObstacleRay -1 -1,-1 160.25,74.75 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastSeeRay 0 160.25,74.75 unseen cd2164b9 seen 38 last 22,74",
+		"-- ray 13 from 21.25,74.75 along 139,0 skip 0: CastUnseeRay 0 160.25,74.75 unseen cd2164b9 seen 38 last 22,74",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay 0 -1,-1 last 22,74",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 22,74",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay distance -1 last 22,74",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay 0 -1,-1 last 22,74",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay with MOs 1 27,20 last 27,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay distance 1.82002747 last 48,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthSumRay 0 last 48,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaxStrengthRay 0 last 48,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthRay 0 -3,20 last 48,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthRay unwrapped 0 -3,20 last 48,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastWeaknessRay 1 48,20 last 48,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMORay 3 last 27,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMORay through terrain 255 last 27,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastFindMORay 1 27,20 last 27,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastObstacleRay 22 27.75,20.5 28.75,20.5 last 27,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastSeeRay 1 -2.25,20.5 unseen 6321d824 seen 51 last 27,20",
+		"-- ray 14 from 49.75,20.5 along -52,0 skip 0: CastUnseeRay 1 -2.25,20.5 unseen 889367a6 seen 86 last 27,20",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay 1 77,63 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay unwrapped 1 77,63 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay distance 41.6203079 last 85,57",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay 1 77,63 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay with MOs 1 77,63 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay distance 1.11803401 last 53,82",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthSumRay 400 last 53,82",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaxStrengthRay 100 last 53,82",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthRay 1 77,63 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthRay unwrapped 1 77,63 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastWeaknessRay 1 53,82 last 53,82",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastMORay 255 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastMORay through terrain 255 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastFindMORay 0 -1,-1 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastObstacleRay 32.0156212 77.5,63 76.5,64 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastSeeRay 1 79,62 unseen 2995d00a seen 76 last 77,63",
+		"-- ray 15 from 52.5,83 along 71,-56 skip 1: CastUnseeRay 1 79,62 unseen fd713dc3 seen 81 last 77,63",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay 1 70,46 last 70,46",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay unwrapped 1 70,46 last 70,46",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay distance 35.4691772 last 90,50",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay 1 60,45 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay with MOs 1 60,45 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay distance 1.03077638 last 56,44",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthSumRay 800 last 56,44",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastMaxStrengthRay 100 last 56,44",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthRay 1 60,45 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthRay unwrapped 1 60,45 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastWeaknessRay 1 56,44 last 56,44",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastMORay 255 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastMORay through terrain 255 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastFindMORay 0 -1,-1 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastObstacleRay 5.09901953 60,45.25 59,45.25 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastSeeRay 1 60,45 unseen dc1f5a5f seen 85 last 60,45",
+		"-- ray 16 from 55,44.25 along 107,17 skip 0: CastUnseeRay 1 60,45 unseen cf20ee77 seen 99 last 60,45",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay 0 -1,-1 last 60,45",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 60,45",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay distance -1 last 60,45",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay 0 -1,-1 last 60,45",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 60,45",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay distance 1.58113885 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthSumRay 0 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaxStrengthRay 0 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthRay 0 20,-141 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthRay unwrapped 0 20,-141 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastWeaknessRay 1 54,8 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMORay 255 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMORay through terrain 255 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastFindMORay 0 -1,-1 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastObstacleRay -1 -1,-1 20.5,-140.5 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastSeeRay 1 20.5,-140.5 unseen b1a2d109 seen 113 last 54,8",
+		"-- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastUnseeRay 1 20.5,-140.5 unseen 5dd659b2 seen 124 last 54,8",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay 0 -1,-1 last 54,8",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 54,8",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay distance -1 last 54,8",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay 0 -1,-1 last 54,8",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 54,8",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay distance 1.25 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthSumRay 0 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastMaxStrengthRay 0 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthRay 0 192,71 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthRay unwrapped 0 192,71 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastWeaknessRay 1 50,71 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastMORay 255 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastMORay through terrain 255 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastFindMORay 0 -1,-1 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastObstacleRay -1 -1,-1 192,71.75 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastSeeRay 0 192,71.75 unseen 2deed023 seen 120 last 50,71",
+		"-- ray 18 from 49,71.75 along 143,0 skip 0: CastUnseeRay 0 192,71.75 unseen e529b70f seen 122 last 50,71",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay 0 -1,-1 last 50,71",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay unwrapped 0 -1,-1 last 50,71",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay distance -1 last 50,71",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay 0 -1,-1 last 50,71",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay with MOs 0 -1,-1 last 50,71",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay distance 1.80277562 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthSumRay 0 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaxStrengthRay 0 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthRay 0 153,-51 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthRay unwrapped 0 153,-51 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastWeaknessRay 1 87,81 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastMORay 255 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastMORay through terrain 255 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastFindMORay 0 -1,-1 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastObstacleRay -1 -1,-1 153,-50.5 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastSeeRay 0 153,-50.5 unseen e529b70f seen 119 last 87,81",
+		"-- ray 19 from 86,82.5 along 67,-133 skip 2: CastUnseeRay 0 153,-50.5 unseen e529b70f seen 121 last 87,81",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay 1 61,58 last 61,58",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay unwrapped 1 61,58 last 61,58",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay distance 21.9160328 last 23,50",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay 1 14,48 last 14,48",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay with MOs 1 2,45 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay distance 0.901387811 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthSumRay 3400 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaxStrengthRay 100 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthRay 1 14,48 last 14,48",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthRay unwrapped 1 14,48 last 14,48",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastWeaknessRay 1 2,45 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMORay 3 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMORay through terrain 255 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastFindMORay 1 2,45 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastObstacleRay 0 2.5,45.75 -1,-1 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastSeeRay 1 14,48 unseen 84027d5e seen 120 last 2,45",
+		"-- ray 20 from 1.5,45.75 along 120,25 skip 0: CastUnseeRay 1 14,48 unseen 8254e3b2 seen 131 last 2,45",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay 0 -1,-1 last 2,45",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 2,45",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay distance -1 last 2,45",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay 0 -1,-1 last 2,45",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 2,45",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay distance 0.25 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthSumRay 0 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaxStrengthRay 0 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthRay 0 233,-5 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthRay unwrapped 0 233,-5 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastWeaknessRay 1 100,-5 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastMORay 255 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastMORay through terrain 255 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastFindMORay 0 -1,-1 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastObstacleRay -1 -1,-1 233.75,-5 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastSeeRay 0 233.75,-5 unseen f38de14f seen 122 last 100,-5",
+		"-- ray 21 from 99.75,-5 along 134,0 skip 0: CastUnseeRay 0 233.75,-5 unseen f38de14f seen 123 last 100,-5",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay 0 -1,-1 last 100,-5",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 100,-5",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay distance -1 last 100,-5",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay 0 -1,-1 last 100,-5",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 100,-5",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay distance 1.11803401 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthSumRay 0 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaxStrengthRay 0 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthRay 0 78,-44 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthRay unwrapped 0 78,-44 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastWeaknessRay 1 90,12 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastMORay 255 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastMORay through terrain 255 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastFindMORay 0 -1,-1 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastObstacleRay -1 -1,-1 78.5,-44 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastSeeRay 1 78.5,-44 unseen e4ced90c seen 127 last 90,12",
+		"-- ray 22 from 90.5,13 along -12,-57 skip 0: CastUnseeRay 1 78.5,-44 unseen c7d71d1c seen 139 last 90,12",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay 0 -1,-1 last 90,12",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay unwrapped 0 -1,-1 last 90,12",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay distance -1 last 90,12",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay 0 -1,-1 last 90,12",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay with MOs 0 -1,-1 last 90,12",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay distance 1.9039433 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthSumRay 0 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaxStrengthRay 0 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthRay 0 -104,81 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthRay unwrapped 0 -104,81 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastWeaknessRay 1 41,82 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMORay 255 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMORay through terrain 255 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastFindMORay 0 -1,-1 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastObstacleRay -1 -1,-1 -103.25,81.75 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastSeeRay 0 -103.25,81.75 unseen 359f240e seen 128 last 41,82",
+		"-- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastUnseeRay 0 -103.25,81.75 unseen 3e1128cd seen 129 last 41,82",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay 1 24,30 last 24,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay unwrapped 1 24,30 last 24,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaterialRay distance 14.5086184 last 4,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay 1 4,30 last 4,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay with MOs 1 4,30 last 4,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastNotMaterialRay distance 96.501297 last 86,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthSumRay 2300 last 86,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMaxStrengthRay 100 last 86,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthRay 1 24,30 last 24,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastStrengthRay unwrapped 1 24,30 last 24,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastWeaknessRay 1 86,30 last 86,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMORay 3 last 20,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastMORay through terrain 255 last 20,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastFindMORay 1 20,30 last 20,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastObstacleRay 31 20.5,30.5 19.5,30.5 last 20,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastSeeRay 1 26,30 unseen 2f548f93 seen 10 last 20,30",
+		"X- ray 0 from -10.5,30.5 along 200,0 skip 0: CastUnseeRay 1 26,30 unseen 6dabf7ec seen 31 last 20,30",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay 1 72,21 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay unwrapped 1 72,21 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaterialRay distance 22.2626362 last 68,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay 1 72,21 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay with MOs 1 72,21 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastNotMaterialRay distance 1.45773792 last 89,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthSumRay 300 last 89,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMaxStrengthRay 100 last 89,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthRay 1 72,21 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastStrengthRay unwrapped 1 72,21 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastWeaknessRay 1 89,21 last 89,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMORay 255 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastMORay through terrain 255 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastFindMORay 0 -1,-1 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastObstacleRay 18 72.25,21.75 73.25,21.75 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastSeeRay 1 71,21 unseen 7569210a seen 17 last 72,21",
+		"X- ray 1 from 90.25,21.75 along -130,0 skip 0: CastUnseeRay 1 71,21 unseen 75e87be4 seen 29 last 72,21",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay 1 24,30 last 24,30",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay unwrapped 1 24,30 last 24,30",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaterialRay distance 56.5022125 last 24,50",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay 1 24,13 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay with MOs 1 24,13 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastNotMaterialRay distance 0.707106769 last 24,-6",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthSumRay 1200 last 24,-6",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMaxStrengthRay 100 last 24,-6",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthRay 1 24,13 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastStrengthRay unwrapped 1 24,13 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastWeaknessRay 1 24,-6 last 24,-6",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMORay 255 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastMORay through terrain 255 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastFindMORay 0 -1,-1 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastObstacleRay 20 24.5,13.5 24.5,12.5 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastSeeRay 1 24,13 unseen 7ed7232a seen 31 last 24,13",
+		"X- ray 2 from 24.5,-6.5 along 0,150 skip 0: CastUnseeRay 1 24,13 unseen a27b5a1a seen 38 last 24,13",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay 1 42,63 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay unwrapped 1 42,63 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaterialRay distance 13.5092564 last 42,57",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay 1 42,63 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay with MOs 1 42,63 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastNotMaterialRay distance 1.58113885 last 42,69",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthSumRay 1900 last 42,69",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMaxStrengthRay 100 last 42,69",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthRay 1 42,63 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastStrengthRay unwrapped 1 42,63 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastWeaknessRay 1 42,69 last 42,69",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMORay 255 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastMORay through terrain 7 last 42,13",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastFindMORay 0 -1,-1 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastObstacleRay 7 42.5,63.5 42.5,64.5 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastSeeRay 1 42,61 unseen 9d416acc seen 35 last 42,63",
+		"X- ray 3 from 42.5,70.5 along 0,-90 skip 1: CastUnseeRay 1 42,61 unseen 4c1c58fb seen 39 last 42,63",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay 1 22,22 last 22,22",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay unwrapped 1 118,22 last 118,22",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaterialRay distance 1.58113885 last 86,54",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay 1 86,54 last 86,54",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay with MOs 1 86,54 last 86,54",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastNotMaterialRay distance 8.51469326 last 91,49",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthSumRay 1100 last 91,49",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMaxStrengthRay 100 last 91,49",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthRay 1 1,43 last 1,43",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastStrengthRay unwrapped 1 97,43 last 97,43",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastWeaknessRay 1 86,54 last 86,54",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMORay 3 last 93,47",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastMORay through terrain 255 last 93,47",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastFindMORay 1 93,47 last 93,47",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastObstacleRay 11.3137083 93.5,47.5 92.5,48.5 last 93,47",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastSeeRay 1 90,50 unseen 0307479e seen 43 last 93,47",
+		"X- ray 4 from 85.5,55.5 along 40,-40 skip 0: CastUnseeRay 1 90,50 unseen 479797e7 seen 47 last 93,47",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay 1 88,46 last 88,46",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay unwrapped 1 -8,46 last -8,46",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaterialRay distance -1 last -8,46",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay 1 88,46 last 88,46",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay with MOs 1 3,45 last 3,45",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastNotMaterialRay distance 1.76776695 last 9,44",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthSumRay 500 last 9,44",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMaxStrengthRay 100 last 9,44",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthRay 1 88,46 last 88,46",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastStrengthRay unwrapped 1 -8,46 last -8,46",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastWeaknessRay 1 9,44 last 9,44",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMORay 3 last 3,45",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastMORay through terrain 255 last 3,45",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastFindMORay 1 3,45 last 3,45",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastObstacleRay 7.07106781 3.75,45.25 4.75,45.25 last 3,45",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastSeeRay 1 73,48 unseen 95fd44af seen 53 last 3,45",
+		"X- ray 5 from 10.75,44.25 along -37,5 skip 0: CastUnseeRay 1 73,48 unseen d61ced4e seen 73 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastMaterialRay distance -1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastNotMaterialRay distance -1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastStrengthSumRay 0 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastMaxStrengthRay 0 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastStrengthRay 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastStrengthRay unwrapped 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastWeaknessRay 0 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastMORay 255 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastMORay through terrain 255 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastFindMORay 1 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastObstacleRay 0 -1,-1 -1,-1 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastSeeRay 0 30,30 unseen 040a7851 seen 59 last 3,45",
+		"X- ray 6 from 30,30 along 0,0 skip 0: CastUnseeRay 0 30,30 unseen b2abecf9 seen 60 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay unwrapped 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaterialRay distance -1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay with MOs 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastNotMaterialRay distance -1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthSumRay 0 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMaxStrengthRay 0 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthRay 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastStrengthRay unwrapped 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastWeaknessRay 0 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMORay 255 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastMORay through terrain 255 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastFindMORay 1 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastObstacleRay 0 -1,-1 -1,-1 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastSeeRay 0 30.3999996,30.5 unseen 4d856c36 seen 64 last 3,45",
+		"X- ray 7 from 30.1000004,30.1000004 along 0.300000012,0.400000006 skip 2: CastUnseeRay 0 30.3999996,30.5 unseen 9fac3885 seen 62 last 3,45",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay 1 68,12 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay unwrapped 1 68,12 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaterialRay distance 72.2253418 last 87,50",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay 1 68,12 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay with MOs 1 62,0 last 62,0",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastNotMaterialRay distance 0.707106769 last 55,-14",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthSumRay 1600 last 55,-14",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMaxStrengthRay 100 last 55,-14",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthRay 1 68,12 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastStrengthRay unwrapped 1 68,12 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastWeaknessRay 1 55,-14 last 55,-14",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMORay 255 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastMORay through terrain 7 last 62,0",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastFindMORay 0 -1,-1 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastObstacleRay 30.4138126 68.5,12.5 67.5,11.5 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastSeeRay 1 69,14 unseen f70725d1 seen 67 last 68,12",
+		"X- ray 8 from 54.5,-14.5 along 59,115 skip 0: CastUnseeRay 1 69,14 unseen b54bfdf8 seen 74 last 68,12",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay 1 3,6 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay unwrapped 1 99,6 last 99,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaterialRay distance -1 last 99,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay 1 3,6 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay with MOs 1 3,6 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastNotMaterialRay distance 96.2659073 last 1,18",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthSumRay 100 last 1,18",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMaxStrengthRay 100 last 1,18",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthRay 1 3,6 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastStrengthRay unwrapped 1 99,6 last 99,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastWeaknessRay 1 1,18 last 1,18",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMORay 255 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastMORay through terrain 255 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastFindMORay 0 -1,-1 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastObstacleRay 13.1529465 3.25,6.75 3.25,7.75 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastSeeRay 1 114.25,-86.25 unseen fd934d49 seen 73 last 3,6",
+		"X- ray 9 from 97.25,19.75 along 17,-106 skip 0: CastUnseeRay 1 114.25,-86.25 unseen d30e2072 seen 86 last 3,6",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay 0 -1,-1 last 3,6",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 3,6",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaterialRay distance -1 last 3,6",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay 0 -1,-1 last 3,6",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 3,6",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastNotMaterialRay distance 0.353553385 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthSumRay 0 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMaxStrengthRay 0 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthRay 0 8,73 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastStrengthRay unwrapped 0 104,73 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastWeaknessRay 1 15,73 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMORay 255 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastMORay through terrain 255 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastFindMORay 0 -1,-1 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastObstacleRay -1 -1,-1 8.75,73.25 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastSeeRay 0 104.75,73.25 unseen c8ed7b92 seen 79 last 15,73",
+		"X- ray 10 from 14.75,73.25 along 90,0 skip 0: CastUnseeRay 0 104.75,73.25 unseen 82194bca seen 76 last 15,73",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay 0 -1,-1 last 15,73",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay unwrapped 0 -1,-1 last 15,73",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaterialRay distance -1 last 15,73",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay 0 -1,-1 last 15,73",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay with MOs 0 -1,-1 last 15,73",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastNotMaterialRay distance 1.11803401 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthSumRay 0 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastMaxStrengthRay 0 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthRay 0 75,66 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastStrengthRay unwrapped 0 171,66 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastWeaknessRay 1 36,81 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastMORay 255 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastMORay through terrain 255 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastFindMORay 0 -1,-1 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastObstacleRay -1 -1,-1 75,66.5 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastSeeRay 0 171,66.5 unseen 8dbf5511 seen 77 last 36,81",
+		"X- ray 11 from 35,81.5 along 136,-15 skip 3: CastUnseeRay 0 171,66.5 unseen 8dbf5511 seen 75 last 36,81",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay 0 -1,-1 last 36,81",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 36,81",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastMaterialRay distance -1 last 36,81",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay 0 -1,-1 last 36,81",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 36,81",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastNotMaterialRay distance 1.25 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthSumRay 0 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastMaxStrengthRay 0 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthRay 0 36,85 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastStrengthRay unwrapped 0 -60,85 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastWeaknessRay 1 70,85 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastMORay 255 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastMORay through terrain 255 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastFindMORay 0 -1,-1 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastObstacleRay -1 -1,-1 36.25,85 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastSeeRay 0 -59.75,85 unseen 8dbf5511 seen 77 last 70,85",
+		"X- ray 12 from 71.25,85 along -131,0 skip 0: CastUnseeRay 0 -59.75,85 unseen 8dbf5511 seen 75 last 70,85",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay 0 -1,-1 last 70,85",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 70,85",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaterialRay distance -1 last 70,85",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay 0 -1,-1 last 70,85",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 70,85",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastNotMaterialRay distance 1.06066012 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthSumRay 0 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMaxStrengthRay 0 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthRay 0 64,74 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastStrengthRay unwrapped 0 160,74 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastWeaknessRay 1 22,74 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMORay 255 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastMORay through terrain 255 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastFindMORay 0 -1,-1 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastObstacleRay -1 -1,-1 64.25,74.75 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastSeeRay 0 160.25,74.75 unseen 8dbf5511 seen 77 last 22,74",
+		"X- ray 13 from 21.25,74.75 along 139,0 skip 0: CastUnseeRay 0 160.25,74.75 unseen 8dbf5511 seen 75 last 22,74",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay 0 -1,-1 last 22,74",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 22,74",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaterialRay distance -1 last 22,74",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay 0 -1,-1 last 22,74",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay with MOs 1 27,20 last 27,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastNotMaterialRay distance 1.82002747 last 48,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthSumRay 900 last 48,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMaxStrengthRay 100 last 48,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthRay 0 93,20 last 48,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastStrengthRay unwrapped 0 -3,20 last 48,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastWeaknessRay 1 48,20 last 48,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMORay 3 last 27,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastMORay through terrain 255 last 27,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastFindMORay 1 27,20 last 27,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastObstacleRay 22 27.75,20.5 28.75,20.5 last 27,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastSeeRay 1 -2.25,20.5 unseen 5a739525 seen 89 last 27,20",
+		"X- ray 14 from 49.75,20.5 along -52,0 skip 0: CastUnseeRay 1 -2.25,20.5 unseen 54977a89 seen 126 last 27,20",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay 1 77,63 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay unwrapped 1 77,63 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaterialRay distance 41.6203079 last 85,57",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay 1 77,63 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay with MOs 1 77,63 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastNotMaterialRay distance 1.11803401 last 53,82",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthSumRay 300 last 53,82",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastMaxStrengthRay 100 last 53,82",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthRay 1 77,63 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastStrengthRay unwrapped 1 77,63 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastWeaknessRay 1 53,82 last 53,82",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastMORay 255 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastMORay through terrain 255 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastFindMORay 0 -1,-1 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastObstacleRay 32.0156212 77.5,63 76.5,64 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastSeeRay 1 79,62 unseen b85b5671 seen 116 last 77,63",
+		"X- ray 15 from 52.5,83 along 71,-56 skip 1: CastUnseeRay 1 79,62 unseen 079e0bbf seen 120 last 77,63",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay 1 70,46 last 70,46",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay unwrapped 1 70,46 last 70,46",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastMaterialRay distance 35.4691772 last 90,50",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay 1 60,45 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay with MOs 1 60,45 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastNotMaterialRay distance 1.03077638 last 56,44",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthSumRay 400 last 56,44",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastMaxStrengthRay 100 last 56,44",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthRay 1 60,45 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastStrengthRay unwrapped 1 60,45 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastWeaknessRay 1 56,44 last 56,44",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastMORay 255 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastMORay through terrain 7 last 60,60",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastFindMORay 0 -1,-1 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastObstacleRay 5.09901953 60,45.25 59,45.25 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastSeeRay 1 60,45 unseen 7a811d50 seen 128 last 60,45",
+		"X- ray 16 from 55,44.25 along 107,17 skip 0: CastUnseeRay 1 60,45 unseen 39cf513e seen 141 last 60,45",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay 0 -1,-1 last 60,45",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 60,45",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaterialRay distance -1 last 60,45",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay 0 -1,-1 last 60,45",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 60,45",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastNotMaterialRay distance 1.58113885 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthSumRay 0 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMaxStrengthRay 0 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthRay 0 20,-141 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastStrengthRay unwrapped 0 20,-141 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastWeaknessRay 1 54,8 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMORay 255 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastMORay through terrain 255 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastFindMORay 0 -1,-1 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastObstacleRay -1 -1,-1 20.5,-140.5 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastSeeRay 1 20.5,-140.5 unseen 450cb0a8 seen 156 last 54,8",
+		"X- ray 17 from 54.5,9.5 along -34,-150 skip 0: CastUnseeRay 1 20.5,-140.5 unseen 4ac8ae18 seen 165 last 54,8",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay 0 -1,-1 last 54,8",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 54,8",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastMaterialRay distance -1 last 54,8",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay 0 -1,-1 last 54,8",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 54,8",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastNotMaterialRay distance 1.25 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthSumRay 0 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastMaxStrengthRay 0 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthRay 0 0,71 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastStrengthRay unwrapped 0 192,71 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastWeaknessRay 1 50,71 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastMORay 255 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastMORay through terrain 255 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastFindMORay 0 -1,-1 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastObstacleRay -1 -1,-1 0,71.75 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastSeeRay 0 192,71.75 unseen 19b03421 seen 163 last 50,71",
+		"X- ray 18 from 49,71.75 along 143,0 skip 0: CastUnseeRay 0 192,71.75 unseen 827b6631 seen 164 last 50,71",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay 1 0,63 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay unwrapped 1 96,63 last 96,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaterialRay distance 86.8288574 last 3,57",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay 1 0,63 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay with MOs 1 0,63 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastNotMaterialRay distance 1.80277562 last 87,81",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthSumRay 500 last 87,81",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastMaxStrengthRay 100 last 87,81",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthRay 1 0,63 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastStrengthRay unwrapped 1 96,63 last 96,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastWeaknessRay 1 87,81 last 87,81",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastMORay 255 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastMORay through terrain 255 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastFindMORay 0 -1,-1 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastObstacleRay 21.470911 0,63.5 95,64.5 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastSeeRay 0 1,60 unseen 827b6631 seen 163 last 0,63",
+		"X- ray 19 from 86,82.5 along 67,-133 skip 2: CastUnseeRay 1 1,60 unseen 9078a275 seen 165 last 0,63",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay 1 61,58 last 61,58",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay unwrapped 1 61,58 last 61,58",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaterialRay distance 21.9160328 last 23,50",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay 1 14,48 last 14,48",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay with MOs 1 2,45 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastNotMaterialRay distance 0.901387811 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthSumRay 600 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMaxStrengthRay 100 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthRay 1 14,48 last 14,48",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastStrengthRay unwrapped 1 14,48 last 14,48",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastWeaknessRay 1 2,45 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMORay 3 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastMORay through terrain 255 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastFindMORay 1 2,45 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastObstacleRay 0 2.5,45.75 -1,-1 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastSeeRay 1 14,48 unseen 4e837384 seen 164 last 2,45",
+		"X- ray 20 from 1.5,45.75 along 120,25 skip 0: CastUnseeRay 1 14,48 unseen e2945948 seen 173 last 2,45",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay 0 -1,-1 last 2,45",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 2,45",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaterialRay distance -1 last 2,45",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay 0 -1,-1 last 2,45",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 2,45",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastNotMaterialRay distance 95.75 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthSumRay 0 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastMaxStrengthRay 0 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthRay 0 41,-5 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastStrengthRay unwrapped 0 233,-5 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastWeaknessRay 1 4,-5 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastMORay 255 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastMORay through terrain 255 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastFindMORay 0 -1,-1 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastObstacleRay -1 -1,-1 41.75,-5 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastSeeRay 0 233.75,-5 unseen 38e0cf59 seen 166 last 4,-5",
+		"X- ray 21 from 99.75,-5 along 134,0 skip 0: CastUnseeRay 0 233.75,-5 unseen 38e0cf59 seen 165 last 4,-5",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay 0 -1,-1 last 4,-5",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay unwrapped 0 -1,-1 last 4,-5",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaterialRay distance -1 last 4,-5",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay 0 -1,-1 last 4,-5",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay with MOs 0 -1,-1 last 4,-5",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastNotMaterialRay distance 1.11803401 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthSumRay 0 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastMaxStrengthRay 0 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthRay 0 78,-44 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastStrengthRay unwrapped 0 78,-44 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastWeaknessRay 1 90,12 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastMORay 255 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastMORay through terrain 255 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastFindMORay 0 -1,-1 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastObstacleRay -1 -1,-1 78.5,-44 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastSeeRay 1 78.5,-44 unseen 69145e3e seen 171 last 90,12",
+		"X- ray 22 from 90.5,13 along -12,-57 skip 0: CastUnseeRay 1 78.5,-44 unseen 853aba8b seen 182 last 90,12",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay 0 -1,-1 last 90,12",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay unwrapped 0 -1,-1 last 90,12",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaterialRay distance -1 last 90,12",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay 0 -1,-1 last 90,12",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay with MOs 0 -1,-1 last 90,12",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastNotMaterialRay distance 1.9039433 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthSumRay 0 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMaxStrengthRay 0 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthRay 0 88,81 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastStrengthRay unwrapped 0 -104,81 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastWeaknessRay 1 41,82 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMORay 255 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastMORay through terrain 255 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastFindMORay 0 -1,-1 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastObstacleRay -1 -1,-1 88.75,81.75 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastSeeRay 0 -103.25,81.75 unseen 13e2d1dc seen 177 last 41,82",
+		"X- ray 23 from 42.75,82.75 along -146,-1 skip 3: CastUnseeRay 0 -103.25,81.75 unseen bce5afef seen 175 last 41,82"
+	};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Implementation of the main function that runs the SceneMan ray cast tests.
+/// </summary>
+int main(int argc, char **argv) {
+	return (RTE::SceneManCastTests::Run(argc > 1 && std::string(argv[1]) == "--record") == 0) ? 0 : 1;
+}
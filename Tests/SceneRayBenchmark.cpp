@@ -0,0 +1,207 @@
+#include "SceneSampler.h"
+#include "Scene.h"
+#include "SLTerrain.h"
+#include "Material.h"
+#include "Reader.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// Measures how many rays per second SceneMan's ray casts and the different ways of sampling the Scene pixel by pixel get through, on a generated Scene the size of a small map.
+	/// The pixel walks step along the rays the way Atom and AtomGroup travel does, once going through SceneMan for every pixel and once through a single sampler for the whole walk.
+	/// </summary>
+	class SceneRayBenchmark {
+
+	public:
+
+		/// <summary>
+		/// Sets up the Scene, runs all the cases and prints their results.
+		/// </summary>
+		static void Run() {
+			install_allegro(SYSTEM_NONE, &errno, std::atexit);
+			CreateMaterials();
+			CreateScene();
+
+			std::mt19937 randomGenerator(4242);
+			std::uniform_real_distribution<float> positionDistribution(0, 1.0F);
+			std::uniform_real_distribution<float> angleDistribution(0, c_TwoPI);
+			std::vector<std::pair<Vector, Vector>> rays(c_RayCount);
+			for (std::pair<Vector, Vector> &ray : rays) {
+				ray.first.SetXY(positionDistribution(randomGenerator) * static_cast<float>(c_SceneWidth), positionDistribution(randomGenerator) * static_cast<float>(c_SceneHeight));
+				ray.second.SetXY(c_RayLength, 0);
+				ray.second.RadRotate(angleDistribution(randomGenerator));
+			}
+
+			RunCase("Pixel walk, SceneMan per pixel", rays, [](const Vector &start, const Vector &ray) {
+				return WalkRay(start, ray, [](int pixelX, int pixelY) { return g_SceneMan.GetTerrMatter(pixelX, pixelY) + g_SceneMan.GetMOIDPixel(pixelX, pixelY); });
+			});
+			RunCase("Pixel walk, one SceneSamplerBase", rays, [](const Vector &start, const Vector &ray) {
+				const SceneSamplerBase sceneSampler;
+				return WalkRay(start, ray, [&sceneSampler](int pixelX, int pixelY) { return sceneSampler.GetTerrMatter(pixelX, pixelY) + sceneSampler.GetMOIDPixel(pixelX, pixelY); });
+			});
+			RunCase("Pixel walk, one SceneSampler", rays, [](const Vector &start, const Vector &ray) {
+				return SceneSamplerBase::VisitCurrentScene([&start, &ray](auto sceneSampler) {
+					return WalkRay(start, ray, [&sceneSampler](int pixelX, int pixelY) { return sceneSampler.GetTerrMatter(pixelX, pixelY) + sceneSampler.GetMOIDPixel(pixelX, pixelY); });
+				});
+			});
+			RunCase("CastMaterialRay", rays, [](const Vector &start, const Vector &ray) {
+				Vector result;
+				return g_SceneMan.CastMaterialRay(start, ray, c_Concrete, result, 0, true) ? result.GetFloorIntX() : 0;
+			});
+			RunCase("CastNotMaterialRay with MOs", rays, [](const Vector &start, const Vector &ray) {
+				Vector result;
+				return g_SceneMan.CastNotMaterialRay(start, ray, g_MaterialAir, result, 0, true) ? result.GetFloorIntX() : 0;
+			});
+			RunCase("CastStrengthSumRay", rays, [](const Vector &start, const Vector &ray) {
+				return static_cast<int>(g_SceneMan.CastStrengthSumRay(start, start + ray, 0, g_MaterialAir));
+			});
+			RunCase("CastMORay", rays, [](const Vector &start, const Vector &ray) {
+				return static_cast<int>(g_SceneMan.CastMORay(start, ray, g_NoMOID, Activity::NoTeam, g_MaterialAir, false, 0));
+			});
+			RunCase("CastObstacleRay", rays, [](const Vector &start, const Vector &ray) {
+				Vector obstaclePos;
+				Vector freePos;
+				return static_cast<int>(g_SceneMan.CastObstacleRay(start, ray, obstaclePos, freePos, g_NoMOID, Activity::NoTeam, g_MaterialAir, 0));
+			});
+
+			DestroyScene();
+		}
+
+	private:
+
+		static constexpr int c_SceneWidth = 2048; //!< The width of the generated Scene.
+		static constexpr int c_SceneHeight = 1024; //!< The height of the generated Scene.
+		static constexpr int c_RayCount = 4096; //!< How many different rays are cast, over and over.
+		static constexpr float c_RayLength = 400.0F; //!< The length of every ray, in pixels.
+		static constexpr double c_CaseDuration = 0.5; //!< How long each case is run for, in seconds.
+
+		static constexpr unsigned char c_Sand = 5; //!< A weak material.
+		static constexpr unsigned char c_Concrete = 12; //!< A strong material.
+
+		/// <summary>
+		/// Reads the materials into SceneMan's material palette, the same way SceneMan reads AddMaterial properties.
+		/// </summary>
+		static void CreateMaterials() {
+			const std::string materialFile = (std::filesystem::temp_directory_path() / "SceneRayBenchmarkMaterial.ini").generic_string();
+			for (const auto &[index, integrity] : { std::make_pair(static_cast<int>(g_MaterialAir), 0), std::make_pair(static_cast<int>(c_Sand), 30), std::make_pair(static_cast<int>(c_Concrete), 100) }) {
+				std::ofstream(materialFile) << "AddMaterial = Material\n\tIndex = " << index << "\n\tIntegrity = " << integrity << "\n";
+				// The file is outside of any data module, so it's opened without the case sensitive path check against the working directory.
+				Reader reader(materialFile, false, nullptr, true);
+				reader.NextProperty();
+				reader.ReadPropName();
+				Material *material = new Material();
+				material->Serializable::Create(reader);
+				g_SceneMan.m_apMatPalette.at(index) = material;
+			}
+			std::filesystem::remove(materialFile);
+		}
+
+		/// <summary>
+		/// Makes a generated Scene, which wraps horizontally, the current Scene. It has rolling ground, scattered clumps of both materials in the air and a scattering of MOs.
+		/// </summary>
+		static void CreateScene() {
+			BITMAP *materialBitmap = create_bitmap_ex(8, c_SceneWidth, c_SceneHeight);
+			clear_to_color(materialBitmap, g_MaterialAir);
+			std::mt19937 randomGenerator(20201);
+			for (int pixelX = 0; pixelX < c_SceneWidth; ++pixelX) {
+				int groundHeight = c_SceneHeight / 2 + static_cast<int>(std::sin(static_cast<float>(pixelX) / 90.0F) * 80.0F);
+				vline(materialBitmap, pixelX, groundHeight, groundHeight + 40, c_Sand);
+				vline(materialBitmap, pixelX, groundHeight + 41, c_SceneHeight - 1, c_Concrete);
+			}
+			for (int clump = 0; clump < 600; ++clump) {
+				circlefill(materialBitmap, randomGenerator() % c_SceneWidth, randomGenerator() % (c_SceneHeight / 2), 2 + randomGenerator() % 10, (clump % 2 == 0) ? c_Sand : c_Concrete);
+			}
+			SLTerrain *terrain = new SLTerrain();
+			terrain->SceneLayer::Create(materialBitmap, false, Vector(), true, false, Vector(1.0F, 1.0F));
+			Scene *scene = new Scene();
+			scene->Create(terrain);
+			g_SceneMan.m_pCurrentScene = scene;
+
+			BITMAP *moidBitmap = create_bitmap_ex(c_MOIDLayerBitDepth, c_SceneWidth, c_SceneHeight);
+			clear_to_color(moidBitmap, g_NoMOID);
+			for (int movableObject = 0; movableObject < 300; ++movableObject) {
+				int posX = randomGenerator() % c_SceneWidth;
+				int posY = randomGenerator() % c_SceneHeight;
+				rectfill(moidBitmap, posX, posY, posX + 8, posY + 20, 1 + movableObject % 200);
+			}
+			g_SceneMan.m_pMOIDLayer = new SceneLayer();
+			g_SceneMan.m_pMOIDLayer->Create(moidBitmap, false, Vector(), true, false, Vector(1.0F, 1.0F));
+		}
+
+		/// <summary>
+		/// Removes the generated Scene and its MOID layer from SceneMan.
+		/// </summary>
+		static void DestroyScene() {
+			delete g_SceneMan.m_pMOIDLayer;
+			g_SceneMan.m_pMOIDLayer = nullptr;
+			delete g_SceneMan.m_pCurrentScene;
+			g_SceneMan.m_pCurrentScene = nullptr;
+		}
+
+		/// <summary>
+		/// Steps along a ray pixel by pixel with Bresenham's line algorithm, the way Atom travel does, and samples every pixel. Wrapping is left to the sampling.
+		/// </summary>
+		/// <param name="start">The start of the ray.</param>
+		/// <param name="ray">The ray.</param>
+		/// <param name="samplePixel">The function to sample each pixel with.</param>
+		/// <returns>The sum of all the samples, so the sampling can't be optimized away.</returns>
+		template <typename SampleFunction> static int WalkRay(const Vector &start, const Vector &ray, SampleFunction &&samplePixel) {
+			int intPos[2] = { start.GetFloorIntX(), start.GetFloorIntY() };
+			int delta[2] = { static_cast<int>(std::floor(start.m_X + ray.m_X)) - intPos[0], static_cast<int>(std::floor(start.m_Y + ray.m_Y)) - intPos[1] };
+			int increment[2] = { (delta[0] < 0) ? -1 : 1, (delta[1] < 0) ? -1 : 1 };
+			delta[0] = std::abs(delta[0]);
+			delta[1] = std::abs(delta[1]);
+			const int dom = (delta[0] > delta[1]) ? 0 : 1;
+			const int sub = 1 - dom;
+
+			int sampleSum = 0;
+			int error = 2 * delta[sub] - delta[dom];
+			for (int domSteps = 0; domSteps < delta[dom]; ++domSteps) {
+				intPos[dom] += increment[dom];
+				if (error >= 0) {
+					intPos[sub] += increment[sub];
+					error -= 2 * delta[dom];
+				}
+				error += 2 * delta[sub];
+				sampleSum += samplePixel(intPos[0], intPos[1]);
+			}
+			return sampleSum;
+		}
+
+		/// <summary>
+		/// Casts the rays over and over for a while and prints how many rays per second got cast.
+		/// </summary>
+		/// <param name="caseName">The name of the case to print.</param>
+		/// <param name="rays">The start and ray of each ray to cast.</param>
+		/// <param name="castRay">The function to cast a ray with.</param>
+		template <typename CastFunction> static void RunCase(const std::string &caseName, const std::vector<std::pair<Vector, Vector>> &rays, CastFunction &&castRay) {
+			// The checksum is of a single pass over the rays, so cases that should give the same results, like the pixel walks, can be told apart from ones that don't.
+			long long checksum = 0;
+			for (const auto &[start, ray] : rays) {
+				checksum += castRay(start, ray);
+			}
+			const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			std::chrono::duration<double> elapsedTime(0);
+			long long rayCount = 0;
+			volatile long long resultSum = 0;
+			while (elapsedTime.count() < c_CaseDuration) {
+				for (const auto &[start, ray] : rays) {
+					resultSum = resultSum + castRay(start, ray);
+				}
+				rayCount += static_cast<long long>(rays.size());
+				elapsedTime = std::chrono::steady_clock::now() - startTime;
+			}
+			std::printf("%-32s %12.0f rays/sec (checksum %lld)\n", caseName.c_str(), static_cast<double>(rayCount) / elapsedTime.count(), checksum);
+		}
+	};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Implementation of the main function that runs the SceneMan ray cast benchmark.
+/// </summary>
+int main() {
+	RTE::SceneRayBenchmark::Run();
+	return 0;
+}
@@ -0,0 +1,244 @@
+#include "SceneRay.h"
+
+namespace RTE {
+
+	/// <summary>
+	/// Pins the results of the span scanning fast paths of SceneSampler and SceneRay to the pixel by pixel paths they replace.
+	/// Every case is run on small generated material layers, so no Scene needs to be set up. Allegro is still installed, since SceneRay checks SceneMan for the ray cast visualization layer and SceneMan makes its bitmaps when it's first used.
+	/// </summary>
+	class SceneRayTests {
+
+	public:
+
+		/// <summary>
+		/// Runs all the test cases and reports the failed ones.
+		/// </summary>
+		/// <returns>The number of failed checks.</returns>
+		static int Run() {
+			install_allegro(SYSTEM_NONE, &errno, std::atexit);
+			TestRowScanInBounds();
+			TestRowScanWrapping();
+			TestMarchToMaterial();
+			TestSkipAtLastPixel();
+			std::printf("%i checks, %i failed\n", s_CheckCount, s_FailureCount);
+			return s_FailureCount;
+		}
+
+	private:
+
+		static constexpr unsigned char c_TestMaterial = 12; //!< The material the generated layers are sprinkled with.
+
+		static int s_CheckCount; //!< The number of checks made so far.
+		static int s_FailureCount; //!< The number of checks that failed so far.
+
+		/// <summary>
+		/// A generated material layer and the row pointers to sample it through.
+		/// </summary>
+		struct MaterialLayer {
+			int Width; //!< The width of the layer, in pixels.
+			int Height; //!< The height of the layer, in pixels.
+			std::vector<unsigned char> Pixels; //!< The material indices of the layer, row after row.
+			std::vector<const unsigned char *> Rows; //!< Pointers to the start of each row.
+
+			/// <summary>
+			/// Constructor method used to instantiate a MaterialLayer object in system memory. Fills the layer with air.
+			/// </summary>
+			/// <param name="width">The width of the layer.</param>
+			/// <param name="height">The height of the layer.</param>
+			MaterialLayer(int width, int height) : Width(width), Height(height), Pixels(static_cast<size_t>(width * height), g_MaterialAir) {
+				for (int row = 0; row < height; ++row) {
+					Rows.emplace_back(Pixels.data() + row * width);
+				}
+			}
+
+			/// <summary>
+			/// Sets the material of a pixel of the layer.
+			/// </summary>
+			/// <param name="pixelX">The X coordinate of the pixel.</param>
+			/// <param name="pixelY">The Y coordinate of the pixel.</param>
+			/// <param name="material">The material to set.</param>
+			void SetPixel(int pixelX, int pixelY, unsigned char material) { Pixels.at(static_cast<size_t>(pixelY * Width + pixelX)) = material; }
+
+			/// <summary>
+			/// Makes the layers to sample this through.
+			/// </summary>
+			/// <param name="wraps">Whether the layers wrap on both axes.</param>
+			/// <returns>The layers to sample this through.</returns>
+			SceneSamplerBase GetLayers(bool wraps) const { return SceneSamplerBase(Rows.data(), Width, Height, wraps, wraps); }
+		};
+
+		/// <summary>
+		/// Records the outcome of a check, and reports it if it failed.
+		/// </summary>
+		/// <param name="passed">Whether the check passed.</param>
+		/// <param name="description">What was checked, to report if it failed.</param>
+		static void Check(bool passed, const std::string &description) {
+			s_CheckCount++;
+			if (!passed) {
+				s_FailureCount++;
+				std::printf("FAILED: %s\n", description.c_str());
+			}
+		}
+
+		/// <summary>
+		/// Finds the first pixel of a run that is, or isn't, of a material by sampling each pixel on its own, the way FindTerrMatterInRow is supposed to behave.
+		/// </summary>
+		template <typename Sampler>
+		static int FindTerrMatterPixelByPixel(const Sampler &sceneSampler, int pixelY, int startX, int pixelCount, int increment, unsigned char material, bool findMaterial) {
+			for (int index = 0; index < pixelCount; ++index) {
+				if ((sceneSampler.GetTerrMatter(startX + index * increment, pixelY) == material) == findMaterial) {
+					return index;
+				}
+			}
+			return pixelCount;
+		}
+
+		/// <summary>
+		/// Checks FindTerrMatterInRow against sampling pixel by pixel for a run in both directions, looking for the test material and for anything but air.
+		/// </summary>
+		static void CheckRowScan(const MaterialLayer &layer, bool wraps, int pixelY, int startX, int pixelCount, const std::string &caseName) {
+			SceneSamplerBase::Visit(layer.GetLayers(wraps), [&](auto sceneSampler) {
+				for (int increment : { 1, -1 }) {
+					for (const auto &[material, findMaterial] : { std::make_pair(c_TestMaterial, true), std::make_pair(static_cast<unsigned char>(g_MaterialAir), false) }) {
+						int expected = FindTerrMatterPixelByPixel(sceneSampler, pixelY, startX, pixelCount, increment, material, findMaterial);
+						int found = sceneSampler.FindTerrMatterInRow(pixelY, startX, pixelCount, increment, material, findMaterial);
+						Check(found == expected, caseName + ": run of " + std::to_string(pixelCount) + " from " + std::to_string(startX) + "," + std::to_string(pixelY) + " going " + ((increment > 0) ? "right" : "left") + (wraps ? " with" : " without") + " wrapping found " + std::to_string(found) + " instead of " + std::to_string(expected));
+					}
+				}
+				return 0;
+			});
+		}
+
+		/// <summary>
+		/// Scans runs that stay within the layer, with a single pixel of material at every position a 16 or 8 pixel block or the leftover pixels after them can put it, so every block offset of the vectorized scan gets hit in both directions.
+		/// </summary>
+		static void TestRowScanInBounds() {
+			const int width = 80;
+			for (int materialX = 0; materialX < width; ++materialX) {
+				MaterialLayer layer(width, 2);
+				layer.SetPixel(materialX, 0, c_TestMaterial);
+				for (int pixelCount : { 0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 40 }) {
+					CheckRowScan(layer, false, 0, 0, std::min(pixelCount, width), "In bounds, material at " + std::to_string(materialX));
+					CheckRowScan(layer, false, 0, width - 1, std::min(pixelCount, width), "In bounds, material at " + std::to_string(materialX));
+					CheckRowScan(layer, false, 0, 23, std::min(pixelCount, 23 + 1), "In bounds, material at " + std::to_string(materialX));
+				}
+			}
+			// A row without any material has to run all the way through every block.
+			MaterialLayer emptyLayer(width, 1);
+			CheckRowScan(emptyLayer, false, 0, 0, width, "In bounds, no material");
+			CheckRowScan(emptyLayer, false, 0, width - 1, width, "In bounds, no material");
+		}
+
+		/// <summary>
+		/// Scans runs that start outside of the layer, cross its edges or go around it more than once, with and without wrapping.
+		/// </summary>
+		static void TestRowScanWrapping() {
+			const int width = 37;
+			const int height = 3;
+			std::mt19937 randomGenerator(5489);
+			for (int layerIndex = 0; layerIndex < 20; ++layerIndex) {
+				MaterialLayer layer(width, height);
+				// Sparse layers keep the found pixels far enough apart for the runs to cross edges before finding anything.
+				for (int pixel = 0; pixel < width * height; ++pixel) {
+					if (randomGenerator() % 23 == 0) { layer.SetPixel(pixel % width, pixel / width, c_TestMaterial); }
+				}
+				const std::string caseName = "Wrapping, layer " + std::to_string(layerIndex);
+				for (bool wraps : { false, true }) {
+					for (int pixelY : { -1, 0, height - 1, height + 1 }) {
+						for (int startX : { -2 * width - 3, -width, -5, -1, 0, 3, width - 1, width, width + 4, 2 * width + 1 }) {
+							for (int pixelCount : { 1, 6, width - 1, width, width + 1, 3 * width + 5 }) {
+								CheckRowScan(layer, wraps, pixelY, startX, pixelCount, caseName);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Marches horizontal rays with MarchToMaterial, which scans whole spans of the row, and with March and a material predicate, which checks every pixel on its own, and checks that both stop in the same place.
+		/// </summary>
+		static void TestMarchToMaterial() {
+			const int width = 53;
+			std::mt19937 randomGenerator(1234);
+			MaterialLayer layer(width, 1);
+			for (int pixelX = 0; pixelX < width; ++pixelX) {
+				if (randomGenerator() % 9 == 0) { layer.SetPixel(pixelX, 0, c_TestMaterial); }
+			}
+			for (bool wraps : { false, true }) {
+				const SceneSamplerBase layers = layer.GetLayers(wraps);
+				for (bool wrap : { false, true }) {
+					for (int startX : { -width - 2, -3, 0, 17, width - 1, width + 6 }) {
+						for (int rayLength : { -3 * width, -width - 1, -20, -1, 1, 20, width + 1, 3 * width }) {
+							for (const auto &[material, stopAtMaterial] : { std::make_pair(c_TestMaterial, true), std::make_pair(static_cast<unsigned char>(g_MaterialAir), false) }) {
+								const Vector start(static_cast<float>(startX) + 0.5F, 0.5F);
+								const Vector ray(static_cast<float>(rayLength), 0);
+
+								SceneRay spanRay(start, ray, 0);
+								bool spanHit = spanRay.MarchToMaterial(layers, wrap, material, stopAtMaterial);
+								SceneRay pixelRay(start, ray, 0);
+								bool pixelHit = pixelRay.March(layers, wrap, [material = material, stopAtMaterial = stopAtMaterial](const auto &sceneSampler, int posX, int posY) { return (sceneSampler.GetTerrMatter(posX, posY) == material) == stopAtMaterial; }, [](int, int) {});
+
+								const std::string caseName = "MarchToMaterial from " + std::to_string(startX) + " along " + std::to_string(rayLength) + (wraps ? " on a wrapping layer" : "") + (wrap ? " with wrapping" : "") + (stopAtMaterial ? " to material" : " to air");
+								Check(spanHit == pixelHit, caseName + ": hit " + std::to_string(spanHit) + " instead of " + std::to_string(pixelHit));
+								Check(spanRay.GetPosX() == pixelRay.GetPosX() && spanRay.GetPosY() == pixelRay.GetPosY(), caseName + ": stopped at " + std::to_string(spanRay.GetPosX()) + " instead of " + std::to_string(pixelRay.GetPosX()));
+								Check(spanRay.GetCompletedSteps() == pixelRay.GetCompletedSteps(), caseName + ": completed " + std::to_string(spanRay.GetCompletedSteps()) + " steps instead of " + std::to_string(pixelRay.GetCompletedSteps()));
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Marches rays that skip pixels along every direction, and checks that the first and every skip + 1th pixel after it are checked, that the last pixel is always checked even when it's off that grid, and that a ray stops at material on its last pixel.
+		/// </summary>
+		static void TestSkipAtLastPixel() {
+			MaterialLayer layer(64, 64);
+			for (int skip : { 1, 2, 3, 7 }) {
+				for (const auto &[rayX, rayY] : { std::make_pair(10, 0), std::make_pair(-10, 0), std::make_pair(0, 11), std::make_pair(0, -11), std::make_pair(13, 5), std::make_pair(-13, 5), std::make_pair(4, -9), std::make_pair(-6, -17) }) {
+					const Vector start(32.5F, 32.5F);
+					const Vector ray(static_cast<float>(rayX), static_cast<float>(rayY));
+					const int stepCount = std::max(std::abs(rayX), std::abs(rayY));
+					const std::string caseName = "Skip " + std::to_string(skip) + " along " + std::to_string(rayX) + "," + std::to_string(rayY);
+
+					std::vector<int> checkedSteps;
+					int skippedCount = 0;
+					SceneRay checkingRay(start, ray, skip);
+					bool hit = checkingRay.March(layer.GetLayers(false), false, [&checkedSteps, &skippedCount](const auto &, int, int) { checkedSteps.emplace_back(static_cast<int>(checkedSteps.size()) + skippedCount + 1); return false; }, [&skippedCount](int, int) { skippedCount++; });
+
+					std::vector<int> expectedSteps;
+					// The first pixel is always checked, then every skip + 1th pixel after it.
+					for (int step = 1; step < stepCount; step += skip + 1) {
+						expectedSteps.emplace_back(step);
+					}
+					expectedSteps.emplace_back(stepCount);
+					Check(!hit, caseName + ": hit air");
+					Check(checkedSteps == expectedSteps, caseName + ": checked " + std::to_string(checkedSteps.size()) + " pixels instead of " + std::to_string(expectedSteps.size()));
+					Check(static_cast<int>(checkedSteps.size()) + skippedCount == stepCount, caseName + ": went past " + std::to_string(checkedSteps.size() + skippedCount) + " pixels instead of " + std::to_string(stepCount));
+
+					// Put material on the last pixel of the ray only, which a skipping ray can only find by checking it.
+					MaterialLayer endLayer(64, 64);
+					endLayer.SetPixel(checkingRay.GetPosX(), checkingRay.GetPosY(), c_TestMaterial);
+					SceneRay endRay(start, ray, skip);
+					bool endHit = endRay.MarchToMaterial(endLayer.GetLayers(false), false, c_TestMaterial, true);
+					Check(endHit, caseName + ": missed material on the last pixel");
+					Check(endRay.GetPosX() == checkingRay.GetPosX() && endRay.GetPosY() == checkingRay.GetPosY(), caseName + ": stopped before the last pixel");
+					Check(endRay.GetCompletedSteps() == stepCount - 1, caseName + ": completed " + std::to_string(endRay.GetCompletedSteps()) + " steps instead of " + std::to_string(stepCount - 1));
+				}
+			}
+		}
+	};
+
+	int SceneRayTests::s_CheckCount = 0;
+	int SceneRayTests::s_FailureCount = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Implementation of the main function that runs the SceneRay tests.
+/// </summary>
+int main() {
+	return (RTE::SceneRayTests::Run() == 0) ? 0 : 1;
+}